@@ -0,0 +1,160 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Many small independent problems: the batched GEMM, LU and Cholesky kernels against a loop over Matrix<double>
+ * calling MatMult, LUFactorization and CholeskyDecomposition once per matrix. range(0) is the matrix size, every
+ * benchmark processes kBatchSize matrices per iteration.
+ */
+
+#include "matrix_solvers/batched/batched_matrix.h"
+#include "matrix_solvers/decomposition_methods/lu_decomposition.h"
+#include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/utilities.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr std::int32_t kBatchSize{1024};
+
+/// @brief Random matrices shifted by n on the diagonal, symmetric positive definite so every kernel applies
+std::vector<nm::matrix::Matrix<double>> CreateMatrices(const std::int32_t size)
+{
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+
+    std::vector<nm::matrix::Matrix<double>> matrices{};
+    matrices.reserve(kBatchSize);
+    for (std::int32_t b{0}; b < kBatchSize; ++b)
+    {
+        nm::matrix::Matrix<double> matrix(size, size);
+        for (std::int32_t i{0}; i < size; ++i)
+        {
+            for (std::int32_t j{0}; j < i; ++j)
+            {
+                matrix(i, j) = distribution(generator);
+                matrix(j, i) = matrix(i, j);
+            }
+            matrix(i, i) = static_cast<double>(size);
+        }
+        matrices.push_back(matrix);
+    }
+    return matrices;
+}
+
+void SetMatricesCounter(benchmark::State& state)
+{
+    state.counters["matrices/s"] = benchmark::Counter(kBatchSize, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_GemmLoop(benchmark::State& state)
+{
+    const auto matrices = CreateMatrices(static_cast<std::int32_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const auto& A : matrices)
+        {
+            auto C = nm::matrix::MatMult(A, A);
+            benchmark::DoNotOptimize(C.Data());
+        }
+        benchmark::ClobberMemory();
+    }
+    SetMatricesCounter(state);
+}
+
+void BM_BatchedGemm(benchmark::State& state)
+{
+    const nm::matrix::BatchedMatrix A{CreateMatrices(static_cast<std::int32_t>(state.range(0)))};
+
+    for (auto _ : state)
+    {
+        auto C = nm::matrix::BatchedMatMult(A, A);
+        benchmark::DoNotOptimize(C.Data());
+        benchmark::ClobberMemory();
+    }
+    SetMatricesCounter(state);
+}
+
+void BM_LUSolveLoop(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto matrices = CreateMatrices(size);
+    const std::vector<double> b(static_cast<std::size_t>(size), 1.0);
+
+    for (auto _ : state)
+    {
+        for (const auto& A : matrices)
+        {
+            const nm::matrix::LUFactorization LU{A};
+            auto x = LU.Solve(b);
+            benchmark::DoNotOptimize(x.data());
+        }
+        benchmark::ClobberMemory();
+    }
+    SetMatricesCounter(state);
+}
+
+void BM_BatchedLUSolve(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const nm::matrix::BatchedMatrix A{CreateMatrices(size)};
+    nm::matrix::BatchedMatrix b(kBatchSize, size, 1);
+
+    for (auto _ : state)
+    {
+        const nm::matrix::BatchedLUFactorization LU{A};
+        auto x = LU.Solve(b);
+        benchmark::DoNotOptimize(x.Data());
+        benchmark::ClobberMemory();
+    }
+    SetMatricesCounter(state);
+}
+
+void BM_CholeskyLoop(benchmark::State& state)
+{
+    const auto matrices = CreateMatrices(static_cast<std::int32_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        for (const auto& A : matrices)
+        {
+            auto L = nm::matrix::CholeskyDecomposition(A);
+            benchmark::DoNotOptimize(L.Data());
+        }
+        benchmark::ClobberMemory();
+    }
+    SetMatricesCounter(state);
+}
+
+void BM_BatchedCholesky(benchmark::State& state)
+{
+    const nm::matrix::BatchedMatrix A{CreateMatrices(static_cast<std::int32_t>(state.range(0)))};
+
+    for (auto _ : state)
+    {
+        const nm::matrix::BatchedCholeskyFactorization cholesky{A};
+        benchmark::DoNotOptimize(cholesky.Factors().Data());
+        benchmark::ClobberMemory();
+    }
+    SetMatricesCounter(state);
+}
+
+void SmallMatrixSizes(benchmark::internal::Benchmark* benchmark)
+{
+    // 7 has no fixed-size kernel and shows what the compile time bounds are worth
+    benchmark->Arg(3)->Arg(4)->Arg(7)->Arg(8)->Arg(16)->Unit(benchmark::kMicrosecond);
+}
+
+}  // namespace
+
+BENCHMARK(BM_GemmLoop)->Apply(SmallMatrixSizes);
+BENCHMARK(BM_BatchedGemm)->Apply(SmallMatrixSizes);
+BENCHMARK(BM_LUSolveLoop)->Apply(SmallMatrixSizes);
+BENCHMARK(BM_BatchedLUSolve)->Apply(SmallMatrixSizes);
+BENCHMARK(BM_CholeskyLoop)->Apply(SmallMatrixSizes);
+BENCHMARK(BM_BatchedCholesky)->Apply(SmallMatrixSizes);
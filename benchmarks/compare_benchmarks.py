@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""
+Compares two sets of Google Benchmark JSON results and reports the benchmarks that got slower.
+
+Usage:
+    benchmarks/compare_benchmarks.py <baseline> <contender> [--threshold 0.05] [--metric real_time]
+
+Both arguments are a JSON file written with --benchmark_out_format=json or a directory of them, as written by
+benchmarks/run_benchmarks.sh. When a benchmark was repeated its median is compared, otherwise the mean of its runs.
+Exits with 1 when any benchmark is slower than the baseline by more than the threshold, so the script can gate a
+local pre-merge check.
+"""
+
+import argparse
+import json
+import pathlib
+import sys
+
+TIME_UNIT_TO_NANOSECONDS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_results(path, metric):
+    """Returns {benchmark name: time in nanoseconds} of a JSON file or a directory of JSON files."""
+    path = pathlib.Path(path)
+    files = sorted(path.glob("*.json")) if path.is_dir() else [path]
+    if not files:
+        sys.exit(f"No benchmark results found in {path}")
+
+    medians = {}
+    runs = {}
+    for file in files:
+        with open(file, encoding="utf-8") as stream:
+            benchmarks = json.load(stream).get("benchmarks", [])
+        for benchmark in benchmarks:
+            if benchmark.get("error_occurred"):
+                continue
+            name = benchmark.get("run_name", benchmark["name"])
+            time = benchmark[metric] * TIME_UNIT_TO_NANOSECONDS[benchmark.get("time_unit", "ns")]
+            if benchmark.get("run_type") == "aggregate":
+                if benchmark.get("aggregate_name") == "median":
+                    medians[name] = time
+            else:
+                runs.setdefault(name, []).append(time)
+
+    results = {name: sum(times) / len(times) for name, times in runs.items()}
+    results.update(medians)
+    return results
+
+
+def format_time(nanoseconds):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if nanoseconds >= scale:
+            return f"{nanoseconds / scale:.3f} {unit}"
+    return f"{nanoseconds:.1f} ns"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="JSON file or directory of JSON files of the reference commit")
+    parser.add_argument("contender", help="JSON file or directory of JSON files of the commit under test")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="relative change reported as a slowdown or a speedup, default 0.05 for 5%%",
+    )
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="real_time")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline, args.metric)
+    contender = load_results(args.contender, args.metric)
+
+    common = sorted(set(baseline) & set(contender))
+    width = max([len(name) for name in common] + [len("Benchmark")])
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Contender':>12}  {'Change':>8}")
+
+    slowdowns = []
+    for name in common:
+        change = contender[name] / baseline[name] - 1.0 if baseline[name] > 0.0 else 0.0
+        verdict = ""
+        if change > args.threshold:
+            verdict = "SLOWER"
+            slowdowns.append(name)
+        elif change < -args.threshold:
+            verdict = "faster"
+        row = f"{name:<{width}}  {format_time(baseline[name]):>12}  {format_time(contender[name]):>12}  "
+        print(f"{row}{100.0 * change:>+7.1f}%  {verdict}".rstrip())
+
+    for name in sorted(set(baseline) - set(contender)):
+        print(f"Only in baseline: {name}")
+    for name in sorted(set(contender) - set(baseline)):
+        print(f"Only in contender: {name}")
+
+    if slowdowns:
+        print(f"\n{len(slowdowns)} of {len(common)} benchmarks are more than {100.0 * args.threshold:.0f}% slower")
+        return 1
+    print(f"\nNo benchmark is more than {100.0 * args.threshold:.0f}% slower")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,80 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Dense Cholesky and Gram-Schmidt QR decomposition throughput, both O(n^3) like the LU factorizations in lu_benchmark
+ */
+
+#include "matrix_solvers/decomposition_methods/lu_decomposition.h"
+#include "matrix_solvers/decomposition_methods/qr_decomposition.h"
+#include "matrix_solvers/utilities.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+
+namespace
+{
+
+/// @brief Random symmetric matrix shifted by n on the diagonal, strictly diagonally dominant and so positive definite
+nm::matrix::Matrix<double> CreateSymmetricPositiveDefiniteMatrix(const std::int32_t size)
+{
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+
+    nm::matrix::Matrix<double> matrix(size, size);
+    for (std::int32_t i{0}; i < size; ++i)
+    {
+        for (std::int32_t j{0}; j < i; ++j)
+        {
+            matrix(i, j) = distribution(generator);
+            matrix(j, i) = matrix(i, j);
+        }
+        matrix(i, i) = static_cast<double>(size);
+    }
+    return matrix;
+}
+
+void SetFlopCounter(benchmark::State& state, const double flops)
+{
+    state.counters["FLOPS"] =
+        benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+
+void BM_CholeskyDecomposition(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateSymmetricPositiveDefiniteMatrix(size);
+
+    for (auto _ : state)
+    {
+        auto L = nm::matrix::CholeskyDecomposition(A);
+        benchmark::DoNotOptimize(L.Data());
+        benchmark::ClobberMemory();
+    }
+    // Half of the work of LU, 1/3 n^3
+    const auto n = static_cast<double>(size);
+    SetFlopCounter(state, n * n * n / 3.0);
+}
+
+void BM_QRDecompositionGramSchmidt(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateSymmetricPositiveDefiniteMatrix(size);
+
+    for (auto _ : state)
+    {
+        auto QR = nm::matrix::QRDecompositionGramSchmidt(A);
+        benchmark::DoNotOptimize(QR.first.Data());
+        benchmark::DoNotOptimize(QR.second.Data());
+        benchmark::ClobberMemory();
+    }
+    // Gram-Schmidt on an m x n matrix costs 2 m n^2
+    const auto n = static_cast<double>(size);
+    SetFlopCounter(state, 2.0 * n * n * n);
+}
+
+}  // namespace
+
+BENCHMARK(BM_CholeskyDecomposition)->RangeMultiplier(2)->Range(32, 1024)->Unit(benchmark::kMillisecond);
+// Gram-Schmidt reads Q and A by column, beyond 512 a single iteration takes seconds
+BENCHMARK(BM_QRDecompositionGramSchmidt)->RangeMultiplier(2)->Range(32, 512)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,210 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Direct solves of Ax = b: dense LU, Cholesky and triangular substitution at O(n^2) to O(n^3), and the Thomas and
+ * banded LU solvers at O(n) on the second difference matrix the PDE solver assembles. The factor-once LUFactorization
+ * is timed against a fresh LUSolve per right hand side.
+ */
+
+#include "matrix_solvers/banded/banded_matrix.h"
+#include "matrix_solvers/decomposition_methods/lu_decomposition.h"
+#include "matrix_solvers/direct_solvers/backwards_substitution.h"
+#include "matrix_solvers/direct_solvers/banded_solve.h"
+#include "matrix_solvers/direct_solvers/forward_substitution.h"
+#include "matrix_solvers/direct_solvers/lu_solve.h"
+#include "matrix_solvers/utilities.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+/// @brief Random symmetric matrix shifted by n on the diagonal, so that every solver applies without pivoting
+nm::matrix::Matrix<double> CreateDiagonallyDominantMatrix(const std::int32_t size)
+{
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+
+    nm::matrix::Matrix<double> matrix(size, size);
+    for (std::int32_t i{0}; i < size; ++i)
+    {
+        for (std::int32_t j{0}; j < i; ++j)
+        {
+            matrix(i, j) = distribution(generator);
+            matrix(j, i) = matrix(i, j);
+        }
+        matrix(i, i) = static_cast<double>(size);
+    }
+    return matrix;
+}
+
+/// @brief Keeps the lower (lower = true) or upper triangle of A
+nm::matrix::Matrix<double> Triangle(const nm::matrix::Matrix<double>& A, const bool lower)
+{
+    auto triangle = A;
+    for (std::int32_t i{0}; i < A.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < A.NumberOfColumns(); ++j)
+        {
+            if ((lower && j > i) || (!lower && j < i))
+            {
+                triangle(i, j) = 0.0;
+            }
+        }
+    }
+    return triangle;
+}
+
+/// @brief Second difference matrix [-1 2 -1]
+nm::matrix::TridiagonalMatrix CreateSecondDifferenceMatrix(const std::int32_t size)
+{
+    const auto n = static_cast<std::size_t>(size);
+    return nm::matrix::TridiagonalMatrix{std::vector<double>(n - 1, -1.0),
+                                         std::vector<double>(n, 2.0),
+                                         std::vector<double>(n - 1, -1.0)};
+}
+
+void SetUnknownsCounter(benchmark::State& state, const std::int64_t size)
+{
+    state.counters["unknowns/s"] =
+        benchmark::Counter(static_cast<double>(size), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_LUSolve(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateDiagonallyDominantMatrix(size);
+    const std::vector<double> b(static_cast<std::size_t>(size), 1.0);
+
+    for (auto _ : state)
+    {
+        auto x = nm::matrix::LUSolve(A, b);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    SetUnknownsCounter(state, size);
+}
+
+void BM_LUSolveCholesky(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateDiagonallyDominantMatrix(size);
+    const std::vector<double> b(static_cast<std::size_t>(size), 1.0);
+
+    for (auto _ : state)
+    {
+        auto x = nm::matrix::LUSolveCholesky(A, b);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    SetUnknownsCounter(state, size);
+}
+
+/// range(1) right hand sides, LUSolve factors A for every one of them while LUFactorization factors it once
+void BM_MultipleRightHandSides(benchmark::State& state, const bool factor_once)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto number_of_right_hand_sides = state.range(1);
+    const auto A = CreateDiagonallyDominantMatrix(size);
+    const std::vector<double> b(static_cast<std::size_t>(size), 1.0);
+
+    for (auto _ : state)
+    {
+        if (factor_once)
+        {
+            const nm::matrix::LUFactorization LU{A};
+            for (std::int64_t k{0}; k < number_of_right_hand_sides; ++k)
+            {
+                auto x = LU.Solve(b);
+                benchmark::DoNotOptimize(x.data());
+            }
+        }
+        else
+        {
+            for (std::int64_t k{0}; k < number_of_right_hand_sides; ++k)
+            {
+                auto x = nm::matrix::LUSolve(A, b);
+                benchmark::DoNotOptimize(x.data());
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+}
+
+void BM_TriangularSubstitution(benchmark::State& state, const bool lower)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto A = Triangle(CreateDiagonallyDominantMatrix(size), lower);
+    const std::vector<double> b(static_cast<std::size_t>(size), 1.0);
+
+    for (auto _ : state)
+    {
+        auto x = lower ? nm::matrix::ForwardSubstitution(A, b) : nm::matrix::BackwardsSubstitution(A, b);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    // One multiply and one add per entry of the triangle
+    const auto n = static_cast<double>(size);
+    state.counters["FLOPS"] =
+        benchmark::Counter(n * n, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+
+void BM_ThomasSolve(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateSecondDifferenceMatrix(size);
+    const std::vector<double> b(static_cast<std::size_t>(size), 1.0);
+
+    for (auto _ : state)
+    {
+        auto x = nm::matrix::ThomasSolve(A, b);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    SetUnknownsCounter(state, size);
+}
+
+void BM_BandedLUSolve(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    nm::matrix::BandedMatrix A{size, {.lower = 1, .upper = 1}};
+    for (std::int32_t i{0}; i < size; ++i)
+    {
+        A(i, i) = 2.0;
+        if (i + 1 < size)
+        {
+            A(i + 1, i) = -1.0;
+            A(i, i + 1) = -1.0;
+        }
+    }
+    const std::vector<double> b(static_cast<std::size_t>(size), 1.0);
+
+    for (auto _ : state)
+    {
+        auto x = nm::matrix::BandedLUSolve(A, b);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    SetUnknownsCounter(state, size);
+}
+
+}  // namespace
+
+BENCHMARK(BM_LUSolve)->RangeMultiplier(2)->Range(32, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LUSolveCholesky)->RangeMultiplier(2)->Range(32, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_MultipleRightHandSides, LUSolvePerRightHandSide, false)
+    ->ArgsProduct({{64, 256}, {1, 4, 16}})
+    ->ArgNames({"n", "rhs"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_MultipleRightHandSides, LUFactorizationOnce, true)
+    ->ArgsProduct({{64, 256}, {1, 4, 16}})
+    ->ArgNames({"n", "rhs"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TriangularSubstitution, Forward, true)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_CAPTURE(BM_TriangularSubstitution, Backwards, false)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK(BM_ThomasSolve)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_BandedLUSolve)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
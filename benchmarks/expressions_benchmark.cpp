@@ -0,0 +1,137 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Memory traffic of the Runge-Kutta state updates of TimeVariable::StepOnce over range(0) unknowns. Each update is
+ * written three ways: nested AddVectors / ScalarMultiply calls with a temporary per call, the in-place copy and Axpy
+ * chain the steppers used before, and a single fused expression template loop. bytes_per_second counts the vector
+ * traffic the variant itself implies, so equal rates mean the variants are equally bandwidth bound and the time
+ * ratio is the traffic ratio.
+ */
+
+#include "matrix_solvers/operations/vector_expressions.h"
+#include "matrix_solvers/utilities.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+namespace expressions = nm::matrix::expressions;
+using expressions::Lazy;
+
+constexpr double kDeltaT{1e-3};
+
+struct RungeKuttaState
+{
+    explicit RungeKuttaState(const std::size_t size)
+        : u(size, 1.0), k1(size, 0.1), k2(size, 0.2), k3(size, 0.3), k4(size, 0.4), result(size, 0.0)
+    {
+    }
+
+    std::vector<double> u;
+    std::vector<double> k1;
+    std::vector<double> k2;
+    std::vector<double> k3;
+    std::vector<double> k4;
+    std::vector<double> result;
+};
+
+/// @brief Reports vectors_moved full vector reads or writes per iteration
+void SetTraffic(benchmark::State& state, const std::int64_t vectors_moved)
+{
+    state.SetBytesProcessed(state.iterations() * vectors_moved * state.range(0) *
+                            static_cast<std::int64_t>(sizeof(double)));
+}
+
+void BM_RungeKutta4UpdateTemporaries(benchmark::State& state)
+{
+    RungeKuttaState s{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        using nm::matrix::AddVectors;
+        using nm::matrix::ScalarMultiply;
+        const auto sum = AddVectors(AddVectors(AddVectors(s.k1, ScalarMultiply(2.0, s.k2)), ScalarMultiply(2.0, s.k3)),
+                                    s.k4);
+        s.result = AddVectors(s.u, ScalarMultiply(kDeltaT / 6, sum));
+        benchmark::DoNotOptimize(s.result.data());
+        benchmark::ClobberMemory();
+    }
+    // 2 scalings (r + w), 4 additions (2r + w), 1 scaling (r + w) and the copy into result (r + w)
+    SetTraffic(state, 2 * 2 + 4 * 3 + 2 + 2);
+}
+
+void BM_RungeKutta4UpdateAxpyChain(benchmark::State& state)
+{
+    RungeKuttaState s{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        s.result = s.u;
+        nm::matrix::Axpy(kDeltaT / 6, s.k1, s.result);
+        nm::matrix::Axpy(kDeltaT / 3, s.k2, s.result);
+        nm::matrix::Axpy(kDeltaT / 3, s.k3, s.result);
+        nm::matrix::Axpy(kDeltaT / 6, s.k4, s.result);
+        benchmark::DoNotOptimize(s.result.data());
+        benchmark::ClobberMemory();
+    }
+    // Copy (r + w) and 4 axpys (2r + w)
+    SetTraffic(state, 2 + 4 * 3);
+}
+
+void BM_RungeKutta4UpdateFused(benchmark::State& state)
+{
+    RungeKuttaState s{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        expressions::Assign(s.result,
+                            Lazy(s.u) + kDeltaT / 6 * (Lazy(s.k1) + 2.0 * Lazy(s.k2) + 2.0 * Lazy(s.k3) + Lazy(s.k4)));
+        benchmark::DoNotOptimize(s.result.data());
+        benchmark::ClobberMemory();
+    }
+    // 5 reads and 1 write
+    SetTraffic(state, 6);
+}
+
+void BM_RungeKutta2UpdateAxpyChain(benchmark::State& state)
+{
+    RungeKuttaState s{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        s.result = s.u;
+        nm::matrix::Axpy(0.5, s.k1, s.result);
+        nm::matrix::Axpy(0.5, s.k2, s.result);
+        benchmark::DoNotOptimize(s.result.data());
+        benchmark::ClobberMemory();
+    }
+    // Copy (r + w) and 2 axpys (2r + w)
+    SetTraffic(state, 2 + 2 * 3);
+}
+
+void BM_RungeKutta2UpdateFused(benchmark::State& state)
+{
+    RungeKuttaState s{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state)
+    {
+        expressions::Assign(s.result, Lazy(s.u) + 0.5 * (Lazy(s.k1) + Lazy(s.k2)));
+        benchmark::DoNotOptimize(s.result.data());
+        benchmark::ClobberMemory();
+    }
+    // 3 reads and 1 write
+    SetTraffic(state, 4);
+}
+
+}  // namespace
+
+// From L1 resident to well beyond the last level cache, where the update is bound by memory bandwidth
+BENCHMARK(BM_RungeKutta4UpdateTemporaries)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_RungeKutta4UpdateAxpyChain)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_RungeKutta4UpdateFused)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_RungeKutta2UpdateAxpyChain)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_RungeKutta2UpdateFused)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
@@ -0,0 +1,115 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Time to solution of restarted GMRES and BiCGSTAB on the non-symmetric five point convection-diffusion system of a
+ * square grid, with and without ILU(0). range(1) is the cell Peclet number, the larger it is the further the matrix is
+ * from symmetric and the more the short recurrence of BiCGSTAB is tested against the long one of GMRES.
+ */
+
+#include "matrix_solvers/iterative_solvers/bicgstab.h"
+#include "matrix_solvers/iterative_solvers/gmres.h"
+#include "matrix_solvers/preconditioners/incomplete_factorization.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+constexpr double kRelativeTolerance{1e-8};
+constexpr std::int32_t kMaxIterations{20000};
+
+/// Central differences of -laplace(u) + peclet * du/dx with h = 1 and homogeneous Dirichlet boundaries
+nm::matrix::CsrMatrix CreateConvectionDiffusionMatrix(const std::int32_t grid_size, const double peclet)
+{
+    const auto n = grid_size * grid_size;
+    nm::matrix::CooMatrix coo(n, n);
+    coo.Reserve(5 * static_cast<std::size_t>(n));
+    for (std::int32_t row{0}; row < grid_size; ++row)
+    {
+        for (std::int32_t column{0}; column < grid_size; ++column)
+        {
+            const auto i = row * grid_size + column;
+            if (row > 0)
+            {
+                coo.Add(i, i - grid_size, -1.0);
+            }
+            if (column > 0)
+            {
+                coo.Add(i, i - 1, -1.0 - 0.5 * peclet);
+            }
+            coo.Add(i, i, 4.0);
+            if (column < grid_size - 1)
+            {
+                coo.Add(i, i + 1, -1.0 + 0.5 * peclet);
+            }
+            if (row < grid_size - 1)
+            {
+                coo.Add(i, i + grid_size, -1.0);
+            }
+        }
+    }
+    return nm::matrix::CsrMatrix{coo};
+}
+
+enum class KrylovMethod : std::int8_t
+{
+    kGMRES = 0,
+    kBiCGSTAB = 1,
+};
+
+/// Setup of the preconditioner is part of the timed region, as in pcg_benchmark
+void BM_NonSymmetricSolve(benchmark::State& state, const KrylovMethod method, const bool preconditioned)
+{
+    const auto grid_size = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateConvectionDiffusionMatrix(grid_size, static_cast<double>(state.range(1)));
+    const std::vector<double> b(static_cast<std::size_t>(A.NumberOfRows()), 1.0);
+    const auto tolerance = kRelativeTolerance * std::sqrt(static_cast<double>(b.size()));
+    constexpr std::int32_t kRestart{30};
+
+    std::int32_t iterations{0};
+    for (auto _ : state)
+    {
+        std::vector<double> x(b.size(), 0.0);
+        if (preconditioned)
+        {
+            const nm::matrix::IncompleteLUPreconditioner M{A};
+            iterations = (method == KrylovMethod::kGMRES)
+                             ? nm::matrix::GMRES(A, b, x, M, tolerance, kMaxIterations, kRestart)
+                             : nm::matrix::BiCGSTAB(A, b, x, M, tolerance, kMaxIterations);
+        }
+        else
+        {
+            iterations = (method == KrylovMethod::kGMRES)
+                             ? nm::matrix::GMRES(A, b, x, tolerance, kMaxIterations, kRestart)
+                             : nm::matrix::BiCGSTAB(A, b, x, tolerance, kMaxIterations);
+        }
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["iterations"] = iterations;
+}
+
+void ConvectionDiffusionArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgsProduct({{32, 64, 128}, {0, 1, 4}})->ArgNames({"grid", "peclet"});
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_NonSymmetricSolve, GMRES, KrylovMethod::kGMRES, false)
+    ->Apply(ConvectionDiffusionArguments)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_NonSymmetricSolve, BiCGSTAB, KrylovMethod::kBiCGSTAB, false)
+    ->Apply(ConvectionDiffusionArguments)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_NonSymmetricSolve, GMRESWithILU0, KrylovMethod::kGMRES, true)
+    ->Apply(ConvectionDiffusionArguments)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_NonSymmetricSolve, BiCGSTABWithILU0, KrylovMethod::kBiCGSTAB, true)
+    ->Apply(ConvectionDiffusionArguments)
+    ->Unit(benchmark::kMillisecond);
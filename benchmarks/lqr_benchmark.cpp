@@ -0,0 +1,100 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Newton-Kleinman LQR gains for a chain of range(0) masses. Every Newton step solves the Lyapunov equation through
+ * its Kronecker form, a dense LU of an n^2 x n^2 matrix for n = 2 * masses states, so the cost grows like n^6. The
+ * FixedMatrix overload solves the same systems for 1 to 4 masses without touching the heap.
+ */
+
+#include "controls/lqr/newton_kleinman.h"
+#include "matrix_solvers/fixed/fixed_matrix.h"
+#include "matrix_solvers/utilities.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace
+{
+
+struct LinearSystem
+{
+    nm::matrix::Matrix<double> A{};
+    nm::matrix::Matrix<double> B{};
+    nm::matrix::Matrix<double> Q{};
+    nm::matrix::Matrix<double> R{};
+};
+
+/// Unit masses coupled by unit springs, each also held by a spring and a damper to the ground so that A is stable and
+/// K0 = 0 is a stabilizing initial gain. The state is all positions followed by all velocities, the single input pushes
+/// the last mass.
+LinearSystem CreateMassSpringChain(const std::int32_t masses)
+{
+    constexpr double kStiffness{1.0};
+    constexpr double kDamping{0.5};
+
+    const auto n = 2 * masses;
+    LinearSystem system{nm::matrix::Matrix<double>(n, n),
+                        nm::matrix::Matrix<double>(n, 1),
+                        nm::matrix::CreateIdentityMatrix<double>(n),
+                        nm::matrix::Matrix<double>{{1.0}}};
+    for (std::int32_t i{0}; i < masses; ++i)
+    {
+        const auto velocity = masses + i;
+        system.A(i, velocity) = 1.0;
+        system.A(velocity, velocity) = -kDamping;
+        system.A(velocity, i) = -kStiffness;
+        if (i > 0)
+        {
+            system.A(velocity, i) -= kStiffness;
+            system.A(velocity, i - 1) = kStiffness;
+        }
+        if (i + 1 < masses)
+        {
+            system.A(velocity, i) -= kStiffness;
+            system.A(velocity, i + 1) = kStiffness;
+        }
+    }
+    system.B(n - 1, 0) = 1.0;
+    return system;
+}
+
+void BM_NewtonKleinman(benchmark::State& state)
+{
+    const auto masses = static_cast<std::int32_t>(state.range(0));
+    const auto system = CreateMassSpringChain(masses);
+    const nm::matrix::Matrix<double> K0(1, 2 * masses);
+
+    for (auto _ : state)
+    {
+        auto gains = nm::controls::NewtonKleinman(system.A, system.B, system.Q, system.R, K0);
+        benchmark::DoNotOptimize(gains.first.Data());
+        benchmark::ClobberMemory();
+    }
+}
+
+template <std::int32_t kMasses>
+void BM_NewtonKleinmanFixedSize(benchmark::State& state)
+{
+    constexpr std::int32_t kStates{2 * kMasses};
+    const auto system = CreateMassSpringChain(kMasses);
+    const nm::matrix::FixedMatrix<double, kStates, kStates> A{system.A};
+    const nm::matrix::FixedMatrix<double, kStates, 1> B{system.B};
+    const nm::matrix::FixedMatrix<double, kStates, kStates> Q{system.Q};
+    const nm::matrix::FixedMatrix<double, 1, 1> R{system.R};
+    const nm::matrix::FixedMatrix<double, 1, kStates> K0{};
+
+    for (auto _ : state)
+    {
+        auto gains = nm::controls::NewtonKleinman(A, B, Q, R, K0);
+        benchmark::DoNotOptimize(gains.first.Data());
+        benchmark::ClobberMemory();
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_NewtonKleinman)->DenseRange(1, 8)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_NewtonKleinmanFixedSize, 1)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_NewtonKleinmanFixedSize, 2)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_NewtonKleinmanFixedSize, 3)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_NewtonKleinmanFixedSize, 4)->Unit(benchmark::kMillisecond);
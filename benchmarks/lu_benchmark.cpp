@@ -0,0 +1,77 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Dense LU decomposition throughput, blocked partial pivoting LUFactorization vs. the unpivoted Doolittle loop
+ */
+
+#include "matrix_solvers/decomposition_methods/lu_decomposition.h"
+#include "matrix_solvers/utilities.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+
+namespace
+{
+
+nm::matrix::Matrix<double> CreateRandomMatrix(const std::int32_t size)
+{
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+
+    // Diagonal shift keeps the unpivoted Doolittle baseline away from tiny pivots
+    nm::matrix::Matrix<double> matrix(size, size);
+    for (std::int32_t i{0}; i < size; ++i)
+    {
+        for (std::int32_t j{0}; j < size; ++j)
+        {
+            matrix(i, j) = distribution(generator);
+        }
+        matrix(i, i) += static_cast<double>(size);
+    }
+    return matrix;
+}
+
+void SetFlopCounter(benchmark::State& state, const std::int64_t size)
+{
+    // LU of an n x n matrix costs 2/3 n^3 floating point operations
+    state.counters["FLOPS"] = benchmark::Counter(2.0 / 3.0 * static_cast<double>(size) * static_cast<double>(size) *
+                                                     static_cast<double>(size),
+                                                 benchmark::Counter::kIsIterationInvariantRate,
+                                                 benchmark::Counter::OneK::kIs1000);
+}
+
+void BM_LUFactorizationBlocked(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateRandomMatrix(size);
+
+    for (auto _ : state)
+    {
+        nm::matrix::LUFactorization LU{A};
+        benchmark::DoNotOptimize(LU.PackedFactors().Data());
+        benchmark::ClobberMemory();
+    }
+    SetFlopCounter(state, size);
+}
+
+void BM_Doolittle(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateRandomMatrix(size);
+
+    for (auto _ : state)
+    {
+        auto LU = nm::matrix::Doolittle(A);
+        benchmark::DoNotOptimize(LU.second.Data());
+        benchmark::ClobberMemory();
+    }
+    SetFlopCounter(state, size);
+}
+
+}  // namespace
+
+BENCHMARK(BM_LUFactorizationBlocked)->RangeMultiplier(2)->Range(64, 4096)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Doolittle walks U by column, beyond 2048 a single iteration takes minutes while the trend is already clear
+BENCHMARK(BM_Doolittle)->RangeMultiplier(2)->Range(64, 2048)->Unit(benchmark::kMillisecond)->UseRealTime();
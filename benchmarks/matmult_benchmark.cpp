@@ -0,0 +1,100 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Dense matrix-matrix multiplication throughput, blocked GEMM vs. the previous naive triple loop
+ */
+
+#include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/utilities.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+
+namespace
+{
+
+nm::matrix::Matrix<double> CreateRandomMatrix(const std::int32_t rows, const std::int32_t columns)
+{
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+
+    nm::matrix::Matrix<double> matrix(rows, columns);
+    for (std::int32_t i{0}; i < rows; ++i)
+    {
+        for (std::int32_t j{0}; j < columns; ++j)
+        {
+            matrix(i, j) = distribution(generator);
+        }
+    }
+    return matrix;
+}
+
+/// @brief The i-j-k, bounds checked product MatMult used before the blocked kernel, kept as the baseline
+nm::matrix::Matrix<double> NaiveMatMult(const nm::matrix::Matrix<double>& A, const nm::matrix::Matrix<double>& B)
+{
+    const auto m = A.NumberOfRows();
+    const auto n = B.NumberOfRows();
+    const auto p = B.NumberOfColumns();
+
+    nm::matrix::Matrix<double> result(m, p);
+    for (std::int32_t i = 0; i < m; ++i)
+    {
+        for (std::int32_t j = 0; j < p; ++j)
+        {
+            double sum{0.0};
+            for (std::int32_t k = 0; k < n; ++k)
+            {
+                sum += A.at(i).at(k) * B.at(k).at(j);
+            }
+            result.at(i).at(j) = sum;
+        }
+    }
+    return result;
+}
+
+void SetFlopCounter(benchmark::State& state, const std::int64_t size)
+{
+    // One multiply and one add per inner iteration
+    state.counters["FLOPS"] =
+        benchmark::Counter(2.0 * static_cast<double>(size) * static_cast<double>(size) * static_cast<double>(size),
+                           benchmark::Counter::kIsIterationInvariantRate,
+                           benchmark::Counter::OneK::kIs1000);
+}
+
+void BM_MatMultBlocked(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateRandomMatrix(size, size);
+    const auto B = CreateRandomMatrix(size, size);
+
+    for (auto _ : state)
+    {
+        auto C = nm::matrix::MatMult(A, B);
+        benchmark::DoNotOptimize(C.Data());
+        benchmark::ClobberMemory();
+    }
+    SetFlopCounter(state, size);
+}
+
+void BM_MatMultNaive(benchmark::State& state)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateRandomMatrix(size, size);
+    const auto B = CreateRandomMatrix(size, size);
+
+    for (auto _ : state)
+    {
+        auto C = NaiveMatMult(A, B);
+        benchmark::DoNotOptimize(C.Data());
+        benchmark::ClobberMemory();
+    }
+    SetFlopCounter(state, size);
+}
+
+}  // namespace
+
+BENCHMARK(BM_MatMultBlocked)->RangeMultiplier(2)->Range(64, 4096)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// The naive kernel needs minutes per iteration beyond 2048, the cache-miss trend is already visible well before that
+BENCHMARK(BM_MatMultNaive)->RangeMultiplier(2)->Range(64, 2048)->Unit(benchmark::kMillisecond)->UseRealTime();
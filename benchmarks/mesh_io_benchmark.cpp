@@ -0,0 +1,126 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Time to open the triangulated unit square of range(0) x range(0) cells, 2 * range(0)^2 triangles, from an ASCII
+ * Gmsh file, from the native binary file through ReadBinaryMesh, and as a MappedMesh. The mapped case also sums the
+ * x coordinates so the pages are actually read. The bytes/s counter is the file size over the time.
+ */
+
+#include "pde_solver/data_types/grid.h"
+#include "pde_solver/utilities/mesh_io.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+pde::geometry::Grid CreateTriangulatedSquare(const std::int32_t cells)
+{
+    const auto side = cells + 1;
+    std::vector<double> x(static_cast<std::size_t>(side) * static_cast<std::size_t>(side));
+    std::vector<double> y(x.size());
+    for (std::int32_t j{0}; j < side; ++j)
+    {
+        for (std::int32_t i{0}; i < side; ++i)
+        {
+            const auto node = static_cast<std::size_t>(i + side * j);
+            x[node] = static_cast<double>(i) / static_cast<double>(cells);
+            y[node] = static_cast<double>(j) / static_cast<double>(cells);
+        }
+    }
+
+    std::vector<std::int32_t> connectivity{};
+    connectivity.reserve(6 * static_cast<std::size_t>(cells) * static_cast<std::size_t>(cells));
+    for (std::int32_t j{0}; j < cells; ++j)
+    {
+        for (std::int32_t i{0}; i < cells; ++i)
+        {
+            const auto corner = i + side * j;
+            connectivity.insert(connectivity.end(), {corner, corner + 1, corner + side + 1});
+            connectivity.insert(connectivity.end(), {corner, corner + side + 1, corner + side});
+        }
+    }
+
+    pde::geometry::Grid grid{std::move(connectivity), 3, std::move(x), std::move(y)};
+    for (std::int32_t j{0}; j < side; ++j)
+    {
+        for (std::int32_t i{0}; i < side; ++i)
+        {
+            if (i == 0 || j == 0 || i == cells || j == cells)
+            {
+                grid.SetBoundaryNode(i + side * j, true);
+            }
+        }
+    }
+    return grid;
+}
+
+std::int64_t FileSize(const std::string& path)
+{
+    std::ifstream file{path, std::ios::binary | std::ios::ate};
+    return static_cast<std::int64_t>(file.tellg());
+}
+
+void SetBytesProcessed(benchmark::State& state, const std::string& path)
+{
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * FileSize(path));
+    std::remove(path.c_str());
+}
+
+void BM_ReadGmshMesh(benchmark::State& state)
+{
+    const std::string path{"mesh_io_benchmark.msh"};
+    pde::geometry::WriteGmshMesh(CreateTriangulatedSquare(static_cast<std::int32_t>(state.range(0))), path);
+
+    for (auto _ : state)
+    {
+        const auto grid = pde::geometry::ReadGmshMesh(path);
+        benchmark::DoNotOptimize(grid.GetConnectivity().data());
+    }
+    SetBytesProcessed(state, path);
+}
+
+void BM_ReadBinaryMesh(benchmark::State& state)
+{
+    const std::string path{"mesh_io_benchmark.mesh"};
+    pde::geometry::WriteBinaryMesh(CreateTriangulatedSquare(static_cast<std::int32_t>(state.range(0))), path);
+
+    for (auto _ : state)
+    {
+        const auto grid = pde::geometry::ReadBinaryMesh(path);
+        benchmark::DoNotOptimize(grid.GetConnectivity().data());
+    }
+    SetBytesProcessed(state, path);
+}
+
+void BM_MapBinaryMesh(benchmark::State& state)
+{
+    const std::string path{"mesh_io_benchmark_mapped.mesh"};
+    pde::geometry::WriteBinaryMesh(CreateTriangulatedSquare(static_cast<std::int32_t>(state.range(0))), path);
+
+    for (auto _ : state)
+    {
+        const pde::geometry::MappedMesh mesh{path};
+        double sum{0.0};
+        for (std::int32_t node{0}; node < mesh.GetNumberOfNodes(); ++node)
+        {
+            sum += mesh.GetX()[node];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    SetBytesProcessed(state, path);
+}
+
+}  // namespace
+
+// 1024 x 1024 cells are about two million triangles
+BENCHMARK(BM_ReadGmshMesh)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadBinaryMesh)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MapBinaryMesh)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,193 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Speed and accuracy of single precision and mixed precision solves against the all double path. Dense systems of
+ * range(0) unknowns are solved with a double LUSolve, a float LUSolve and MixedPrecisionLUSolve, the five point
+ * Laplace system of a range(0) x range(0) grid with double and mixed precision Conjugate Gradient. The residual
+ * counter is the L2 norm of b - A * x in double, it shows the float solve stops at single precision accuracy while
+ * the mixed solve matches the double one. Dividing the time by the iterations counter separates the cheaper float
+ * Conjugate Gradient iteration from the extra iterations float rounding costs on an ill conditioned system.
+ */
+
+#include "matrix_solvers/direct_solvers/lu_solve.h"
+#include "matrix_solvers/iterative_solvers/conjugate_gradient.h"
+#include "matrix_solvers/mixed_precision/mixed_precision_solvers.h"
+#include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr double kDenseTolerance{1e-10};
+constexpr double kSparseTolerance{1e-8};
+constexpr std::int32_t kMaxIterations{100000};
+
+/// @brief Random diagonally dominant matrix, cond(A) stays small enough for single precision factors
+nm::matrix::Matrix<double> CreateDenseMatrix(const std::int32_t n)
+{
+    std::mt19937 generator{3};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+    nm::matrix::Matrix<double> A(n, n);
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        for (std::int32_t j{0}; j < n; ++j)
+        {
+            A(i, j) = distribution(generator);
+        }
+        A(i, i) += static_cast<double>(n);
+    }
+    return A;
+}
+
+nm::matrix::CsrMatrix CreateLaplaceMatrix(const std::int32_t grid_size)
+{
+    const auto n = grid_size * grid_size;
+    nm::matrix::CooMatrix coo(n, n);
+    coo.Reserve(5 * static_cast<std::size_t>(n));
+    for (std::int32_t row{0}; row < grid_size; ++row)
+    {
+        for (std::int32_t column{0}; column < grid_size; ++column)
+        {
+            const auto i = row * grid_size + column;
+            if (row > 0)
+            {
+                coo.Add(i, i - grid_size, -1.0);
+            }
+            if (column > 0)
+            {
+                coo.Add(i, i - 1, -1.0);
+            }
+            coo.Add(i, i, 4.0);
+            if (column < grid_size - 1)
+            {
+                coo.Add(i, i + 1, -1.0);
+            }
+            if (row < grid_size - 1)
+            {
+                coo.Add(i, i + grid_size, -1.0);
+            }
+        }
+    }
+    return nm::matrix::CsrMatrix{coo};
+}
+
+double DenseResidual(const nm::matrix::Matrix<double>& A, const std::vector<double>& x, const std::vector<double>& b)
+{
+    auto residual = b;
+    nm::matrix::Gemv(-1.0, A, x, 1.0, residual);
+    return nm::matrix::L2Norm(residual);
+}
+
+double SparseResidual(const nm::matrix::CsrMatrix& A, const std::vector<double>& x, const std::vector<double>& b)
+{
+    auto residual = b;
+    nm::matrix::SpMV(-1.0, A, x, 1.0, residual);
+    return nm::matrix::L2Norm(residual);
+}
+
+void BM_DoubleLUSolve(benchmark::State& state)
+{
+    const auto n = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateDenseMatrix(n);
+    const std::vector<double> b(static_cast<std::size_t>(n), 1.0);
+
+    std::vector<double> x{};
+    for (auto _ : state)
+    {
+        x = nm::matrix::LUSolve(A, b);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.counters["residual"] = DenseResidual(A, x, b);
+}
+
+void BM_FloatLUSolve(benchmark::State& state)
+{
+    const auto n = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateDenseMatrix(n);
+    const std::vector<double> b(static_cast<std::size_t>(n), 1.0);
+    nm::matrix::Matrix<float> A_float(n, n);
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        for (std::int32_t j{0}; j < n; ++j)
+        {
+            A_float(i, j) = static_cast<float>(A(i, j));
+        }
+    }
+    const std::vector<float> b_float(b.cbegin(), b.cend());
+
+    std::vector<float> x_float{};
+    for (auto _ : state)
+    {
+        x_float = nm::matrix::LUSolve(A_float, b_float);
+        benchmark::DoNotOptimize(x_float.data());
+    }
+    state.counters["residual"] = DenseResidual(A, std::vector<double>(x_float.cbegin(), x_float.cend()), b);
+}
+
+/// Includes the conversion of A to float and the copy of A kept for the residuals, a solve pays both once
+void BM_MixedPrecisionLUSolve(benchmark::State& state)
+{
+    const auto n = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateDenseMatrix(n);
+    const std::vector<double> b(static_cast<std::size_t>(n), 1.0);
+
+    std::vector<double> x{};
+    nm::matrix::SolverStats stats{};
+    for (auto _ : state)
+    {
+        x = nm::matrix::MixedPrecisionLUSolve(A, b, kDenseTolerance, 10, {&stats});
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.counters["residual"] = DenseResidual(A, x, b);
+    state.counters["refinements"] = stats.iterations;
+}
+
+void BM_DoubleConjugateGradient(benchmark::State& state)
+{
+    const auto A = CreateLaplaceMatrix(static_cast<std::int32_t>(state.range(0)));
+    const std::vector<double> b(static_cast<std::size_t>(A.NumberOfRows()), 1.0);
+
+    std::vector<double> x{};
+    std::int32_t iterations{0};
+    for (auto _ : state)
+    {
+        x.assign(b.size(), 0.0);
+        iterations = nm::matrix::ConjugateGradient(A, b, x, kSparseTolerance, kMaxIterations);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.counters["residual"] = SparseResidual(A, x, b);
+    state.counters["iterations"] = iterations;
+}
+
+void BM_MixedPrecisionConjugateGradient(benchmark::State& state)
+{
+    const auto A = CreateLaplaceMatrix(static_cast<std::int32_t>(state.range(0)));
+    const std::vector<double> b(static_cast<std::size_t>(A.NumberOfRows()), 1.0);
+
+    std::vector<double> x{};
+    std::int32_t iterations{0};
+    for (auto _ : state)
+    {
+        x.assign(b.size(), 0.0);
+        iterations = nm::matrix::MixedPrecisionConjugateGradient(A, b, x, kSparseTolerance, kMaxIterations);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.counters["residual"] = SparseResidual(A, x, b);
+    state.counters["iterations"] = iterations;
+}
+
+}  // namespace
+
+BENCHMARK(BM_DoubleLUSolve)->RangeMultiplier(2)->Range(128, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FloatLUSolve)->RangeMultiplier(2)->Range(128, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MixedPrecisionLUSolve)->RangeMultiplier(2)->Range(128, 1024)->Unit(benchmark::kMillisecond);
+
+// Grids from cache resident to well beyond the last level cache, where Conjugate Gradient is bandwidth bound
+BENCHMARK(BM_DoubleConjugateGradient)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MixedPrecisionConjugateGradient)->RangeMultiplier(2)->Range(64, 512)->Unit(benchmark::kMillisecond);
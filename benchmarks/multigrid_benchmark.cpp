@@ -0,0 +1,133 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Time to solution of geometric multigrid on 1D and 2D Poisson systems across refinement levels, setup included.
+ * Multigrid is O(N), so unknowns/s stays flat as the grid is refined while the cycle count stays constant. Conjugate
+ * gradient on the same systems shows the O(N^1.5) growth in 2D that multigrid removes.
+ */
+
+#include "matrix_solvers/iterative_solvers/conjugate_gradient.h"
+#include "matrix_solvers/iterative_solvers/multigrid.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+constexpr double kRelativeTolerance{1e-8};
+constexpr std::int32_t kMaxIterations{100000};
+
+/// Five point stencil in the interior, identity rows on the boundary and h^2 = 1
+///
+/// The boundary values are eliminated from the interior rows so that the matrix is symmetric positive definite and
+/// conjugate gradient applies.
+nm::matrix::CsrMatrix CreatePoissonMatrix(const nm::matrix::GridShape shape)
+{
+    const auto is_boundary = [&shape](const std::int32_t i) {
+        const auto x = i % shape.nx;
+        const auto y = i / shape.nx;
+        return (shape.nx > 1 && (x == 0 || x == shape.nx - 1)) || (shape.ny > 1 && (y == 0 || y == shape.ny - 1));
+    };
+
+    const auto n = shape.nx * shape.ny;
+    const auto dimensions = (shape.ny > 1) ? 2 : 1;
+    nm::matrix::CooMatrix coo(n, n);
+    coo.Reserve(static_cast<std::size_t>(2 * dimensions + 1) * static_cast<std::size_t>(n));
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        if (is_boundary(i))
+        {
+            coo.Add(i, i, 1.0);
+            continue;
+        }
+
+        coo.Add(i, i, 2.0 * dimensions);
+        for (const auto neighbour : {i - 1, i + 1, i - shape.nx, i + shape.nx})
+        {
+            if ((dimensions == 2 || neighbour == i - 1 || neighbour == i + 1) && !is_boundary(neighbour))
+            {
+                coo.Add(i, neighbour, -1.0);
+            }
+        }
+    }
+    return nm::matrix::CsrMatrix{coo};
+}
+
+nm::matrix::GridShape ShapeOf(const benchmark::State& state)
+{
+    // range(0) is the refinement level, the grid has 2^level + 1 nodes per dimension
+    const auto nodes = (1 << state.range(0)) + 1;
+    return state.range(1) == 1 ? nm::matrix::GridShape{.nx = nodes} : nm::matrix::GridShape{.nx = nodes, .ny = nodes};
+}
+
+void BM_Multigrid(benchmark::State& state, const nm::matrix::MultigridCycle cycle)
+{
+    const auto shape = ShapeOf(state);
+    const auto A = CreatePoissonMatrix(shape);
+    const std::vector<double> b(static_cast<std::size_t>(A.NumberOfRows()), 1.0);
+    const auto tolerance = kRelativeTolerance * std::sqrt(static_cast<double>(b.size()));
+
+    std::int32_t cycles{0};
+    for (auto _ : state)
+    {
+        std::vector<double> x(b.size(), 0.0);
+        const nm::matrix::Multigrid multigrid{A, shape, {.cycle = cycle}};
+        cycles = multigrid.Solve(b, x, tolerance, kMaxIterations);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["cycles"] = cycles;
+    state.counters["unknowns/s"] =
+        benchmark::Counter(static_cast<double>(b.size()), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_ConjugateGradient(benchmark::State& state)
+{
+    const auto A = CreatePoissonMatrix(ShapeOf(state));
+    const std::vector<double> b(static_cast<std::size_t>(A.NumberOfRows()), 1.0);
+    const auto tolerance = kRelativeTolerance * std::sqrt(static_cast<double>(b.size()));
+
+    std::int32_t iterations{0};
+    for (auto _ : state)
+    {
+        std::vector<double> x(b.size(), 0.0);
+        iterations = nm::matrix::ConjugateGradient(A, b, x, tolerance, kMaxIterations);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["iterations"] = iterations;
+    state.counters["unknowns/s"] =
+        benchmark::Counter(static_cast<double>(b.size()), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void RefinementArguments(benchmark::internal::Benchmark* benchmark)
+{
+    // Beyond 2^16 nodes in 1D the condition number of about N^2 puts the tolerance below the rounding error
+    for (std::int64_t level{10}; level <= 16; level += 2)
+    {
+        benchmark->Args({level, 1});
+    }
+    for (std::int64_t level{4}; level <= 9; ++level)
+    {
+        benchmark->Args({level, 2});
+    }
+    benchmark->ArgNames({"level", "dimensions"});
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_Multigrid, VCycle, nm::matrix::MultigridCycle::kV)
+    ->Apply(RefinementArguments)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Multigrid, WCycle, nm::matrix::MultigridCycle::kW)
+    ->Apply(RefinementArguments)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Multigrid, FullMultigrid, nm::matrix::MultigridCycle::kFull)
+    ->Apply(RefinementArguments)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ConjugateGradient)->Apply(RefinementArguments)->Unit(benchmark::kMillisecond);
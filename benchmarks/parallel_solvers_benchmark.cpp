@@ -0,0 +1,83 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Strong scaling of the thread parallel Jacobi and red-black Gauss-Seidel solvers, from one thread to every hardware
+ * thread on the Laplace systems of the MPI Jacobi prototype. Speedup is the 1 thread time over the N thread time.
+ */
+
+#include "matrix_solvers/iterative_solvers/gauss_seidel.h"
+#include "matrix_solvers/iterative_solvers/jacobi.h"
+#include "matrix_solvers/iterative_solvers/jacobi_mpi/utils.h"
+#include "matrix_solvers/parallel/thread_pool.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/utilities.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+/// Fixed sweep count, the tolerance of zero is never reached so every run does the same work
+constexpr int kSweeps{100};
+
+nm::matrix::CsrMatrix CreateLaplaceMatrix(const std::int32_t size)
+{
+    const double* dense = InitializeLaplaceMatrix(size);
+    const nm::matrix::CsrMatrix A{nm::matrix::Matrix<double>(dense, size, size)};
+    delete[] dense;
+    return A;
+}
+
+template <typename Solver>
+void RunSolver(benchmark::State& state, Solver&& solver)
+{
+    const auto size = static_cast<std::int32_t>(state.range(0));
+    const auto number_of_threads = static_cast<std::int32_t>(state.range(1));
+    const auto A = CreateLaplaceMatrix(size);
+    const std::vector<double> b(static_cast<std::size_t>(size), 1.0);
+    nm::matrix::ThreadPool pool{number_of_threads};
+
+    for (auto _ : state)
+    {
+        std::vector<double> x(static_cast<std::size_t>(size), 0.0);
+        solver(A, b, x, pool);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["threads"] = number_of_threads;
+    state.counters["sweeps/s"] = benchmark::Counter(kSweeps, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_ParallelJacobi(benchmark::State& state)
+{
+    RunSolver(state, [](const auto& A, const auto& b, auto& x, auto& pool) {
+        nm::matrix::Jacobi(A, b, x, kSweeps, 0.0, pool);
+    });
+}
+
+void BM_RedBlackGaussSeidel(benchmark::State& state)
+{
+    RunSolver(state, [](const auto& A, const auto& b, auto& x, auto& pool) {
+        nm::matrix::GaussSeidel(A, b, x, kSweeps, 0.0, pool);
+    });
+}
+
+void ScalingArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (const std::int64_t size : {1024, 4096})
+    {
+        for (std::int64_t threads{1}; threads < nm::matrix::ThreadPool::DefaultNumberOfThreads(); threads *= 2)
+        {
+            benchmark->Args({size, threads});
+        }
+        benchmark->Args({size, nm::matrix::ThreadPool::DefaultNumberOfThreads()});
+    }
+    benchmark->ArgNames({"N", "threads"});
+}
+
+}  // namespace
+
+BENCHMARK(BM_ParallelJacobi)->Apply(ScalingArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_RedBlackGaussSeidel)->Apply(ScalingArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
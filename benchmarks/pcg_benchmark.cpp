@@ -0,0 +1,122 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Iteration count and wall time of conjugate gradient with each preconditioner on the five point Laplace system of a
+ * square grid. The condition number grows like the number of grid points per side squared, so the iteration counts
+ * show how well each preconditioner clusters the spectrum and the wall time whether that pays for its setup and apply.
+ */
+
+#include "matrix_solvers/iterative_solvers/conjugate_gradient.h"
+#include "matrix_solvers/preconditioners/incomplete_factorization.h"
+#include "matrix_solvers/preconditioners/preconditioner.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+constexpr double kTolerance{1e-8};
+constexpr std::int32_t kMaxIterations{100000};
+
+enum class PreconditionerType : std::int64_t
+{
+    kNone = 0,
+    kJacobi = 1,
+    kSsor = 2,
+    kIncompleteCholesky = 3,
+    kIncompleteLU = 4,
+};
+
+nm::matrix::CsrMatrix CreateLaplaceMatrix(const std::int32_t grid_size)
+{
+    const auto n = grid_size * grid_size;
+    nm::matrix::CooMatrix coo(n, n);
+    coo.Reserve(5 * static_cast<std::size_t>(n));
+    for (std::int32_t row{0}; row < grid_size; ++row)
+    {
+        for (std::int32_t column{0}; column < grid_size; ++column)
+        {
+            const auto i = row * grid_size + column;
+            if (row > 0)
+            {
+                coo.Add(i, i - grid_size, -1.0);
+            }
+            if (column > 0)
+            {
+                coo.Add(i, i - 1, -1.0);
+            }
+            coo.Add(i, i, 4.0);
+            if (column < grid_size - 1)
+            {
+                coo.Add(i, i + 1, -1.0);
+            }
+            if (row < grid_size - 1)
+            {
+                coo.Add(i, i + grid_size, -1.0);
+            }
+        }
+    }
+    return nm::matrix::CsrMatrix{coo};
+}
+
+std::unique_ptr<nm::matrix::Preconditioner> CreatePreconditioner(const PreconditionerType type,
+                                                                 const nm::matrix::CsrMatrix& A)
+{
+    switch (type)
+    {
+        case PreconditionerType::kJacobi:
+            return std::make_unique<nm::matrix::JacobiPreconditioner>(A);
+        case PreconditionerType::kSsor:
+            return std::make_unique<nm::matrix::SsorPreconditioner>(A, 1.5);
+        case PreconditionerType::kIncompleteCholesky:
+            return std::make_unique<nm::matrix::IncompleteCholeskyPreconditioner>(A);
+        case PreconditionerType::kIncompleteLU:
+            return std::make_unique<nm::matrix::IncompleteLUPreconditioner>(A);
+        case PreconditionerType::kNone:
+        default:
+            return nullptr;
+    }
+}
+
+/// Setup of the preconditioner is part of the timed region, it is paid once per solve in the PDE time loop
+void BM_PreconditionedConjugateGradient(benchmark::State& state)
+{
+    const auto grid_size = static_cast<std::int32_t>(state.range(0));
+    const auto type = static_cast<PreconditionerType>(state.range(1));
+    const auto A = CreateLaplaceMatrix(grid_size);
+    const std::vector<double> b(static_cast<std::size_t>(A.NumberOfRows()), 1.0);
+
+    std::int32_t iterations{0};
+    for (auto _ : state)
+    {
+        std::vector<double> x(b.size(), 0.0);
+        const auto M = CreatePreconditioner(type, A);
+        iterations = (M == nullptr) ? nm::matrix::ConjugateGradient(A, b, x, kTolerance, kMaxIterations)
+                                    : nm::matrix::ConjugateGradient(A, b, x, *M, kTolerance, kMaxIterations);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["iterations"] = iterations;
+}
+
+void PreconditionerArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (const std::int64_t grid_size : {32, 64, 128, 256})
+    {
+        for (std::int64_t type{0}; type <= static_cast<std::int64_t>(PreconditionerType::kIncompleteLU); ++type)
+        {
+            benchmark->Args({grid_size, type});
+        }
+    }
+    // 0: none, 1: Jacobi, 2: SSOR, 3: IC(0), 4: ILU(0)
+    benchmark->ArgNames({"grid", "preconditioner"});
+}
+
+}  // namespace
+
+BENCHMARK(BM_PreconditionedConjugateGradient)->Apply(PreconditionerArguments)->Unit(benchmark::kMillisecond);
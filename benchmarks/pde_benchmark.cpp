@@ -0,0 +1,255 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * PDE solver throughput on 1D diffusion with range(0) grid points: explicit time stepping through TimeVariable::Run,
+ * one sparse product per stage, and the steady state solve of SpatialVariable with each matrix solver. The assembly
+ * benchmarks build the Laplace stiffness matrix of about range(0) nodes, from the element grid in 1D and from a
+ * structured grid in 1D, 2D and 3D. The adaptive runs cover the same time span with the embedded pairs. The
+ * snapshot run repeats the Euler run while writing every range(1)-th step to a binary file on the background writer
+ * thread.
+ */
+
+#include "pde_solver/data_types/discretization_methods.h"
+#include "pde_solver/data_types/finite_difference_schemas.h"
+#include "pde_solver/data_types/grid.h"
+#include "pde_solver/data_types/spatial_variable.h"
+#include "pde_solver/data_types/structured_grid.h"
+#include "pde_solver/data_types/time_variable.h"
+#include "pde_solver/operators/laplace.h"
+#include "pde_solver/utilities/grid_generator.h"
+#include "pde_solver/utilities/snapshot_writer.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+constexpr double kDiffusion{0.1};
+constexpr std::int32_t kTimeSteps{100};
+
+/// Central difference Laplacian on [0, 1] with unit forcing and zero Dirichlet values on both ends
+pde::SpatialVariable CreateDiffusionVariable(const std::int32_t number_of_grid_points)
+{
+    pde::geometry::GridGenerator grid_generator{};
+    const auto grid = grid_generator.Create1DLinearGrid(number_of_grid_points, 0.0, 1.0);
+
+    pde::SpatialVariable u{};
+    u.SetGrid(grid);
+    u.SetSpatialDiscretizationMethod(pde::SpatialDiscretizationMethod::kFiniteDifferenceMethod);
+    u.SetDiscretizationSchema(pde::FiniteDifferenceSchema::kCentralDifference);
+
+    pde::operators::LaplaceOperator laplace{};
+    laplace.SetConstantDiffusion(kDiffusion);
+    laplace.GenerateMatrixForSpatialVariable(u);
+    u.SetForceVector(std::vector<double>(static_cast<std::size_t>(number_of_grid_points), 1.0));
+
+    u.SetDirichletBoundaryCondition(0.0, 0);
+    u.SetDirichletBoundaryCondition(0.0, number_of_grid_points - 1);
+    return u;
+}
+
+/// Sets up uu for kTimeSteps explicit steps of the diffusion of a unit pulse and returns the pulse
+std::vector<double> SetUpDiffusionRun(pde::TimeVariable& uu,
+                                      const std::int32_t number_of_grid_points,
+                                      const pde::TimeDiscretizationMethod method)
+{
+    const auto u = CreateDiffusionVariable(number_of_grid_points);
+
+    // Explicit Euler is stable for kDiffusion * dt / dx^2 <= 1/2
+    const auto dx = 1.0 / static_cast<double>(number_of_grid_points - 1);
+    const auto delta_t = 0.4 * dx * dx / kDiffusion;
+
+    uu.InitializeWithSpatialVariable(u);
+    uu.SetTimeDiscretizationMethod(method);
+    uu.SetStartTime(0.0);
+    uu.SetEndTime((kTimeSteps + 0.5) * delta_t);
+    uu.SetTimeStep(delta_t);
+    uu.SetRightHandSideMatrix(uu.ux_.GetStiffnessMatrix());
+
+    std::vector<double> initial_condition(static_cast<std::size_t>(number_of_grid_points), 0.0);
+    std::fill(initial_condition.begin() + number_of_grid_points / 4,
+              initial_condition.begin() + 3 * number_of_grid_points / 4,
+              1.0);
+    return initial_condition;
+}
+
+void BM_TimeVariableRun(benchmark::State& state, const pde::TimeDiscretizationMethod method)
+{
+    const auto number_of_grid_points = static_cast<std::int32_t>(state.range(0));
+    pde::TimeVariable uu{};
+    const auto initial_condition = SetUpDiffusionRun(uu, number_of_grid_points, method);
+
+    for (auto _ : state)
+    {
+        uu.SetInitialCondition(initial_condition);
+        uu.Run();
+        benchmark::DoNotOptimize(uu.GetTimeVariable().data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["node_steps/s"] = benchmark::Counter(static_cast<double>(number_of_grid_points) * kTimeSteps,
+                                                        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/// Adaptive run over the same time span, started from the fixed methods' step. Diffusion is stiff, so the step size
+/// settles near the stability limit of the method rather than at the tolerance.
+void BM_TimeVariableRunAdaptive(benchmark::State& state, const pde::TimeDiscretizationMethod method)
+{
+    const auto number_of_grid_points = static_cast<std::int32_t>(state.range(0));
+    pde::TimeVariable uu{};
+    const auto initial_condition = SetUpDiffusionRun(uu, number_of_grid_points, method);
+    uu.SetTolerances(1e-8, 1e-6);
+
+    for (auto _ : state)
+    {
+        uu.SetInitialCondition(initial_condition);
+        uu.Run();
+        benchmark::DoNotOptimize(uu.GetTimeVariable().data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["accepted_steps"] = uu.GetNumberOfAcceptedSteps();
+    state.counters["rejected_steps"] = uu.GetNumberOfRejectedSteps();
+}
+
+/// Euler run writing every range(1)-th step to a binary snapshot file, to compare against BM_TimeVariableRun
+void BM_TimeVariableRunWithSnapshots(benchmark::State& state)
+{
+    const auto number_of_grid_points = static_cast<std::int32_t>(state.range(0));
+    const auto every_steps = static_cast<std::int32_t>(state.range(1));
+    pde::TimeVariable uu{};
+    const auto initial_condition =
+        SetUpDiffusionRun(uu, number_of_grid_points, pde::TimeDiscretizationMethod::kEulerStep);
+    const std::string path{"pde_benchmark.snapshots"};
+
+    for (auto _ : state)
+    {
+        pde::SnapshotWriter writer{path, pde::SnapshotFormat::kBinary, {every_steps, {}}};
+        uu.SetInitialCondition(initial_condition);
+        uu.Run([&writer](const std::int32_t step, const double time, const std::vector<double>& u) {
+            writer.Offer(step, time, u);
+        });
+        writer.Close();
+    }
+    std::remove(path.c_str());
+    state.counters["node_steps/s"] = benchmark::Counter(static_cast<double>(number_of_grid_points) * kTimeSteps,
+                                                        benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_SpatialVariableSolve(benchmark::State& state, const pde::MatrixSolverEnum matrix_solver)
+{
+    const auto number_of_grid_points = static_cast<std::int32_t>(state.range(0));
+    auto initial_u = CreateDiffusionVariable(number_of_grid_points);
+    initial_u.SetMatrixSolver(matrix_solver);
+
+    for (auto _ : state)
+    {
+        // Solve starts from the stored solution, every solve gets the zero initial guess and no cached factorization
+        state.PauseTiming();
+        auto u = initial_u;
+        state.ResumeTiming();
+
+        u.Solve(100 * number_of_grid_points, 1e-8);
+        benchmark::DoNotOptimize(u.GetDiscretizedVariable().data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["unknowns/s"] =
+        benchmark::Counter(static_cast<double>(number_of_grid_points), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_LaplaceAssemblyElementGrid(benchmark::State& state)
+{
+    pde::geometry::GridGenerator grid_generator{};
+    pde::SpatialVariable u{};
+    u.SetGrid(grid_generator.Create1DLinearGrid(static_cast<std::uint64_t>(state.range(0)), 0.0, 1.0));
+    u.SetSpatialDiscretizationMethod(pde::SpatialDiscretizationMethod::kFiniteDifferenceMethod);
+    u.SetDiscretizationSchema(pde::FiniteDifferenceSchema::kCentralDifference);
+    pde::operators::LaplaceOperator laplace{};
+
+    for (auto _ : state)
+    {
+        laplace.GenerateMatrixForSpatialVariable(u);
+        benchmark::DoNotOptimize(u.GetStiffnessMatrix().Values().data());
+    }
+    state.counters["nodes/s"] =
+        benchmark::Counter(static_cast<double>(state.range(0)), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+/// range(1) is the dimension, every axis gets the same number of nodes
+void BM_LaplaceAssemblyStructuredGrid(benchmark::State& state)
+{
+    const auto dimension = state.range(1);
+    const auto nodes_per_axis = static_cast<std::uint64_t>(
+        std::lround(std::pow(static_cast<double>(state.range(0)), 1.0 / static_cast<double>(dimension))));
+    const pde::geometry::GridAxis axis{nodes_per_axis, 0.0, 1.0};
+
+    pde::geometry::GridGenerator grid_generator{};
+    pde::geometry::StructuredGrid grid{};
+    if (dimension == 1)
+    {
+        std::vector<double> x(nodes_per_axis);
+        for (std::size_t i{0}; i < x.size(); ++i)
+        {
+            x[i] = static_cast<double>(i) / static_cast<double>(x.size() - 1);
+        }
+        grid = pde::geometry::StructuredGrid{std::move(x)};
+    }
+    else if (dimension == 2)
+    {
+        grid = grid_generator.Create2DStructuredGrid(axis, axis);
+    }
+    else
+    {
+        grid = grid_generator.Create3DStructuredGrid(axis, axis, axis);
+    }
+    const pde::operators::LaplaceOperator laplace{};
+
+    for (auto _ : state)
+    {
+        const auto K = laplace.GenerateMatrixForStructuredGrid(grid);
+        benchmark::DoNotOptimize(K.Values().data());
+    }
+    state.counters["nodes/s"] = benchmark::Counter(static_cast<double>(grid.GetNumberOfNodes()),
+                                                   benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_TimeVariableRun, EulerStep, pde::TimeDiscretizationMethod::kEulerStep)
+    ->RangeMultiplier(4)
+    ->Range(64, 16384);
+BENCHMARK_CAPTURE(BM_TimeVariableRun, RungeKutta2, pde::TimeDiscretizationMethod::kRungeKutta2)
+    ->RangeMultiplier(4)
+    ->Range(64, 16384);
+BENCHMARK_CAPTURE(BM_TimeVariableRun, RungeKutta4, pde::TimeDiscretizationMethod::kRungeKutta4)
+    ->RangeMultiplier(4)
+    ->Range(64, 16384);
+BENCHMARK_CAPTURE(BM_TimeVariableRunAdaptive, DormandPrince54, pde::TimeDiscretizationMethod::kDormandPrince54)
+    ->RangeMultiplier(4)
+    ->Range(64, 16384);
+BENCHMARK_CAPTURE(BM_TimeVariableRunAdaptive, BogackiShampine32, pde::TimeDiscretizationMethod::kBogackiShampine32)
+    ->RangeMultiplier(4)
+    ->Range(64, 16384);
+BENCHMARK(BM_TimeVariableRunWithSnapshots)->ArgsProduct({{4096, 16384}, {1, 10}})->ArgNames({"nodes", "every"});
+
+// The multigrid hierarchy wants 2^k + 1 points. Without a preconditioner the Krylov solvers need O(n) iterations on
+// this system, beyond a few hundred points a single solve takes seconds.
+BENCHMARK_CAPTURE(BM_SpatialVariableSolve, Thomas, pde::MatrixSolverEnum::kThomas)->Arg(257)->Arg(4097);
+BENCHMARK_CAPTURE(BM_SpatialVariableSolve, ConjugateGradient, pde::MatrixSolverEnum::kConjugateGradient)
+    ->Arg(257)
+    ->Arg(4097);
+BENCHMARK_CAPTURE(BM_SpatialVariableSolve, Multigrid, pde::MatrixSolverEnum::kMultigrid)->Arg(257)->Arg(4097);
+BENCHMARK_CAPTURE(BM_SpatialVariableSolve, GMRES, pde::MatrixSolverEnum::kGMRES)->Arg(257);
+BENCHMARK_CAPTURE(BM_SpatialVariableSolve, BiCGSTAB, pde::MatrixSolverEnum::kBiCGSTAB)->Arg(257);
+
+BENCHMARK(BM_LaplaceAssemblyElementGrid)->RangeMultiplier(16)->Range(4096, 1 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LaplaceAssemblyStructuredGrid)
+    ->ArgsProduct({{4096, 65536, 1 << 20}, {1, 2, 3}})
+    ->ArgNames({"nodes", "dimension"})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,50 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Trapezoidal and Simpson's rule cost per integrand evaluation. Both are one pass over range(0) intervals, so the
+ * evaluations/s counter exposes the std::function call overhead per node.
+ */
+
+#include "calculus/integration/simpsons_method/simpsons_method.h"
+#include "calculus/integration/trapezoidal_method/trapezoidal_method.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+
+namespace
+{
+
+double Integrand(const double x)
+{
+    return std::exp(-x * x);
+}
+
+void BM_TrapezoidalIntegration(benchmark::State& state)
+{
+    const auto intervals = static_cast<std::int32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        auto integral = nm::calculus::TrapezoidalIntegration(Integrand, 0.0, 2.0, intervals);
+        benchmark::DoNotOptimize(integral);
+    }
+    state.counters["evaluations/s"] =
+        benchmark::Counter(static_cast<double>(intervals + 1), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_SimpsonsIntegration(benchmark::State& state)
+{
+    const auto intervals = static_cast<std::int32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        auto integral = nm::calculus::SimpsonsIntegration(Integrand, 0.0, 2.0, intervals);
+        benchmark::DoNotOptimize(integral);
+    }
+    state.counters["evaluations/s"] =
+        benchmark::Counter(static_cast<double>(intervals + 1), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+BENCHMARK(BM_TrapezoidalIntegration)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK(BM_SimpsonsIntegration)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
@@ -0,0 +1,106 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Root finder cost per solve. The scalar methods solve x^3 - 2x - 5 = 0, Wallis' classic test, and are dominated by
+ * std::function calls. Broyden's method solves the Broyden tridiagonal system of range(0) equations, its finite
+ * difference Jacobian and dense inverse update grow like n^2 per iteration.
+ */
+
+#include "matrix_solvers/telemetry/solver_telemetry.h"
+#include "root_finders/bisection_method/bisection_method.h"
+#include "root_finders/broydens_method/broydens_method.h"
+#include "root_finders/newtons_method.h"
+#include "root_finders/secant_method/secant_method.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace
+{
+
+constexpr double kTolerance{1e-10};
+constexpr std::int32_t kMaxIterations{1000};
+
+double Cubic(const double x)
+{
+    return x * x * x - 2.0 * x - 5.0;
+}
+
+double CubicDerivative(const double x)
+{
+    return 3.0 * x * x - 2.0;
+}
+
+void BM_NewtonsMethod(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        double x_0{2.0};
+        auto root = nm::root_finders::NewtonsMethod(x_0, Cubic, CubicDerivative, kTolerance, kMaxIterations);
+        benchmark::DoNotOptimize(root);
+    }
+}
+
+void BM_SecantMethod(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto root = nm::root_finders::SecantMethod(Cubic, 2.0, 3.0, kTolerance, kMaxIterations);
+        benchmark::DoNotOptimize(root);
+    }
+}
+
+void BM_BisectionMethod(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto root = nm::root_finders::BisectionMethod(Cubic, 2.0, 3.0, kTolerance);
+        benchmark::DoNotOptimize(root);
+    }
+}
+
+/// f_i(x) = (3 - 2 x_i) x_i - x_i-1 - 2 x_i+1 + 1 with x_0 = x_n+1 = 0
+std::vector<std::function<double(std::vector<double>)>> CreateBroydenTridiagonalSystem(const std::size_t size)
+{
+    std::vector<std::function<double(std::vector<double>)>> equations{};
+    equations.reserve(size);
+    for (std::size_t i{0}; i < size; ++i)
+    {
+        equations.emplace_back([i, size](const std::vector<double>& x) {
+            const auto previous = (i > 0) ? x[i - 1] : 0.0;
+            const auto next = (i + 1 < size) ? x[i + 1] : 0.0;
+            return (3.0 - 2.0 * x[i]) * x[i] - previous - 2.0 * next + 1.0;
+        });
+    }
+    return equations;
+}
+
+void BM_BroydensMethod(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const auto equations = CreateBroydenTridiagonalSystem(size);
+    const std::vector<double> initial_guess(size, -1.0);
+
+    for (auto _ : state)
+    {
+        auto root = nm::root_finders::BroydensMethod(equations, initial_guess, 1e-6, kTolerance, kMaxIterations);
+        benchmark::DoNotOptimize(root.data());
+        benchmark::ClobberMemory();
+    }
+
+    // Counted by a separate solve so that the telemetry does not take part in the timed ones
+    nm::matrix::SolverStats stats{};
+    nm::root_finders::BroydensMethod(
+        equations, initial_guess, 1e-6, kTolerance, kMaxIterations, nm::matrix::SolverTelemetry{&stats});
+    state.counters["iterations"] = stats.iterations;
+}
+
+}  // namespace
+
+BENCHMARK(BM_NewtonsMethod);
+BENCHMARK(BM_SecantMethod);
+BENCHMARK(BM_BisectionMethod);
+BENCHMARK(BM_BroydensMethod)->RangeMultiplier(2)->Range(2, 64)->Unit(benchmark::kMicrosecond);
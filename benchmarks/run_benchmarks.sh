@@ -0,0 +1,55 @@
+#!/bin/bash
+# Runs every benchmark binary and writes one Google Benchmark JSON file per binary into an output directory.
+#
+# Usage, from the root of the repository:
+#   benchmarks/run_benchmarks.sh <output_directory> [bazel flags, e.g. --config=gcc12]
+#
+# Environment:
+#   BENCHMARK_BINARY_DIR   directory of already built binaries, e.g. _build/benchmarks of a CMake build configured with
+#                          -DBUILD_BENCHMARKS=ON, skips the bazel build
+#   BENCHMARK_FILTER       regular expression of the benchmarks to run, default all
+#   BENCHMARK_REPETITIONS  repetitions of every benchmark, default 5, the JSON files keep only their mean, median,
+#                          stddev and cv
+#
+# Compare two runs with benchmarks/compare_benchmarks.py, e.g.
+#   git checkout main && benchmarks/run_benchmarks.sh /tmp/main
+#   git checkout my-branch && benchmarks/run_benchmarks.sh /tmp/my-branch
+#   benchmarks/compare_benchmarks.py /tmp/main /tmp/my-branch
+
+set -euo pipefail
+
+if [ $# -lt 1 ]; then
+  echo "Usage: $0 <output_directory> [bazel flags]"
+  exit 1
+fi
+
+OUTPUT_DIRECTORY=$1
+shift
+mkdir -p "${OUTPUT_DIRECTORY}"
+
+REPETITIONS=${BENCHMARK_REPETITIONS:-5}
+FILTER=${BENCHMARK_FILTER:-.}
+COMMIT=$(git rev-parse --short HEAD 2>/dev/null || echo unknown)
+
+if [ -n "${BENCHMARK_BINARY_DIR:-}" ]; then
+  BINARY_DIR=${BENCHMARK_BINARY_DIR}
+else
+  bazel build -c opt "$@" //benchmarks:all
+  BINARY_DIR=bazel-bin/benchmarks
+fi
+
+for BINARY in "${BINARY_DIR}"/*_benchmark; do
+  NAME=$(basename "${BINARY}")
+  echo "Running ${NAME}"
+  "${BINARY}" \
+    --benchmark_filter="${FILTER}" \
+    --benchmark_repetitions="${REPETITIONS}" \
+    --benchmark_report_aggregates_only=true \
+    --benchmark_context=commit="${COMMIT}" \
+    --benchmark_out="${OUTPUT_DIRECTORY}/${NAME}.json" \
+    --benchmark_out_format=json
+  # A filter that matches nothing in a binary leaves an empty file behind
+  if [ ! -s "${OUTPUT_DIRECTORY}/${NAME}.json" ]; then
+    rm -f "${OUTPUT_DIRECTORY}/${NAME}.json"
+  fi
+done
@@ -0,0 +1,142 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Bytes moved per cycle by the BLAS level 1 kernels, for every instruction set the machine supports.
+ *
+ * BM_StreamCopy is the roofline reference: a plain copy is bound only by load/store bandwidth, so for working sets
+ * past the last level cache the kernels cannot do better than its bytes/cycle.
+ */
+
+#include "matrix_solvers/operations/vector_kernels.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#define NM_BENCHMARK_HAS_TSC
+#endif
+
+namespace
+{
+
+using nm::matrix::kernels::InstructionSet;
+
+/// @brief Runs body once per benchmark iteration and reports bytes/s and, where a cycle counter exists,
+/// bytes/cycle
+template <typename Body>
+void RunKernel(benchmark::State& state, const std::size_t bytes_per_call, Body&& body)
+{
+    const auto requested = static_cast<InstructionSet>(state.range(1));
+    if (nm::matrix::kernels::SetInstructionSet(requested) != requested)
+    {
+        state.SkipWithError("instruction set not supported on this machine");
+        return;
+    }
+    state.SetLabel(nm::matrix::kernels::ToString(requested));
+
+#ifdef NM_BENCHMARK_HAS_TSC
+    const auto start_cycles = __rdtsc();
+#endif
+    for (auto _ : state)
+    {
+        body();
+        benchmark::ClobberMemory();
+    }
+#ifdef NM_BENCHMARK_HAS_TSC
+    const auto cycles = static_cast<double>(__rdtsc() - start_cycles);
+    const auto bytes = static_cast<double>(bytes_per_call) * static_cast<double>(state.iterations());
+    state.counters["bytes/cycle"] = bytes / cycles;
+#endif
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(bytes_per_call) * state.iterations());
+    nm::matrix::kernels::SetInstructionSet(nm::matrix::kernels::DetectInstructionSet());
+}
+
+void BM_Dot(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<double> a(size, 1.0);
+    const std::vector<double> b(size, 2.0);
+
+    RunKernel(state, 2 * size * sizeof(double), [&]() {
+        benchmark::DoNotOptimize(nm::matrix::kernels::Dot(a.data(), b.data(), size));
+    });
+}
+
+void BM_SumOfSquares(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<double> a(size, 1.0);
+
+    RunKernel(state, size * sizeof(double), [&]() {
+        benchmark::DoNotOptimize(nm::matrix::kernels::SumOfSquares(a.data(), size));
+    });
+}
+
+void BM_Add(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<double> a(size, 1.0);
+    const std::vector<double> b(size, 2.0);
+    std::vector<double> result(size);
+
+    RunKernel(state, 3 * size * sizeof(double), [&]() {
+        nm::matrix::kernels::Add(a.data(), b.data(), result.data(), size);
+        benchmark::DoNotOptimize(result.data());
+    });
+}
+
+void BM_Scale(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<double> a(size, 1.0);
+    std::vector<double> result(size);
+
+    RunKernel(state, 2 * size * sizeof(double), [&]() {
+        nm::matrix::kernels::Scale(0.5, a.data(), result.data(), size);
+        benchmark::DoNotOptimize(result.data());
+    });
+}
+
+void BM_StreamCopy(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<double> a(size, 1.0);
+    std::vector<double> result(size);
+
+    RunKernel(state, 2 * size * sizeof(double), [&]() {
+        std::copy(a.cbegin(), a.cend(), result.begin());
+        benchmark::DoNotOptimize(result.data());
+    });
+}
+
+// 1 Ki to 8 Mi doubles: 8 KiB (L1 resident) up to 64 MiB per vector (DRAM bound)
+const std::vector<std::int64_t> kSizes{benchmark::CreateRange(1 << 10, 1 << 23, 8)};
+
+void KernelArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"size", "isa"});
+    benchmark->ArgsProduct({kSizes,
+                            {static_cast<std::int64_t>(InstructionSet::kScalar),
+                             static_cast<std::int64_t>(InstructionSet::kAvx2),
+                             static_cast<std::int64_t>(InstructionSet::kAvx512)}});
+}
+
+void RooflineArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"size", "isa"});
+    benchmark->ArgsProduct({kSizes, {static_cast<std::int64_t>(InstructionSet::kScalar)}});
+}
+
+}  // namespace
+
+BENCHMARK(BM_Dot)->Apply(KernelArguments);
+BENCHMARK(BM_SumOfSquares)->Apply(KernelArguments);
+BENCHMARK(BM_Add)->Apply(KernelArguments);
+BENCHMARK(BM_Scale)->Apply(KernelArguments);
+BENCHMARK(BM_StreamCopy)->Apply(RooflineArguments);
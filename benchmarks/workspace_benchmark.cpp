@@ -0,0 +1,86 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Cost of scratch vector allocation in short, repeated solves, as the inner solve of an implicit time step does. Each
+ * solve runs a few BiCGSTAB iterations on the 1D Laplace system of range(0) unknowns, either from a fresh Workspace,
+ * which allocates every scratch vector like a solver constructing its own vectors, or from the warm workspace of the
+ * thread, which reuses the buffers of the previous solve. allocations_per_solve is read from the workspace stats.
+ */
+
+#include "matrix_solvers/iterative_solvers/bicgstab.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/workspace/workspace.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+constexpr std::int32_t kIterationsPerSolve{5};
+
+nm::matrix::CsrMatrix CreateLaplaceMatrix(const std::int32_t n)
+{
+    nm::matrix::CooMatrix coo(n, n);
+    coo.Reserve(3 * static_cast<std::size_t>(n));
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        if (i > 0)
+        {
+            coo.Add(i, i - 1, -1.0);
+        }
+        coo.Add(i, i, 2.0);
+        if (i < n - 1)
+        {
+            coo.Add(i, i + 1, -1.0);
+        }
+    }
+    return nm::matrix::CsrMatrix{coo};
+}
+
+void BM_RepeatedSolvesFreshWorkspace(benchmark::State& state)
+{
+    const auto n = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateLaplaceMatrix(n);
+    const std::vector<double> b(static_cast<std::size_t>(n), 1.0);
+    std::vector<double> x(static_cast<std::size_t>(n), 0.0);
+
+    std::size_t allocations{0};
+    for (auto _ : state)
+    {
+        nm::matrix::Workspace workspace{};
+        const nm::matrix::ScopedWorkspace scope{workspace};
+        nm::matrix::BiCGSTAB(A, b, x, 0.0, kIterationsPerSolve);
+        benchmark::DoNotOptimize(x.data());
+        allocations += workspace.Stats().allocations;
+    }
+    state.counters["allocations_per_solve"] =
+        static_cast<double>(allocations) / static_cast<double>(state.iterations());
+}
+
+void BM_RepeatedSolvesWarmWorkspace(benchmark::State& state)
+{
+    const auto n = static_cast<std::int32_t>(state.range(0));
+    const auto A = CreateLaplaceMatrix(n);
+    const std::vector<double> b(static_cast<std::size_t>(n), 1.0);
+    std::vector<double> x(static_cast<std::size_t>(n), 0.0);
+
+    auto& workspace = nm::matrix::CurrentWorkspace();
+    nm::matrix::BiCGSTAB(A, b, x, 0.0, kIterationsPerSolve);
+    workspace.ResetStats();
+    for (auto _ : state)
+    {
+        nm::matrix::BiCGSTAB(A, b, x, 0.0, kIterationsPerSolve);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.counters["allocations_per_solve"] =
+        static_cast<double>(workspace.Stats().allocations) / static_cast<double>(state.iterations());
+}
+
+}  // namespace
+
+// Small systems are dominated by allocation, large ones by the iterations themselves
+BENCHMARK(BM_RepeatedSolvesFreshWorkspace)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK(BM_RepeatedSolvesWarmWorkspace)->RangeMultiplier(8)->Range(64, 1 << 18);
@@ -8,7 +8,10 @@
 #ifndef CONTROLS_LQR_NEWTON_KLEINMAN_H
 #define CONTROLS_LQR_NEWTON_KLEINMAN_H
 
+#include "matrix_solvers/fixed/fixed_matrix.h"
 #include "matrix_solvers/utilities.h"
+#include <cstdint>
+#include <utility>
 
 namespace nm
 {
@@ -42,6 +45,52 @@ std::pair<matrix::Matrix<double>, matrix::Matrix<double>> NewtonKleinman(const m
                                                                          const std::int32_t max_iterations = 1000,
                                                                          const double tolerance = 1e-6);
 
+///
+/// @brief Fixed size overload of NewtonKleinman for n states and m inputs, runs without any heap allocation
+///
+/// Same iteration on FixedMatrix, with the Lyapunov equation solved as an n^2 x n^2 system on the stack, which limits
+/// it to small systems of up to about 8 states. The gain update solves with R instead of inverting its diagonal, the
+/// two overloads agree whenever R is diagonal.
+///
+/// @return std::pair of the optimal state feedback gain matrix (K) and the solution to the Riccati equation (P)
+///
+template <std::int32_t N, std::int32_t M>
+std::pair<matrix::FixedMatrix<double, M, N>, matrix::FixedMatrix<double, N, N>> NewtonKleinman(
+    const matrix::FixedMatrix<double, N, N>& A,
+    const matrix::FixedMatrix<double, N, M>& B,
+    const matrix::FixedMatrix<double, N, N>& Q,
+    const matrix::FixedMatrix<double, M, M>& R,
+    const matrix::FixedMatrix<double, M, N>& K0,
+    const std::int32_t max_iterations = 1000,
+    const double tolerance = 1e-6)
+{
+    const auto I = matrix::FixedMatrix<double, N, N>::Identity();
+    const auto BT = B.Transpose();
+    matrix::FixedMatrix<double, N, N> P{};
+    auto K_previous = K0;
+    auto K_next = K0;
+
+    for (std::int32_t iter{0}; iter < max_iterations; ++iter)
+    {
+        // S'P + PS = -Q - K'RK with S = A - BK, vectorized column by column
+        const auto ST = (A - matrix::MatMult(B, K_previous)).Transpose();
+        const auto RHS = Q + matrix::MatMult(matrix::MatMult(K_previous.Transpose(), R), K_previous);
+        const auto AA = matrix::KroneckerProduct(I, ST) + matrix::KroneckerProduct(ST, I);
+        const auto P_vectorized = matrix::LUSolve(AA, matrix::Vectorize(matrix::ScalarMultiply(-1.0, RHS)));
+
+        P = matrix::Devectorize<N, N>(P_vectorized);
+        K_next = matrix::LUSolve(R, matrix::MatMult(BT, P));
+
+        if (matrix::L2Norm(K_next - K_previous) < tolerance)
+        {
+            break;
+        }
+        K_previous = K_next;
+    }
+
+    return {K_next, P};
+}
+
 }  // namespace controls
 }  // namespace nm
 
@@ -3,6 +3,7 @@
  */
 
 #include "controls/lqr/newton_kleinman.h"
+#include "matrix_solvers/fixed/fixed_matrix.h"
 #include "matrix_solvers/utilities.h"
 #include <cmath>
 #include <gtest/gtest.h>
@@ -50,6 +51,34 @@ TEST(LQRTests, GivenLyaponovEquation_ExpectValidSolution)
     EXPECT_NEAR(result.second.at(1).at(1), 19.7089, tolerance);
 }
 
+TEST(LQRTests, GivenFixedSizeSystem_ExpectSameSolutionAsDynamicSize)
+{
+    // Given
+    const double m_ = 10.0;
+    const double k_ = 50.0;
+    const double c_ = 0.3 * (2 * std::sqrt(k_ * m_));
+    const matrix::FixedMatrix<double, 2, 2> A{{-c_ / m_, -k_ / m_, 1.0, 0.0}};
+    const matrix::FixedMatrix<double, 2, 1> B{{1 / m_, 0.0}};
+    const matrix::FixedMatrix<double, 2, 2> Q{{0.0, 0.0, 0.0, 40.0}};
+    const matrix::FixedMatrix<double, 1, 1> R{{0.2}};
+    const matrix::FixedMatrix<double, 1, 2> K0{{2.0, 2.0}};
+
+    // Call
+    const auto result = NewtonKleinman(A, B, Q, R, K0);
+
+    // Expect
+    const auto expected = NewtonKleinman(A.ToMatrix(), B.ToMatrix(), Q.ToMatrix(), R.ToMatrix(), K0.ToMatrix());
+    for (std::int32_t j{0}; j < 2; ++j)
+    {
+        EXPECT_NEAR(result.first(0, j), expected.first(0, j), 1e-9);
+        for (std::int32_t i{0}; i < 2; ++i)
+        {
+            EXPECT_NEAR(result.second(i, j), expected.second(i, j), 1e-9);
+        }
+    }
+    EXPECT_NEAR(result.first(0, 0), 1.39003, 1e-3);
+}
+
 }  // namespace
 }  // namespace controls
 }  // namespace nm
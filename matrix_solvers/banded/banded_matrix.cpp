@@ -0,0 +1,182 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/banded/banded_matrix.h"
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+Bandwidth GetBandwidth(const CsrMatrix& A)
+{
+    const auto& offsets = A.RowOffsets();
+    const auto& columns = A.ColumnIndices();
+
+    Bandwidth bandwidth{};
+    for (std::int32_t i{0}; i < A.NumberOfRows(); ++i)
+    {
+        const auto begin = offsets[static_cast<std::size_t>(i)];
+        const auto end = offsets[static_cast<std::size_t>(i) + 1];
+        if (begin == end)
+        {
+            continue;
+        }
+
+        // Columns are sorted, the first and last entries bound the row
+        bandwidth.lower = std::max(bandwidth.lower, i - columns[static_cast<std::size_t>(begin)]);
+        bandwidth.upper = std::max(bandwidth.upper, columns[static_cast<std::size_t>(end) - 1] - i);
+    }
+    return bandwidth;
+}
+
+bool IsTridiagonal(const CsrMatrix& A)
+{
+    if (A.NumberOfRows() != A.NumberOfColumns())
+    {
+        return false;
+    }
+    const auto bandwidth = GetBandwidth(A);
+    return bandwidth.lower <= 1 && bandwidth.upper <= 1;
+}
+
+TridiagonalMatrix::TridiagonalMatrix(std::vector<double> lower, std::vector<double> diagonal, std::vector<double> upper)
+    : lower_(std::move(lower)), diagonal_(std::move(diagonal)), upper_(std::move(upper))
+{
+    const auto off_diagonal_size = diagonal_.empty() ? 0 : diagonal_.size() - 1;
+    if (lower_.size() != off_diagonal_size || upper_.size() != off_diagonal_size)
+    {
+        throw std::invalid_argument("Tridiagonal off-diagonals must be one entry shorter than the diagonal.");
+    }
+}
+
+TridiagonalMatrix::TridiagonalMatrix(const CsrMatrix& A)
+{
+    if (!IsTridiagonal(A))
+    {
+        throw std::invalid_argument("Matrix is not tridiagonal.");
+    }
+
+    const auto n = static_cast<std::size_t>(A.NumberOfRows());
+    diagonal_.assign(n, 0.0);
+    lower_.assign(n == 0 ? 0 : n - 1, 0.0);
+    upper_.assign(n == 0 ? 0 : n - 1, 0.0);
+
+    const auto& offsets = A.RowOffsets();
+    const auto& columns = A.ColumnIndices();
+    const auto& values = A.Values();
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        for (auto k = static_cast<std::size_t>(offsets[i]); k < static_cast<std::size_t>(offsets[i + 1]); ++k)
+        {
+            const auto j = static_cast<std::size_t>(columns[k]);
+            if (j + 1 == i)
+            {
+                lower_[j] = values[k];
+            }
+            else if (j == i)
+            {
+                diagonal_[i] = values[k];
+            }
+            else
+            {
+                upper_[i] = values[k];
+            }
+        }
+    }
+}
+
+Matrix<double> TridiagonalMatrix::ToDense() const
+{
+    const auto n = NumberOfRows();
+    Matrix<double> dense(n, n);
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        dense(i, i) = diagonal_[static_cast<std::size_t>(i)];
+        if (i + 1 < n)
+        {
+            dense(i + 1, i) = lower_[static_cast<std::size_t>(i)];
+            dense(i, i + 1) = upper_[static_cast<std::size_t>(i)];
+        }
+    }
+    return dense;
+}
+
+BandedMatrix::BandedMatrix(const std::int32_t n, const Bandwidth bandwidth)
+    : n_(n), bandwidth_(bandwidth), data_(static_cast<std::size_t>(n) * static_cast<std::size_t>(Width()), 0.0)
+{
+    if (n < 0 || bandwidth.lower < 0 || bandwidth.upper < 0)
+    {
+        throw std::invalid_argument("Banded matrix size and bandwidth must be non-negative.");
+    }
+}
+
+BandedMatrix::BandedMatrix(const CsrMatrix& A) : BandedMatrix(A.NumberOfRows(), nm::matrix::GetBandwidth(A))
+{
+    if (A.NumberOfRows() != A.NumberOfColumns())
+    {
+        throw std::invalid_argument("Banded matrices must be square.");
+    }
+
+    const auto& offsets = A.RowOffsets();
+    const auto& columns = A.ColumnIndices();
+    const auto& values = A.Values();
+    for (std::int32_t i{0}; i < n_; ++i)
+    {
+        for (auto k = offsets[static_cast<std::size_t>(i)]; k < offsets[static_cast<std::size_t>(i) + 1]; ++k)
+        {
+            (*this)(i, columns[static_cast<std::size_t>(k)]) = values[static_cast<std::size_t>(k)];
+        }
+    }
+}
+
+bool BandedMatrix::IsInBand(const std::int32_t i, const std::int32_t j) const
+{
+    return i >= 0 && i < n_ && j >= 0 && j < n_ && j - i <= bandwidth_.upper && i - j <= bandwidth_.lower;
+}
+
+double BandedMatrix::operator()(const std::int32_t i, const std::int32_t j) const
+{
+    if (!IsInBand(i, j))
+    {
+        return 0.0;
+    }
+    return data_[static_cast<std::size_t>(i) * static_cast<std::size_t>(Width()) +
+                 static_cast<std::size_t>(j - i + bandwidth_.lower)];
+}
+
+double& BandedMatrix::operator()(const std::int32_t i, const std::int32_t j)
+{
+    if (!IsInBand(i, j))
+    {
+        throw std::out_of_range("Entry is outside of the band of the matrix.");
+    }
+    return data_[static_cast<std::size_t>(i) * static_cast<std::size_t>(Width()) +
+                 static_cast<std::size_t>(j - i + bandwidth_.lower)];
+}
+
+Matrix<double> BandedMatrix::ToDense() const
+{
+    Matrix<double> dense(n_, n_);
+    for (std::int32_t i{0}; i < n_; ++i)
+    {
+        const auto first = std::max(0, i - bandwidth_.lower);
+        const auto last = std::min(n_ - 1, i + bandwidth_.upper);
+        for (auto j = first; j <= last; ++j)
+        {
+            dense(i, j) = (*this)(i, j);
+        }
+    }
+    return dense;
+}
+
+}  // namespace matrix
+
+}  // namespace nm
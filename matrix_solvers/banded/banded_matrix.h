@@ -0,0 +1,104 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Tridiagonal and general banded matrix storage
+ */
+
+#ifndef MATRIX_SOLVERS_BANDED_BANDED_MATRIX_H
+#define MATRIX_SOLVERS_BANDED_BANDED_MATRIX_H
+
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/utilities.h"
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Number of nonzero diagonals below and above the main diagonal
+struct Bandwidth
+{
+    std::int32_t lower{0};
+    std::int32_t upper{0};
+};
+
+/// @brief Smallest band holding every stored entry of A
+Bandwidth GetBandwidth(const CsrMatrix& A);
+
+/// @brief Whether A is square and stores no entry beyond its first sub- and super-diagonal
+bool IsTridiagonal(const CsrMatrix& A);
+
+/// @brief nxn matrix with nonzeros only on its main, first sub- and first super-diagonal
+///
+/// lower[i] is entry (i + 1, i), diagonal[i] is entry (i, i) and upper[i] is entry (i, i + 1).
+class TridiagonalMatrix
+{
+  public:
+    TridiagonalMatrix() = default;
+
+    /// @throws std::invalid_argument: when lower and upper are not one entry shorter than diagonal
+    TridiagonalMatrix(std::vector<double> lower, std::vector<double> diagonal, std::vector<double> upper);
+
+    /// @throws std::invalid_argument: when A is not tridiagonal
+    explicit TridiagonalMatrix(const CsrMatrix& A);
+
+    std::int32_t NumberOfRows() const { return static_cast<std::int32_t>(diagonal_.size()); }
+
+    const std::vector<double>& Lower() const { return lower_; }
+    const std::vector<double>& Diagonal() const { return diagonal_; }
+    const std::vector<double>& Upper() const { return upper_; }
+
+    Matrix<double> ToDense() const;
+
+  private:
+    std::vector<double> lower_{};
+    std::vector<double> diagonal_{};
+    std::vector<double> upper_{};
+};
+
+/// @brief nxn matrix whose nonzeros lie within a fixed number of diagonals around the main diagonal
+///
+/// Row i stores the lower + upper + 1 entries from column i - lower to column i + upper contiguously, so memory is
+/// O(n * (lower + upper + 1)) and row operations stay within one cache friendly stride.
+class BandedMatrix
+{
+  public:
+    BandedMatrix() = default;
+
+    /// @brief Zero nxn matrix with the given band
+    BandedMatrix(const std::int32_t n, const Bandwidth bandwidth);
+
+    /// @brief Copies A into the smallest band that holds it
+    explicit BandedMatrix(const CsrMatrix& A);
+
+    std::int32_t NumberOfRows() const { return n_; }
+    Bandwidth GetBandwidth() const { return bandwidth_; }
+
+    /// @brief Entry (i, j), zero outside of the band
+    double operator()(const std::int32_t i, const std::int32_t j) const;
+
+    /// @brief Writable entry (i, j)
+    ///
+    /// @throws std::out_of_range: when (i, j) is outside of the band
+    double& operator()(const std::int32_t i, const std::int32_t j);
+
+    Matrix<double> ToDense() const;
+
+  private:
+    bool IsInBand(const std::int32_t i, const std::int32_t j) const;
+    std::int32_t Width() const { return bandwidth_.lower + bandwidth_.upper + 1; }
+
+    std::int32_t n_{0};
+    Bandwidth bandwidth_{};
+    std::vector<double> data_{};
+};
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_BANDED_BANDED_MATRIX_H
@@ -0,0 +1,97 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/banded/banded_matrix.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/utilities.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+void ExpectSameEntries(const Matrix<double>& result, const Matrix<double>& expected)
+{
+    ASSERT_EQ(result.NumberOfRows(), expected.NumberOfRows());
+    ASSERT_EQ(result.NumberOfColumns(), expected.NumberOfColumns());
+    for (std::int32_t i{0}; i < result.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < result.NumberOfColumns(); ++j)
+        {
+            EXPECT_DOUBLE_EQ(result(i, j), expected(i, j)) << "entry (" << i << ", " << j << ")";
+        }
+    }
+}
+
+TEST(BandwidthTest, GivenPentadiagonalMatrix_ExpectTwoDiagonalsOnEachSide)
+{
+    // Given
+    const Matrix<double> A{{4.0, 1.0, 2.0, 0.0}, {1.0, 4.0, 1.0, 0.0}, {0.0, 1.0, 4.0, 1.0}, {0.0, 3.0, 1.0, 4.0}};
+
+    // Call
+    const auto bandwidth = GetBandwidth(CsrMatrix{A});
+
+    // Expect
+    EXPECT_EQ(bandwidth.lower, 2);
+    EXPECT_EQ(bandwidth.upper, 2);
+    EXPECT_FALSE(IsTridiagonal(CsrMatrix{A}));
+}
+
+TEST(TridiagonalMatrixTest, GivenTridiagonalCsrMatrix_ExpectSameEntries)
+{
+    // Given
+    const Matrix<double> A{{2.0, -1.0, 0.0}, {-3.0, 2.0, -1.0}, {0.0, -3.0, 2.0}};
+    const CsrMatrix A_sparse{A};
+
+    // Call
+    const TridiagonalMatrix A_tridiagonal{A_sparse};
+
+    // Expect
+    EXPECT_TRUE(IsTridiagonal(A_sparse));
+    EXPECT_EQ(A_tridiagonal.Lower(), (std::vector<double>{-3.0, -3.0}));
+    EXPECT_EQ(A_tridiagonal.Diagonal(), (std::vector<double>{2.0, 2.0, 2.0}));
+    EXPECT_EQ(A_tridiagonal.Upper(), (std::vector<double>{-1.0, -1.0}));
+    ExpectSameEntries(A_tridiagonal.ToDense(), A);
+}
+
+TEST(TridiagonalMatrixTest, GivenInvalidDiagonals_ExpectException)
+{
+    // Given
+    const Matrix<double> A{{2.0, 0.0, 1.0}, {0.0, 2.0, 0.0}, {0.0, 0.0, 2.0}};
+
+    // Call & Expect
+    EXPECT_THROW(TridiagonalMatrix({1.0}, {1.0, 1.0}, {1.0, 1.0}), std::invalid_argument);
+    EXPECT_THROW(TridiagonalMatrix{CsrMatrix{A}}, std::invalid_argument);
+}
+
+TEST(BandedMatrixTest, GivenCsrMatrix_ExpectSameEntriesInSmallestBand)
+{
+    // Given
+    const Matrix<double> A{{4.0, 1.0, 0.0, 0.0}, {2.0, 4.0, 1.0, 0.0}, {5.0, 2.0, 4.0, 1.0}, {0.0, 5.0, 2.0, 4.0}};
+
+    // Call
+    BandedMatrix A_banded{CsrMatrix{A}};
+
+    // Expect
+    EXPECT_EQ(A_banded.GetBandwidth().lower, 2);
+    EXPECT_EQ(A_banded.GetBandwidth().upper, 1);
+    ExpectSameEntries(A_banded.ToDense(), A);
+    EXPECT_DOUBLE_EQ(static_cast<const BandedMatrix&>(A_banded)(0, 3), 0.0);
+    EXPECT_THROW(A_banded(0, 3), std::out_of_range);
+}
+
+}  // namespace
+
+}  // namespace matrix
+
+}  // namespace nm
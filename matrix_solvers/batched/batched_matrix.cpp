@@ -0,0 +1,559 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Batches of many small, same-sized dense matrices and their GEMM, LU and Cholesky kernels
+ */
+
+#include "matrix_solvers/batched/batched_matrix.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+using batched::kLaneBlock;
+
+/// @brief Calls kernel with std::integral_constant<std::int32_t, n> when n is one of Sizes and with 0 otherwise
+template <typename Kernel, std::int32_t... Sizes>
+void DispatchOnSize(const std::int32_t n, batched::KernelSizes<Sizes...>, Kernel&& kernel)
+{
+    const bool fixed = ((n == Sizes && (kernel(std::integral_constant<std::int32_t, Sizes>{}), true)) || ...);
+    if (!fixed)
+    {
+        kernel(std::integral_constant<std::int32_t, 0>{});
+    }
+}
+
+/// @brief Size known at compile time when kN > 0, otherwise the runtime one
+template <std::int32_t kN>
+constexpr std::int32_t KernelSize(const std::int32_t n)
+{
+    return (kN > 0) ? kN : n;
+}
+
+/// @brief Entry (i, j) of the lanes [lane_begin, lane_begin + lanes) of a batch with the given number of columns
+///
+/// @param T: double, or const double for a read-only block
+template <typename T>
+class LaneBlock
+{
+  public:
+    LaneBlock(T* data, const std::int32_t columns, const std::size_t stride, const std::size_t lane_begin)
+        : data_(data + lane_begin), columns_(static_cast<std::size_t>(columns)), stride_(stride)
+    {
+    }
+
+    T* operator()(const std::int32_t i, const std::int32_t j) const
+    {
+        return data_ + (static_cast<std::size_t>(i) * columns_ + static_cast<std::size_t>(j)) * stride_;
+    }
+
+  private:
+    T* data_;
+    std::size_t columns_;
+    std::size_t stride_;
+};
+
+/// y[b] += a[b] * x[b]
+inline void LaneMultiplyAdd(const double* __restrict a,
+                            const double* __restrict x,
+                            double* __restrict y,
+                            const std::int32_t lanes)
+{
+    for (std::int32_t b{0}; b < lanes; ++b)
+    {
+        y[b] += a[b] * x[b];
+    }
+}
+
+/// y[b] -= a[b] * x[b]
+inline void LaneMultiplySubtract(const double* __restrict a,
+                                 const double* __restrict x,
+                                 double* __restrict y,
+                                 const std::int32_t lanes)
+{
+    for (std::int32_t b{0}; b < lanes; ++b)
+    {
+        y[b] -= a[b] * x[b];
+    }
+}
+
+template <std::int32_t kM, std::int32_t kN, std::int32_t kK>
+void GemmBlock(const std::int32_t runtime_m,
+               const std::int32_t runtime_n,
+               const std::int32_t runtime_k,
+               const LaneBlock<const double>& A,
+               const LaneBlock<const double>& B,
+               const LaneBlock<double>& C,
+               const std::int32_t lanes)
+{
+    const auto m = KernelSize<kM>(runtime_m);
+    const auto n = KernelSize<kN>(runtime_n);
+    const auto k = KernelSize<kK>(runtime_k);
+    // i-p-j order, every update is a multiply-add of whole lane arrays
+    for (std::int32_t i{0}; i < m; ++i)
+    {
+        for (std::int32_t p{0}; p < k; ++p)
+        {
+            const double* a_ip = A(i, p);
+            for (std::int32_t j{0}; j < n; ++j)
+            {
+                LaneMultiplyAdd(a_ip, B(p, j), C(i, j), lanes);
+            }
+        }
+    }
+}
+
+template <std::int32_t kN>
+void LUFactorBlock(const std::int32_t runtime_n,
+                   const LaneBlock<double>& A,
+                   std::int32_t* pivots,
+                   const std::size_t stride,
+                   const std::size_t lane_begin,
+                   const std::int32_t lanes)
+{
+    const auto n = KernelSize<kN>(runtime_n);
+    double largest[kLaneBlock];
+    std::int32_t pivot_row[kLaneBlock];
+    double inverse_pivot[kLaneBlock];
+
+    for (std::int32_t k{0}; k < n; ++k)
+    {
+        // Partial pivoting, every matrix of the block picks its own pivot row, found with a branch free selection
+        const double* a_kk = A(k, k);
+        for (std::int32_t b{0}; b < lanes; ++b)
+        {
+            largest[b] = std::abs(a_kk[b]);
+            pivot_row[b] = k;
+        }
+        for (auto i = k + 1; i < n; ++i)
+        {
+            const double* a_ik = A(i, k);
+            for (std::int32_t b{0}; b < lanes; ++b)
+            {
+                const auto candidate = std::abs(a_ik[b]);
+                pivot_row[b] = (candidate > largest[b]) ? i : pivot_row[b];
+                largest[b] = (candidate > largest[b]) ? candidate : largest[b];
+            }
+        }
+        for (std::int32_t b{0}; b < lanes; ++b)
+        {
+            if (largest[b] == 0.0)
+            {
+                throw std::invalid_argument("Matrix " + std::to_string(lane_begin + static_cast<std::size_t>(b)) +
+                                            " of the batch is singular.");
+            }
+            pivots[static_cast<std::size_t>(k) * stride + lane_begin + static_cast<std::size_t>(b)] = pivot_row[b];
+        }
+
+        // Row interchanges differ between the matrices, so they are done lane by lane
+        for (std::int32_t b{0}; b < lanes; ++b)
+        {
+            if (pivot_row[b] != k)
+            {
+                for (std::int32_t j{0}; j < n; ++j)
+                {
+                    std::swap(A(k, j)[b], A(pivot_row[b], j)[b]);
+                }
+            }
+        }
+
+        for (std::int32_t b{0}; b < lanes; ++b)
+        {
+            inverse_pivot[b] = 1.0 / a_kk[b];
+        }
+        for (auto i = k + 1; i < n; ++i)
+        {
+            double* l_ik = A(i, k);
+            for (std::int32_t b{0}; b < lanes; ++b)
+            {
+                l_ik[b] *= inverse_pivot[b];
+            }
+            for (auto j = k + 1; j < n; ++j)
+            {
+                LaneMultiplySubtract(l_ik, A(k, j), A(i, j), lanes);
+            }
+        }
+    }
+}
+
+template <std::int32_t kN>
+void LUSolveBlock(const std::int32_t runtime_n,
+                  const std::int32_t number_of_right_hand_sides,
+                  const LaneBlock<const double>& LU,
+                  const std::int32_t* pivots,
+                  const LaneBlock<double>& X,
+                  const std::size_t stride,
+                  const std::size_t lane_begin,
+                  const std::int32_t lanes)
+{
+    const auto n = KernelSize<kN>(runtime_n);
+    for (std::int32_t k{0}; k < n; ++k)
+    {
+        const auto* pivot_row = pivots + static_cast<std::size_t>(k) * stride + lane_begin;
+        for (std::int32_t b{0}; b < lanes; ++b)
+        {
+            if (pivot_row[b] != k)
+            {
+                for (std::int32_t r{0}; r < number_of_right_hand_sides; ++r)
+                {
+                    std::swap(X(k, r)[b], X(pivot_row[b], r)[b]);
+                }
+            }
+        }
+    }
+
+    // Forward substitution with the unit lower triangular L
+    for (std::int32_t i{1}; i < n; ++i)
+    {
+        for (std::int32_t j{0}; j < i; ++j)
+        {
+            for (std::int32_t r{0}; r < number_of_right_hand_sides; ++r)
+            {
+                LaneMultiplySubtract(LU(i, j), X(j, r), X(i, r), lanes);
+            }
+        }
+    }
+
+    // Backwards substitution with U
+    for (auto i = n - 1; i >= 0; --i)
+    {
+        for (auto j = i + 1; j < n; ++j)
+        {
+            for (std::int32_t r{0}; r < number_of_right_hand_sides; ++r)
+            {
+                LaneMultiplySubtract(LU(i, j), X(j, r), X(i, r), lanes);
+            }
+        }
+        const double* u_ii = LU(i, i);
+        for (std::int32_t r{0}; r < number_of_right_hand_sides; ++r)
+        {
+            double* x_ir = X(i, r);
+            for (std::int32_t b{0}; b < lanes; ++b)
+            {
+                x_ir[b] /= u_ii[b];
+            }
+        }
+    }
+}
+
+template <std::int32_t kN>
+void CholeskyFactorBlock(const std::int32_t runtime_n,
+                         const LaneBlock<double>& L,
+                         const std::size_t lane_begin,
+                         const std::int32_t lanes)
+{
+    const auto n = KernelSize<kN>(runtime_n);
+    double inverse_diagonal[kLaneBlock];
+
+    // Left looking, column j is updated with the finished columns left of it before it is scaled
+    for (std::int32_t j{0}; j < n; ++j)
+    {
+        for (std::int32_t k{0}; k < j; ++k)
+        {
+            const double* l_jk = L(j, k);
+            for (auto i = j; i < n; ++i)
+            {
+                LaneMultiplySubtract(L(i, k), l_jk, L(i, j), lanes);
+            }
+        }
+
+        double* l_jj = L(j, j);
+        for (std::int32_t b{0}; b < lanes; ++b)
+        {
+            // Negated comparison so that a NaN is rejected as well
+            if (!(l_jj[b] > 0.0))
+            {
+                throw std::invalid_argument("Matrix " + std::to_string(lane_begin + static_cast<std::size_t>(b)) +
+                                            " of the batch is not positive definite.");
+            }
+        }
+        for (std::int32_t b{0}; b < lanes; ++b)
+        {
+            l_jj[b] = std::sqrt(l_jj[b]);
+            inverse_diagonal[b] = 1.0 / l_jj[b];
+        }
+        for (auto i = j + 1; i < n; ++i)
+        {
+            double* l_ij = L(i, j);
+            for (std::int32_t b{0}; b < lanes; ++b)
+            {
+                l_ij[b] *= inverse_diagonal[b];
+            }
+            std::fill(L(j, i), L(j, i) + lanes, 0.0);
+        }
+    }
+}
+
+template <std::int32_t kN>
+void CholeskySolveBlock(const std::int32_t runtime_n,
+                        const std::int32_t number_of_right_hand_sides,
+                        const LaneBlock<const double>& L,
+                        const LaneBlock<double>& X,
+                        const std::int32_t lanes)
+{
+    const auto n = KernelSize<kN>(runtime_n);
+    const auto divide = [&X, &L, number_of_right_hand_sides, lanes](const std::int32_t i) {
+        const double* l_ii = L(i, i);
+        for (std::int32_t r{0}; r < number_of_right_hand_sides; ++r)
+        {
+            double* x_ir = X(i, r);
+            for (std::int32_t b{0}; b < lanes; ++b)
+            {
+                x_ir[b] /= l_ii[b];
+            }
+        }
+    };
+
+    // L y = b
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        for (std::int32_t j{0}; j < i; ++j)
+        {
+            for (std::int32_t r{0}; r < number_of_right_hand_sides; ++r)
+            {
+                LaneMultiplySubtract(L(i, j), X(j, r), X(i, r), lanes);
+            }
+        }
+        divide(i);
+    }
+
+    // L^T x = y, L^T(i, j) = L(j, i)
+    for (auto i = n - 1; i >= 0; --i)
+    {
+        for (auto j = i + 1; j < n; ++j)
+        {
+            for (std::int32_t r{0}; r < number_of_right_hand_sides; ++r)
+            {
+                LaneMultiplySubtract(L(j, i), X(j, r), X(i, r), lanes);
+            }
+        }
+        divide(i);
+    }
+}
+
+/// @brief Calls block(lane_begin, lanes) for consecutive blocks of at most kLaneBlock lanes, padding lanes included
+template <typename Block>
+void ForEachLaneBlock(const std::size_t stride, Block&& block)
+{
+    for (std::size_t lane_begin{0}; lane_begin < stride; lane_begin += kLaneBlock)
+    {
+        const auto lanes = static_cast<std::int32_t>(std::min<std::size_t>(kLaneBlock, stride - lane_begin));
+        block(lane_begin, lanes);
+    }
+}
+
+/// @brief Padding lanes are not part of the batch, making them identity matrices keeps the factorizations valid there
+void SetPaddingLanesToIdentity(BatchedMatrix& A)
+{
+    for (std::int32_t i{0}; i < A.NumberOfRows(); ++i)
+    {
+        std::fill(A.Lanes(i, i) + A.BatchSize(), A.Lanes(i, i) + A.Stride(), 1.0);
+    }
+}
+
+void CheckRightHandSides(const BatchedMatrix& factors, const BatchedMatrix& B)
+{
+    if (B.BatchSize() != factors.BatchSize() || B.NumberOfRows() != factors.NumberOfRows())
+    {
+        throw std::length_error("Batched factorization and right hand side dimensions do not match.");
+    }
+}
+
+}  // namespace
+
+BatchedMatrix::BatchedMatrix(const std::int32_t batch_size, const std::int32_t rows, const std::int32_t columns)
+    : batch_size_(batch_size), m_(rows), n_(columns)
+{
+    assert(batch_size > 0);
+    assert(rows > 0);
+    assert(columns > 0);
+
+    const auto padding = static_cast<std::size_t>(kLanePadding);
+    stride_ = (static_cast<std::size_t>(batch_size) + padding - 1) / padding * padding;
+    data_.assign(static_cast<std::size_t>(rows) * static_cast<std::size_t>(columns) * stride_, 0.0);
+}
+
+BatchedMatrix::BatchedMatrix(const std::vector<Matrix<double>>& matrices)
+{
+    if (matrices.empty())
+    {
+        throw std::invalid_argument("A batch needs at least one matrix.");
+    }
+    *this = BatchedMatrix(static_cast<std::int32_t>(matrices.size()),
+                          matrices.front().NumberOfRows(),
+                          matrices.front().NumberOfColumns());
+    for (std::int32_t b{0}; b < batch_size_; ++b)
+    {
+        Set(b, matrices[static_cast<std::size_t>(b)]);
+    }
+}
+
+Matrix<double> BatchedMatrix::Get(const std::int32_t batch) const
+{
+    assert(batch >= 0 && batch < batch_size_);
+
+    Matrix<double> matrix(m_, n_);
+    for (std::int32_t i{0}; i < m_; ++i)
+    {
+        for (std::int32_t j{0}; j < n_; ++j)
+        {
+            matrix(i, j) = (*this)(batch, i, j);
+        }
+    }
+    return matrix;
+}
+
+void BatchedMatrix::Set(const std::int32_t batch, const Matrix<double>& matrix)
+{
+    assert(batch >= 0 && batch < batch_size_);
+    if (matrix.NumberOfRows() != m_ || matrix.NumberOfColumns() != n_)
+    {
+        throw std::length_error("Matrix dimensions do not match the batch.");
+    }
+
+    for (std::int32_t i{0}; i < m_; ++i)
+    {
+        for (std::int32_t j{0}; j < n_; ++j)
+        {
+            (*this)(batch, i, j) = matrix(i, j);
+        }
+    }
+}
+
+void BatchedGemm(const BatchedMatrix& A, const BatchedMatrix& B, BatchedMatrix& C)
+{
+    const auto m = A.NumberOfRows();
+    const auto n = B.NumberOfColumns();
+    const auto k = A.NumberOfColumns();
+    if (A.BatchSize() != B.BatchSize() || A.BatchSize() != C.BatchSize())
+    {
+        throw std::length_error("Batch sizes do not match.");
+    }
+    if (B.NumberOfRows() != k || C.NumberOfRows() != m || C.NumberOfColumns() != n)
+    {
+        throw std::length_error("Matrix dimensions are not compatible for multiplication.");
+    }
+
+    // Only square products have a fixed-size kernel
+    const auto square_size = (m == n && n == k) ? m : 0;
+    const auto stride = A.Stride();
+    ForEachLaneBlock(stride, [&](const std::size_t lane_begin, const std::int32_t lanes) {
+        const LaneBlock<const double> A_block{A.Data(), k, stride, lane_begin};
+        const LaneBlock<const double> B_block{B.Data(), n, stride, lane_begin};
+        const LaneBlock<double> C_block{C.Data(), n, stride, lane_begin};
+        DispatchOnSize(square_size, batched::FixedKernelSizes{}, [&](auto size) {
+            constexpr auto kSize = decltype(size)::value;
+            GemmBlock<kSize, kSize, kSize>(m, n, k, A_block, B_block, C_block, lanes);
+        });
+    });
+}
+
+BatchedMatrix BatchedMatMult(const BatchedMatrix& A, const BatchedMatrix& B)
+{
+    BatchedMatrix C(A.BatchSize(), A.NumberOfRows(), B.NumberOfColumns());
+    BatchedGemm(A, B, C);
+    return C;
+}
+
+BatchedLUFactorization::BatchedLUFactorization(const BatchedMatrix& A)
+    : LU_(A), pivots_(static_cast<std::size_t>(A.NumberOfRows()) * A.Stride())
+{
+    const auto n = LU_.NumberOfRows();
+    if (n != LU_.NumberOfColumns())
+    {
+        throw std::invalid_argument("LU factorization requires square matrices.");
+    }
+    SetPaddingLanesToIdentity(LU_);
+
+    const auto stride = LU_.Stride();
+    ForEachLaneBlock(stride, [&](const std::size_t lane_begin, const std::int32_t lanes) {
+        const LaneBlock<double> block{LU_.Data(), n, stride, lane_begin};
+        DispatchOnSize(n, batched::FixedKernelSizes{}, [&](auto size) {
+            LUFactorBlock<decltype(size)::value>(n, block, pivots_.data(), stride, lane_begin, lanes);
+        });
+    });
+}
+
+void BatchedLUFactorization::SolveInPlace(BatchedMatrix& B) const
+{
+    CheckRightHandSides(LU_, B);
+
+    const auto n = LU_.NumberOfRows();
+    const auto number_of_right_hand_sides = B.NumberOfColumns();
+    const auto stride = LU_.Stride();
+    ForEachLaneBlock(stride, [&](const std::size_t lane_begin, const std::int32_t lanes) {
+        const LaneBlock<const double> LU{LU_.Data(), n, stride, lane_begin};
+        const LaneBlock<double> X{B.Data(), number_of_right_hand_sides, stride, lane_begin};
+        DispatchOnSize(n, batched::FixedKernelSizes{}, [&](auto size) {
+            LUSolveBlock<decltype(size)::value>(
+                n, number_of_right_hand_sides, LU, pivots_.data(), X, stride, lane_begin, lanes);
+        });
+    });
+}
+
+BatchedMatrix BatchedLUFactorization::Solve(const BatchedMatrix& B) const
+{
+    auto X = B;
+    SolveInPlace(X);
+    return X;
+}
+
+BatchedCholeskyFactorization::BatchedCholeskyFactorization(const BatchedMatrix& A) : L_(A)
+{
+    const auto n = L_.NumberOfRows();
+    if (n != L_.NumberOfColumns())
+    {
+        throw std::invalid_argument("Cholesky factorization requires square matrices.");
+    }
+    SetPaddingLanesToIdentity(L_);
+
+    const auto stride = L_.Stride();
+    ForEachLaneBlock(stride, [&](const std::size_t lane_begin, const std::int32_t lanes) {
+        const LaneBlock<double> block{L_.Data(), n, stride, lane_begin};
+        DispatchOnSize(n, batched::FixedKernelSizes{}, [&](auto size) {
+            CholeskyFactorBlock<decltype(size)::value>(n, block, lane_begin, lanes);
+        });
+    });
+}
+
+void BatchedCholeskyFactorization::SolveInPlace(BatchedMatrix& B) const
+{
+    CheckRightHandSides(L_, B);
+
+    const auto n = L_.NumberOfRows();
+    const auto number_of_right_hand_sides = B.NumberOfColumns();
+    const auto stride = L_.Stride();
+    ForEachLaneBlock(stride, [&](const std::size_t lane_begin, const std::int32_t lanes) {
+        const LaneBlock<const double> L{L_.Data(), n, stride, lane_begin};
+        const LaneBlock<double> X{B.Data(), number_of_right_hand_sides, stride, lane_begin};
+        DispatchOnSize(n, batched::FixedKernelSizes{}, [&](auto size) {
+            CholeskySolveBlock<decltype(size)::value>(n, number_of_right_hand_sides, L, X, lanes);
+        });
+    });
+}
+
+BatchedMatrix BatchedCholeskyFactorization::Solve(const BatchedMatrix& B) const
+{
+    auto X = B;
+    SolveInPlace(X);
+    return X;
+}
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,197 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Batches of many small, same-sized dense matrices and their GEMM, LU and Cholesky kernels
+ */
+
+#ifndef MATRIX_SOLVERS_BATCHED_BATCHED_MATRIX_H
+#define MATRIX_SOLVERS_BATCHED_BATCHED_MATRIX_H
+
+#include "matrix_solvers/utilities.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace batched
+{
+
+template <std::int32_t... Sizes>
+struct KernelSizes
+{
+};
+
+/// Matrix sizes with a fixed-size kernel, their loops over the entries have compile time bounds that the compiler
+/// unrolls, every other size runs the same kernel with runtime bounds
+using FixedKernelSizes = KernelSizes<2, 3, 4, 5, 6, 8, 12, 16>;
+
+/// Lanes processed together by a kernel, keeps the entries of a block of small matrices in L1 or L2
+constexpr std::int32_t kLaneBlock{32};
+
+}  // namespace batched
+
+/// @brief batch_size matrices of rows x columns, stored as a structure of arrays over the batch
+///
+/// Entry (i, j) of every matrix of the batch is contiguous: matrix b keeps it at Lanes(i, j)[b]. Each kernel
+/// then walks the entries of a single matrix in its usual order and applies every step to all the matrices of the
+/// batch at once, an inner loop over the batch with unit stride that the compiler vectorizes. The lanes of an entry
+/// are padded to a multiple of kLanePadding, so every lane array starts on a kMatrixAlignment boundary, and the
+/// whole batch costs a single allocation. Kernels run over the padding lanes too instead of handling a remainder,
+/// the factorizations fill them with identity matrices.
+class BatchedMatrix
+{
+  public:
+    /// Lanes of an entry are padded to a multiple of this, one cache line of doubles
+    static constexpr std::int32_t kLanePadding{static_cast<std::int32_t>(kMatrixAlignment / sizeof(double))};
+
+    BatchedMatrix() = default;
+
+    /// @brief batch_size zero matrices of rows x columns
+    BatchedMatrix(const std::int32_t batch_size, const std::int32_t rows, const std::int32_t columns);
+
+    /// @brief Gathers the matrices into a batch
+    ///
+    /// @throws std::invalid_argument: when matrices is empty
+    /// @throws std::length_error: when the matrices do not all have the same dimensions
+    explicit BatchedMatrix(const std::vector<Matrix<double>>& matrices);
+
+    std::int32_t BatchSize() const { return batch_size_; }
+    std::int32_t NumberOfRows() const { return m_; }
+    std::int32_t NumberOfColumns() const { return n_; }
+
+    /// @brief Distance between the lane arrays of two consecutive entries, BatchSize() rounded up to kLanePadding
+    std::size_t Stride() const { return stride_; }
+
+    double& operator()(const std::int32_t batch, const std::int32_t i, const std::int32_t j)
+    {
+        return Lanes(i, j)[batch];
+    }
+    const double& operator()(const std::int32_t batch, const std::int32_t i, const std::int32_t j) const
+    {
+        return Lanes(i, j)[batch];
+    }
+
+    /// @brief Entry (i, j) of every matrix in the batch, BatchSize() contiguous values
+    double* Lanes(const std::int32_t i, const std::int32_t j)
+    {
+        return data_.data() + (static_cast<std::size_t>(i) * static_cast<std::size_t>(n_) + j) * stride_;
+    }
+    const double* Lanes(const std::int32_t i, const std::int32_t j) const
+    {
+        return data_.data() + (static_cast<std::size_t>(i) * static_cast<std::size_t>(n_) + j) * stride_;
+    }
+
+    double* Data() { return data_.data(); }
+    const double* Data() const { return data_.data(); }
+
+    /// @brief Copies matrix batch out of the batch
+    Matrix<double> Get(const std::int32_t batch) const;
+
+    /// @brief Overwrites matrix batch of the batch
+    ///
+    /// @throws std::length_error: when matrix does not have the dimensions of the batch
+    void Set(const std::int32_t batch, const Matrix<double>& matrix);
+
+  private:
+    std::int32_t batch_size_{0};
+    std::int32_t m_{0};
+    std::int32_t n_{0};
+    std::size_t stride_{0};
+    Matrix<double>::Storage data_{};
+};
+
+/// @brief Accumulates the product of every pair of matrices in the batches, C_b += A_b * B_b
+///
+/// Square products of one of the batched::FixedKernelSizes run the fixed-size kernel, any other shape the same loops
+/// with runtime bounds. C must not share storage with A or B.
+///
+/// @throws std::length_error: when the batch sizes or the matrix dimensions do not match
+void BatchedGemm(const BatchedMatrix& A, const BatchedMatrix& B, BatchedMatrix& C);
+
+/// @brief Product of every pair of matrices in the batches, C_b = A_b * B_b
+///
+/// @throws std::length_error: when the batch sizes or the matrix dimensions do not match
+BatchedMatrix BatchedMatMult(const BatchedMatrix& A, const BatchedMatrix& B);
+
+/// @brief LU decompositions with partial pivoting, P_b A_b = L_b U_b, of every matrix of a batch
+///
+/// The batched counterpart of LUFactorization: L (unit diagonal, not stored) and U are packed in place of A and each
+/// matrix has its own row interchanges.
+class BatchedLUFactorization
+{
+  public:
+    BatchedLUFactorization() = default;
+
+    /// @throws std::invalid_argument: when the matrices are not square or one of them is singular
+    explicit BatchedLUFactorization(const BatchedMatrix& A);
+
+    std::int32_t BatchSize() const { return LU_.BatchSize(); }
+    std::int32_t NumberOfRows() const { return LU_.NumberOfRows(); }
+
+    /// @brief Strictly lower part of every matrix holds L, upper part holds U
+    const BatchedMatrix& PackedFactors() const { return LU_; }
+
+    /// @brief Row interchanges, at step k row k of matrix b was swapped with row Pivot(b, k) >= k
+    std::int32_t Pivot(const std::int32_t batch, const std::int32_t k) const
+    {
+        return pivots_[static_cast<std::size_t>(k) * LU_.Stride() + static_cast<std::size_t>(batch)];
+    }
+
+    /// @brief Solves A_b X_b = B_b for every matrix of the batch
+    ///
+    /// @throws std::length_error: when B does not have the batch size of A or n rows
+    BatchedMatrix Solve(const BatchedMatrix& B) const;
+
+    /// @brief Overwrites B with the solutions, without allocating
+    ///
+    /// @throws std::length_error: when B does not have the batch size of A or n rows
+    void SolveInPlace(BatchedMatrix& B) const;
+
+  private:
+    BatchedMatrix LU_{};
+    /// Pivot row of every step k and matrix b at k * Stride() + b
+    std::vector<std::int32_t> pivots_{};
+};
+
+/// @brief Cholesky decompositions, A_b = L_b L_b^T, of every symmetric positive definite matrix of a batch
+class BatchedCholeskyFactorization
+{
+  public:
+    BatchedCholeskyFactorization() = default;
+
+    /// @brief Only the lower triangles of the matrices are read
+    ///
+    /// @throws std::invalid_argument: when the matrices are not square or one of them is not positive definite
+    explicit BatchedCholeskyFactorization(const BatchedMatrix& A);
+
+    std::int32_t BatchSize() const { return L_.BatchSize(); }
+    std::int32_t NumberOfRows() const { return L_.NumberOfRows(); }
+
+    /// @brief Lower triangular factors, their strictly upper parts are zero
+    const BatchedMatrix& Factors() const { return L_; }
+
+    /// @brief Solves A_b X_b = B_b for every matrix of the batch
+    ///
+    /// @throws std::length_error: when B does not have the batch size of A or n rows
+    BatchedMatrix Solve(const BatchedMatrix& B) const;
+
+    /// @brief Overwrites B with the solutions, without allocating
+    ///
+    /// @throws std::length_error: when B does not have the batch size of A or n rows
+    void SolveInPlace(BatchedMatrix& B) const;
+
+  private:
+    BatchedMatrix L_{};
+};
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_BATCHED_BATCHED_MATRIX_H
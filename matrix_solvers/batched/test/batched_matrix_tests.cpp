@@ -0,0 +1,271 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/batched/batched_matrix.h"
+#include "matrix_solvers/decomposition_methods/lu_decomposition.h"
+#include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/utilities.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+constexpr double kTolerance{1e-10};
+
+/// Batch size that is not a multiple of the lane padding nor of the lane block, so every remainder path runs
+constexpr std::int32_t kBatchSize{37};
+
+std::vector<Matrix<double>> CreateRandomMatrices(const std::int32_t count,
+                                                 const std::int32_t rows,
+                                                 const std::int32_t columns,
+                                                 const std::uint32_t seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+    std::vector<Matrix<double>> matrices{};
+    for (std::int32_t b{0}; b < count; ++b)
+    {
+        Matrix<double> matrix(rows, columns);
+        for (std::int32_t i{0}; i < rows; ++i)
+        {
+            for (std::int32_t j{0}; j < columns; ++j)
+            {
+                matrix(i, j) = distribution(generator);
+            }
+        }
+        matrices.push_back(matrix);
+    }
+    return matrices;
+}
+
+/// A A^T + n I of random matrices
+std::vector<Matrix<double>> CreateSymmetricPositiveDefiniteMatrices(const std::int32_t count, const std::int32_t size)
+{
+    auto matrices = CreateRandomMatrices(count, size, size, 7U);
+    for (auto& matrix : matrices)
+    {
+        matrix = MatMult(matrix, matrix.Transpose());
+        for (std::int32_t i{0}; i < size; ++i)
+        {
+            matrix(i, i) += static_cast<double>(size);
+        }
+    }
+    return matrices;
+}
+
+void ExpectNearEntries(const Matrix<double>& result, const Matrix<double>& expected)
+{
+    ASSERT_EQ(result.NumberOfRows(), expected.NumberOfRows());
+    ASSERT_EQ(result.NumberOfColumns(), expected.NumberOfColumns());
+    for (std::int32_t i{0}; i < result.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < result.NumberOfColumns(); ++j)
+        {
+            EXPECT_NEAR(result(i, j), expected(i, j), kTolerance) << "entry (" << i << ", " << j << ")";
+        }
+    }
+}
+
+TEST(BatchedMatrixTest, GivenMatrices_ExpectSameMatricesOutOfTheBatch)
+{
+    // Given
+    const auto matrices = CreateRandomMatrices(kBatchSize, 3, 5, 1U);
+
+    // Call
+    const BatchedMatrix batch{matrices};
+
+    // Expect
+    EXPECT_EQ(batch.BatchSize(), kBatchSize);
+    EXPECT_EQ(batch.Stride() % BatchedMatrix::kLanePadding, 0U);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.Lanes(1, 2)) % kMatrixAlignment, 0U);
+    for (std::int32_t b{0}; b < kBatchSize; ++b)
+    {
+        ExpectNearEntries(batch.Get(b), matrices[static_cast<std::size_t>(b)]);
+    }
+}
+
+TEST(BatchedMatrixTest, GivenMatricesOfDifferentSizes_ExpectThrow)
+{
+    // Given
+    const std::vector<Matrix<double>> matrices{Matrix<double>(3, 3), Matrix<double>(3, 4)};
+
+    // Call, Expect
+    EXPECT_THROW(BatchedMatrix{matrices}, std::length_error);
+    EXPECT_THROW(BatchedMatrix{std::vector<Matrix<double>>{}}, std::invalid_argument);
+}
+
+class BatchedGemmTest : public ::testing::TestWithParam<std::int32_t>
+{
+};
+
+TEST_P(BatchedGemmTest, GivenSquareMatrices_ExpectSameProductsAsMatMult)
+{
+    // Given
+    const auto size = GetParam();
+    const auto A = CreateRandomMatrices(kBatchSize, size, size, 2U);
+    const auto B = CreateRandomMatrices(kBatchSize, size, size, 3U);
+
+    // Call
+    const auto C = BatchedMatMult(BatchedMatrix{A}, BatchedMatrix{B});
+
+    // Expect
+    for (std::int32_t b{0}; b < kBatchSize; ++b)
+    {
+        const auto index = static_cast<std::size_t>(b);
+        ExpectNearEntries(C.Get(b), MatMult(A[index], B[index]));
+    }
+}
+
+// 3, 8 and 16 have fixed-size kernels, 7 runs the runtime sized one
+INSTANTIATE_TEST_SUITE_P(FixedAndRuntimeSizes, BatchedGemmTest, ::testing::Values(3, 7, 8, 16));
+
+TEST(BatchedGemmTest, GivenRectangularMatrices_ExpectAccumulatedProducts)
+{
+    // Given
+    const auto A = CreateRandomMatrices(kBatchSize, 3, 5, 4U);
+    const auto B = CreateRandomMatrices(kBatchSize, 5, 2, 5U);
+    const auto C_initial = CreateRandomMatrices(kBatchSize, 3, 2, 6U);
+    BatchedMatrix C{C_initial};
+
+    // Call
+    BatchedGemm(BatchedMatrix{A}, BatchedMatrix{B}, C);
+
+    // Expect
+    for (std::int32_t b{0}; b < kBatchSize; ++b)
+    {
+        const auto index = static_cast<std::size_t>(b);
+        auto expected = MatMult(A[index], B[index]);
+        for (std::int32_t i{0}; i < 3; ++i)
+        {
+            for (std::int32_t j{0}; j < 2; ++j)
+            {
+                expected(i, j) += C_initial[index](i, j);
+            }
+        }
+        ExpectNearEntries(C.Get(b), expected);
+    }
+}
+
+TEST(BatchedGemmTest, GivenMismatchedDimensions_ExpectThrow)
+{
+    // Given
+    const BatchedMatrix A(kBatchSize, 3, 4);
+    const BatchedMatrix B(kBatchSize, 3, 4);
+    const BatchedMatrix B_other_batch(kBatchSize + 1, 4, 4);
+
+    // Call, Expect
+    EXPECT_THROW(BatchedMatMult(A, B), std::length_error);
+    EXPECT_THROW(BatchedMatMult(A, B_other_batch), std::length_error);
+}
+
+class BatchedLUFactorizationTest : public ::testing::TestWithParam<std::int32_t>
+{
+};
+
+TEST_P(BatchedLUFactorizationTest, GivenMatrices_ExpectSameSolutionsAsLUFactorization)
+{
+    // Given
+    const auto size = GetParam();
+    const auto A = CreateRandomMatrices(kBatchSize, size, size, 8U);
+    const auto B = CreateRandomMatrices(kBatchSize, size, 2, 9U);
+
+    // Call
+    const BatchedLUFactorization LU{BatchedMatrix{A}};
+    const auto X = LU.Solve(BatchedMatrix{B});
+
+    // Expect
+    for (std::int32_t b{0}; b < kBatchSize; ++b)
+    {
+        const auto index = static_cast<std::size_t>(b);
+        const LUFactorization expected{A[index]};
+        ExpectNearEntries(X.Get(b), expected.Solve(B[index]));
+        for (std::int32_t k{0}; k < size; ++k)
+        {
+            EXPECT_EQ(LU.Pivot(b, k), expected.Pivots()[static_cast<std::size_t>(k)]);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(FixedAndRuntimeSizes, BatchedLUFactorizationTest, ::testing::Values(2, 5, 7, 12));
+
+TEST(BatchedLUFactorizationTest, GivenOneSingularMatrix_ExpectThrowNamingIt)
+{
+    // Given
+    auto A = CreateRandomMatrices(kBatchSize, 4, 4, 10U);
+    A[33] = Matrix<double>{{1.0, 2.0, 0.0, 0.0}, {2.0, 4.0, 0.0, 0.0}, {0.0, 0.0, 1.0, 0.0}, {0.0, 0.0, 0.0, 1.0}};
+
+    // Call, Expect
+    try
+    {
+        const BatchedLUFactorization LU{BatchedMatrix{A}};
+        FAIL() << "Expected std::invalid_argument";
+    }
+    catch (const std::invalid_argument& error)
+    {
+        EXPECT_STREQ(error.what(), "Matrix 33 of the batch is singular.");
+    }
+}
+
+class BatchedCholeskyFactorizationTest : public ::testing::TestWithParam<std::int32_t>
+{
+};
+
+TEST_P(BatchedCholeskyFactorizationTest, GivenSymmetricPositiveDefiniteMatrices_ExpectSameFactorsAndSolutions)
+{
+    // Given
+    const auto size = GetParam();
+    const auto A = CreateSymmetricPositiveDefiniteMatrices(kBatchSize, size);
+    const auto B = CreateRandomMatrices(kBatchSize, size, 1, 11U);
+
+    // Call
+    const BatchedCholeskyFactorization cholesky{BatchedMatrix{A}};
+    const auto X = cholesky.Solve(BatchedMatrix{B});
+
+    // Expect
+    for (std::int32_t b{0}; b < kBatchSize; ++b)
+    {
+        const auto index = static_cast<std::size_t>(b);
+        ExpectNearEntries(cholesky.Factors().Get(b), CholeskyDecomposition(A[index]));
+        ExpectNearEntries(MatMult(A[index], X.Get(b)), B[index]);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(FixedAndRuntimeSizes, BatchedCholeskyFactorizationTest, ::testing::Values(3, 6, 9, 16));
+
+TEST(BatchedCholeskyFactorizationTest, GivenIndefiniteMatrix_ExpectThrow)
+{
+    // Given
+    auto A = CreateSymmetricPositiveDefiniteMatrices(kBatchSize, 3);
+    A[2] = Matrix<double>{{1.0, 2.0, 0.0}, {2.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+
+    // Call, Expect
+    EXPECT_THROW(BatchedCholeskyFactorization{BatchedMatrix{A}}, std::invalid_argument);
+}
+
+TEST(BatchedCholeskyFactorizationTest, GivenRightHandSidesOfOtherBatchSize_ExpectThrow)
+{
+    // Given
+    const BatchedCholeskyFactorization cholesky{BatchedMatrix{CreateSymmetricPositiveDefiniteMatrices(4, 3)}};
+    BatchedMatrix B(5, 3, 1);
+
+    // Call, Expect
+    EXPECT_THROW(cholesky.SolveInPlace(B), std::length_error);
+}
+
+}  // namespace
+
+}  // namespace matrix
+
+}  // namespace nm
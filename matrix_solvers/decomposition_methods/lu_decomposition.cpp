@@ -6,8 +6,12 @@
  */
 
 #include "matrix_solvers/decomposition_methods/lu_decomposition.h"
+#include "matrix_solvers/operations/gemm.h"
+#include "matrix_solvers/operations/vector_kernels.h"
 #include "matrix_solvers/utilities.h"
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <stdexcept>
 
@@ -25,7 +29,7 @@ std::pair<Matrix<double>, Matrix<double>> Doolittle(const Matrix<double>& A)
     double templ{};
     double sumu{};
     double suml{};
-    const auto m = static_cast<std::int32_t>(A.size());
+    const auto m = A.NumberOfRows();
 
     /* Set Identity Matrix */
     auto L = CreateIdentityMatrix<double>(m);
@@ -41,11 +45,11 @@ std::pair<Matrix<double>, Matrix<double>> Doolittle(const Matrix<double>& A)
             sumu = 0.0;
             for (std::int32_t j = 0; j < k; ++j)
             {
-                tempu = L.at(k).at(j) * U.at(j).at(q);
+                tempu = L(k, j) * U(j, q);
                 sumu = sumu + tempu;
             }
 
-            U.at(k).at(q) = A.at(k).at(q) - sumu;
+            U(k, q) = A(k, q) - sumu;
         }
 
         // Lower Triangular Matrix
@@ -55,11 +59,11 @@ std::pair<Matrix<double>, Matrix<double>> Doolittle(const Matrix<double>& A)
             suml = 0.0;
             for (std::int32_t j = 0; j < k; ++j)
             {
-                templ = L.at(i).at(j) * U.at(j).at(k);
+                templ = L(i, j) * U(j, k);
                 suml = suml + templ;
             }
 
-            L.at(i).at(k) = (A.at(i).at(k) - suml) / U.at(k).at(k);
+            L(i, k) = (A(i, k) - suml) / U(k, k);
         }
     }
 
@@ -68,7 +72,7 @@ std::pair<Matrix<double>, Matrix<double>> Doolittle(const Matrix<double>& A)
 
 Matrix<double> CholeskyDecomposition(const Matrix<double>& A)
 {
-    const std::int32_t n = static_cast<std::int32_t>(A.size());
+    const std::int32_t n = A.NumberOfRows();
     Matrix<double> G{A};
     double sum{0.0};
     for (std::int32_t j{0}; j < n; ++j)
@@ -77,28 +81,28 @@ Matrix<double> CholeskyDecomposition(const Matrix<double>& A)
         {
             if (i < j)
             {
-                G.at(i).at(j) = 0;
+                G(i, j) = 0;
                 continue;
             }
 
             sum = 0.0;
             for (std::int32_t k{0}; k < j; ++k)
             {
-                sum += G.at(i).at(k) * G.at(j).at(k);
+                sum += G(i, k) * G(j, k);
             }
 
-            if ((A.at(i).at(i) - sum) < 0)
+            if ((A(i, i) - sum) < 0)
             {
                 throw std::invalid_argument("Matrix A is not positive definite!");
             }
 
             if (i == j)
             {
-                G.at(i).at(j) = std::sqrt(A.at(j).at(j) - sum);
+                G(i, j) = std::sqrt(A(j, j) - sum);
             }
             else
             {
-                G.at(i).at(j) = 1 / G.at(j).at(j) * (A.at(i).at(j) - sum);
+                G(i, j) = 1 / G(j, j) * (A(i, j) - sum);
             }
         }
     }
@@ -106,6 +110,201 @@ Matrix<double> CholeskyDecomposition(const Matrix<double>& A)
     return G;
 }
 
+template <typename T>
+BasicLUFactorization<T>::BasicLUFactorization(const Matrix<T>& A) : LU_(A), pivots_(A.size())
+{
+    const auto n = LU_.NumberOfRows();
+    if (n != LU_.NumberOfColumns())
+    {
+        throw std::invalid_argument("LU factorization requires a square matrix.");
+    }
+
+    // Right looking blocked factorization, each step factors a narrow panel with vector operations and pushes the
+    // bulk of the O(n^3) work into a single GEMM on the trailing matrix
+    for (std::int32_t k0{0}; k0 < n; k0 += kPanelWidth)
+    {
+        const auto panel_width = std::min(kPanelWidth, n - k0);
+        FactorPanel(k0, panel_width);
+        UpdateTrailingMatrix(k0, panel_width);
+    }
+}
+
+template <typename T>
+void BasicLUFactorization<T>::FactorPanel(const std::int32_t k0, const std::int32_t panel_width)
+{
+    const auto n = NumberOfRows();
+    const auto panel_end = k0 + panel_width;
+    for (auto k = k0; k < panel_end; ++k)
+    {
+        // Partial pivoting, bring the largest entry of column k on or below the diagonal to the pivot position
+        auto pivot_row = k;
+        for (auto i = k + 1; i < n; ++i)
+        {
+            if (std::abs(LU_(i, k)) > std::abs(LU_(pivot_row, k)))
+            {
+                pivot_row = i;
+            }
+        }
+        if (LU_(pivot_row, k) == T{0})
+        {
+            throw std::invalid_argument("Matrix is singular.");
+        }
+        pivots_[static_cast<std::size_t>(k)] = pivot_row;
+        if (pivot_row != k)
+        {
+            std::swap_ranges(LU_.Row(k).begin(), LU_.Row(k).end(), LU_.Row(pivot_row).begin());
+        }
+
+        // Eliminate below the pivot, only the columns of the panel, the rest is deferred to the blocked update
+        const T* pivot_row_data = LU_.Data() + static_cast<std::size_t>(k) * n;
+        const auto panel_tail_size = static_cast<std::size_t>(panel_end - k - 1);
+        for (auto i = k + 1; i < n; ++i)
+        {
+            T* row_data = LU_.Data() + static_cast<std::size_t>(i) * n;
+            const auto factor = row_data[k] / pivot_row_data[k];
+            row_data[k] = factor;
+            if (factor != T{0})
+            {
+                kernels::Axpy(-factor, pivot_row_data + k + 1, row_data + k + 1, panel_tail_size);
+            }
+        }
+    }
+}
+
+template <typename T>
+void BasicLUFactorization<T>::UpdateTrailingMatrix(const std::int32_t k0, const std::int32_t panel_width)
+{
+    const auto n = NumberOfRows();
+    const auto k1 = k0 + panel_width;
+    if (k1 >= n)
+    {
+        return;
+    }
+    const auto trailing_size = n - k1;
+    const auto row = [this, n](const std::int32_t i) { return LU_.Data() + static_cast<std::size_t>(i) * n; };
+
+    // U12 = inverse(L11) * A12, forward substitution with the unit lower triangle of the panel
+    for (auto k = k0; k < k1; ++k)
+    {
+        for (auto i = k + 1; i < k1; ++i)
+        {
+            const auto l_ik = row(i)[k];
+            if (l_ik != T{0})
+            {
+                kernels::Axpy(-l_ik, row(k) + k1, row(i) + k1, static_cast<std::size_t>(trailing_size));
+            }
+        }
+    }
+
+    // A22 -= L21 * U12, the GEMM kernel only accumulates so L21 is negated into a contiguous buffer first
+    std::vector<T> negative_L21(static_cast<std::size_t>(trailing_size) * static_cast<std::size_t>(panel_width));
+    for (std::int32_t i{0}; i < trailing_size; ++i)
+    {
+        kernels::Scale(T{-1},
+                       row(k1 + i) + k0,
+                       negative_L21.data() + static_cast<std::size_t>(i) * static_cast<std::size_t>(panel_width),
+                       static_cast<std::size_t>(panel_width));
+    }
+    Gemm(trailing_size, trailing_size, panel_width, negative_L21.data(), panel_width, row(k0) + k1, n, row(k1) + k1, n);
+}
+
+template <typename T>
+void BasicLUFactorization<T>::SolveInPlace(std::vector<T>& b) const
+{
+    const auto n = NumberOfRows();
+    if (b.size() != static_cast<std::size_t>(n))
+    {
+        throw std::length_error("LU factorization and right hand side dimensions do not match.");
+    }
+
+    for (std::int32_t k{0}; k < n; ++k)
+    {
+        std::swap(b[static_cast<std::size_t>(k)], b[static_cast<std::size_t>(pivots_[static_cast<std::size_t>(k)])]);
+    }
+
+    // Forward substitution with the unit lower triangular L
+    for (std::int32_t i{1}; i < n; ++i)
+    {
+        const T* row_data = LU_.Data() + static_cast<std::size_t>(i) * n;
+        b[static_cast<std::size_t>(i)] -= kernels::Dot(row_data, b.data(), static_cast<std::size_t>(i));
+    }
+
+    // Backwards substitution with U
+    for (auto i = n - 1; i >= 0; --i)
+    {
+        const T* row_data = LU_.Data() + static_cast<std::size_t>(i) * n;
+        const auto tail_size = static_cast<std::size_t>(n - i - 1);
+        const auto sum = kernels::Dot(row_data + i + 1, b.data() + i + 1, tail_size);
+        b[static_cast<std::size_t>(i)] = (b[static_cast<std::size_t>(i)] - sum) / row_data[i];
+    }
+}
+
+template <typename T>
+std::vector<T> BasicLUFactorization<T>::Solve(const std::vector<T>& b) const
+{
+    auto x = b;
+    SolveInPlace(x);
+    return x;
+}
+
+template <typename T>
+Matrix<T> BasicLUFactorization<T>::Solve(const Matrix<T>& B) const
+{
+    const auto n = NumberOfRows();
+    if (B.NumberOfRows() != n)
+    {
+        throw std::length_error("LU factorization and right hand side dimensions do not match.");
+    }
+
+    // All right hand sides advance together, so every update is a contiguous axpy over a row of X
+    auto X = B;
+    const auto k = static_cast<std::size_t>(X.NumberOfColumns());
+    const auto row = [&X, k](const std::int32_t i) { return X.Data() + static_cast<std::size_t>(i) * k; };
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        const auto pivot_row = pivots_[static_cast<std::size_t>(i)];
+        if (pivot_row != i)
+        {
+            std::swap_ranges(row(i), row(i) + k, row(pivot_row));
+        }
+    }
+
+    for (std::int32_t i{1}; i < n; ++i)
+    {
+        for (std::int32_t j{0}; j < i; ++j)
+        {
+            const auto l_ij = LU_(i, j);
+            if (l_ij != T{0})
+            {
+                kernels::Axpy(-l_ij, row(j), row(i), k);
+            }
+        }
+    }
+
+    for (auto i = n - 1; i >= 0; --i)
+    {
+        for (auto j = i + 1; j < n; ++j)
+        {
+            const auto u_ij = LU_(i, j);
+            if (u_ij != T{0})
+            {
+                kernels::Axpy(-u_ij, row(j), row(i), k);
+            }
+        }
+        kernels::Scale(T{1} / LU_(i, i), row(i), row(i), k);
+    }
+    return X;
+}
+
+template <typename T>
+Matrix<T> BasicLUFactorization<T>::Inverse() const
+{
+    return Solve(CreateIdentityMatrix<T>(NumberOfRows()));
+}
+
+template class BasicLUFactorization<float>;
+template class BasicLUFactorization<double>;
+
 }  // namespace matrix
 
 }  // namespace nm
@@ -9,7 +9,9 @@
 #define MATRIX_SOLVERS_DECOMPOSITION_METHODS_LU_DECOMPOSITION_H
 
 #include "matrix_solvers/utilities.h"
+#include <cstdint>
 #include <utility>
+#include <vector>
 
 namespace nm
 {
@@ -17,9 +19,71 @@ namespace nm
 namespace matrix
 {
 
+/// @brief Unpivoted LU decomposition returning separate L and U, fails on a zero pivot, see LUFactorization
 std::pair<Matrix<double>, Matrix<double>> Doolittle(const Matrix<double>& A);
 Matrix<double> CholeskyDecomposition(const Matrix<double>& A);
 
+/// @brief LU decomposition with partial pivoting, PA = LU, kept for reuse across solves
+///
+/// Factoring costs O(n^3) once, every later solve with the same matrix costs O(n^2). L (unit diagonal, not stored)
+/// and U are packed into a single n x n matrix. The factorization is blocked: panels of kPanelWidth columns are
+/// factored with pivoting and the trailing matrix is updated with the cache blocked GEMM kernel, so that unlike
+/// Doolittle most of the work runs at matrix-matrix rather than memory bandwidth speed.
+///
+/// @param T: template-parameter-typename, float or double. A float factorization moves half the bytes and fits
+/// twice the entries per vector register, MixedPrecisionLUSolve recovers double accuracy from it.
+template <typename T>
+class BasicLUFactorization
+{
+  public:
+    BasicLUFactorization() = default;
+
+    /// @throws std::invalid_argument: when A is not square or is singular
+    explicit BasicLUFactorization(const Matrix<T>& A);
+
+    std::int32_t NumberOfRows() const { return LU_.NumberOfRows(); }
+
+    /// @brief Strictly lower part holds L, upper part holds U
+    const Matrix<T>& PackedFactors() const { return LU_; }
+
+    /// @brief Row interchanges, at step k row k was swapped with row Pivots()[k] >= k
+    const std::vector<std::int32_t>& Pivots() const { return pivots_; }
+
+    /// @throws std::length_error: when b does not have n entries
+    std::vector<T> Solve(const std::vector<T>& b) const;
+
+    /// @brief Overwrites b with the solution, without allocating
+    ///
+    /// @throws std::length_error: when b does not have n entries
+    void SolveInPlace(std::vector<T>& b) const;
+
+    /// @brief Solves AX = B for all the columns of B at once
+    ///
+    /// @throws std::length_error: when B does not have n rows
+    Matrix<T> Solve(const Matrix<T>& B) const;
+
+    Matrix<T> Inverse() const;
+
+    /// Number of columns factored per panel before the blocked trailing update
+    static constexpr std::int32_t kPanelWidth{64};
+
+  private:
+    /// @brief Pivoted elimination of columns [k0, k0 + panel_width), rows swaps span the whole matrix
+    void FactorPanel(const std::int32_t k0, const std::int32_t panel_width);
+
+    /// @brief Computes the U block right of the panel and applies the panel to the trailing matrix
+    void UpdateTrailingMatrix(const std::int32_t k0, const std::int32_t panel_width);
+
+    Matrix<T> LU_{};
+    std::vector<std::int32_t> pivots_{};
+};
+
+extern template class BasicLUFactorization<float>;
+extern template class BasicLUFactorization<double>;
+
+/// @brief The double precision factorization the solvers use
+using LUFactorization = BasicLUFactorization<double>;
+
 }  // namespace matrix
 
 }  // namespace nm
@@ -9,8 +9,12 @@
 #include "matrix_solvers/decomposition_methods/qr_decomposition.h"
 #include "matrix_solvers/utilities.h"
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <random>
 #include <stdexcept>
+#include <vector>
 
 namespace nm
 {
@@ -204,6 +208,121 @@ TEST(CholeskyDecompositionTests, GivenNonPositiveDefiniteMatrix_ExpectThrow)
     EXPECT_THROW(CholeskyDecomposition(A), std::invalid_argument);
 }
 
+class LUFactorizationTestFixture : public ::testing::Test
+{
+  public:
+    // Zero leading entry, so the factorization only exists with row interchanges
+    Matrix<double> A_{{0.0, 2.0, 1.0}, {1.0, 1.0, 0.0}, {3.0, 0.0, 1.0}};
+    double tolerance_{1e-12};
+};
+
+TEST_F(LUFactorizationTestFixture, GivenMatrixNeedingPivoting_ExpectExactSolution)
+{
+    // Given
+    const LUFactorization LU{A_};
+
+    // Call
+    const auto x = LU.Solve(std::vector<double>{5.0, 3.0, 4.0});
+
+    // Expect
+    EXPECT_NEAR(x[0], 1.0, tolerance_);
+    EXPECT_NEAR(x[1], 2.0, tolerance_);
+    EXPECT_NEAR(x[2], 1.0, tolerance_);
+    EXPECT_EQ(LU.Pivots().front(), 2);
+}
+
+TEST_F(LUFactorizationTestFixture, GivenSeveralRightHandSides_ExpectSameAsSolvingEachColumn)
+{
+    // Given
+    const LUFactorization LU{A_};
+    const Matrix<double> B{{1.0, -2.0}, {0.5, 4.0}, {3.0, 0.0}};
+
+    // Call
+    const auto X = LU.Solve(B);
+    const auto A_inverse = LU.Inverse();
+
+    // Expect
+    for (std::int32_t j{0}; j < B.NumberOfColumns(); ++j)
+    {
+        const auto x = LU.Solve(std::vector<double>(B.Column(j)));
+        for (std::int32_t i{0}; i < B.NumberOfRows(); ++i)
+        {
+            EXPECT_NEAR(X(i, j), x[static_cast<std::size_t>(i)], tolerance_);
+        }
+    }
+    for (std::int32_t i{0}; i < A_.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < A_.NumberOfColumns(); ++j)
+        {
+            double sum{0.0};
+            for (std::int32_t k{0}; k < A_.NumberOfColumns(); ++k)
+            {
+                sum += A_(i, k) * A_inverse(k, j);
+            }
+            EXPECT_NEAR(sum, (i == j) ? 1.0 : 0.0, tolerance_);
+        }
+    }
+}
+
+TEST_F(LUFactorizationTestFixture, GivenMatrixLargerThanPanel_ExpectSmallResidual)
+{
+    // Given
+    const std::int32_t n{3 * LUFactorization::kPanelWidth + 5};
+    std::mt19937 generator{7};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+    Matrix<double> A(n, n);
+    std::vector<double> b(static_cast<std::size_t>(n));
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        for (std::int32_t j{0}; j < n; ++j)
+        {
+            A(i, j) = distribution(generator);
+        }
+        b[static_cast<std::size_t>(i)] = distribution(generator);
+    }
+
+    // Call
+    const auto x = LUFactorization{A}.Solve(b);
+
+    // Expect
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        double Ax_i{0.0};
+        for (std::int32_t j{0}; j < n; ++j)
+        {
+            Ax_i += A(i, j) * x[static_cast<std::size_t>(j)];
+        }
+        EXPECT_NEAR(Ax_i, b[static_cast<std::size_t>(i)], 1e-9) << "row " << i;
+    }
+}
+
+TEST_F(LUFactorizationTestFixture, GivenSinglePrecisionMatrix_ExpectSolutionToSinglePrecision)
+{
+    // Given
+    const Matrix<float> A{{0.0F, 2.0F, 1.0F}, {1.0F, 1.0F, 0.0F}, {3.0F, 0.0F, 1.0F}};
+
+    // Call
+    const BasicLUFactorization<float> LU{A};
+    const auto x = LU.Solve(std::vector<float>{5.0F, 3.0F, 4.0F});
+
+    // Expect
+    EXPECT_NEAR(x[0], 1.0F, 1e-6F);
+    EXPECT_NEAR(x[1], 2.0F, 1e-6F);
+    EXPECT_NEAR(x[2], 1.0F, 1e-6F);
+    EXPECT_EQ(LU.Pivots().front(), 2);
+}
+
+TEST_F(LUFactorizationTestFixture, GivenInvalidSystem_ExpectThrow)
+{
+    // Given
+    const Matrix<double> singular{{1.0, 2.0}, {2.0, 4.0}};
+    const LUFactorization LU{A_};
+
+    // Call and Expect
+    EXPECT_THROW(LUFactorization{singular}, std::invalid_argument);
+    EXPECT_THROW(LU.Solve(std::vector<double>{1.0, 2.0}), std::length_error);
+}
+
 }  // namespace
 }  // namespace matrix
 }  // namespace nm
@@ -26,7 +26,7 @@ std::vector<double> BackwardsSubstitution(const Matrix<double>& A, const std::ve
 {
     const auto n = static_cast<int>(b.size() - 1);
     std::vector<double> x(n + 1, 0.0);
-    x.at(n) = b.at(n) / A.at(n).at(n);
+    x.at(n) = b.at(n) / A(n, n);
 
     double sum{};
     for (std::int32_t i = n - 1; i > -1; --i)
@@ -34,9 +34,9 @@ std::vector<double> BackwardsSubstitution(const Matrix<double>& A, const std::ve
         sum = 0.0;
         for (std::int32_t j = i + 1; j < n + 1; ++j)
         {
-            sum += A.at(i).at(j) * x.at(j);
+            sum += A(i, j) * x.at(j);
         }
-        x.at(i) = (b.at(i) - sum) / A.at(i).at(i);
+        x.at(i) = (b.at(i) - sum) / A(i, i);
     }
 
     return x;
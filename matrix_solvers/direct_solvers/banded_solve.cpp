@@ -0,0 +1,120 @@
+/*
+ * Direct Solution to Banded Linear Systems
+ *
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/direct_solvers/banded_solve.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+std::vector<double> ThomasSolve(const TridiagonalMatrix& A, const std::vector<double>& b)
+{
+    const auto n = static_cast<std::size_t>(A.NumberOfRows());
+    if (b.size() != n)
+    {
+        throw std::length_error("Tridiagonal matrix and right hand side dimensions do not match.");
+    }
+    if (n == 0)
+    {
+        return {};
+    }
+
+    const auto& lower = A.Lower();
+    const auto& diagonal = A.Diagonal();
+    const auto& upper = A.Upper();
+
+    // Forward sweep, upper_prime holds the eliminated super-diagonal and x the eliminated right hand side
+    std::vector<double> upper_prime(n - 1);
+    std::vector<double> x(n);
+    auto pivot = diagonal[0];
+    for (std::size_t i{0}; i < n; ++i)
+    {
+        if (i > 0)
+        {
+            pivot = diagonal[i] - lower[i - 1] * upper_prime[i - 1];
+        }
+        if (pivot == 0.0)
+        {
+            throw std::invalid_argument("Thomas algorithm encountered a zero pivot.");
+        }
+        if (i + 1 < n)
+        {
+            upper_prime[i] = upper[i] / pivot;
+        }
+        x[i] = (i > 0) ? (b[i] - lower[i - 1] * x[i - 1]) / pivot : b[i] / pivot;
+    }
+
+    // Backward substitution
+    for (auto i = n - 1; i > 0; --i)
+    {
+        x[i - 1] -= upper_prime[i - 1] * x[i];
+    }
+    return x;
+}
+
+std::vector<double> BandedLUSolve(const BandedMatrix& A, const std::vector<double>& b)
+{
+    const auto n = A.NumberOfRows();
+    if (b.size() != static_cast<std::size_t>(n))
+    {
+        throw std::length_error("Banded matrix and right hand side dimensions do not match.");
+    }
+
+    const auto bandwidth = A.GetBandwidth();
+    auto LU = A;
+    auto x = b;
+
+    // Without row exchanges, fill in stays within the band, so L and U overwrite the copy of A
+    for (std::int32_t k{0}; k < n; ++k)
+    {
+        const auto pivot = LU(k, k);
+        if (pivot == 0.0)
+        {
+            throw std::invalid_argument("Banded LU decomposition encountered a zero pivot.");
+        }
+
+        const auto last_row = std::min(n - 1, k + bandwidth.lower);
+        const auto last_column = std::min(n - 1, k + bandwidth.upper);
+        for (auto i = k + 1; i <= last_row; ++i)
+        {
+            const auto factor = LU(i, k) / pivot;
+            if (factor == 0.0)
+            {
+                continue;
+            }
+            LU(i, k) = factor;
+            for (auto j = k + 1; j <= last_column; ++j)
+            {
+                LU(i, j) -= factor * LU(k, j);
+            }
+            x[static_cast<std::size_t>(i)] -= factor * x[static_cast<std::size_t>(k)];
+        }
+    }
+
+    // Backwards substitution with U
+    for (auto i = n - 1; i >= 0; --i)
+    {
+        const auto last_column = std::min(n - 1, i + bandwidth.upper);
+        auto sum = x[static_cast<std::size_t>(i)];
+        for (auto j = i + 1; j <= last_column; ++j)
+        {
+            sum -= LU(i, j) * x[static_cast<std::size_t>(j)];
+        }
+        x[static_cast<std::size_t>(i)] = sum / LU(i, i);
+    }
+    return x;
+}
+
+}  // namespace matrix
+
+}  // namespace nm
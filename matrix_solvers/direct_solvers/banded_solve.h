@@ -0,0 +1,46 @@
+/*
+ * Direct Solution to Banded Linear Systems
+ *
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#ifndef MATRIX_SOLVERS_DIRECT_SOLVERS_BANDED_SOLVE_H
+#define MATRIX_SOLVERS_DIRECT_SOLVERS_BANDED_SOLVE_H
+
+#include "matrix_solvers/banded/banded_matrix.h"
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief This function performs the Thomas algorithm to solve the matrix equation Ax = b in O(n)
+///
+/// NOTE: No pivoting is performed, which is stable for diagonally dominant or symmetric positive definite A
+///
+/// @param A: The tridiagonal matrix (square n x n)
+/// @param b: The right hand side of the matrix equation (column n x 1)
+/// @throws std::length_error: when b does not have n entries
+/// @throws std::invalid_argument: when a zero pivot is encountered
+std::vector<double> ThomasSolve(const TridiagonalMatrix& A, const std::vector<double>& b);
+
+/// @brief This function performs a Doolittle LU decomposition restricted to the band of A to solve the matrix
+/// equation Ax = b in O(n * lower * upper)
+///
+/// NOTE: No pivoting is performed so that the factors keep the band of A, which is stable for diagonally dominant or
+/// symmetric positive definite A
+///
+/// @param A: The banded matrix (square n x n)
+/// @param b: The right hand side of the matrix equation (column n x 1)
+/// @throws std::length_error: when b does not have n entries
+/// @throws std::invalid_argument: when a zero pivot is encountered
+std::vector<double> BandedLUSolve(const BandedMatrix& A, const std::vector<double>& b);
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_DIRECT_SOLVERS_BANDED_SOLVE_H
@@ -20,17 +20,17 @@ std::vector<double> ForwardSubstitution(const Matrix<double>& A, const std::vect
     std::vector<double> x{b};
 
     /* Main Algorithm */
-    x.at(0) = b.at(0) / A.at(0).at(0);
+    x.at(0) = b.at(0) / A(0, 0);
     const auto n = static_cast<std::int32_t>(b.size());
     for (std::int32_t i = 1; i < n; ++i)
     {
         sum = 0.0;
         for (std::int32_t j = 0; j < i; ++j)
         {
-            sum += A.at(i).at(j) * x.at(j);
+            sum += A(i, j) * x.at(j);
         }
 
-        x.at(i) = (b[i] - sum) / A.at(i).at(i);
+        x.at(i) = (b[i] - sum) / A(i, i);
     }
 
     return x;
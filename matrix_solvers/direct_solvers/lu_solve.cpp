@@ -18,10 +18,12 @@ namespace matrix
 
 std::vector<double> LUSolve(const Matrix<double>& A, const std::vector<double>& b)
 {
-    const auto LU_matrices = Doolittle(A);
-    const auto y = ForwardSubstitution(LU_matrices.first, b);
-    const auto x = BackwardsSubstitution(LU_matrices.second, y);
-    return x;
+    return LUFactorization{A}.Solve(b);
+}
+
+std::vector<float> LUSolve(const Matrix<float>& A, const std::vector<float>& b)
+{
+    return BasicLUFactorization<float>{A}.Solve(b);
 }
 
 std::vector<double> LUSolveCholesky(const Matrix<double>& A, const std::vector<double>& b)
@@ -17,13 +17,19 @@ namespace nm
 namespace matrix
 {
 
-/// @brief This function performs a Doolittle LU decomposition to solve
+/// @brief This function performs an LU decomposition with partial pivoting to solve
 /// the matrix equation Ax = b
 ///
+/// NOTE: Solving several systems with the same A should factor it once with LUFactorization
+///
 /// @param A: The lower triangular matrix (square n x n)
 /// @param b: The right hand side of the matrix equation (column n x 1)
 std::vector<double> LUSolve(const Matrix<double>& A, const std::vector<double>& b);
 
+/// @brief Single precision LUSolve, accurate to about 1e-7 * cond(A). MixedPrecisionLUSolve refines its solution to
+/// double accuracy.
+std::vector<float> LUSolve(const Matrix<float>& A, const std::vector<float>& b);
+
 /// @brief This function performs a Cholesky LU decomposition to solve
 /// the matrix equation Ax = b
 ///
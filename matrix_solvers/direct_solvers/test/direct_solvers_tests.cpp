@@ -3,13 +3,18 @@
  * Project: Backwards Substitution - main unit tests
  */
 
+#include "matrix_solvers/banded/banded_matrix.h"
 #include "matrix_solvers/direct_solvers/backwards_substitution.h"
+#include "matrix_solvers/direct_solvers/banded_solve.h"
 #include "matrix_solvers/direct_solvers/forward_substitution.h"
 #include "matrix_solvers/direct_solvers/lu_solve.h"
 #include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
 #include "matrix_solvers/utilities.h"
+#include <cstddef>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <stdexcept>
 #include <vector>
 
 namespace nm
@@ -180,6 +185,90 @@ TEST(MatrixEquationTests, GivenSqaureMatrices_ExpectCorrectResult)
     EXPECT_NEAR(result.at(3), 0.2393, tolerance);
 }
 
+class BandedSolveTestFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        // Diagonally dominant, non symmetric matrix with two sub- and one super-diagonal
+        CooMatrix coo(number_of_nodes_, number_of_nodes_);
+        for (std::int32_t i{0}; i < number_of_nodes_; ++i)
+        {
+            coo.Add(i, i, 6.0 + 0.1 * i);
+            if (i > 0)
+            {
+                coo.Add(i, i - 1, -1.5);
+            }
+            if (i > 1)
+            {
+                coo.Add(i, i - 2, 0.5);
+            }
+            if (i < number_of_nodes_ - 1)
+            {
+                coo.Add(i, i + 1, -2.0);
+            }
+            b_.push_back(static_cast<double>((i * 3) % 5) - 2.0);
+        }
+        A_ = CsrMatrix{coo};
+    }
+
+    void ExpectSameAsLUSolve(const std::vector<double>& x, const Matrix<double>& A)
+    {
+        const auto x_expected = LUSolve(A, b_);
+        ASSERT_EQ(x.size(), x_expected.size());
+        for (std::size_t i{0}; i < x.size(); ++i)
+        {
+            EXPECT_NEAR(x[i], x_expected[i], tolerance_) << "row " << i;
+        }
+    }
+
+  public:
+    std::int32_t number_of_nodes_{12};
+    CsrMatrix A_{};
+    std::vector<double> b_{};
+    double tolerance_{1e-10};
+};
+
+TEST_F(BandedSolveTestFixture, GivenBandedMatrix_ExpectSameSolutionAsLUSolve)
+{
+    // Given
+    const BandedMatrix A_banded{A_};
+
+    // Call
+    const auto x = BandedLUSolve(A_banded, b_);
+
+    // Expect
+    ExpectSameAsLUSolve(x, A_.ToDense());
+}
+
+TEST_F(BandedSolveTestFixture, GivenTridiagonalMatrix_ExpectSameSolutionAsLUSolve)
+{
+    // Given
+    std::vector<double> lower(static_cast<std::size_t>(number_of_nodes_) - 1, -1.0);
+    std::vector<double> diagonal(static_cast<std::size_t>(number_of_nodes_), 4.0);
+    std::vector<double> upper(static_cast<std::size_t>(number_of_nodes_) - 1, -2.0);
+    const TridiagonalMatrix A_tridiagonal{lower, diagonal, upper};
+
+    // Call
+    const auto x = ThomasSolve(A_tridiagonal, b_);
+
+    // Expect
+    ExpectSameAsLUSolve(x, A_tridiagonal.ToDense());
+    ExpectSameAsLUSolve(BandedLUSolve(BandedMatrix{CsrMatrix{A_tridiagonal.ToDense()}}, b_), A_tridiagonal.ToDense());
+}
+
+TEST_F(BandedSolveTestFixture, GivenInvalidSystem_ExpectException)
+{
+    // Given
+    const TridiagonalMatrix singular{{1.0}, {0.0, 1.0}, {1.0}};
+    const BandedMatrix A_banded{A_};
+    b_.pop_back();
+
+    // Call & Expect
+    EXPECT_THROW(ThomasSolve(singular, {1.0, 1.0}), std::invalid_argument);
+    EXPECT_THROW(BandedLUSolve(A_banded, b_), std::length_error);
+}
+
 }  // namespace
 
 }  // namespace matrix
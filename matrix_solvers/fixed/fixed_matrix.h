@@ -0,0 +1,338 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Dense matrices and vectors whose dimensions are known at compile time, stored on the stack
+ */
+
+#ifndef MATRIX_SOLVERS_FIXED_FIXED_MATRIX_H
+#define MATRIX_SOLVERS_FIXED_FIXED_MATRIX_H
+
+#include "matrix_solvers/utilities.h"
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief M x N matrix with row-major storage inside the object, no heap allocation
+///
+/// Every loop of the operations below has compile time bounds, so for the small sizes this type is meant for the
+/// compiler unrolls them completely and keeps the entries in registers. The element type only needs +, -, * and / and
+/// a value initialized zero, so e.g. calculus::DualNumber entries work with everything except LUSolve and Inverse,
+/// which pivot on magnitudes. Converts to and from Matrix<T> for the code that works on dynamic sizes.
+///
+/// @param T: template-parameter-typename
+/// @param M: number of rows
+/// @param N: number of columns
+template <typename T, std::int32_t M, std::int32_t N>
+class FixedMatrix
+{
+    static_assert(M > 0 && N > 0, "FixedMatrix dimensions must be positive");
+
+  public:
+    using value_type = T;
+
+    static constexpr std::int32_t kRows{M};
+    static constexpr std::int32_t kColumns{N};
+    static constexpr std::size_t kSize{static_cast<std::size_t>(M) * static_cast<std::size_t>(N)};
+
+    /// @brief All entries value initialized
+    constexpr FixedMatrix() = default;
+
+    /// @brief Entries row by row, e.g. FixedMatrix<double, 2, 2> A{{1.0, 2.0, 3.0, 4.0}}
+    constexpr FixedMatrix(const T (&values)[kSize])
+    {
+        for (std::size_t k{0}; k < kSize; ++k)
+        {
+            data_[k] = values[k];
+        }
+    }
+
+    /// @throws std::length_error: when A is not M x N
+    explicit FixedMatrix(const Matrix<T>& A)
+    {
+        if (A.NumberOfRows() != M || A.NumberOfColumns() != N)
+        {
+            throw std::length_error("Matrix dimensions do not match the fixed size matrix.");
+        }
+        for (std::size_t k{0}; k < kSize; ++k)
+        {
+            data_[k] = A.Data()[k];
+        }
+    }
+
+    static constexpr FixedMatrix Identity()
+    {
+        static_assert(M == N, "Only square matrices have an identity");
+        FixedMatrix identity{};
+        for (std::int32_t i{0}; i < M; ++i)
+        {
+            identity(i, i) = T{1};
+        }
+        return identity;
+    }
+
+    static constexpr std::int32_t NumberOfRows() { return M; }
+    static constexpr std::int32_t NumberOfColumns() { return N; }
+
+    constexpr T& operator()(const std::int32_t i, const std::int32_t j)
+    {
+        return data_[static_cast<std::size_t>(i) * N + static_cast<std::size_t>(j)];
+    }
+    constexpr const T& operator()(const std::int32_t i, const std::int32_t j) const
+    {
+        return data_[static_cast<std::size_t>(i) * N + static_cast<std::size_t>(j)];
+    }
+
+    /// @brief Entry k in row-major order, the natural index of a FixedVector
+    constexpr T& operator[](const std::int32_t k) { return data_[static_cast<std::size_t>(k)]; }
+    constexpr const T& operator[](const std::int32_t k) const { return data_[static_cast<std::size_t>(k)]; }
+
+    constexpr T* Data() { return data_.data(); }
+    constexpr const T* Data() const { return data_.data(); }
+
+    Matrix<T> ToMatrix() const { return Matrix<T>(data_.data(), M, N); }
+
+    constexpr FixedMatrix<T, N, M> Transpose() const
+    {
+        FixedMatrix<T, N, M> transpose{};
+        for (std::int32_t i{0}; i < M; ++i)
+        {
+            for (std::int32_t j{0}; j < N; ++j)
+            {
+                transpose(j, i) = (*this)(i, j);
+            }
+        }
+        return transpose;
+    }
+
+    constexpr FixedMatrix& operator+=(const FixedMatrix& other)
+    {
+        for (std::size_t k{0}; k < kSize; ++k)
+        {
+            data_[k] = data_[k] + other.data_[k];
+        }
+        return *this;
+    }
+
+    constexpr FixedMatrix& operator-=(const FixedMatrix& other)
+    {
+        for (std::size_t k{0}; k < kSize; ++k)
+        {
+            data_[k] = data_[k] - other.data_[k];
+        }
+        return *this;
+    }
+
+    constexpr FixedMatrix operator+(const FixedMatrix& other) const
+    {
+        auto result = *this;
+        result += other;
+        return result;
+    }
+
+    constexpr FixedMatrix operator-(const FixedMatrix& other) const
+    {
+        auto result = *this;
+        result -= other;
+        return result;
+    }
+
+  private:
+    std::array<T, kSize> data_{};
+};
+
+/// @brief Column vector of N entries
+template <typename T, std::int32_t N>
+using FixedVector = FixedMatrix<T, N, 1>;
+
+/// @brief Matrix product, C = A * B
+template <typename T, std::int32_t M, std::int32_t K, std::int32_t N>
+constexpr FixedMatrix<T, M, N> MatMult(const FixedMatrix<T, M, K>& A, const FixedMatrix<T, K, N>& B)
+{
+    FixedMatrix<T, M, N> C{};
+    for (std::int32_t i{0}; i < M; ++i)
+    {
+        for (std::int32_t p{0}; p < K; ++p)
+        {
+            const auto a_ip = A(i, p);
+            for (std::int32_t j{0}; j < N; ++j)
+            {
+                C(i, j) = C(i, j) + a_ip * B(p, j);
+            }
+        }
+    }
+    return C;
+}
+
+template <typename T, std::int32_t M, std::int32_t N>
+constexpr FixedMatrix<T, M, N> ScalarMultiply(const T& scalar_value, const FixedMatrix<T, M, N>& A)
+{
+    FixedMatrix<T, M, N> result{};
+    for (std::int32_t k{0}; k < M * N; ++k)
+    {
+        result[k] = scalar_value * A[k];
+    }
+    return result;
+}
+
+/// @brief Sum of the products of the entries, the dot product for vectors
+template <typename T, std::int32_t M, std::int32_t N>
+constexpr T Dot(const FixedMatrix<T, M, N>& a, const FixedMatrix<T, M, N>& b)
+{
+    T sum{};
+    for (std::int32_t k{0}; k < M * N; ++k)
+    {
+        sum = sum + a[k] * b[k];
+    }
+    return sum;
+}
+
+/// @brief Euclidean norm of a vector, Frobenius norm of a matrix
+template <typename T, std::int32_t M, std::int32_t N>
+T L2Norm(const FixedMatrix<T, M, N>& a)
+{
+    return std::sqrt(Dot(a, a));
+}
+
+template <typename T, std::int32_t M, std::int32_t N, std::int32_t P, std::int32_t Q>
+constexpr FixedMatrix<T, M * P, N * Q> KroneckerProduct(const FixedMatrix<T, M, N>& A, const FixedMatrix<T, P, Q>& B)
+{
+    FixedMatrix<T, M * P, N * Q> result{};
+    for (std::int32_t i{0}; i < M; ++i)
+    {
+        for (std::int32_t j{0}; j < N; ++j)
+        {
+            for (std::int32_t k{0}; k < P; ++k)
+            {
+                for (std::int32_t l{0}; l < Q; ++l)
+                {
+                    result(i * P + k, j * Q + l) = A(i, j) * B(k, l);
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/// @brief Stacks the columns of A into a single vector, as Vectorize does for Matrix
+template <typename T, std::int32_t M, std::int32_t N>
+constexpr FixedVector<T, M * N> Vectorize(const FixedMatrix<T, M, N>& A)
+{
+    FixedVector<T, M * N> a{};
+    for (std::int32_t j{0}; j < N; ++j)
+    {
+        for (std::int32_t i{0}; i < M; ++i)
+        {
+            a[j * M + i] = A(i, j);
+        }
+    }
+    return a;
+}
+
+/// @brief Inverse of Vectorize, fills an M x N matrix column by column
+template <std::int32_t M, std::int32_t N, typename T>
+constexpr FixedMatrix<T, M, N> Devectorize(const FixedVector<T, M * N>& a)
+{
+    FixedMatrix<T, M, N> A{};
+    for (std::int32_t j{0}; j < N; ++j)
+    {
+        for (std::int32_t i{0}; i < M; ++i)
+        {
+            A(i, j) = a[j * M + i];
+        }
+    }
+    return A;
+}
+
+/// @brief Solves AX = B by LU decomposition with partial pivoting, entirely on the stack
+///
+/// @throws std::invalid_argument: when A is singular
+template <typename T, std::int32_t N, std::int32_t K>
+constexpr FixedMatrix<T, N, K> LUSolve(FixedMatrix<T, N, N> A, FixedMatrix<T, N, K> B)
+{
+    static_assert(std::is_floating_point<T>::value, "Pivoting needs a floating point element type");
+    const auto magnitude = [](const T value) { return (value < T{0}) ? -value : value; };
+
+    for (std::int32_t k{0}; k < N; ++k)
+    {
+        auto pivot_row = k;
+        for (auto i = k + 1; i < N; ++i)
+        {
+            if (magnitude(A(i, k)) > magnitude(A(pivot_row, k)))
+            {
+                pivot_row = i;
+            }
+        }
+        if (A(pivot_row, k) == T{0})
+        {
+            throw std::invalid_argument("Matrix is singular.");
+        }
+        if (pivot_row != k)
+        {
+            // std::swap is only constexpr from C++20
+            for (std::int32_t j{0}; j < N; ++j)
+            {
+                const auto a_kj = A(k, j);
+                A(k, j) = A(pivot_row, j);
+                A(pivot_row, j) = a_kj;
+            }
+            for (std::int32_t j{0}; j < K; ++j)
+            {
+                const auto b_kj = B(k, j);
+                B(k, j) = B(pivot_row, j);
+                B(pivot_row, j) = b_kj;
+            }
+        }
+
+        // Eliminates below the pivot in A and applies the same row operations to B, i.e. the forward substitution
+        for (auto i = k + 1; i < N; ++i)
+        {
+            const auto factor = A(i, k) / A(k, k);
+            for (auto j = k + 1; j < N; ++j)
+            {
+                A(i, j) -= factor * A(k, j);
+            }
+            for (std::int32_t j{0}; j < K; ++j)
+            {
+                B(i, j) -= factor * B(k, j);
+            }
+        }
+    }
+
+    // Backwards substitution with U
+    for (auto i = N - 1; i >= 0; --i)
+    {
+        for (std::int32_t j{0}; j < K; ++j)
+        {
+            auto sum = B(i, j);
+            for (auto p = i + 1; p < N; ++p)
+            {
+                sum -= A(i, p) * B(p, j);
+            }
+            B(i, j) = sum / A(i, i);
+        }
+    }
+    return B;
+}
+
+/// @throws std::invalid_argument: when A is singular
+template <typename T, std::int32_t N>
+constexpr FixedMatrix<T, N, N> Inverse(const FixedMatrix<T, N, N>& A)
+{
+    return LUSolve(A, FixedMatrix<T, N, N>::Identity());
+}
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_FIXED_FIXED_MATRIX_H
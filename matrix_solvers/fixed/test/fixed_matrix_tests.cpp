@@ -0,0 +1,154 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "calculus/data_types/data_types.h"
+#include "matrix_solvers/fixed/fixed_matrix.h"
+#include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/utilities.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <type_traits>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+constexpr double kTolerance{1e-12};
+
+// Evaluated by the compiler, a failure here breaks the build
+constexpr FixedMatrix<double, 2, 2> kRotation{{0.0, -1.0, 1.0, 0.0}};
+static_assert(MatMult(kRotation, kRotation)(0, 0) == -1.0, "Two quarter turns are a half turn");
+static_assert(MatMult(kRotation, kRotation.Transpose())(1, 1) == 1.0, "Rotations are orthogonal");
+static_assert(LUSolve(kRotation, FixedVector<double, 2>{{1.0, 2.0}})[0] == 2.0, "LUSolve is constexpr");
+
+TEST(FixedMatrixTest, GivenFixedMatrix_ExpectNoHeapStorage)
+{
+    // Call, Expect
+    EXPECT_EQ(sizeof(FixedMatrix<double, 3, 4>), 12 * sizeof(double));
+    EXPECT_TRUE((std::is_trivially_copyable<FixedMatrix<double, 3, 4>>::value));
+}
+
+TEST(FixedMatrixTest, GivenMatrix_ExpectRoundTripThroughFixedMatrix)
+{
+    // Given
+    const Matrix<double> A{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+
+    // Call
+    const FixedMatrix<double, 2, 3> A_fixed{A};
+    const auto A_back = A_fixed.ToMatrix();
+
+    // Expect
+    EXPECT_EQ(A_fixed(1, 0), 4.0);
+    ASSERT_EQ(A_back.NumberOfRows(), 2);
+    ASSERT_EQ(A_back.NumberOfColumns(), 3);
+    for (std::int32_t i{0}; i < 2; ++i)
+    {
+        for (std::int32_t j{0}; j < 3; ++j)
+        {
+            EXPECT_EQ(A_back(i, j), A(i, j));
+        }
+    }
+    EXPECT_THROW((FixedMatrix<double, 3, 2>{A}), std::length_error);
+}
+
+TEST(FixedMatrixTest, GivenRectangularMatrices_ExpectSameProductAsMatMult)
+{
+    // Given
+    const FixedMatrix<double, 2, 3> A{{1.0, -2.0, 3.0, 0.5, 4.0, -1.0}};
+    const FixedMatrix<double, 3, 2> B{{2.0, 1.0, 0.0, -3.0, 1.5, 2.0}};
+
+    // Call
+    const auto C = MatMult(A, B);
+
+    // Expect
+    const auto expected = MatMult(A.ToMatrix(), B.ToMatrix());
+    for (std::int32_t i{0}; i < 2; ++i)
+    {
+        for (std::int32_t j{0}; j < 2; ++j)
+        {
+            EXPECT_DOUBLE_EQ(C(i, j), expected(i, j));
+        }
+    }
+}
+
+TEST(FixedMatrixTest, GivenMatrixNeedingPivoting_ExpectLUSolveAndInverse)
+{
+    // Given, a zero leading entry
+    const FixedMatrix<double, 3, 3> A{{0.0, 2.0, 1.0, 1.0, 1.0, 0.0, 2.0, 0.0, 3.0}};
+    const FixedVector<double, 3> x_expected{{1.0, -2.0, 0.5}};
+    const auto b = MatMult(A, x_expected);
+
+    // Call
+    const auto x = LUSolve(A, b);
+    const auto identity = MatMult(A, Inverse(A));
+
+    // Expect
+    for (std::int32_t i{0}; i < 3; ++i)
+    {
+        EXPECT_NEAR(x[i], x_expected[i], kTolerance);
+        for (std::int32_t j{0}; j < 3; ++j)
+        {
+            EXPECT_NEAR(identity(i, j), (i == j) ? 1.0 : 0.0, kTolerance);
+        }
+    }
+}
+
+TEST(FixedMatrixTest, GivenSingularMatrix_ExpectThrow)
+{
+    // Given
+    const FixedMatrix<double, 2, 2> A{{1.0, 2.0, 2.0, 4.0}};
+
+    // Call, Expect
+    EXPECT_THROW(Inverse(A), std::invalid_argument);
+}
+
+TEST(FixedMatrixTest, GivenMatrix_ExpectVectorizeLikeMatrixAndDevectorizeInverse)
+{
+    // Given
+    const FixedMatrix<double, 2, 3> A{{1.0, 2.0, 3.0, 4.0, 5.0, 6.0}};
+
+    // Call
+    const auto a = Vectorize(A);
+    const auto A_back = Devectorize<2, 3>(a);
+
+    // Expect
+    const auto expected = Vectorize(A.ToMatrix());
+    for (std::int32_t k{0}; k < 6; ++k)
+    {
+        EXPECT_EQ(a[k], expected[static_cast<std::size_t>(k)]);
+        EXPECT_EQ(A_back[k], A[k]);
+    }
+}
+
+TEST(FixedMatrixTest, GivenDualNumberEntries_ExpectDerivativeOfProduct)
+{
+    // Given, A(t) = [t 1; 0 2t] at t = 3 with dA/dt = [1 0; 0 2]
+    using calculus::DualNumber;
+    const FixedMatrix<DualNumber, 2, 2> A{
+        {DualNumber{3.0, 1.0}, DualNumber{1.0, 0.0}, DualNumber{0.0, 0.0}, DualNumber{6.0, 2.0}}};
+
+    // Call
+    const auto A_squared = MatMult(A, A);
+
+    // Expect, A^2 = [t^2 3t; 0 4t^2] and d(A^2)/dt = [2t 3; 0 8t]
+    EXPECT_DOUBLE_EQ(A_squared(0, 0).real, 9.0);
+    EXPECT_DOUBLE_EQ(A_squared(0, 0).dual, 6.0);
+    EXPECT_DOUBLE_EQ(A_squared(0, 1).real, 9.0);
+    EXPECT_DOUBLE_EQ(A_squared(0, 1).dual, 3.0);
+    EXPECT_DOUBLE_EQ(A_squared(1, 1).real, 36.0);
+    EXPECT_DOUBLE_EQ(A_squared(1, 1).dual, 24.0);
+}
+
+}  // namespace
+
+}  // namespace matrix
+
+}  // namespace nm
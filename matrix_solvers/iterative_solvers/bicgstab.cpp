@@ -0,0 +1,270 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/iterative_solvers/bicgstab.h"
+#include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/workspace/workspace.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+constexpr double kBreakdownTolerance{1e-10};
+
+/// @brief Right preconditioned BiCGSTAB, without a preconditioner (M == nullptr) p_hat and s_hat are p and s
+///
+/// @return Number of iterations performed
+std::int32_t BiCGSTABSolve(const LinearOperator& A,
+                           const std::vector<double>& b,
+                           std::vector<double>& x,
+                           const Preconditioner* M,
+                           const double tolerance,
+                           const std::int32_t max_iterations,
+                           const SolverTelemetry& telemetry)
+{
+    SolverMonitor monitor{telemetry};
+
+    const auto n = b.size();
+
+    // Work vectors come from the workspace of the thread, repeated solves of the same size reuse its buffers and the
+    // iterations below only write into them
+    auto& workspace = CurrentWorkspace();
+    auto r_lease = workspace.Acquire(n);
+    auto r_shadow_lease = workspace.Acquire(n);
+    auto p_lease = workspace.Acquire(n);
+    auto v_lease = workspace.Acquire(n);
+    auto t_lease = workspace.Acquire(n);
+    auto p_hat_lease = workspace.Acquire(M ? n : 0);
+    auto s_hat_lease = workspace.Acquire(M ? n : 0);
+    auto& r = *r_lease;
+    auto& r_shadow = *r_shadow_lease;
+    auto& p = *p_lease;
+    auto& v = *v_lease;
+    auto& t = *t_lease;
+    auto& p_hat_storage = *p_hat_lease;
+    auto& s_hat_storage = *s_hat_lease;
+
+    // r = b - A * x, r is overwritten by s = r - alpha * v halfway through every iteration
+    std::copy(b.cbegin(), b.cend(), r.begin());
+    {
+        const auto timer = monitor.Time(SolverPhase::kSetup);
+        A.Apply(-1.0, x, 1.0, r);
+    }
+    monitor.RecordInitialResidual(L2Norm(r));
+    std::copy(r.cbegin(), r.cend(), r_shadow.begin());
+
+    const auto& p_hat = M ? p_hat_storage : p;
+    const auto& s_hat = M ? s_hat_storage : r;
+
+    // Two products with A, six dot products or norms and six vector updates per iteration
+    const auto iteration_work = 2.0 * A.ApplyWork() + 6.0 * DotWork(n) + 6.0 * AxpyWork(n);
+
+    double rho{1.0};
+    double alpha{1.0};
+    double omega{1.0};
+
+    // Restarts the recurrence from the current residual r
+    const auto restart = [&]() {
+        std::copy(r.cbegin(), r.cend(), r_shadow.begin());
+        std::fill(p.begin(), p.end(), 0.0);
+        std::fill(v.begin(), v.end(), 0.0);
+        rho = alpha = omega = 1.0;
+    };
+
+    // Whether a / (||u|| * ||w||) is too small to divide by, the inner products of BiCGSTAB are not bounded away from
+    // zero and dividing by a near zero one blows up the residual recurrence, losing all accuracy in x
+    const auto is_breakdown = [](const double a, const std::vector<double>& u, const std::vector<double>& w) {
+        return std::abs(a) <= kBreakdownTolerance * L2Norm(u) * L2Norm(w);
+    };
+
+    // The recursively updated residual drifts from b - A * x, so convergence is confirmed on the true residual
+    const auto has_converged = [&]() {
+        if (L2Norm(r) > tolerance)
+        {
+            return false;
+        }
+        std::copy(b.cbegin(), b.cend(), r.begin());
+        {
+            const auto timer = monitor.Time(SolverPhase::kOperator);
+            A.Apply(-1.0, x, 1.0, r);
+        }
+        if (L2Norm(r) <= tolerance)
+        {
+            return true;
+        }
+        restart();
+        return false;
+    };
+
+    // The norm of r is only needed for the history, so it is only computed when somebody listens
+    const auto record_iteration = [&](const std::int32_t completed_iterations, const double fraction_of_work) {
+        if (monitor.IsActive())
+        {
+            monitor.AddWork(fraction_of_work * iteration_work);
+            monitor.RecordIteration(completed_iterations, L2Norm(r));
+        }
+    };
+
+    std::int32_t iteration{0};
+    for (; iteration < max_iterations; ++iteration)
+    {
+        if (has_converged())
+        {
+            monitor.Finish(iteration, true);
+            return iteration;
+        }
+
+        auto rho_new = Dot(r_shadow, r);
+        if (is_breakdown(rho_new, r_shadow, r))
+        {
+            restart();
+            rho_new = Dot(r_shadow, r);
+        }
+
+        // p = r + beta * (p - omega * v)
+        const auto beta = (rho_new / rho) * (alpha / omega);
+        Axpy(-omega, v, p);
+        Axpby(1.0, r, beta, p);
+        rho = rho_new;
+
+        if (M)
+        {
+            const auto timer = monitor.Time(SolverPhase::kPreconditioner);
+            M->Apply(p, p_hat_storage);
+        }
+        {
+            const auto timer = monitor.Time(SolverPhase::kOperator);
+            A.Apply(1.0, p_hat, 0.0, v);
+        }
+        const auto sigma = Dot(r_shadow, v);
+        if (is_breakdown(sigma, r_shadow, v))
+        {
+            restart();
+            record_iteration(iteration + 1, 0.5);
+            continue;
+        }
+        alpha = rho / sigma;
+
+        // s = r - alpha * v, when it is already small the stabilizing half step is skipped
+        Axpy(-alpha, v, r);
+        Axpy(alpha, p_hat, x);
+        if (has_converged())
+        {
+            record_iteration(iteration + 1, 0.5);
+            monitor.Finish(iteration + 1, true);
+            return iteration + 1;
+        }
+
+        if (M)
+        {
+            const auto timer = monitor.Time(SolverPhase::kPreconditioner);
+            M->Apply(r, s_hat_storage);
+        }
+        {
+            const auto timer = monitor.Time(SolverPhase::kOperator);
+            A.Apply(1.0, s_hat, 0.0, t);
+        }
+        const auto t_norm_squared = Dot(t, t);
+        if (t_norm_squared == 0.0)
+        {
+            restart();
+            record_iteration(iteration + 1, 1.0);
+            continue;
+        }
+        omega = Dot(t, r) / t_norm_squared;
+
+        // x += omega * s_hat is done before r = s - omega * t, since without M s_hat is r itself
+        Axpy(omega, s_hat, x);
+        Axpy(-omega, t, r);
+
+        // omega divides the next beta, a stagnating stabilization step is handled like a breakdown
+        if (omega == 0.0)
+        {
+            restart();
+        }
+
+        record_iteration(iteration + 1, 1.0);
+    }
+
+    monitor.Finish(iteration, false);
+    return iteration;
+}
+
+}  // namespace
+
+std::int32_t BiCGSTAB(const Matrix<double>& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const double tolerance,
+                      const std::int32_t max_iterations,
+                      const SolverTelemetry& telemetry)
+{
+    return BiCGSTABSolve(DenseMatrixOperator{A}, b, x, nullptr, tolerance, max_iterations, telemetry);
+}
+
+std::int32_t BiCGSTAB(const Matrix<double>& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const Preconditioner& M,
+                      const double tolerance,
+                      const std::int32_t max_iterations,
+                      const SolverTelemetry& telemetry)
+{
+    return BiCGSTABSolve(DenseMatrixOperator{A}, b, x, &M, tolerance, max_iterations, telemetry);
+}
+
+std::int32_t BiCGSTAB(const CsrMatrix& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const double tolerance,
+                      const std::int32_t max_iterations,
+                      const SolverTelemetry& telemetry)
+{
+    return BiCGSTABSolve(SparseMatrixOperator{A}, b, x, nullptr, tolerance, max_iterations, telemetry);
+}
+
+std::int32_t BiCGSTAB(const CsrMatrix& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const Preconditioner& M,
+                      const double tolerance,
+                      const std::int32_t max_iterations,
+                      const SolverTelemetry& telemetry)
+{
+    return BiCGSTABSolve(SparseMatrixOperator{A}, b, x, &M, tolerance, max_iterations, telemetry);
+}
+
+std::int32_t BiCGSTAB(const LinearOperator& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const double tolerance,
+                      const std::int32_t max_iterations,
+                      const SolverTelemetry& telemetry)
+{
+    return BiCGSTABSolve(A, b, x, nullptr, tolerance, max_iterations, telemetry);
+}
+
+std::int32_t BiCGSTAB(const LinearOperator& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const Preconditioner& M,
+                      const double tolerance,
+                      const std::int32_t max_iterations,
+                      const SolverTelemetry& telemetry)
+{
+    return BiCGSTABSolve(A, b, x, &M, tolerance, max_iterations, telemetry);
+}
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,94 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#ifndef MATRIX_SOLVERS_ITERATIVE_SOLVERS_BICGSTAB_H
+#define MATRIX_SOLVERS_ITERATIVE_SOLVERS_BICGSTAB_H
+
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/preconditioners/preconditioner.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
+#include "matrix_solvers/utilities.h"
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Biconjugate gradient stabilized iterative linear solver
+///
+/// Solves Ax = b for general, including non-symmetric, nxn matrices with two products with A per iteration and a
+/// fixed set of seven work vectors, independent of the number of iterations. Unlike GMRES the residual is not
+/// minimized, so it may oscillate, but memory and cost per iteration stay constant. On a near breakdown, or when the
+/// recursively updated residual has drifted from the true one, the recurrence restarts from the current x.
+///
+/// @param A nxn matrix
+/// @param b Right-hand side vector
+/// @param x On input: initial guess; on output: approximate solution
+/// @param tolerance Stopping criterion for the L2 norm of b - A * x
+/// @param max_iterations Maximum number of iterations
+/// @param telemetry Optional stats and observer, receives the L2 norm of the residual after every iteration
+///
+/// @return Number of iterations performed
+std::int32_t BiCGSTAB(const Matrix<double>& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const double tolerance = 1e-3,
+                      const std::int32_t max_iterations = 1000,
+                      const SolverTelemetry& telemetry = {});
+
+/// @brief Right preconditioned BiCGSTAB, the tolerance applies to the true residual b - A * x
+///
+/// @param M Preconditioner, e.g. ILU(0), need not be symmetric
+std::int32_t BiCGSTAB(const Matrix<double>& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const Preconditioner& M,
+                      const double tolerance = 1e-3,
+                      const std::int32_t max_iterations = 1000,
+                      const SolverTelemetry& telemetry = {});
+
+/// @brief BiCGSTAB iterative linear solver for a sparse matrix
+std::int32_t BiCGSTAB(const CsrMatrix& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const double tolerance = 1e-3,
+                      const std::int32_t max_iterations = 1000,
+                      const SolverTelemetry& telemetry = {});
+
+/// @brief Right preconditioned BiCGSTAB iterative linear solver for a sparse matrix
+std::int32_t BiCGSTAB(const CsrMatrix& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const Preconditioner& M,
+                      const double tolerance = 1e-3,
+                      const std::int32_t max_iterations = 1000,
+                      const SolverTelemetry& telemetry = {});
+
+/// @brief BiCGSTAB iterative linear solver for a matrix-free operator, only uses A.Apply()
+std::int32_t BiCGSTAB(const LinearOperator& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const double tolerance = 1e-3,
+                      const std::int32_t max_iterations = 1000,
+                      const SolverTelemetry& telemetry = {});
+
+/// @brief Right preconditioned BiCGSTAB iterative linear solver for a matrix-free operator
+std::int32_t BiCGSTAB(const LinearOperator& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const Preconditioner& M,
+                      const double tolerance = 1e-3,
+                      const std::int32_t max_iterations = 1000,
+                      const SolverTelemetry& telemetry = {});
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_ITERATIVE_SOLVERS_BICGSTAB_H
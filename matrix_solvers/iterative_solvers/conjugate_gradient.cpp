@@ -5,6 +5,8 @@
 
 #include "matrix_solvers/iterative_solvers/conjugate_gradient.h"
 #include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/workspace/workspace.h"
+#include <algorithm>
 
 namespace nm
 {
@@ -15,77 +17,198 @@ namespace matrix
 namespace
 {
 
-bool IsSolutionConverged(double residual,
-                         const double tolerance,
-                         const std::int32_t iteration,
-                         std::int32_t max_iterations)
+/// @brief y = alpha * A * x + beta * y for either storage format
+void Apply(const double alpha,
+           const Matrix<double>& A,
+           const std::vector<double>& x,
+           const double beta,
+           std::vector<double>& y)
 {
-    if (residual <= tolerance)
-    {
-        // clang-format off
-        #ifdef PRINT_DEBUG
-            std::cerr << "Conjugate gradient solver converged in " << iteration << " iterations\n";
-        #endif
-        //clang-format on
-        return true;
-    }
+    Gemv(alpha, A, x, beta, y);
+}
 
-    if (iteration == max_iterations)
-    {
-        // clang-format off
-        #ifdef PRINT_DEBUG
-            std::cerr << "Conjugate gradient solver reached max iterations with a l2norm residual: " << residual  << "\n";
-        #endif
-        //clang-format on
-    }
-    
-    return false;
+void Apply(const double alpha,
+           const CsrMatrix& A,
+           const std::vector<double>& x,
+           const double beta,
+           std::vector<double>& y)
+{
+    SpMV(alpha, A, x, beta, y);
 }
 
-}  // namespace
+void Apply(const double alpha,
+           const LinearOperator& A,
+           const std::vector<double>& x,
+           const double beta,
+           std::vector<double>& y)
+{
+    A.Apply(alpha, x, beta, y);
+}
 
-void ConjugateGradient(const Matrix<double>& A,
-                       const std::vector<double>& b,
-                       std::vector<double>& x,
-                       const double tolerance,
-                       const std::int32_t max_iterations)
+/// @brief Estimated cost of one Apply() for either storage format
+WorkEstimate ApplyWork(const Matrix<double>& A)
 {
+    return DenseMatrixOperator{A}.ApplyWork();
+}
 
-    const auto n = static_cast<std::int32_t>(b.size());
-    auto residual_vector = CalculateResidual(A, b, x, n);
-    auto residual = L2Norm(residual_vector);
+WorkEstimate ApplyWork(const CsrMatrix& A)
+{
+    return SparseMatrixOperator{A}.ApplyWork();
+}
 
-    for (std::int32_t iteration{0}; iteration < max_iterations; ++iteration)
+WorkEstimate ApplyWork(const LinearOperator& A)
+{
+    return A.ApplyWork();
+}
+
+/// @brief Preconditioned conjugate gradient, without a preconditioner (M == nullptr) z is the residual itself
+///
+/// @return Number of iterations performed
+template <typename MatrixType>
+std::int32_t ConjugateGradientSolve(const MatrixType& A,
+                                    const std::vector<double>& b,
+                                    std::vector<double>& x,
+                                    const Preconditioner* M,
+                                    const double tolerance,
+                                    const std::int32_t max_iterations,
+                                    const SolverTelemetry& telemetry)
+{
+    SolverMonitor monitor{telemetry};
+
+    // Work vectors come from the workspace of the thread, repeated solves of the same size reuse its buffers and the
+    // iterations below only write into them
+    auto& workspace = CurrentWorkspace();
+    auto residual_lease = workspace.Acquire(b.size());
+    auto z_lease = workspace.Acquire(M ? b.size() : 0);
+    auto p_lease = workspace.Acquire(b.size());
+    auto Ap_lease = workspace.Acquire(b.size());
+    auto& residual_vector = *residual_lease;
+    auto& z = *z_lease;
+    auto& p = *p_lease;
+    auto& Ap = *Ap_lease;
+
+    // r = b - A * x
+    std::copy(b.cbegin(), b.cend(), residual_vector.begin());
     {
-        ++iteration;
-        if (IsSolutionConverged(residual, tolerance, iteration, max_iterations))
+        const auto timer = monitor.Time(SolverPhase::kSetup);
+        Apply(-1.0, A, x, 1.0, residual_vector);
+        if (M)
         {
-            return;
+            M->Apply(residual_vector, z);
         }
+    }
+    auto residual = L2Norm(residual_vector);
+    monitor.RecordInitialResidual(residual);
 
-        auto p = residual_vector;
+    const auto& preconditioned_residual = M ? z : residual_vector;
+    std::copy(preconditioned_residual.cbegin(), preconditioned_residual.cend(), p.begin());
+    auto residual_dotted = Dot(residual_vector, preconditioned_residual);
 
-        const auto residual_dotted = Dot(residual_vector, residual_vector);
-        const auto Ap = MatMult(A, p);
-        const double alpha = residual_dotted / Dot(p, Ap);
+    // One product with A, three dot products, a norm and three vector updates per iteration
+    const auto n = residual_vector.size();
+    const auto iteration_work = ApplyWork(A) + 4.0 * DotWork(n) + 3.0 * AxpyWork(n);
 
-        for (std::int32_t i = 0; i < n; ++i)
+    std::int32_t iteration{0};
+    for (; iteration < max_iterations; ++iteration)
+    {
+        if (residual <= tolerance)
         {
-            x.at(i) += alpha * p.at(i);
-            residual_vector.at(i) -= alpha * Ap.at(i);
+            break;
         }
 
-        const auto new_residual_dotted = Dot(residual_vector, residual_vector);
-        const auto beta = new_residual_dotted / residual_dotted;
-
-        for (std::int32_t i = 0; i < n; ++i)
         {
-            p.at(i) = residual_vector.at(i) + beta * p.at(i);
+            const auto timer = monitor.Time(SolverPhase::kOperator);
+            Apply(1.0, A, p, 0.0, Ap);
         }
+        const double alpha = residual_dotted / Dot(p, Ap);
 
+        Axpy(alpha, p, x);
+        Axpy(-alpha, Ap, residual_vector);
         residual = L2Norm(residual_vector);
+
+        if (M)
+        {
+            const auto timer = monitor.Time(SolverPhase::kPreconditioner);
+            M->Apply(residual_vector, z);
+        }
+        const auto new_residual_dotted = Dot(residual_vector, preconditioned_residual);
+        const auto beta = new_residual_dotted / residual_dotted;
+        residual_dotted = new_residual_dotted;
+
+        // p = z + beta * p keeps the new direction A-conjugate to all previous ones
+        Axpby(1.0, preconditioned_residual, beta, p);
+
+        monitor.AddWork(iteration_work);
+        monitor.RecordIteration(iteration + 1, residual);
     }
-        
+
+    monitor.Finish(iteration, residual <= tolerance);
+    return iteration;
+}
+
+}  // namespace
+
+std::int32_t ConjugateGradient(const Matrix<double>& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const double tolerance,
+                               const std::int32_t max_iterations,
+                               const SolverTelemetry& telemetry)
+{
+    return ConjugateGradientSolve(A, b, x, nullptr, tolerance, max_iterations, telemetry);
+}
+
+std::int32_t ConjugateGradient(const Matrix<double>& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const Preconditioner& M,
+                               const double tolerance,
+                               const std::int32_t max_iterations,
+                               const SolverTelemetry& telemetry)
+{
+    return ConjugateGradientSolve(A, b, x, &M, tolerance, max_iterations, telemetry);
+}
+
+std::int32_t ConjugateGradient(const CsrMatrix& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const double tolerance,
+                               const std::int32_t max_iterations,
+                               const SolverTelemetry& telemetry)
+{
+    return ConjugateGradientSolve(A, b, x, nullptr, tolerance, max_iterations, telemetry);
+}
+
+std::int32_t ConjugateGradient(const CsrMatrix& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const Preconditioner& M,
+                               const double tolerance,
+                               const std::int32_t max_iterations,
+                               const SolverTelemetry& telemetry)
+{
+    return ConjugateGradientSolve(A, b, x, &M, tolerance, max_iterations, telemetry);
+}
+
+std::int32_t ConjugateGradient(const LinearOperator& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const double tolerance,
+                               const std::int32_t max_iterations,
+                               const SolverTelemetry& telemetry)
+{
+    return ConjugateGradientSolve(A, b, x, nullptr, tolerance, max_iterations, telemetry);
+}
+
+std::int32_t ConjugateGradient(const LinearOperator& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const Preconditioner& M,
+                               const double tolerance,
+                               const std::int32_t max_iterations,
+                               const SolverTelemetry& telemetry)
+{
+    return ConjugateGradientSolve(A, b, x, &M, tolerance, max_iterations, telemetry);
 }
 
 }  // namespace matrix
@@ -3,6 +3,10 @@
  * Update: October 8, 2023
  */
 
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/preconditioners/preconditioner.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include "matrix_solvers/utilities.h"
 #include <cstdint>
 #include <vector>
@@ -40,12 +44,61 @@ std::pair<std::vector<double>, std::vector<double>> ConjugateGradient(const Matr
 /// @param x On input: initial guess; on output: approximate solution
 /// @param tolerance Stopping criterion for the residual norm
 /// @param max_iterations Maximum number of iterations
+/// @param telemetry Optional stats and observer, receives the L2 norm of b - A * x after every iteration
 ///
-void ConjugateGradient(const Matrix<double>& A,
-                       const std::vector<double>& b,
-                       std::vector<double>& x,
-                       const double tolerance = 1e-3,
-                       const std::int32_t max_iterations = 1000);
+/// @return Number of iterations performed
+std::int32_t ConjugateGradient(const Matrix<double>& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const double tolerance = 1e-3,
+                               const std::int32_t max_iterations = 1000,
+                               const SolverTelemetry& telemetry = {});
+
+/// @brief Preconditioned Conjugate Gradient iterative linear solver
+///
+/// @param M Symmetric positive-definite preconditioner, e.g. Jacobi, SSOR or IC(0)
+std::int32_t ConjugateGradient(const Matrix<double>& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const Preconditioner& M,
+                               const double tolerance = 1e-3,
+                               const std::int32_t max_iterations = 1000,
+                               const SolverTelemetry& telemetry = {});
+
+/// @brief Conjugate Gradient iterative linear solver for a sparse symmetric positive-definite matrix
+std::int32_t ConjugateGradient(const CsrMatrix& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const double tolerance = 1e-3,
+                               const std::int32_t max_iterations = 1000,
+                               const SolverTelemetry& telemetry = {});
+
+/// @brief Preconditioned Conjugate Gradient iterative linear solver for a sparse symmetric positive-definite matrix
+std::int32_t ConjugateGradient(const CsrMatrix& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const Preconditioner& M,
+                               const double tolerance = 1e-3,
+                               const std::int32_t max_iterations = 1000,
+                               const SolverTelemetry& telemetry = {});
+
+/// @brief Conjugate Gradient iterative linear solver for a matrix-free symmetric positive-definite operator
+std::int32_t ConjugateGradient(const LinearOperator& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const double tolerance = 1e-3,
+                               const std::int32_t max_iterations = 1000,
+                               const SolverTelemetry& telemetry = {});
+
+/// @brief Preconditioned Conjugate Gradient iterative linear solver for a matrix-free symmetric positive-definite
+/// operator
+std::int32_t ConjugateGradient(const LinearOperator& A,
+                               const std::vector<double>& b,
+                               std::vector<double>& x,
+                               const Preconditioner& M,
+                               const double tolerance = 1e-3,
+                               const std::int32_t max_iterations = 1000,
+                               const SolverTelemetry& telemetry = {});
 
 }  // namespace matrix
 
@@ -4,12 +4,13 @@
  */
 
 #include "matrix_solvers/iterative_solvers/gauss_seidel.h"
+#include "matrix_solvers/operations/vector_kernels.h"
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
-#include <numeric>
-#include <tuple>
+#include <stdexcept>
 
 namespace nm
 {
@@ -20,95 +21,315 @@ namespace matrix
 namespace
 {
 
-double L2Norm(const std::vector<double>& vector)
+/// @brief Sum of squared updates of one thread, padded to a cache line so that the threads do not write to a shared one
+struct alignas(64) ThreadUpdateSquared
 {
-    std::vector<double> vector_squared{};
+    double value{0.0};
+};
 
-    std::transform(
-        std::cbegin(vector), std::cend(vector), std::back_inserter(vector_squared), [](const auto& vector_element) {
-            return vector_element * vector_element;
-        });
+/// @brief One in-place Gauss-Seidel sweep
+///
+/// @return Sum of the squared updates of every entry of x
+double Sweep(const Matrix<double>& A, const std::vector<double>& b, std::vector<double>& x)
+{
+    const auto n = x.size();
+    double update_squared{0.0};
 
-    return std::sqrt(std::accumulate(std::cbegin(vector_squared), std::cend(vector_squared), 0.0));
-}
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(b.size()); ++i)
+    {
+        const double* row = &A(i, 0);
+        const auto i_index = static_cast<std::size_t>(i);
+        const auto sum = kernels::Dot(row, x.data(), i_index) +
+                         kernels::Dot(row + i_index + 1, x.data() + i_index + 1, n - i_index - 1);
 
-}  // namespace
+        const auto x_i = (b[i] - sum) / A(i, i);
+        update_squared += (x_i - x[i]) * (x_i - x[i]);
+        x[i] = x_i;
+    }
 
-double GaussSeidel(const Matrix<double>& A, const std::vector<double>& b, std::vector<double>& x)
+    return update_squared;
+}
+
+/// @brief In-place Gauss-Seidel update of row i of a sparse matrix
+///
+/// @return Squared update of x_i
+double UpdateRow(const CsrMatrix& A, const std::vector<double>& b, std::vector<double>& x, const std::int32_t i)
 {
+    const auto& offsets = A.RowOffsets();
+    const auto& columns = A.ColumnIndices();
+    const auto& values = A.Values();
 
-    const auto x_initial = x;
     double sum{0.0};
-
-    for (std::int32_t i = 0; i < static_cast<std::int32_t>(b.size()); ++i)
+    double diagonal{0.0};
+    for (auto k = offsets[i]; k < offsets[i + 1]; ++k)
     {
-        for (std::int32_t j = 0; j < static_cast<std::int32_t>(b.size()); ++j)
+        if (columns[k] == i)
         {
-            if (j != i)
-            {
-                sum += (A.at(i).at(j) * x.at(j));
-            }
+            diagonal = values[k];
+        }
+        else
+        {
+            sum += values[k] * x[columns[k]];
         }
+    }
+
+    const auto x_i = (b[i] - sum) / diagonal;
+    const auto update = x_i - x[i];
+    x[i] = x_i;
+    return update * update;
+}
+
+/// @brief One in-place Gauss-Seidel sweep over a sparse matrix
+///
+/// @return Sum of the squared updates of every entry of x
+double Sweep(const CsrMatrix& A, const std::vector<double>& b, std::vector<double>& x)
+{
+    double update_squared{0.0};
+
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(b.size()); ++i)
+    {
+        update_squared += UpdateRow(A, b, x, i);
+    }
+
+    return update_squared;
+}
+
+/// @brief One in-place Gauss-Seidel sweep over a matrix-free operator, x_i += (b_i - a_i . x) / a_ii
+///
+/// @return Sum of the squared updates of every entry of x
+double Sweep(const LinearOperator& A,
+             const std::vector<double>& diagonal,
+             const std::vector<double>& b,
+             std::vector<double>& x)
+{
+    double update_squared{0.0};
+
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(b.size()); ++i)
+    {
+        const auto update = (b[i] - A.RowDot(i, x)) / diagonal[i];
+        update_squared += update * update;
+        x[i] += update;
+    }
+
+    return update_squared;
+}
+
+/// @brief Estimated cost of one product with A for either storage format
+WorkEstimate ApplyWork(const Matrix<double>& A)
+{
+    return DenseMatrixOperator{A}.ApplyWork();
+}
 
-        x.at(i) = (b.at(i) - sum) / A.at(i).at(i);
-        sum = 0.0;
+WorkEstimate ApplyWork(const CsrMatrix& A)
+{
+    return SparseMatrixOperator{A}.ApplyWork();
+}
+
+void CheckRowAccess(const LinearOperator& A)
+{
+    if (!A.HasRowAccess())
+    {
+        throw std::invalid_argument("Gauss Seidel requires a linear operator with row access.");
     }
+}
 
-    std::vector<double> residual{};
-    std::ignore = std::transform(
-        std::cbegin(x),
-        std::cend(x),
-        std::cbegin(x_initial),
-        std::back_inserter(residual),
-        [](const auto& x_element, const auto& x_initial_element) { return x_initial_element - x_element; });
+/// @brief Sweeps until the update falls below tolerance or max_iterations is reached
+template <typename MatrixType>
+void GaussSeidelSolve(const MatrixType& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const int max_iterations,
+                      const double tolerance,
+                      const SolverTelemetry& telemetry)
+{
+    SolverMonitor monitor{telemetry};
 
-    return L2Norm(residual);
+    // Every sweep reads A once and updates and measures x once
+    const auto iteration_work = ApplyWork(A) + AxpyWork(b.size());
+
+    std::int32_t iteration{0};
+
+    auto residual = std::numeric_limits<double>::infinity();
+
+    while ((residual > tolerance) && (iteration < max_iterations))
+    {
+        ++iteration;
+        residual = std::sqrt(Sweep(A, b, x));
+
+        monitor.AddWork(iteration_work);
+        monitor.RecordIteration(iteration, residual);
+    }
+
+    monitor.Finish(iteration, residual <= tolerance);
+}
+
+}  // namespace
+
+double GaussSeidel(const Matrix<double>& A, const std::vector<double>& b, std::vector<double>& x)
+{
+    return std::sqrt(Sweep(A, b, x));
 }
 
 void GaussSeidel(const Matrix<double>& A,
                  const std::vector<double>& b,
                  std::vector<double>& x,
                  const int max_iterations,
-                 const double tolerance)
+                 const double tolerance,
+                 const SolverTelemetry& telemetry)
 {
-    const auto x_initial = x;
-    auto residual_vector = x;
-    double sum{0.0};
-    double iteration{0.0};
+    GaussSeidelSolve(A, b, x, max_iterations, tolerance, telemetry);
+}
 
-    auto residual = std::numeric_limits<double>::infinity();
+double GaussSeidel(const CsrMatrix& A, const std::vector<double>& b, std::vector<double>& x)
+{
+    return std::sqrt(Sweep(A, b, x));
+}
 
-    while (residual > tolerance)
-    {
-        ++iteration;
+void GaussSeidel(const CsrMatrix& A,
+                 const std::vector<double>& b,
+                 std::vector<double>& x,
+                 const int max_iterations,
+                 const double tolerance,
+                 const SolverTelemetry& telemetry)
+{
+    GaussSeidelSolve(A, b, x, max_iterations, tolerance, telemetry);
+}
 
-        for (std::int32_t i = 0; i < static_cast<std::int32_t>(b.size()); ++i)
-        {
-            for (std::int32_t j = 0; j < static_cast<std::int32_t>(b.size()); ++j)
+double GaussSeidel(const LinearOperator& A, const std::vector<double>& b, std::vector<double>& x)
+{
+    CheckRowAccess(A);
+    return std::sqrt(Sweep(A, A.Diagonal(), b, x));
+}
+
+std::vector<std::vector<std::int32_t>> ColorRows(const CsrMatrix& A)
+{
+    // Row i reads x_j for every stored a_ij, so rows are coupled through the pattern of A and of its transpose
+    const auto A_transpose = A.Transpose();
+    const auto n = A.NumberOfRows();
+
+    std::vector<std::int32_t> row_colors(static_cast<std::size_t>(n), -1);
+    std::vector<std::int32_t> color_used_by_row{};
+    std::vector<std::vector<std::int32_t>> colors{};
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        // color_used_by_row[c] == i marks colour c as taken by a neighbour of i
+        const auto mark_neighbours = [&](const CsrMatrix& pattern) {
+            const auto& offsets = pattern.RowOffsets();
+            const auto& columns = pattern.ColumnIndices();
+            for (auto k = offsets[i]; k < offsets[i + 1]; ++k)
             {
-                if (j != i)
+                const auto neighbour_color = row_colors[static_cast<std::size_t>(columns[k])];
+                if (columns[k] != i && neighbour_color >= 0)
                 {
-                    sum += (A.at(i).at(j) * x.at(j));
+                    color_used_by_row[static_cast<std::size_t>(neighbour_color)] = i;
                 }
             }
+        };
+        mark_neighbours(A);
+        mark_neighbours(A_transpose);
 
-            x.at(i) = (b.at(i) - sum) / A.at(i).at(i);
-            sum = 0.0;
+        std::size_t color{0};
+        while (color < colors.size() && color_used_by_row[color] == i)
+        {
+            ++color;
+        }
+        if (color == colors.size())
+        {
+            colors.emplace_back();
+            color_used_by_row.push_back(-1);
         }
+        row_colors[static_cast<std::size_t>(i)] = static_cast<std::int32_t>(color);
+        colors[color].push_back(i);
+    }
+    return colors;
+}
 
-        std::ignore = std::transform(
-            std::cbegin(x),
-            std::cend(x),
-            std::cbegin(x_initial),
-            std::back_inserter(residual_vector),
-            [](const auto& x_element, const auto& x_initial_element) { return x_initial_element - x_element; });
-        residual = L2Norm(residual_vector);
+void GaussSeidel(const CsrMatrix& A,
+                 const std::vector<double>& b,
+                 std::vector<double>& x,
+                 const int max_iterations,
+                 const double tolerance,
+                 ThreadPool& pool,
+                 const SolverTelemetry& telemetry)
+{
+    SolverMonitor monitor{telemetry};
+    const auto colors = [&]() {
+        const auto timer = monitor.Time(SolverPhase::kSetup);
+        return ColorRows(A);
+    }();
+    std::vector<ThreadUpdateSquared> update_squared(static_cast<std::size_t>(pool.NumberOfThreads()));
 
-        if (iteration > max_iterations)
+    const auto iteration_work = SparseMatrixOperator{A}.ApplyWork() + AxpyWork(b.size());
+
+    std::int32_t iteration{0};
+
+    auto residual = std::numeric_limits<double>::infinity();
+
+    while ((residual > tolerance) && (iteration < max_iterations))
+    {
+        ++iteration;
+
+        std::fill(update_squared.begin(), update_squared.end(), ThreadUpdateSquared{});
+        for (const auto& rows : colors)
         {
-            break;
+            // Rows of one colour never read each other, so they can be updated in any order and in parallel
+            pool.ParallelFor(0,
+                             static_cast<std::int32_t>(rows.size()),
+                             [&](const std::int32_t begin, const std::int32_t end, const std::int32_t thread_index) {
+                                 double chunk_update_squared{0.0};
+                                 for (auto k = begin; k < end; ++k)
+                                 {
+                                     chunk_update_squared += UpdateRow(A, b, x, rows[static_cast<std::size_t>(k)]);
+                                 }
+                                 update_squared[static_cast<std::size_t>(thread_index)].value +=
+                                     chunk_update_squared;
+                             });
         }
+
+        double sum_of_update_squared{0.0};
+        for (const auto& thread_update_squared : update_squared)
+        {
+            sum_of_update_squared += thread_update_squared.value;
+        }
+        residual = std::sqrt(sum_of_update_squared);
+
+        monitor.AddWork(iteration_work);
+        monitor.RecordIteration(iteration, residual);
+    }
+
+    monitor.Finish(iteration, residual <= tolerance);
+}
+
+void GaussSeidel(const LinearOperator& A,
+                 const std::vector<double>& b,
+                 std::vector<double>& x,
+                 const int max_iterations,
+                 const double tolerance,
+                 const SolverTelemetry& telemetry)
+{
+    CheckRowAccess(A);
+    SolverMonitor monitor{telemetry};
+    const auto diagonal = [&]() {
+        const auto timer = monitor.Time(SolverPhase::kSetup);
+        return A.Diagonal();
+    }();
+
+    const auto iteration_work = A.ApplyWork() + AxpyWork(b.size());
+
+    std::int32_t iteration{0};
+
+    auto residual = std::numeric_limits<double>::infinity();
+
+    while ((residual > tolerance) && (iteration < max_iterations))
+    {
+        ++iteration;
+        residual = std::sqrt(Sweep(A, diagonal, b, x));
+
+        monitor.AddWork(iteration_work);
+        monitor.RecordIteration(iteration, residual);
     }
+
+    monitor.Finish(iteration, residual <= tolerance);
 }
 
 }  // namespace matrix
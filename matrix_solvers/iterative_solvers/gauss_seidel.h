@@ -6,7 +6,12 @@
 #ifndef MATRIX_SOLVERS_ITERATIVE_SOLVERS_GAUSS_SEIDEL_H
 #define MATRIX_SOLVERS_ITERATIVE_SOLVERS_GAUSS_SEIDEL_H
 
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/parallel/thread_pool.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include "matrix_solvers/utilities.h"
+#include <cstdint>
 #include <vector>
 
 namespace nm
@@ -31,12 +36,59 @@ double GaussSeidel(const Matrix<double>& A, const std::vector<double>& b, std::v
 /// @param x: Initial guess to solution
 /// @param max_iterations: maximum iterations limit for algorithm
 /// @param tolerance: tolerance limit for algorithm break
+/// @param telemetry: optional stats and observer, receives the L2 norm of every update
 ///
 void GaussSeidel(const Matrix<double>& A,
                  const std::vector<double>& b,
                  std::vector<double>& x,
                  const int max_iterations,
-                 const double tolerance);
+                 const double tolerance,
+                 const SolverTelemetry& telemetry = {});
+
+/// @brief Single Gauss Seidel sweep on a sparse matrix, every row must store its diagonal entry
+double GaussSeidel(const CsrMatrix& A, const std::vector<double>& b, std::vector<double>& x);
+
+/// @brief Gauss Seidel solver on a sparse matrix, every row must store its diagonal entry
+void GaussSeidel(const CsrMatrix& A,
+                 const std::vector<double>& b,
+                 std::vector<double>& x,
+                 const int max_iterations,
+                 const double tolerance,
+                 const SolverTelemetry& telemetry = {});
+
+/// @brief Greedy multicolouring of the rows of A, no two rows of one colour are coupled through A or its transpose
+///
+/// Rows within each colour are in ascending order. For three point and five point stencils in natural ordering the
+/// result is the two colour red-black ordering.
+std::vector<std::vector<std::int32_t>> ColorRows(const CsrMatrix& A);
+
+/// @brief Multicolour Gauss Seidel solver on a sparse matrix, every row must store its diagonal entry
+///
+/// Each sweep updates the colours of ColorRows(A) one after the other, and the rows of one colour in parallel over
+/// the threads of pool. The ordering differs from the natural order of the serial solver, so iterates differ while
+/// the converged solution is the same.
+void GaussSeidel(const CsrMatrix& A,
+                 const std::vector<double>& b,
+                 std::vector<double>& x,
+                 const int max_iterations,
+                 const double tolerance,
+                 ThreadPool& pool,
+                 const SolverTelemetry& telemetry = {});
+
+/// @brief Single Gauss Seidel sweep on a matrix-free operator
+///
+/// @throws std::invalid_argument: when A does not provide row access
+double GaussSeidel(const LinearOperator& A, const std::vector<double>& b, std::vector<double>& x);
+
+/// @brief Gauss Seidel solver on a matrix-free operator
+///
+/// @throws std::invalid_argument: when A does not provide row access
+void GaussSeidel(const LinearOperator& A,
+                 const std::vector<double>& b,
+                 std::vector<double>& x,
+                 const int max_iterations,
+                 const double tolerance,
+                 const SolverTelemetry& telemetry = {});
 
 }  // namespace matrix
 
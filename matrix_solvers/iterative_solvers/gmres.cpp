@@ -0,0 +1,249 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/iterative_solvers/gmres.h"
+#include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/workspace/workspace.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+/// @brief Right preconditioned GMRES(m), without a preconditioner (M == nullptr) the basis is that of A itself
+///
+/// @return Number of iterations performed
+std::int32_t GMRESSolve(const LinearOperator& A,
+                        const std::vector<double>& b,
+                        std::vector<double>& x,
+                        const Preconditioner* M,
+                        const double tolerance,
+                        const std::int32_t max_iterations,
+                        const std::int32_t restart,
+                        const SolverTelemetry& telemetry)
+{
+    SolverMonitor monitor{telemetry};
+
+    const auto n = b.size();
+    const auto m = static_cast<std::size_t>(std::max(1, std::min(restart, static_cast<std::int32_t>(n))));
+
+    // Krylov basis, Hessenberg matrix and Givens rotations are set up once, restarts overwrite them. The vectors come
+    // from the workspace of the thread, so repeated solves with the same n and restart reuse its buffers
+    auto& workspace = CurrentWorkspace();
+    std::vector<Workspace::Lease> basis_leases{};
+    basis_leases.reserve(m + 1);
+    for (std::size_t i{0}; i <= m; ++i)
+    {
+        basis_leases.push_back(workspace.Acquire(n));
+    }
+    const auto V = [&basis_leases](const std::size_t i) -> std::vector<double>& { return *basis_leases[i]; };
+    // Hessenberg matrix, (m + 1) x m in row major order
+    auto hessenberg_lease = workspace.Acquire((m + 1) * m);
+    const auto H = [&hessenberg = *hessenberg_lease, m](const std::int32_t row, const std::int32_t column) -> double& {
+        return hessenberg[static_cast<std::size_t>(row) * m + static_cast<std::size_t>(column)];
+    };
+    auto cosines_lease = workspace.Acquire(m);
+    auto sines_lease = workspace.Acquire(m);
+    auto g_lease = workspace.Acquire(m + 1);
+    auto y_lease = workspace.Acquire(m);
+    auto z_lease = workspace.Acquire(M ? n : 0);
+    auto update_lease = workspace.Acquire(n);
+    auto& cosines = *cosines_lease;
+    auto& sines = *sines_lease;
+    auto& g = *g_lease;
+    auto& y = *y_lease;
+    auto& z = *z_lease;
+    auto& update = *update_lease;
+    const auto apply_work = A.ApplyWork();
+
+    std::int32_t iteration{0};
+    while (true)
+    {
+        // r = b - A * x starts the basis of every cycle
+        auto& r = V(0);
+        std::copy(b.cbegin(), b.cend(), r.begin());
+        {
+            const auto timer = monitor.Time(iteration == 0 ? SolverPhase::kSetup : SolverPhase::kOperator);
+            A.Apply(-1.0, x, 1.0, r);
+        }
+        const auto beta = L2Norm(r);
+        if (iteration == 0)
+        {
+            monitor.RecordInitialResidual(beta);
+        }
+        if (beta <= tolerance || iteration >= max_iterations)
+        {
+            monitor.Finish(iteration, beta <= tolerance);
+            return iteration;
+        }
+        Scal(1.0 / beta, r);
+        std::fill(g.begin(), g.end(), 0.0);
+        g[0] = beta;
+
+        std::size_t k{0};
+        auto residual = beta;
+        while (k < m && iteration < max_iterations && residual > tolerance)
+        {
+            ++iteration;
+            const auto j = static_cast<std::int32_t>(k);
+
+            // w = A * inverse(M) * v_k, orthogonalized against the basis with modified Gram-Schmidt
+            auto& w = V(k + 1);
+            if (M)
+            {
+                const auto timer = monitor.Time(SolverPhase::kPreconditioner);
+                M->Apply(V(k), z);
+            }
+            {
+                const auto timer = monitor.Time(SolverPhase::kOperator);
+                A.Apply(1.0, M ? z : V(k), 0.0, w);
+            }
+            for (std::size_t i{0}; i <= k; ++i)
+            {
+                H(static_cast<std::int32_t>(i), j) = Dot(w, V(i));
+                Axpy(-H(static_cast<std::int32_t>(i), j), V(i), w);
+            }
+            const auto w_norm = L2Norm(w);
+            H(j + 1, j) = w_norm;
+
+            // Previous rotations reduce the new column to upper triangular form, a new one eliminates H(k + 1, k)
+            for (std::size_t i{0}; i < k; ++i)
+            {
+                const auto row = static_cast<std::int32_t>(i);
+                const auto h_upper = H(row, j);
+                const auto h_lower = H(row + 1, j);
+                H(row, j) = cosines[i] * h_upper + sines[i] * h_lower;
+                H(row + 1, j) = -sines[i] * h_upper + cosines[i] * h_lower;
+            }
+            const auto denominator = std::hypot(H(j, j), H(j + 1, j));
+            cosines[k] = H(j, j) / denominator;
+            sines[k] = H(j + 1, j) / denominator;
+            H(j, j) = denominator;
+            H(j + 1, j) = 0.0;
+            g[k + 1] = -sines[k] * g[k];
+            g[k] = cosines[k] * g[k];
+
+            // |g[k + 1]| is the residual norm of the minimizer over the basis, without forming it
+            residual = std::abs(g[k + 1]);
+            ++k;
+
+            // One product with A, k + 1 projections and the normalization of w
+            const auto vector_work = static_cast<double>(k + 1) * (DotWork(n) + AxpyWork(n));
+            monitor.AddWork(apply_work + vector_work);
+            monitor.RecordIteration(iteration, residual);
+
+            // Lucky breakdown, the basis holds the exact solution
+            if (w_norm == 0.0)
+            {
+                break;
+            }
+            Scal(1.0 / w_norm, w);
+        }
+
+        // Back substitution of the triangular system H * y = g, then x += inverse(M) * V * y
+        for (auto i = static_cast<std::int32_t>(k) - 1; i >= 0; --i)
+        {
+            auto sum = g[static_cast<std::size_t>(i)];
+            for (auto l = i + 1; l < static_cast<std::int32_t>(k); ++l)
+            {
+                sum -= H(i, l) * y[static_cast<std::size_t>(l)];
+            }
+            y[static_cast<std::size_t>(i)] = sum / H(i, i);
+        }
+        std::fill(update.begin(), update.end(), 0.0);
+        for (std::size_t i{0}; i < k; ++i)
+        {
+            Axpy(y[i], V(i), update);
+        }
+        if (M)
+        {
+            const auto timer = monitor.Time(SolverPhase::kPreconditioner);
+            M->Apply(update, z);
+        }
+        Axpy(1.0, M ? z : update, x);
+    }
+}
+
+}  // namespace
+
+std::int32_t GMRES(const Matrix<double>& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const double tolerance,
+                   const std::int32_t max_iterations,
+                   const std::int32_t restart,
+                   const SolverTelemetry& telemetry)
+{
+    return GMRESSolve(DenseMatrixOperator{A}, b, x, nullptr, tolerance, max_iterations, restart, telemetry);
+}
+
+std::int32_t GMRES(const Matrix<double>& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const Preconditioner& M,
+                   const double tolerance,
+                   const std::int32_t max_iterations,
+                   const std::int32_t restart,
+                   const SolverTelemetry& telemetry)
+{
+    return GMRESSolve(DenseMatrixOperator{A}, b, x, &M, tolerance, max_iterations, restart, telemetry);
+}
+
+std::int32_t GMRES(const CsrMatrix& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const double tolerance,
+                   const std::int32_t max_iterations,
+                   const std::int32_t restart,
+                   const SolverTelemetry& telemetry)
+{
+    return GMRESSolve(SparseMatrixOperator{A}, b, x, nullptr, tolerance, max_iterations, restart, telemetry);
+}
+
+std::int32_t GMRES(const CsrMatrix& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const Preconditioner& M,
+                   const double tolerance,
+                   const std::int32_t max_iterations,
+                   const std::int32_t restart,
+                   const SolverTelemetry& telemetry)
+{
+    return GMRESSolve(SparseMatrixOperator{A}, b, x, &M, tolerance, max_iterations, restart, telemetry);
+}
+
+std::int32_t GMRES(const LinearOperator& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const double tolerance,
+                   const std::int32_t max_iterations,
+                   const std::int32_t restart,
+                   const SolverTelemetry& telemetry)
+{
+    return GMRESSolve(A, b, x, nullptr, tolerance, max_iterations, restart, telemetry);
+}
+
+std::int32_t GMRES(const LinearOperator& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const Preconditioner& M,
+                   const double tolerance,
+                   const std::int32_t max_iterations,
+                   const std::int32_t restart,
+                   const SolverTelemetry& telemetry)
+{
+    return GMRESSolve(A, b, x, &M, tolerance, max_iterations, restart, telemetry);
+}
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,104 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#ifndef MATRIX_SOLVERS_ITERATIVE_SOLVERS_GMRES_H
+#define MATRIX_SOLVERS_ITERATIVE_SOLVERS_GMRES_H
+
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/preconditioners/preconditioner.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
+#include "matrix_solvers/utilities.h"
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Restarted generalized minimal residual iterative linear solver, GMRES(m)
+///
+/// Solves Ax = b for general, including non-symmetric, nxn matrices. Every iteration adds one vector to an
+/// orthonormal Krylov basis and picks the x that minimizes the residual over it, so the residual never grows. The
+/// basis costs restart + 1 vectors of memory and its orthogonalization O(restart * n) per iteration, after restart
+/// iterations it is discarded and the method starts over from the current x.
+///
+/// @param A nxn matrix
+/// @param b Right-hand side vector
+/// @param x On input: initial guess; on output: approximate solution
+/// @param tolerance Stopping criterion for the L2 norm of b - A * x
+/// @param max_iterations Maximum number of iterations, summed over all restarts
+/// @param restart Number of iterations m between restarts
+/// @param telemetry Optional stats and observer, receives the residual norm of the least squares problem after every
+/// iteration, which equals the L2 norm of b - A * x up to rounding
+///
+/// @return Number of iterations performed
+std::int32_t GMRES(const Matrix<double>& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const double tolerance = 1e-3,
+                   const std::int32_t max_iterations = 1000,
+                   const std::int32_t restart = 30,
+                   const SolverTelemetry& telemetry = {});
+
+/// @brief Right preconditioned GMRES(m), builds the Krylov basis of A * inverse(M)
+///
+/// Right preconditioning leaves the residual b - A * x unchanged, so the tolerance applies to the true residual.
+///
+/// @param M Preconditioner, e.g. ILU(0), need not be symmetric
+std::int32_t GMRES(const Matrix<double>& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const Preconditioner& M,
+                   const double tolerance = 1e-3,
+                   const std::int32_t max_iterations = 1000,
+                   const std::int32_t restart = 30,
+                   const SolverTelemetry& telemetry = {});
+
+/// @brief GMRES(m) iterative linear solver for a sparse matrix
+std::int32_t GMRES(const CsrMatrix& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const double tolerance = 1e-3,
+                   const std::int32_t max_iterations = 1000,
+                   const std::int32_t restart = 30,
+                   const SolverTelemetry& telemetry = {});
+
+/// @brief Right preconditioned GMRES(m) iterative linear solver for a sparse matrix
+std::int32_t GMRES(const CsrMatrix& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const Preconditioner& M,
+                   const double tolerance = 1e-3,
+                   const std::int32_t max_iterations = 1000,
+                   const std::int32_t restart = 30,
+                   const SolverTelemetry& telemetry = {});
+
+/// @brief GMRES(m) iterative linear solver for a matrix-free operator, only uses A.Apply()
+std::int32_t GMRES(const LinearOperator& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const double tolerance = 1e-3,
+                   const std::int32_t max_iterations = 1000,
+                   const std::int32_t restart = 30,
+                   const SolverTelemetry& telemetry = {});
+
+/// @brief Right preconditioned GMRES(m) iterative linear solver for a matrix-free operator
+std::int32_t GMRES(const LinearOperator& A,
+                   const std::vector<double>& b,
+                   std::vector<double>& x,
+                   const Preconditioner& M,
+                   const double tolerance = 1e-3,
+                   const std::int32_t max_iterations = 1000,
+                   const std::int32_t restart = 30,
+                   const SolverTelemetry& telemetry = {});
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_ITERATIVE_SOLVERS_GMRES_H
@@ -4,8 +4,12 @@
  */
 
 #include "matrix_solvers/iterative_solvers/jacobi.h"
+#include "matrix_solvers/operations/vector_kernels.h"
+#include "matrix_solvers/workspace/workspace.h"
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <numeric>
 
@@ -18,101 +22,290 @@ namespace matrix
 namespace
 {
 
-double L2Norm(const std::vector<double>& vector)
+/// @brief Sum of a_ij * x_j over the off-diagonal entries of row i
+double OffDiagonalRowProduct(const Matrix<double>& A, const std::vector<double>& x, const std::int32_t i)
 {
-    std::vector<double> vector_squared{};
+    const auto n = x.size();
+    const double* row = &A(i, 0);
+    const auto i_index = static_cast<std::size_t>(i);
+    return kernels::Dot(row, x.data(), i_index) +
+           kernels::Dot(row + i_index + 1, x.data() + i_index + 1, n - i_index - 1);
+}
 
-    std::transform(
-        std::cbegin(vector), std::cend(vector), std::back_inserter(vector_squared), [](const auto& vector_element) {
-            return vector_element * vector_element;
-        });
+/// @brief Sum of a_ij * x_j over the off-diagonal entries of row i of a sparse matrix, together with a_ii
+double OffDiagonalRowProduct(const CsrMatrix& A, const std::vector<double>& x, const std::int32_t i, double& diagonal)
+{
+    const auto& offsets = A.RowOffsets();
+    const auto& columns = A.ColumnIndices();
+    const auto& values = A.Values();
 
-    return std::sqrt(std::accumulate(std::cbegin(vector_squared), std::cend(vector_squared), 0.0));
+    double sum{0.0};
+    diagonal = 0.0;
+    for (auto k = offsets[i]; k < offsets[i + 1]; ++k)
+    {
+        if (columns[k] == i)
+        {
+            diagonal = values[k];
+        }
+        else
+        {
+            sum += values[k] * x[columns[k]];
+        }
+    }
+    return sum;
 }
 
 }  // namespace
 
 double Jacobi(const Matrix<double>& A, const std::vector<double>& b, std::vector<double>& x)
 {
+    double update_squared{0.0};
 
-    const auto x_initial = x;
-    double sum{0.0};
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(b.size()); ++i)
+    {
+        const auto x_i = (b[i] - OffDiagonalRowProduct(A, x, i)) / A(i, i);
+        update_squared += (x_i - x[i]) * (x_i - x[i]);
+        x[i] = x_i;
+    }
 
-    for (std::size_t i = 0; i < b.size(); ++i)
+    return std::sqrt(update_squared);
+
+}  // end FUNCTION jacobi
+
+void Jacobi(const Matrix<double>& A,
+            const std::vector<double>& b,
+            std::vector<double>& x,
+            const int max_iterations,
+            const double tolerance,
+            const SolverTelemetry& telemetry)
+{
+    // The only scratch vector of the solve, every sweep writes into it and is then swapped with x. It comes from the
+    // workspace of the thread, which takes back whichever of the two buffers x does not hold at the end
+    auto x_new_lease = CurrentWorkspace().Acquire(x.size());
+    auto& x_new = *x_new_lease;
+    SolverMonitor monitor{telemetry};
+
+    // Every sweep reads A once and updates and measures x once
+    const auto iteration_work = DenseMatrixOperator{A}.ApplyWork() + AxpyWork(b.size());
+
+    std::int32_t iteration{0};
+
+    auto residual = std::numeric_limits<double>::infinity();
+
+    while ((residual > tolerance) && (iteration < max_iterations))
     {
-        for (std::size_t j = 0; j < b.size(); ++j)
+        ++iteration;
+
+        double update_squared{0.0};
+        for (std::int32_t i = 0; i < static_cast<std::int32_t>(b.size()); ++i)
         {
-            if (j != i)
-            {
-                sum += (A.at(i).at(j) * x.at(j));
-            }
+            x_new[i] = (b[i] - OffDiagonalRowProduct(A, x, i)) / A(i, i);
+            update_squared += (x_new[i] - x[i]) * (x_new[i] - x[i]);
         }
 
-        x.at(i) = (b.at(i) - sum) / A.at(i).at(i);
-        sum = 0.0;
-    }
+        residual = std::sqrt(update_squared);
+        x.swap(x_new);
 
-    std::vector<double> residual{};
-    std::transform(std::cbegin(x),
-                   std::cend(x),
-                   std::cbegin(x_initial),
-                   std::back_inserter(residual),
-                   [](const auto& x_element, const auto& x_initial_element) { return x_initial_element - x_element; });
+        monitor.AddWork(iteration_work);
+        monitor.RecordIteration(iteration, residual);
+    }
 
-    return L2Norm(residual);
+    monitor.Finish(iteration, residual <= tolerance);
 
 }  // end FUNCTION jacobi
 
-void Jacobi(const Matrix<double>& A,
+double Jacobi(const CsrMatrix& A, const std::vector<double>& b, std::vector<double>& x)
+{
+    double update_squared{0.0};
+
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(b.size()); ++i)
+    {
+        double diagonal{};
+        const auto sum = OffDiagonalRowProduct(A, x, i, diagonal);
+        const auto x_i = (b[i] - sum) / diagonal;
+        update_squared += (x_i - x[i]) * (x_i - x[i]);
+        x[i] = x_i;
+    }
+
+    return std::sqrt(update_squared);
+}
+
+double WeightedJacobi(const CsrMatrix& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const double omega,
+                      std::vector<double>& workspace)
+{
+    workspace.assign(x.cbegin(), x.cend());
+
+    double update_squared{0.0};
+    for (std::int32_t i = 0; i < static_cast<std::int32_t>(b.size()); ++i)
+    {
+        double diagonal{};
+        const auto sum = OffDiagonalRowProduct(A, workspace, i, diagonal);
+        const auto update = omega * ((b[i] - sum) / diagonal - workspace[i]);
+        update_squared += update * update;
+        x[i] += update;
+    }
+
+    return std::sqrt(update_squared);
+}
+
+void Jacobi(const CsrMatrix& A,
             const std::vector<double>& b,
             std::vector<double>& x,
             const int max_iterations,
-            const double tolerance)
+            const double tolerance,
+            const SolverTelemetry& telemetry)
 {
-    auto x_new = x;
-    auto residual_vector = x;
-    double sum{0.0};
-    double iteration{0.0};
+    auto x_new_lease = CurrentWorkspace().Acquire(x.size());
+    auto& x_new = *x_new_lease;
+    SolverMonitor monitor{telemetry};
+
+    const auto iteration_work = SparseMatrixOperator{A}.ApplyWork() + AxpyWork(b.size());
+
+    std::int32_t iteration{0};
 
     auto residual = std::numeric_limits<double>::infinity();
 
-    while (residual > tolerance)
+    while ((residual > tolerance) && (iteration < max_iterations))
     {
         ++iteration;
 
-        for (std::size_t i = 0; i < b.size(); ++i)
+        double update_squared{0.0};
+        for (std::int32_t i = 0; i < static_cast<std::int32_t>(b.size()); ++i)
         {
-            for (std::size_t j = 0; j < b.size(); ++j)
-            {
-                if (j != i)
-                {
-                    sum += (A.at(i).at(j) * x.at(j));
-                }
-            }
-
-            x_new.at(i) = (b.at(i) - sum) / A.at(i).at(i);
-            sum = 0.0;
+            double diagonal{};
+            const auto sum = OffDiagonalRowProduct(A, x, i, diagonal);
+            x_new[i] = (b[i] - sum) / diagonal;
+            update_squared += (x_new[i] - x[i]) * (x_new[i] - x[i]);
         }
 
-        std::transform(
-            std::cbegin(x),
-            std::cend(x),
-            std::cbegin(x_new),
-            std::back_inserter(residual_vector),
-            [](const auto& x_element, const auto& x_initial_element) { return x_initial_element - x_element; });
-        residual = L2Norm(residual_vector);
+        residual = std::sqrt(update_squared);
+        x.swap(x_new);
 
-        if (iteration > max_iterations)
+        monitor.AddWork(iteration_work);
+        monitor.RecordIteration(iteration, residual);
+    }
+
+    monitor.Finish(iteration, residual <= tolerance);
+}
+
+void Jacobi(const CsrMatrix& A,
+            const std::vector<double>& b,
+            std::vector<double>& x,
+            const int max_iterations,
+            const double tolerance,
+            ThreadPool& pool,
+            const SolverTelemetry& telemetry)
+{
+    // Leased on the calling thread, the workers only write into the buffers
+    auto& workspace = CurrentWorkspace();
+    auto x_new_lease = workspace.Acquire(x.size());
+    auto update_squared_lease = workspace.Acquire(static_cast<std::size_t>(pool.NumberOfThreads()));
+    auto& x_new = *x_new_lease;
+    auto& update_squared = *update_squared_lease;
+    SolverMonitor monitor{telemetry};
+
+    const auto iteration_work = SparseMatrixOperator{A}.ApplyWork() + AxpyWork(b.size());
+
+    std::int32_t iteration{0};
+
+    const auto sweep = [&](const std::int32_t begin, const std::int32_t end, const std::int32_t thread_index) {
+        double chunk_update_squared{0.0};
+        for (auto i = begin; i < end; ++i)
         {
-            break;
+            double diagonal{};
+            const auto sum = OffDiagonalRowProduct(A, x, i, diagonal);
+            x_new[i] = (b[i] - sum) / diagonal;
+            chunk_update_squared += (x_new[i] - x[i]) * (x_new[i] - x[i]);
         }
-        else
+        update_squared[static_cast<std::size_t>(thread_index)] = chunk_update_squared;
+    };
+
+    auto residual = std::numeric_limits<double>::infinity();
+
+    while ((residual > tolerance) && (iteration < max_iterations))
+    {
+        ++iteration;
+
+        std::fill(update_squared.begin(), update_squared.end(), 0.0);
+        pool.ParallelFor(0, static_cast<std::int32_t>(b.size()), sweep);
+
+        residual = std::sqrt(std::accumulate(update_squared.cbegin(), update_squared.cend(), 0.0));
+        x.swap(x_new);
+
+        monitor.AddWork(iteration_work);
+        monitor.RecordIteration(iteration, residual);
+    }
+
+    monitor.Finish(iteration, residual <= tolerance);
+}
+
+double Jacobi(const LinearOperator& A, const std::vector<double>& b, std::vector<double>& x)
+{
+    const auto diagonal = A.Diagonal();
+    auto b_minus_Ax_lease = CurrentWorkspace().Acquire(b.size());
+    auto& b_minus_Ax = *b_minus_Ax_lease;
+    std::copy(b.cbegin(), b.cend(), b_minus_Ax.begin());
+    A.Apply(-1.0, x, 1.0, b_minus_Ax);
+
+    // x_i + (b - A * x)_i / a_ii is the Jacobi update written without the off-diagonal part of A
+    double update_squared{0.0};
+    for (std::size_t i = 0; i < b.size(); ++i)
+    {
+        const auto update = b_minus_Ax[i] / diagonal[i];
+        update_squared += update * update;
+        x[i] += update;
+    }
+
+    return std::sqrt(update_squared);
+}
+
+void Jacobi(const LinearOperator& A,
+            const std::vector<double>& b,
+            std::vector<double>& x,
+            const int max_iterations,
+            const double tolerance,
+            const SolverTelemetry& telemetry)
+{
+    SolverMonitor monitor{telemetry};
+    const auto diagonal = [&]() {
+        const auto timer = monitor.Time(SolverPhase::kSetup);
+        return A.Diagonal();
+    }();
+    auto b_minus_Ax_lease = CurrentWorkspace().Acquire(b.size());
+    auto& b_minus_Ax = *b_minus_Ax_lease;
+
+    const auto iteration_work = A.ApplyWork() + AxpyWork(b.size());
+
+    std::int32_t iteration{0};
+
+    auto residual = std::numeric_limits<double>::infinity();
+
+    while ((residual > tolerance) && (iteration < max_iterations))
+    {
+        ++iteration;
+
+        std::copy(b.cbegin(), b.cend(), b_minus_Ax.begin());
+        A.Apply(-1.0, x, 1.0, b_minus_Ax);
+
+        double update_squared{0.0};
+        for (std::size_t i = 0; i < b.size(); ++i)
         {
-            x = x_new;
+            const auto update = b_minus_Ax[i] / diagonal[i];
+            update_squared += update * update;
+            x[i] += update;
         }
+
+        residual = std::sqrt(update_squared);
+
+        monitor.AddWork(iteration_work);
+        monitor.RecordIteration(iteration, residual);
     }
 
-}  // end FUNCTION jacobi
+    monitor.Finish(iteration, residual <= tolerance);
+}
 
 }  // namespace matrix
 
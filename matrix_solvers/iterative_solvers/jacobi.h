@@ -6,6 +6,10 @@
 #ifndef MATRIX_SOLVERS_ITERATIVE_SOLVERS_JACOBI_H
 #define MATRIX_SOLVERS_ITERATIVE_SOLVERS_JACOBI_H
 
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/parallel/thread_pool.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include "matrix_solvers/utilities.h"
 #include <vector>
 
@@ -29,13 +33,62 @@ double Jacobi(const Matrix<double>& A, const std::vector<double>& b, std::vector
 /// @param A: nxn Matrix
 /// @param b:	Right hand side of matrix equation
 /// @param x: Initialized solution
-///
-/// @return residual: L2 norm defined as sqrt(sum((x-x0)^2))
+/// @param telemetry: optional stats and observer, receives the L2 norm of every update
 void Jacobi(const Matrix<double>& A,
             const std::vector<double>& b,
             std::vector<double>& x,
             const int max_iterations,
-            const double tolerance);
+            const double tolerance,
+            const SolverTelemetry& telemetry = {});
+
+/// @brief Single Jacobi iteration on a sparse matrix, every row must store its diagonal entry
+double Jacobi(const CsrMatrix& A, const std::vector<double>& b, std::vector<double>& x);
+
+/// @brief Single weighted Jacobi sweep on a sparse matrix, x = x + omega * inverse(D) * (b - A * x)
+///
+/// Every row reads the previous iterate, which is copied into workspace. With omega = 2/3 in 1D or 4/5 in 2D the
+/// oscillatory error modes of a Laplace matrix are damped the most, which makes it a multigrid smoother.
+///
+/// @param omega: relaxation weight, 1 is the plain Jacobi update
+/// @param workspace: scratch storage for the previous iterate, resized to the length of x
+///
+/// @return residual: L2 norm of the update
+double WeightedJacobi(const CsrMatrix& A,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const double omega,
+                      std::vector<double>& workspace);
+
+/// @brief Full Jacobi solver on a sparse matrix, every row must store its diagonal entry
+void Jacobi(const CsrMatrix& A,
+            const std::vector<double>& b,
+            std::vector<double>& x,
+            const int max_iterations,
+            const double tolerance,
+            const SolverTelemetry& telemetry = {});
+
+/// @brief Full Jacobi solver on a sparse matrix with the rows statically partitioned over the threads of pool
+///
+/// Every sweep only reads the previous iterate, so the result matches the serial solver up to the summation order of
+/// the residual.
+void Jacobi(const CsrMatrix& A,
+            const std::vector<double>& b,
+            std::vector<double>& x,
+            const int max_iterations,
+            const double tolerance,
+            ThreadPool& pool,
+            const SolverTelemetry& telemetry = {});
+
+/// @brief Single Jacobi iteration on a matrix-free operator, only uses A.Apply() and A.Diagonal()
+double Jacobi(const LinearOperator& A, const std::vector<double>& b, std::vector<double>& x);
+
+/// @brief Full Jacobi solver on a matrix-free operator, only uses A.Apply() and A.Diagonal()
+void Jacobi(const LinearOperator& A,
+            const std::vector<double>& b,
+            std::vector<double>& x,
+            const int max_iterations,
+            const double tolerance,
+            const SolverTelemetry& telemetry = {});
 
 }  // namespace matrix
 
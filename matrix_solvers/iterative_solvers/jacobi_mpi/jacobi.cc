@@ -3,9 +3,8 @@
  */
 
 #include "matrix_solvers/iterative_solvers/jacobi_mpi/jacobi.h"
+#include <cmath>
 #include <cstring>
-#include <iomanip>
-#include <iostream>
 #include <mpi.h>
 
 void JacobiMPI(double* A,
@@ -19,13 +18,19 @@ void JacobiMPI(double* A,
                const std::int32_t rows_for_this_process,
                const std::int32_t start_row,
                const std::int32_t* sendcounts_b,
-               const std::int32_t* displacements_b)
+               const std::int32_t* displacements_b,
+               const nm::matrix::SolverTelemetry& telemetry)
 {
+    // Only the root knows whether the iteration converged, the other ranks report to nobody
+    const nm::matrix::SolverTelemetry no_telemetry{};
+    nm::matrix::SolverMonitor monitor{world_rank == ROOT_PROCESS_LABEL ? telemetry : no_telemetry};
+
     // Allocate memory for local solution vector
     double* local_x = new double[rows_for_this_process];
     std::int32_t global_index{0};
     bool converged{false};
-    for (std::int32_t iter = 0; iter < max_iter; ++iter)
+    std::int32_t iter = 0;
+    for (; iter < max_iter; ++iter)
     {
         double local_sum = 0.0;
         for (std::int32_t i = 0; i < rows_for_this_process; ++i)
@@ -52,24 +57,13 @@ void JacobiMPI(double* A,
         MPI_Allreduce(&local_sum, &global_sum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
         // Check convergence
+        monitor.RecordIteration(iter + 1, global_sum);
         if (global_sum < tolerance && world_rank == ROOT_PROCESS_LABEL)
         {
-            std::cout << "Jacobi iteration converged after " << iter + 1 << " iterations." << std::endl;
             converged = true;
         }
-        else if (world_rank == ROOT_PROCESS_LABEL)
-        {
-            std::cout << std::fixed << std::setprecision(4);
-            std::cout << "Iteration: " << std::setw(4) << iter + 1 << " | Global Sum Residual: " << global_sum << "\n";
-        }
         MPI_Bcast(&converged, 1, MPI_C_BOOL, ROOT_PROCESS_LABEL, MPI_COMM_WORLD);
 
-        if (world_rank == ROOT_PROCESS_LABEL && iter == max_iter - 1)
-        {
-            std::cout << "Maximum iterations reached (" << max_iter << ")."
-                      << "\n";
-        }
-
         // Share the updated solution vector
         MPI_Allgatherv(x + start_row,
                        rows_for_this_process,
@@ -82,9 +76,11 @@ void JacobiMPI(double* A,
 
         if (converged)
         {
+            ++iter;
             break;
         }
     }
+    monitor.Finish(iter, converged);
 
     delete[] local_x;
 }
@@ -7,8 +7,11 @@
 
 #define ROOT_PROCESS_LABEL 0
 
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include <cstdint>
 
+/// @param telemetry: optional stats and observer, only the root process records the global sum of |x - x0| of every
+/// iteration
 void JacobiMPI(double* A,
                double* b,
                double* x,
@@ -20,6 +23,7 @@ void JacobiMPI(double* A,
                const std::int32_t rows_for_this_process,
                const std::int32_t start_row,
                const std::int32_t* sendcounts_b,
-               const std::int32_t* displacements_b);
+               const std::int32_t* displacements_b,
+               const nm::matrix::SolverTelemetry& telemetry = {});
 
 #endif  // MATRIX_SOLVERS_ITERATIVE_SOLVERS_JACOBI_MPI_JACOBI_H
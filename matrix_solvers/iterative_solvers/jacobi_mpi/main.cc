@@ -105,6 +105,7 @@ int main()
                  MPI_COMM_WORLD);
     MPI_Bcast(x, n, MPI_DOUBLE, ROOT_PROCESS_LABEL, MPI_COMM_WORLD);
 
+    nm::matrix::SolverStats stats{};
     const auto start = MPI_Wtime();
     JacobiMPI(local_A,
               local_b,
@@ -117,12 +118,14 @@ int main()
               rows_for_this_process,
               start_row,
               sendcounts_b,
-              displacements_b);
+              displacements_b,
+              {&stats});
     const auto end = MPI_Wtime();
     const double elapsed_time = end - start;
     if (world_rank == ROOT_PROCESS_LABEL)
     {
-        std::cout << "Jacobi iteration completed in " << elapsed_time << " seconds.\n";
+        std::cout << "Jacobi iteration " << (stats.converged ? "converged" : "reached the maximum iterations")
+                  << " after " << stats.iterations << " iterations in " << elapsed_time << " seconds.\n";
     }
 
     if (world_rank == ROOT_PROCESS_LABEL)
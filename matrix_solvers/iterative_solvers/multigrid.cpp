@@ -0,0 +1,362 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/iterative_solvers/multigrid.h"
+#include "matrix_solvers/iterative_solvers/gauss_seidel.h"
+#include "matrix_solvers/iterative_solvers/jacobi.h"
+#include "matrix_solvers/operations/vector_kernels.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+struct InterpolationWeight
+{
+    std::int32_t coarse_node{};
+    double weight{};
+};
+
+/// @brief Whether a dimension with n nodes is halved
+bool IsCoarsened(const std::int32_t n, const std::int32_t coarsest_size)
+{
+    return n > coarsest_size;
+}
+
+/// @brief The even numbered nodes, plus the last node when n is even so that both end nodes stay on the coarse grid
+std::int32_t CoarseSize(const std::int32_t n, const bool is_coarsened)
+{
+    return is_coarsened ? n / 2 + 1 : n;
+}
+
+/// @brief Fine node of one dimension with n nodes that coarse node c is a copy of
+std::int32_t FineCopy(const std::int32_t c, const std::int32_t n, const bool is_coarsened)
+{
+    return is_coarsened ? std::min(2 * c, n - 1) : c;
+}
+
+/// @brief Coarse nodes that fine node i of one dimension with n nodes is interpolated from
+std::vector<InterpolationWeight> InterpolationWeights(const std::int32_t i,
+                                                      const std::int32_t n,
+                                                      const bool is_coarsened)
+{
+    if (!is_coarsened)
+    {
+        return {{i, 1.0}};
+    }
+    if (i % 2 == 0)
+    {
+        return {{i / 2, 1.0}};
+    }
+    if (i == n - 1)
+    {
+        // Last node of an even count, copied to the coarse grid one fine spacing after its neighbour
+        return {{i / 2 + 1, 1.0}};
+    }
+    return {{i / 2, 0.5}, {i / 2 + 1, 0.5}};
+}
+
+/// @brief Whether every row of A only stores its diagonal entry, e.g. a Dirichlet boundary row
+std::vector<bool> FindDecoupledRows(const CsrMatrix& A)
+{
+    const auto& offsets = A.RowOffsets();
+    const auto& columns = A.ColumnIndices();
+    std::vector<bool> is_decoupled(static_cast<std::size_t>(A.NumberOfRows()));
+    for (std::int32_t i{0}; i < A.NumberOfRows(); ++i)
+    {
+        is_decoupled[static_cast<std::size_t>(i)] = offsets[i + 1] - offsets[i] == 1 && columns[offsets[i]] == i;
+    }
+    return is_decoupled;
+}
+
+/// @brief Linear interpolation in every halved dimension, the tensor product of the 1D interpolations
+///
+/// Decoupled rows are solved exactly by every smoothing sweep, so their correction is zero: they are neither
+/// corrected nor interpolated from, except for the injection between a decoupled node and its coarse copy.
+CsrMatrix CreateProlongation(const GridShape fine, const GridShape coarse, const std::vector<bool>& is_decoupled)
+{
+    const bool is_x_coarsened = coarse.nx != fine.nx;
+    const bool is_y_coarsened = coarse.ny != fine.ny;
+
+    CooMatrix P(fine.nx * fine.ny, coarse.nx * coarse.ny);
+    P.Reserve(4 * static_cast<std::size_t>(fine.nx) * static_cast<std::size_t>(fine.ny));
+    for (std::int32_t y{0}; y < fine.ny; ++y)
+    {
+        const auto y_weights = InterpolationWeights(y, fine.ny, is_y_coarsened);
+        for (std::int32_t x{0}; x < fine.nx; ++x)
+        {
+            const auto fine_node = x + fine.nx * y;
+            for (const auto& y_weight : y_weights)
+            {
+                for (const auto& x_weight : InterpolationWeights(x, fine.nx, is_x_coarsened))
+                {
+                    const auto coarse_x = x_weight.coarse_node;
+                    const auto coarse_y = y_weight.coarse_node;
+                    const auto copy_x = FineCopy(coarse_x, fine.nx, is_x_coarsened);
+                    const auto copy_y = FineCopy(coarse_y, fine.ny, is_y_coarsened);
+                    const auto copy_of_coarse_node = static_cast<std::size_t>(copy_x + fine.nx * copy_y);
+                    const auto is_injection = static_cast<std::size_t>(fine_node) == copy_of_coarse_node;
+                    if (!is_injection && (is_decoupled[static_cast<std::size_t>(fine_node)] ||
+                                          is_decoupled[copy_of_coarse_node]))
+                    {
+                        continue;
+                    }
+                    P.Add(fine_node, coarse_x + coarse.nx * coarse_y, x_weight.weight * y_weight.weight);
+                }
+            }
+        }
+    }
+    return CsrMatrix{P};
+}
+
+double ResidualNorm(const CsrMatrix& A,
+                    const std::vector<double>& b,
+                    const std::vector<double>& x,
+                    std::vector<double>& r)
+{
+    r = b;
+    SpMV(-1.0, A, x, 1.0, r);
+    return std::sqrt(kernels::SumOfSquares(r.data(), r.size()));
+}
+
+}  // namespace
+
+Multigrid::Multigrid(const CsrMatrix& A, const GridShape shape, const MultigridOptions& options) : options_(options)
+{
+    if (shape.nx < 1 || shape.ny < 1)
+    {
+        throw std::invalid_argument("Multigrid grid dimensions must be positive.");
+    }
+    if (A.NumberOfRows() != A.NumberOfColumns() || A.NumberOfRows() != shape.nx * shape.ny)
+    {
+        throw std::length_error("Multigrid matrix must be square with one row per grid node.");
+    }
+
+    levels_.push_back(Level{A, shape, {}, {}});
+    while (true)
+    {
+        auto& fine = levels_.back();
+        const auto is_x_coarsened = IsCoarsened(fine.shape.nx, options_.coarsest_size);
+        const auto is_y_coarsened = IsCoarsened(fine.shape.ny, options_.coarsest_size);
+        if (!is_x_coarsened && !is_y_coarsened)
+        {
+            break;
+        }
+
+        const GridShape coarse_shape{CoarseSize(fine.shape.nx, is_x_coarsened),
+                                     CoarseSize(fine.shape.ny, is_y_coarsened)};
+        fine.prolongation = CreateProlongation(fine.shape, coarse_shape, FindDecoupledRows(fine.A));
+
+        // Full weighting, the coarse node keeps half of its weight per halved dimension
+        const auto scale = (is_x_coarsened ? 0.5 : 1.0) * (is_y_coarsened ? 0.5 : 1.0);
+        fine.restriction = ScalarMultiply(scale, fine.prolongation.Transpose());
+
+        auto coarse_A = MatMult(fine.restriction, MatMult(fine.A, fine.prolongation));
+        levels_.push_back(Level{std::move(coarse_A), coarse_shape, {}, {}});
+    }
+
+    coarsest_solver_ = LUFactorization{levels_.back().A.ToDense()};
+
+    vectors_.resize(levels_.size());
+    for (std::size_t level{0}; level < levels_.size(); ++level)
+    {
+        const auto n = static_cast<std::size_t>(levels_[level].A.NumberOfRows());
+        auto& vectors = vectors_[level];
+        vectors.residual.resize(n);
+        vectors.workspace.resize(n);
+        if (level > 0)
+        {
+            vectors.b.resize(n);
+            vectors.x.resize(n);
+        }
+    }
+}
+
+std::int32_t Multigrid::NumberOfRows() const
+{
+    return levels_.empty() ? 0 : levels_.front().A.NumberOfRows();
+}
+
+const CsrMatrix& Multigrid::LevelMatrix(const std::int32_t level) const
+{
+    return levels_.at(static_cast<std::size_t>(level)).A;
+}
+
+GridShape Multigrid::LevelShape(const std::int32_t level) const
+{
+    return levels_.at(static_cast<std::size_t>(level)).shape;
+}
+
+void Multigrid::Smooth(const std::size_t level,
+                       const std::vector<double>& b,
+                       std::vector<double>& x,
+                       const std::int32_t sweeps) const
+{
+    const auto& A = levels_[level].A;
+    for (std::int32_t sweep{0}; sweep < sweeps; ++sweep)
+    {
+        if (options_.smoother == MultigridSmoother::kWeightedJacobi)
+        {
+            WeightedJacobi(A, b, x, options_.jacobi_weight, vectors_[level].workspace);
+        }
+        else
+        {
+            GaussSeidel(A, b, x);
+        }
+    }
+}
+
+void Multigrid::Cycle(const std::size_t level,
+                      const std::vector<double>& b,
+                      std::vector<double>& x,
+                      const std::int32_t number_of_corrections) const
+{
+    if (level + 1 == levels_.size())
+    {
+        std::copy(b.cbegin(), b.cend(), x.begin());
+        coarsest_solver_.SolveInPlace(x);
+        return;
+    }
+
+    const auto& current = levels_[level];
+    auto& coarse = vectors_[level + 1];
+
+    Smooth(level, b, x, options_.pre_smoothing_sweeps);
+
+    // Coarse grid correction, the error satisfies A * e = b - A * x and is smooth after the pre-smoothing sweeps
+    auto& residual = vectors_[level].residual;
+    std::copy(b.cbegin(), b.cend(), residual.begin());
+    SpMV(-1.0, current.A, x, 1.0, residual);
+    SpMV(1.0, current.restriction, residual, 0.0, coarse.b);
+    std::fill(coarse.x.begin(), coarse.x.end(), 0.0);
+    for (std::int32_t correction{0}; correction < number_of_corrections; ++correction)
+    {
+        Cycle(level + 1, coarse.b, coarse.x, number_of_corrections);
+    }
+    SpMV(1.0, current.prolongation, coarse.x, 1.0, x);
+
+    Smooth(level, b, x, options_.post_smoothing_sweeps);
+}
+
+void Multigrid::FullCycle(const std::vector<double>& b, std::vector<double>& x) const
+{
+    if (levels_.size() == 1)
+    {
+        Cycle(0, b, x, 1);
+        return;
+    }
+
+    // Restrict the right hand side down to every level, then solve from the coarsest level up
+    SpMV(1.0, levels_[0].restriction, b, 0.0, vectors_[1].b);
+    for (std::size_t level{1}; level + 1 < levels_.size(); ++level)
+    {
+        SpMV(1.0, levels_[level].restriction, vectors_[level].b, 0.0, vectors_[level + 1].b);
+    }
+
+    const auto coarsest = levels_.size() - 1;
+    Cycle(coarsest, vectors_[coarsest].b, vectors_[coarsest].x, 1);
+    for (auto level = coarsest - 1; level > 0; --level)
+    {
+        // The coarse iterate is consumed before the V-cycle of this level reuses it for its own correction
+        SpMV(1.0, levels_[level].prolongation, vectors_[level + 1].x, 0.0, vectors_[level].x);
+        Cycle(level, vectors_[level].b, vectors_[level].x, 1);
+    }
+    SpMV(1.0, levels_[0].prolongation, vectors_[1].x, 0.0, x);
+    Cycle(0, b, x, 1);
+}
+
+void Multigrid::Apply(const std::vector<double>& r, std::vector<double>& z) const
+{
+    CheckDimensions(r, z);
+    std::fill(z.begin(), z.end(), 0.0);
+    switch (options_.cycle)
+    {
+        case MultigridCycle::kW:
+            Cycle(0, r, z, 2);
+            break;
+        case MultigridCycle::kFull:
+            FullCycle(r, z);
+            break;
+        case MultigridCycle::kV:
+        default:
+            Cycle(0, r, z, 1);
+            break;
+    }
+}
+
+WorkEstimate Multigrid::CycleWork() const
+{
+    // A W-cycle visits level l 2^l times, every visit smooths, forms the residual and transfers to and from level l + 1
+    const auto corrections = options_.cycle == MultigridCycle::kW ? 2.0 : 1.0;
+    const auto sweeps = static_cast<double>(options_.pre_smoothing_sweeps + options_.post_smoothing_sweeps);
+
+    WorkEstimate work{};
+    double visits{1.0};
+    for (std::size_t level{0}; level + 1 < levels_.size(); ++level)
+    {
+        const auto& current = levels_[level];
+        const auto transfer_work = SparseMatrixOperator{current.restriction}.ApplyWork() +
+                                   SparseMatrixOperator{current.prolongation}.ApplyWork();
+        work = work + visits * ((sweeps + 1.0) * SparseMatrixOperator{current.A}.ApplyWork() + transfer_work);
+        visits *= corrections;
+    }
+    return work;
+}
+
+std::int32_t Multigrid::Solve(const std::vector<double>& b,
+                              std::vector<double>& x,
+                              const double tolerance,
+                              const std::int32_t max_cycles,
+                              const SolverTelemetry& telemetry) const
+{
+    CheckDimensions(b, x);
+
+    SolverMonitor monitor{telemetry};
+    const auto cycle_work = monitor.IsActive() ? CycleWork() : WorkEstimate{};
+
+    const auto& A = levels_.front().A;
+    auto& residual = vectors_.front().residual;
+    std::int32_t cycle{0};
+    if (options_.cycle == MultigridCycle::kFull && max_cycles > 0)
+    {
+        FullCycle(b, x);
+        ++cycle;
+    }
+
+    auto residual_norm = ResidualNorm(A, b, x, residual);
+    if (cycle == 0)
+    {
+        monitor.RecordInitialResidual(residual_norm);
+    }
+    else
+    {
+        monitor.AddWork(cycle_work);
+        monitor.RecordIteration(cycle, residual_norm);
+    }
+    while (cycle < max_cycles && residual_norm > tolerance)
+    {
+        Cycle(0, b, x, options_.cycle == MultigridCycle::kW ? 2 : 1);
+        ++cycle;
+
+        residual_norm = ResidualNorm(A, b, x, residual);
+        monitor.AddWork(cycle_work);
+        monitor.RecordIteration(cycle, residual_norm);
+    }
+
+    monitor.Finish(cycle, residual_norm <= tolerance);
+    return cycle;
+}
+
+}  // namespace matrix
+
+}  // namespace nm
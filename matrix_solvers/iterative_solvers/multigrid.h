@@ -0,0 +1,161 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Geometric multigrid solver for matrices assembled on structured 1D and 2D grids
+ */
+
+#ifndef MATRIX_SOLVERS_ITERATIVE_SOLVERS_MULTIGRID_H
+#define MATRIX_SOLVERS_ITERATIVE_SOLVERS_MULTIGRID_H
+
+#include "matrix_solvers/decomposition_methods/lu_decomposition.h"
+#include "matrix_solvers/preconditioners/preconditioner.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Order in which the levels are visited
+enum class MultigridCycle : std::int8_t
+{
+    // One coarse grid correction per level
+    kV = 0,
+    // Two coarse grid corrections per level, more work per cycle but more robust
+    kW = 1,
+    // Full multigrid, interpolates the coarse solution up as the initial guess of a V-cycle on every level
+    kFull = 2,
+};
+
+enum class MultigridSmoother : std::int8_t
+{
+    kGaussSeidel = 0,
+    kWeightedJacobi = 1,
+};
+
+struct MultigridOptions
+{
+    MultigridCycle cycle{MultigridCycle::kV};
+    MultigridSmoother smoother{MultigridSmoother::kGaussSeidel};
+    std::int32_t pre_smoothing_sweeps{2};
+    std::int32_t post_smoothing_sweeps{2};
+    double jacobi_weight{2.0 / 3.0};
+
+    // A dimension is no longer halved once it has this many nodes or fewer, which bounds the dense coarsest solve
+    std::int32_t coarsest_size{3};
+};
+
+/// @brief Number of nodes of a structured grid in every dimension, node (x, y) is row x + nx * y of the matrix
+struct GridShape
+{
+    std::int32_t nx{1};
+    std::int32_t ny{1};
+};
+
+/// @brief Geometric multigrid hierarchy for a matrix assembled on a structured grid
+///
+/// Every coarse level keeps the even numbered nodes of the level above in each dimension, and the last node when the
+/// number of nodes is even, prolongation is linear (bilinear in 2D) interpolation and restriction is full weighting,
+/// its transpose scaled by 1/2 per halved dimension. Coarse matrices are the Galerkin products R * A * P, so boundary
+/// rows and variable coefficients carry over without rediscretizing, and the coarsest level is solved with a dense LU
+/// factorization. Rows that only store their diagonal entry, such as Dirichlet boundary rows, are excluded from the
+/// transfers so that their exact values are never disturbed by a coarse grid correction.
+///
+/// Each level costs a constant factor less than the one above, so a cycle is O(N) and the number of cycles does not
+/// grow with the grid.
+///
+/// The vectors of the coarse levels are kept between cycles, so one instance must not be used by several threads at
+/// once.
+class Multigrid : public Preconditioner
+{
+  public:
+    Multigrid() = default;
+
+    /// @param A: square matrix with one row per grid node
+    /// @param shape: nodes per dimension, ny = 1 for 1D grids
+    ///
+    /// @throws std::invalid_argument: when a dimension of shape is not positive, or a coarse level cannot be
+    /// factorized
+    /// @throws std::length_error: when A is not square or its size does not match shape
+    Multigrid(const CsrMatrix& A, const GridShape shape, const MultigridOptions& options = {});
+
+    std::int32_t NumberOfRows() const override;
+    std::int32_t NumberOfLevels() const { return static_cast<std::int32_t>(levels_.size()); }
+
+    /// @brief Matrix of a level, 0 is the finest
+    const CsrMatrix& LevelMatrix(const std::int32_t level) const;
+    GridShape LevelShape(const std::int32_t level) const;
+
+    /// @brief One cycle from a zero initial guess, z approximates inverse(A) * r
+    void Apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+    /// @brief Cycles until the L2 norm of b - A * x is at most tolerance
+    ///
+    /// For a full multigrid cycle the first cycle ignores the initial x, later cycles are V-cycles.
+    ///
+    /// @param telemetry: optional stats and observer, receives the L2 norm of b - A * x after every cycle
+    ///
+    /// @return number of cycles taken
+    ///
+    /// @throws std::length_error: when b or x do not have NumberOfRows() entries
+    std::int32_t Solve(const std::vector<double>& b,
+                       std::vector<double>& x,
+                       const double tolerance,
+                       const std::int32_t max_cycles,
+                       const SolverTelemetry& telemetry = {}) const;
+
+  private:
+    struct Level
+    {
+        CsrMatrix A{};
+        GridShape shape{};
+
+        // Transfer to and from the next coarser level, empty on the coarsest level
+        CsrMatrix restriction{};
+        CsrMatrix prolongation{};
+    };
+
+    struct LevelVectors
+    {
+        std::vector<double> b{};
+        std::vector<double> x{};
+        std::vector<double> residual{};
+        std::vector<double> workspace{};
+    };
+
+    void Smooth(const std::size_t level,
+                const std::vector<double>& b,
+                std::vector<double>& x,
+                const std::int32_t sweeps) const;
+
+    /// @brief V-cycle (number_of_corrections = 1) or W-cycle (number_of_corrections = 2) on level with initial guess x
+    void Cycle(const std::size_t level,
+               const std::vector<double>& b,
+               std::vector<double>& x,
+               const std::int32_t number_of_corrections) const;
+
+    /// @brief Full multigrid cycle, overwrites x
+    void FullCycle(const std::vector<double>& b, std::vector<double>& x) const;
+
+    /// @brief Estimated cost of the sparse products of one V- or W-cycle, without the coarsest level solve
+    WorkEstimate CycleWork() const;
+
+    MultigridOptions options_{};
+    std::vector<Level> levels_{};
+    LUFactorization coarsest_solver_{};
+
+    // Storage of every level reused by every cycle, the finest level only uses residual and workspace
+    mutable std::vector<LevelVectors> vectors_{};
+};
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_ITERATIVE_SOLVERS_MULTIGRID_H
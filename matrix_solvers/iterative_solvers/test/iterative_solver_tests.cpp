@@ -3,11 +3,28 @@
  * Project: Jacobi - main unit tests
  */
 
+#include "matrix_solvers/iterative_solvers/bicgstab.h"
 #include "matrix_solvers/iterative_solvers/conjugate_gradient.h"
 #include "matrix_solvers/iterative_solvers/gauss_seidel.h"
+#include "matrix_solvers/iterative_solvers/gmres.h"
 #include "matrix_solvers/iterative_solvers/jacobi.h"
+#include "matrix_solvers/iterative_solvers/multigrid.h"
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/linear_operators/stencil_operator.h"
+#include "matrix_solvers/parallel/thread_pool.h"
+#include "matrix_solvers/preconditioners/incomplete_factorization.h"
+#include "matrix_solvers/preconditioners/preconditioner.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include "matrix_solvers/utilities.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace nm
 {
@@ -72,6 +89,23 @@ TEST_F(JacobiMethodTestFixture, GivenValidMatrix_ExpectSingleIterationToMatchWit
     EXPECT_NEAR(x.at(0), x_void.at(0), tolerance_);
 }
 
+TEST_F(JacobiMethodTestFixture, GivenSparseMatrix_ExpectSameSolutionAsDenseMatrix)
+{
+    // Given
+    const CsrMatrix A_sparse{A};
+    auto x_sparse = x;
+
+    // Call
+    Jacobi(A, b, x, max_iterations_, tolerance_);
+    Jacobi(A_sparse, b, x_sparse, max_iterations_, tolerance_);
+
+    // Expect
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(x_sparse.at(i), x.at(i), tolerance_);
+    }
+}
+
 class GaussSeidelTestFixture : public IterativeSolversBaseTestFixture
 {
 };
@@ -105,6 +139,40 @@ TEST_F(GaussSeidelTestFixture, GivenValidMatrix_ExpectSingleIterationToMatchWith
     EXPECT_NEAR(x.at(0), x_void.at(0), tolerance_);
 }
 
+TEST_F(GaussSeidelTestFixture, GivenSparseMatrix_ExpectSameSolutionAsDenseMatrix)
+{
+    // Given
+    const CsrMatrix A_sparse{A};
+    auto x_sparse = x;
+
+    // Call
+    GaussSeidel(A, b, x, max_iterations_, tolerance_);
+    GaussSeidel(A_sparse, b, x_sparse, max_iterations_, tolerance_);
+
+    // Expect
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(x_sparse.at(i), x.at(i), tolerance_);
+    }
+}
+
+TEST_F(GaussSeidelTestFixture, GivenTelemetry_ExpectHistoryUntilUpdateBelowTolerance)
+{
+    // Given
+    const CsrMatrix A_sparse{A};
+    SolverStats stats{};
+
+    // Call
+    GaussSeidel(A_sparse, b, x, static_cast<std::int32_t>(max_iterations_), tolerance_, SolverTelemetry{&stats});
+
+    // Expect
+    EXPECT_TRUE(stats.converged);
+    EXPECT_GT(stats.iterations, 0);
+    ASSERT_EQ(stats.residual_history.size(), static_cast<std::size_t>(stats.iterations));
+    EXPECT_LE(stats.residual_history.back(), tolerance_);
+    EXPECT_DOUBLE_EQ(stats.work.flops, stats.iterations * (2.0 * A_sparse.NumberOfNonZeros() + 2.0 * 3.0));
+}
+
 class ConjugateGradientTestFixture : public IterativeSolversBaseTestFixture
 {
   public:
@@ -170,19 +238,726 @@ TEST_F(ConjugateGradientTestFixture, GivenValidMatrix_ExpectUnConvergedSolutionW
     std::vector<double> x{0.0, 0.0};
 
     // When
-    const std::int32_t max_iterations{5};
+    const std::int32_t max_iterations{1};
+
+    // Call
+    const auto iterations = ConjugateGradient(A_, b_, x, tolerance_, max_iterations);
+
+    // Expect, a single iteration is one steepest descent step x = (r . r) / (r . A * r) * r with r = b
+    EXPECT_EQ(iterations, 1);
+    x_expected_ = {0.25, 0.5};
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        EXPECT_NEAR(x.at(i), x_expected_.at(i), tolerance_);
+    }
+}
+
+TEST_F(ConjugateGradientTestFixture, GivenTwoByTwoMatrix_ExpectExactSolutionInTwoIterations)
+{
+    // Given
+    std::vector<double> x{0.0, 0.0};
+
+    // Call
+    const auto iterations = ConjugateGradient(A_, b_, x, 1e-12, 100);
+
+    // Expect, conjugate directions span R^n after n steps
+    EXPECT_EQ(iterations, 2);
+    EXPECT_NEAR(x.at(0), 1.0 / 11.0, 1e-12);
+    EXPECT_NEAR(x.at(1), 7.0 / 11.0, 1e-12);
+}
+
+TEST_F(ConjugateGradientTestFixture, GivenTelemetry_ExpectResidualOfEveryIteration)
+{
+    // Given
+    std::vector<double> x{0.0, 0.0};
+    SolverStats stats{};
+    std::vector<std::int32_t> observed_iterations{};
+    const auto observer = [&observed_iterations](const IterationReport& report) {
+        observed_iterations.push_back(report.iteration);
+    };
+    const SolverTelemetry telemetry{&stats, observer};
+
+    // Call
+    const auto iterations = ConjugateGradient(A_, b_, x, 1e-12, 100, telemetry);
+
+    // Expect
+    EXPECT_EQ(stats.iterations, iterations);
+    EXPECT_TRUE(stats.converged);
+    ASSERT_TRUE(stats.initial_residual.has_value());
+    EXPECT_NEAR(*stats.initial_residual, std::sqrt(5.0), 1e-12);
+    ASSERT_EQ(stats.residual_history.size(), static_cast<std::size_t>(iterations));
+    EXPECT_LT(stats.residual_history.front(), *stats.initial_residual);
+    EXPECT_LE(stats.residual_history.back(), 1e-12);
+    EXPECT_EQ(observed_iterations, (std::vector<std::int32_t>{1, 2}));
+    EXPECT_GT(stats.work.flops, 0.0);
+    EXPECT_GT(stats.work.bytes, stats.work.flops);
+    EXPECT_GE(stats.total_seconds, stats.PhaseSeconds(SolverPhase::kOperator));
+}
+
+TEST_F(ConjugateGradientTestFixture, GivenSparseMatrix_ExpectConvergedSolution)
+{
+    // Given
+    const CsrMatrix A_sparse{A_};
+    std::vector<double> x{0.0, 0.0};
+
+    // Call
+    ConjugateGradient(A_sparse, b_, x, 0.0001, 100);
+
+    // Expect
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(x.at(i), x_expected_.at(i), tolerance_);
+    }
+}
+
+struct MatrixFreeSolverTestParameter
+{
+    std::string solver{};
+    std::string test_name{};
+};
+
+class MatrixFreeSolverTestFixture : public ::testing::TestWithParam<MatrixFreeSolverTestParameter>
+{
+  public:
+    void SetUp() override
+    {
+        // 1D Poisson stencil, symmetric positive definite and never assembled
+        A_ = StencilOperator1D{-1.0, 2.0, -1.0, std::vector<double>(number_of_nodes_, 1.0)};
+
+        for (std::size_t i{0}; i < number_of_nodes_; ++i)
+        {
+            x_expected_.push_back(std::sin(0.3 * static_cast<double>(i)));
+        }
+        b_.resize(number_of_nodes_);
+        A_.Apply(1.0, x_expected_, 0.0, b_);
+    }
+
+    void Solve(std::vector<double>& x) const
+    {
+        const auto& solver = GetParam().solver;
+        if (solver == "Jacobi")
+        {
+            Jacobi(A_, b_, x, max_iterations_, 1e-12);
+        }
+        else if (solver == "GaussSeidel")
+        {
+            GaussSeidel(A_, b_, x, max_iterations_, 1e-12);
+        }
+        else
+        {
+            ConjugateGradient(A_, b_, x, 1e-12, max_iterations_);
+        }
+    }
+
+  public:
+    std::size_t number_of_nodes_{16};
+    StencilOperator1D A_{};
+    std::vector<double> b_{};
+    std::vector<double> x_expected_{};
+    std::int32_t max_iterations_{5000};
+    double tolerance_{1e-6};
+};
+
+TEST_P(MatrixFreeSolverTestFixture, GivenStencilOperator_ExpectSameSolutionAsAssembledMatrix)
+{
+    // Given
+    std::vector<double> x(number_of_nodes_, 0.0);
 
     // Call
-    ConjugateGradient(A_, b_, x, tolerance_, max_iterations);
+    Solve(x);
 
     // Expect
-    x_expected_ = {0.104, 0.625};
+    for (std::size_t i{0}; i < number_of_nodes_; ++i)
+    {
+        EXPECT_NEAR(x.at(i), x_expected_.at(i), tolerance_);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(MatrixFreeSolverTests,
+                         MatrixFreeSolverTestFixture,
+                         ::testing::Values(
+                             // clang-format off
+                         MatrixFreeSolverTestParameter{.solver = "Jacobi", .test_name = "Jacobi"},
+                         MatrixFreeSolverTestParameter{.solver = "GaussSeidel", .test_name = "GaussSeidel"},
+                         MatrixFreeSolverTestParameter{.solver = "ConjugateGradient", .test_name = "ConjugateGradient"}
+                             // clang-format on
+                             ),
+                         [](const ::testing::TestParamInfo<MatrixFreeSolverTestParameter>& info) {
+                             return info.param.test_name;
+                         });
+
+struct ParallelSolverTestParameter
+{
+    std::string solver{};
+    std::int32_t number_of_threads{1};
+    std::string test_name{};
+};
+
+class ParallelSolverTestFixture : public ::testing::TestWithParam<ParallelSolverTestParameter>
+{
+  public:
+    void SetUp() override
+    {
+        // Assembled 1D Poisson stencil, more rows than threads so that every thread owns a chunk
+        A_ = StencilOperator1D{-1.0, 2.0, -1.0, std::vector<double>(number_of_nodes_, 1.0)}.ToCsrMatrix();
+
+        for (std::size_t i{0}; i < number_of_nodes_; ++i)
+        {
+            x_expected_.push_back(std::sin(0.3 * static_cast<double>(i)));
+        }
+        b_.resize(number_of_nodes_);
+        SpMV(1.0, A_, x_expected_, 0.0, b_);
+    }
+
+  public:
+    std::size_t number_of_nodes_{16};
+    CsrMatrix A_{};
+    std::vector<double> b_{};
+    std::vector<double> x_expected_{};
+    std::int32_t max_iterations_{5000};
+    double tolerance_{1e-6};
+};
+
+TEST_P(ParallelSolverTestFixture, GivenThreadPool_ExpectConvergedSolution)
+{
+    // Given
+    const auto& param = GetParam();
+    ThreadPool pool{param.number_of_threads};
+    std::vector<double> x(number_of_nodes_, 0.0);
+    auto x_serial = x;
+
+    // Call
+    if (param.solver == "Jacobi")
+    {
+        Jacobi(A_, b_, x, max_iterations_, 1e-12, pool);
+        Jacobi(A_, b_, x_serial, max_iterations_, 1e-12);
+    }
+    else
+    {
+        GaussSeidel(A_, b_, x, max_iterations_, 1e-12, pool);
+        GaussSeidel(A_, b_, x_serial, max_iterations_, 1e-12);
+    }
+
+    // Expect
+    for (std::size_t i{0}; i < number_of_nodes_; ++i)
+    {
+        EXPECT_NEAR(x.at(i), x_expected_.at(i), tolerance_);
+        EXPECT_NEAR(x.at(i), x_serial.at(i), tolerance_);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ParallelSolverTests,
+                         ParallelSolverTestFixture,
+                         ::testing::Values(
+                             // clang-format off
+                         ParallelSolverTestParameter{.solver = "Jacobi", .number_of_threads = 1, .test_name = "JacobiOneThread"},
+                         ParallelSolverTestParameter{.solver = "Jacobi", .number_of_threads = 3, .test_name = "JacobiThreeThreads"},
+                         ParallelSolverTestParameter{.solver = "GaussSeidel", .number_of_threads = 1, .test_name = "RedBlackOneThread"},
+                         ParallelSolverTestParameter{.solver = "GaussSeidel", .number_of_threads = 3, .test_name = "RedBlackThreeThreads"}
+                             // clang-format on
+                             ),
+                         [](const ::testing::TestParamInfo<ParallelSolverTestParameter>& info) {
+                             return info.param.test_name;
+                         });
+
+TEST(ColorRowsTest, GivenThreePointStencil_ExpectRedBlackOrdering)
+{
+    // Given
+    const auto A = StencilOperator1D{-1.0, 2.0, -1.0, std::vector<double>(7, 1.0)}.ToCsrMatrix();
+
+    // Call
+    const auto colors = ColorRows(A);
+
+    // Expect
+    ASSERT_EQ(colors.size(), 2);
+    EXPECT_EQ(colors[0], (std::vector<std::int32_t>{0, 2, 4, 6}));
+    EXPECT_EQ(colors[1], (std::vector<std::int32_t>{1, 3, 5}));
+}
+
+struct PreconditionedConjugateGradientTestParameter
+{
+    std::string preconditioner{};
+    std::string test_name{};
+};
+
+class PreconditionedConjugateGradientTestFixture
+    : public ::testing::TestWithParam<PreconditionedConjugateGradientTestParameter>
+{
+  public:
+    void SetUp() override
+    {
+        // Five point Laplacian on a grid_size x grid_size grid, condition number grows like grid_size^2
+        const auto n = grid_size_ * grid_size_;
+        CooMatrix coo(n, n);
+        for (std::int32_t row{0}; row < grid_size_; ++row)
+        {
+            for (std::int32_t column{0}; column < grid_size_; ++column)
+            {
+                const auto i = row * grid_size_ + column;
+                coo.Add(i, i, 4.0);
+                if (column > 0)
+                {
+                    coo.Add(i, i - 1, -1.0);
+                }
+                if (column < grid_size_ - 1)
+                {
+                    coo.Add(i, i + 1, -1.0);
+                }
+                if (row > 0)
+                {
+                    coo.Add(i, i - grid_size_, -1.0);
+                }
+                if (row < grid_size_ - 1)
+                {
+                    coo.Add(i, i + grid_size_, -1.0);
+                }
+                x_expected_.push_back(std::sin(0.1 * static_cast<double>(i)));
+            }
+        }
+        A_ = CsrMatrix{coo};
+        b_.resize(static_cast<std::size_t>(n));
+        SpMV(1.0, A_, x_expected_, 0.0, b_);
+    }
+
+    std::unique_ptr<Preconditioner> CreatePreconditioner(const std::string& name) const
+    {
+        if (name == "Jacobi")
+        {
+            return std::make_unique<JacobiPreconditioner>(A_);
+        }
+        if (name == "SSOR")
+        {
+            return std::make_unique<SsorPreconditioner>(A_, 1.5);
+        }
+        if (name == "IC0")
+        {
+            return std::make_unique<IncompleteCholeskyPreconditioner>(A_);
+        }
+        return std::make_unique<IncompleteLUPreconditioner>(A_);
+    }
+
+  public:
+    std::int32_t grid_size_{20};
+    CsrMatrix A_{};
+    std::vector<double> b_{};
+    std::vector<double> x_expected_{};
+    std::int32_t max_iterations_{1000};
+    double tolerance_{1e-6};
+};
+
+TEST_P(PreconditionedConjugateGradientTestFixture, GivenPreconditioner_ExpectFewerIterationsToSameSolution)
+{
+    // Given
+    const auto M = CreatePreconditioner(GetParam().preconditioner);
+    std::vector<double> x(b_.size(), 0.0);
+    std::vector<double> x_unpreconditioned(b_.size(), 0.0);
+
+    // Call
+    const auto iterations = ConjugateGradient(A_, b_, x, *M, 1e-10, max_iterations_);
+    const auto unpreconditioned_iterations = ConjugateGradient(A_, b_, x_unpreconditioned, 1e-10, max_iterations_);
+
+    // Expect
+    EXPECT_LT(iterations, max_iterations_);
+    EXPECT_LE(iterations, unpreconditioned_iterations);
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(x.at(i), x_expected_.at(i), tolerance_);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(PreconditionedConjugateGradientTests,
+                         PreconditionedConjugateGradientTestFixture,
+                         ::testing::Values(
+                             // clang-format off
+                         PreconditionedConjugateGradientTestParameter{.preconditioner = "Jacobi", .test_name = "Jacobi"},
+                         PreconditionedConjugateGradientTestParameter{.preconditioner = "SSOR", .test_name = "SSOR"},
+                         PreconditionedConjugateGradientTestParameter{.preconditioner = "IC0", .test_name = "IncompleteCholesky"},
+                         PreconditionedConjugateGradientTestParameter{.preconditioner = "ILU0", .test_name = "IncompleteLU"}
+                             // clang-format on
+                             ),
+                         [](const ::testing::TestParamInfo<PreconditionedConjugateGradientTestParameter>& info) {
+                             return info.param.test_name;
+                         });
+
+/// @brief Poisson matrix on a structured grid, five point stencil in the interior and identity rows on the boundary
+///
+/// The known boundary values are eliminated from the interior rows, so the matrix is symmetric positive definite.
+CsrMatrix CreatePoissonMatrix(const GridShape shape)
+{
+    const auto is_boundary = [&shape](const std::int32_t i) {
+        const auto x = i % shape.nx;
+        const auto y = i / shape.nx;
+        return (shape.nx > 1 && (x == 0 || x == shape.nx - 1)) || (shape.ny > 1 && (y == 0 || y == shape.ny - 1));
+    };
+
+    const auto n = shape.nx * shape.ny;
+    CooMatrix coo(n, n);
     for (std::int32_t i{0}; i < n; ++i)
+    {
+        if (is_boundary(i))
+        {
+            coo.Add(i, i, 1.0);
+            continue;
+        }
+
+        const auto dimensions = (shape.ny > 1) ? 2 : 1;
+        coo.Add(i, i, 2.0 * dimensions);
+        for (const auto neighbour : {i - 1, i + 1, i - shape.nx, i + shape.nx})
+        {
+            if ((dimensions == 2 || neighbour == i - 1 || neighbour == i + 1) && !is_boundary(neighbour))
+            {
+                coo.Add(i, neighbour, -1.0);
+            }
+        }
+    }
+    return CsrMatrix{coo};
+}
+
+TEST(MultigridTest, GivenOneDimensionalLaplacian_ExpectGalerkinCoarseLevelsMatchRediscretization)
+{
+    // Given
+    CooMatrix coo(9, 9);
+    for (std::int32_t i{0}; i < 9; ++i)
+    {
+        if (i > 0)
+        {
+            coo.Add(i, i - 1, -1.0);
+        }
+        coo.Add(i, i, 2.0);
+        if (i < 8)
+        {
+            coo.Add(i, i + 1, -1.0);
+        }
+    }
+
+    // Call
+    const Multigrid multigrid{CsrMatrix{coo}, GridShape{.nx = 9}};
+
+    // Expect, doubling the spacing scales the interior stencil by 1/4
+    ASSERT_EQ(multigrid.NumberOfLevels(), 3);
+    EXPECT_EQ(multigrid.LevelShape(1).nx, 5);
+    EXPECT_EQ(multigrid.LevelShape(2).nx, 3);
+    const auto& coarse = multigrid.LevelMatrix(1);
+    EXPECT_EQ(coarse.NumberOfNonZeros(), 13);
+    EXPECT_DOUBLE_EQ(coarse(2, 1), -0.25);
+    EXPECT_DOUBLE_EQ(coarse(2, 2), 0.5);
+    EXPECT_DOUBLE_EQ(coarse(2, 3), -0.25);
+    EXPECT_DOUBLE_EQ(multigrid.LevelMatrix(2)(1, 1), 0.125);
+}
+
+TEST(MultigridTest, GivenEvenNumberOfNodes_ExpectLastNodeKeptAndCoarseningToCoarsestSize)
+{
+    // Given, 10 nodes keep 0, 2, 4, 6, 8 and the end node 9
+    const GridShape shape{.nx = 10};
+
+    // Call
+    const Multigrid multigrid{CreatePoissonMatrix(shape), shape};
+
+    // Expect, 10 -> 6 -> 4 -> 3, the end nodes stay decoupled boundary rows on every level
+    ASSERT_EQ(multigrid.NumberOfLevels(), 4);
+    EXPECT_EQ(multigrid.LevelShape(1).nx, 6);
+    EXPECT_EQ(multigrid.LevelShape(2).nx, 4);
+    EXPECT_EQ(multigrid.LevelShape(3).nx, 3);
+    const auto& coarse = multigrid.LevelMatrix(1);
+    EXPECT_DOUBLE_EQ(coarse(5, 5), 0.5);
+    EXPECT_DOUBLE_EQ(coarse(5, 4), 0.0);
+    EXPECT_DOUBLE_EQ(coarse(0, 0), 0.5);
+}
+
+struct MultigridTestParameter
+{
+    GridShape shape{};
+    MultigridOptions options{};
+    std::int32_t max_cycles{};
+    std::string test_name{};
+};
+
+class MultigridTestFixture : public ::testing::TestWithParam<MultigridTestParameter>
+{
+  public:
+    void SetUp() override
+    {
+        const auto shape = GetParam().shape;
+        A_ = CreatePoissonMatrix(shape);
+        for (std::int32_t i{0}; i < shape.nx * shape.ny; ++i)
+        {
+            x_expected_.push_back(std::sin(0.05 * static_cast<double>(i)));
+        }
+        b_.resize(x_expected_.size());
+        SpMV(1.0, A_, x_expected_, 0.0, b_);
+    }
+
+  public:
+    CsrMatrix A_{};
+    std::vector<double> b_{};
+    std::vector<double> x_expected_{};
+    double tolerance_{1e-6};
+};
+
+TEST_P(MultigridTestFixture, GivenPoissonMatrix_ExpectConvergenceInFewCycles)
+{
+    // Given
+    const auto param = GetParam();
+    const Multigrid multigrid{A_, param.shape, param.options};
+    std::vector<double> x(b_.size(), 0.0);
+
+    // Call
+    const auto cycles = multigrid.Solve(b_, x, 1e-10, 100);
+
+    // Expect
+    EXPECT_GT(multigrid.NumberOfLevels(), 3);
+    EXPECT_LE(cycles, param.max_cycles);
+    for (std::size_t i{0}; i < x.size(); ++i)
     {
         EXPECT_NEAR(x.at(i), x_expected_.at(i), tolerance_);
     }
 }
 
+INSTANTIATE_TEST_SUITE_P(MultigridTests,
+                         MultigridTestFixture,
+                         ::testing::Values(
+                             // clang-format off
+                         MultigridTestParameter{.shape = {.nx = 257}, .options = {}, .max_cycles = 12, .test_name = "VCycle1D"},
+                         MultigridTestParameter{.shape = {.nx = 33, .ny = 33}, .options = {}, .max_cycles = 12, .test_name = "VCycle2D"},
+                         MultigridTestParameter{.shape = {.nx = 33, .ny = 33}, .options = {.cycle = MultigridCycle::kW}, .max_cycles = 12, .test_name = "WCycle2D"},
+                         MultigridTestParameter{.shape = {.nx = 33, .ny = 33}, .options = {.cycle = MultigridCycle::kFull}, .max_cycles = 12, .test_name = "FullMultigrid2D"},
+                         MultigridTestParameter{.shape = {.nx = 33, .ny = 33}, .options = {.smoother = MultigridSmoother::kWeightedJacobi, .jacobi_weight = 0.8}, .max_cycles = 25, .test_name = "WeightedJacobiVCycle2D"},
+                         MultigridTestParameter{.shape = {.nx = 65, .ny = 17}, .options = {}, .max_cycles = 12, .test_name = "VCycleRectangular2D"},
+                         MultigridTestParameter{.shape = {.nx = 1000}, .options = {}, .max_cycles = 12, .test_name = "VCycleEvenSize1D"},
+                         MultigridTestParameter{.shape = {.nx = 40, .ny = 26}, .options = {}, .max_cycles = 12, .test_name = "VCycleEvenSize2D"}
+                             // clang-format on
+                             ),
+                         [](const ::testing::TestParamInfo<MultigridTestParameter>& info) {
+                             return info.param.test_name;
+                         });
+
+TEST(MultigridTest, GivenFinerGrid_ExpectSameNumberOfCycles)
+{
+    // Given
+    std::vector<std::int32_t> cycles{};
+
+    // Call
+    for (const std::int32_t n : {17, 65, 257})
+    {
+        const GridShape shape{.nx = n, .ny = n};
+        const auto A = CreatePoissonMatrix(shape);
+        const std::vector<double> b(static_cast<std::size_t>(n * n), 1.0);
+        std::vector<double> x(b.size(), 0.0);
+        cycles.push_back(Multigrid{A, shape}.Solve(b, x, 1e-8, 100));
+    }
+
+    // Expect
+    EXPECT_LE(cycles.back(), cycles.front() + 1);
+}
+
+TEST(MultigridTest, GivenMultigridPreconditioner_ExpectFewerConjugateGradientIterations)
+{
+    // Given
+    const GridShape shape{.nx = 65, .ny = 65};
+    const auto A = CreatePoissonMatrix(shape);
+    const std::vector<double> b(static_cast<std::size_t>(shape.nx * shape.ny), 1.0);
+    const Multigrid M{A, shape, {.smoother = MultigridSmoother::kWeightedJacobi, .jacobi_weight = 0.8}};
+    std::vector<double> x(b.size(), 0.0);
+    std::vector<double> x_unpreconditioned(b.size(), 0.0);
+
+    // Call
+    const auto iterations = ConjugateGradient(A, b, x, M, 1e-8, 1000);
+    const auto unpreconditioned_iterations = ConjugateGradient(A, b, x_unpreconditioned, 1e-8, 1000);
+
+    // Expect
+    EXPECT_LE(iterations, 10);
+    EXPECT_LT(iterations, unpreconditioned_iterations / 5);
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(x.at(i), x_unpreconditioned.at(i), 1e-6);
+    }
+}
+
+TEST(MultigridTest, GivenMismatchedGrid_ExpectException)
+{
+    // Given
+    const auto A = CreatePoissonMatrix(GridShape{.nx = 9});
+
+    // Call & Expect
+    EXPECT_THROW(Multigrid(A, GridShape{.nx = 3, .ny = 4}), std::length_error);
+    EXPECT_THROW(Multigrid(A, GridShape{.nx = 9, .ny = 0}), std::invalid_argument);
+}
+
+struct NonSymmetricSolverTestParameter
+{
+    std::string solver{};
+    bool is_preconditioned{false};
+    std::int32_t restart{30};
+    std::string test_name{};
+};
+
+class NonSymmetricSolverTestFixture : public ::testing::TestWithParam<NonSymmetricSolverTestParameter>
+{
+  public:
+    void SetUp() override
+    {
+        // Steady advection-diffusion on a grid_size x grid_size grid, first order upwind advection along x and y with
+        // a cell Peclet number of 2, so A is far from symmetric
+        const auto n = grid_size_ * grid_size_;
+        const double peclet{2.0};
+        CooMatrix coo(n, n);
+        for (std::int32_t row{0}; row < grid_size_; ++row)
+        {
+            for (std::int32_t column{0}; column < grid_size_; ++column)
+            {
+                const auto i = row * grid_size_ + column;
+                coo.Add(i, i, 4.0 + 2.0 * peclet);
+                if (column > 0)
+                {
+                    coo.Add(i, i - 1, -1.0 - peclet);
+                }
+                if (column < grid_size_ - 1)
+                {
+                    coo.Add(i, i + 1, -1.0);
+                }
+                if (row > 0)
+                {
+                    coo.Add(i, i - grid_size_, -1.0 - peclet);
+                }
+                if (row < grid_size_ - 1)
+                {
+                    coo.Add(i, i + grid_size_, -1.0);
+                }
+                x_expected_.push_back(std::cos(0.07 * static_cast<double>(i)));
+            }
+        }
+        A_ = CsrMatrix{coo};
+        b_.resize(static_cast<std::size_t>(n));
+        SpMV(1.0, A_, x_expected_, 0.0, b_);
+    }
+
+    std::int32_t Solve(const NonSymmetricSolverTestParameter& param, std::vector<double>& x) const
+    {
+        const IncompleteLUPreconditioner M{A_};
+        if (param.solver == "GMRES")
+        {
+            return param.is_preconditioned ? GMRES(A_, b_, x, M, 1e-10, max_iterations_, param.restart)
+                                           : GMRES(A_, b_, x, 1e-10, max_iterations_, param.restart);
+        }
+        return param.is_preconditioned ? BiCGSTAB(A_, b_, x, M, 1e-10, max_iterations_)
+                                       : BiCGSTAB(A_, b_, x, 1e-10, max_iterations_);
+    }
+
+  public:
+    std::int32_t grid_size_{16};
+    CsrMatrix A_{};
+    std::vector<double> b_{};
+    std::vector<double> x_expected_{};
+    std::int32_t max_iterations_{1000};
+    double tolerance_{1e-8};
+};
+
+TEST_P(NonSymmetricSolverTestFixture, GivenAdvectionDiffusionMatrix_ExpectConvergedSolution)
+{
+    // Given
+    const auto param = GetParam();
+    std::vector<double> x(b_.size(), 0.0);
+    std::vector<double> x_unpreconditioned(b_.size(), 0.0);
+
+    // Call
+    const auto iterations = Solve(param, x);
+    const auto unpreconditioned_iterations =
+        Solve({.solver = param.solver, .restart = param.restart}, x_unpreconditioned);
+
+    // Expect
+    EXPECT_LT(iterations, max_iterations_);
+    EXPECT_LE(iterations, unpreconditioned_iterations);
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(x.at(i), x_expected_.at(i), tolerance_);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(NonSymmetricSolverTests,
+                         NonSymmetricSolverTestFixture,
+                         ::testing::Values(
+                             // clang-format off
+                         NonSymmetricSolverTestParameter{.solver = "GMRES", .test_name = "GMRES"},
+                         NonSymmetricSolverTestParameter{.solver = "GMRES", .restart = 5, .test_name = "RestartedGMRES"},
+                         NonSymmetricSolverTestParameter{.solver = "GMRES", .is_preconditioned = true, .test_name = "PreconditionedGMRES"},
+                         NonSymmetricSolverTestParameter{.solver = "BiCGSTAB", .test_name = "BiCGSTAB"},
+                         NonSymmetricSolverTestParameter{.solver = "BiCGSTAB", .is_preconditioned = true, .test_name = "PreconditionedBiCGSTAB"}
+                             // clang-format on
+                             ),
+                         [](const ::testing::TestParamInfo<NonSymmetricSolverTestParameter>& info) {
+                             return info.param.test_name;
+                         });
+
+TEST(GMRESTest, GivenRestartOfAtLeastMatrixSize_ExpectExactSolutionWithinMatrixSizeIterations)
+{
+    // Given, lower bidiagonal upwind matrix on which stationary methods converge slowest
+    Matrix<double> A(5, 5);
+    for (std::int32_t i{0}; i < 5; ++i)
+    {
+        A(i, i) = 1.0;
+        if (i > 0)
+        {
+            A(i, i - 1) = -1.0;
+        }
+    }
+    const std::vector<double> b{1.0, 1.0, 1.0, 1.0, 1.0};
+    std::vector<double> x(5, 0.0);
+    std::vector<double> x_operator(5, 0.0);
+
+    // Call
+    const auto iterations = GMRES(A, b, x, 1e-12, 100, 5);
+    const auto operator_iterations = GMRES(DenseMatrixOperator{A}, b, x_operator, 1e-12, 100, 5);
+
+    // Expect
+    EXPECT_LE(iterations, 5);
+    EXPECT_EQ(operator_iterations, iterations);
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(x.at(i), static_cast<double>(i + 1), 1e-10);
+        EXPECT_NEAR(x_operator.at(i), x.at(i), 1e-12);
+    }
+}
+
+TEST(BiCGSTABTest, GivenConvergedInitialGuess_ExpectNoIterations)
+{
+    // Given
+    const Matrix<double> A{{4.0, 1.0}, {-2.0, 3.0}};
+    const std::vector<double> b{6.0, 4.0};
+    std::vector<double> x{1.0, 2.0};
+
+    // Call
+    const auto iterations = BiCGSTAB(A, b, x, 1e-12, 100);
+
+    // Expect
+    EXPECT_EQ(iterations, 0);
+    EXPECT_EQ(x, (std::vector<double>{1.0, 2.0}));
+}
+
+TEST(MatrixFreeGaussSeidelTest, GivenOperatorWithoutRowAccess_ExpectException)
+{
+    // Given
+    class ApplyOnlyOperator : public LinearOperator
+    {
+      public:
+        std::int32_t NumberOfRows() const override { return 1; }
+        std::int32_t NumberOfColumns() const override { return 1; }
+        void Apply(const double alpha, const std::vector<double>& x, const double beta, std::vector<double>& y)
+            const override
+        {
+            y[0] = alpha * x[0] + beta * y[0];
+        }
+        std::vector<double> Diagonal() const override { return {1.0}; }
+    };
+    const ApplyOnlyOperator A{};
+    const std::vector<double> b{1.0};
+    std::vector<double> x{0.0};
+
+    // Call & Expect
+    EXPECT_THROW(GaussSeidel(A, b, x, 10, 1e-6), std::invalid_argument);
+    Jacobi(A, b, x, 10, 1e-6);
+    EXPECT_NEAR(x.at(0), 1.0, 1e-12);
+}
+
 }  // namespace
 
 }  // namespace matrix
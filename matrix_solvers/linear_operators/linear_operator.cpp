@@ -0,0 +1,91 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/operations/vector_kernels.h"
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+double LinearOperator::RowDot(const std::int32_t, const std::vector<double>&) const
+{
+    throw std::logic_error("This linear operator does not provide access to individual rows.");
+}
+
+void DenseMatrixOperator::Apply(const double alpha,
+                                const std::vector<double>& x,
+                                const double beta,
+                                std::vector<double>& y) const
+{
+    Gemv(alpha, *A_, x, beta, y);
+}
+
+std::vector<double> DenseMatrixOperator::Diagonal() const
+{
+    const auto n = std::min(A_->NumberOfRows(), A_->NumberOfColumns());
+    std::vector<double> diagonal(static_cast<std::size_t>(n));
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        diagonal[static_cast<std::size_t>(i)] = (*A_)(i, i);
+    }
+    return diagonal;
+}
+
+double DenseMatrixOperator::RowDot(const std::int32_t i, const std::vector<double>& x) const
+{
+    return kernels::Dot(&(*A_)(i, 0), x.data(), static_cast<std::size_t>(A_->NumberOfColumns()));
+}
+
+WorkEstimate DenseMatrixOperator::ApplyWork() const
+{
+    const auto rows = static_cast<double>(A_->NumberOfRows());
+    const auto columns = static_cast<double>(A_->NumberOfColumns());
+
+    // Every entry is read once and used in one multiply-add, x is read and y written once
+    return {2.0 * rows * columns, 8.0 * (rows * columns + rows + columns)};
+}
+
+void SparseMatrixOperator::Apply(const double alpha,
+                                 const std::vector<double>& x,
+                                 const double beta,
+                                 std::vector<double>& y) const
+{
+    SpMV(alpha, *A_, x, beta, y);
+}
+
+double SparseMatrixOperator::RowDot(const std::int32_t i, const std::vector<double>& x) const
+{
+    const auto& offsets = A_->RowOffsets();
+    const auto& columns = A_->ColumnIndices();
+    const auto& values = A_->Values();
+
+    double sum{0.0};
+    for (auto k = offsets[static_cast<std::size_t>(i)]; k < offsets[static_cast<std::size_t>(i) + 1]; ++k)
+    {
+        sum += values[static_cast<std::size_t>(k)] * x[static_cast<std::size_t>(columns[static_cast<std::size_t>(k)])];
+    }
+    return sum;
+}
+
+WorkEstimate SparseMatrixOperator::ApplyWork() const
+{
+    const auto rows = static_cast<double>(A_->NumberOfRows());
+    const auto columns = static_cast<double>(A_->NumberOfColumns());
+    const auto non_zeros = static_cast<double>(A_->NumberOfNonZeros());
+
+    // A value and a column index per stored entry plus the row offsets, x is read and y written once
+    return {2.0 * non_zeros, 12.0 * non_zeros + 4.0 * (rows + 1.0) + 8.0 * (rows + columns)};
+}
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,103 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Linear operator interface, lets the iterative solvers work on matrices that are never stored
+ */
+
+#ifndef MATRIX_SOLVERS_LINEAR_OPERATORS_LINEAR_OPERATOR_H
+#define MATRIX_SOLVERS_LINEAR_OPERATORS_LINEAR_OPERATOR_H
+
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
+#include "matrix_solvers/utilities.h"
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Square or rectangular linear map A, known only through its action on vectors
+///
+/// The iterative solvers need at most three things from A: the product with a vector, its diagonal and, for Gauss
+/// Seidel, the product of a single row with a vector. Implementations decide how to provide them, e.g. from a stored
+/// matrix or directly from a finite difference stencil.
+class LinearOperator
+{
+  public:
+    virtual ~LinearOperator() = default;
+
+    virtual std::int32_t NumberOfRows() const = 0;
+    virtual std::int32_t NumberOfColumns() const = 0;
+
+    /// @brief y = alpha * A * x + beta * y
+    ///
+    /// @param x: vector of length NumberOfColumns()
+    /// @param beta: scale of the previous y, when 0 y is write-only and its previous values are ignored
+    /// @param y: vector of length NumberOfRows(), must not alias x
+    ///
+    /// @throws std::length_error: when x or y do not match the dimensions of A
+    virtual void Apply(const double alpha, const std::vector<double>& x, const double beta, std::vector<double>& y)
+        const = 0;
+
+    /// @brief Main diagonal of A
+    virtual std::vector<double> Diagonal() const = 0;
+
+    /// @brief Whether RowDot() is available
+    virtual bool HasRowAccess() const { return false; }
+
+    /// @brief Sum of a_ij * x_j over row i
+    ///
+    /// @throws std::logic_error: when HasRowAccess() is false
+    virtual double RowDot(const std::int32_t i, const std::vector<double>& x) const;
+
+    /// @brief Estimated cost of one Apply(), for solver telemetry; zero when the operator does not know it
+    virtual WorkEstimate ApplyWork() const { return {}; }
+};
+
+/// @brief LinearOperator view of a dense matrix, the matrix must outlive the view
+class DenseMatrixOperator : public LinearOperator
+{
+  public:
+    explicit DenseMatrixOperator(const Matrix<double>& A) : A_(&A) {}
+
+    std::int32_t NumberOfRows() const override { return A_->NumberOfRows(); }
+    std::int32_t NumberOfColumns() const override { return A_->NumberOfColumns(); }
+    void Apply(const double alpha, const std::vector<double>& x, const double beta, std::vector<double>& y)
+        const override;
+    std::vector<double> Diagonal() const override;
+    bool HasRowAccess() const override { return true; }
+    double RowDot(const std::int32_t i, const std::vector<double>& x) const override;
+    WorkEstimate ApplyWork() const override;
+
+  private:
+    const Matrix<double>* A_{};
+};
+
+/// @brief LinearOperator view of a CSR matrix, the matrix must outlive the view
+class SparseMatrixOperator : public LinearOperator
+{
+  public:
+    explicit SparseMatrixOperator(const CsrMatrix& A) : A_(&A) {}
+
+    std::int32_t NumberOfRows() const override { return A_->NumberOfRows(); }
+    std::int32_t NumberOfColumns() const override { return A_->NumberOfColumns(); }
+    void Apply(const double alpha, const std::vector<double>& x, const double beta, std::vector<double>& y)
+        const override;
+    std::vector<double> Diagonal() const override { return A_->Diagonal(); }
+    bool HasRowAccess() const override { return true; }
+    double RowDot(const std::int32_t i, const std::vector<double>& x) const override;
+    WorkEstimate ApplyWork() const override;
+
+  private:
+    const CsrMatrix* A_{};
+};
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_LINEAR_OPERATORS_LINEAR_OPERATOR_H
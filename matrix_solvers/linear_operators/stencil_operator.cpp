@@ -0,0 +1,193 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/linear_operators/stencil_operator.h"
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+StencilOperator1D::StencilOperator1D(const double lower,
+                                     const double center,
+                                     const double upper,
+                                     std::vector<double> row_scales)
+    : lower_(lower), center_(center), upper_(upper), row_scales_(std::move(row_scales))
+{
+}
+
+void StencilOperator1D::SetIdentityRow(const std::int32_t i)
+{
+    if (i < 0 || i >= NumberOfRows())
+    {
+        throw std::out_of_range("Identity row is outside of the operator.");
+    }
+
+    const auto position = std::lower_bound(identity_rows_.begin(), identity_rows_.end(), i);
+    if (position == identity_rows_.end() || *position != i)
+    {
+        identity_rows_.insert(position, i);
+    }
+}
+
+bool StencilOperator1D::IsIdentityRow(const std::int32_t i) const
+{
+    return std::binary_search(identity_rows_.cbegin(), identity_rows_.cend(), i);
+}
+
+void StencilOperator1D::ApplyStencilRows(const double alpha,
+                                         const double* x,
+                                         const double beta,
+                                         double* y,
+                                         const std::int32_t begin,
+                                         const std::int32_t end) const
+{
+    const auto n = NumberOfRows();
+    const auto* scales = row_scales_.data();
+
+    const auto row = [&](const std::int32_t i) {
+        double sum = center_ * x[i];
+        if (i > 0)
+        {
+            sum += lower_ * x[i - 1];
+        }
+        if (i < n - 1)
+        {
+            sum += upper_ * x[i + 1];
+        }
+        return scales[i] * sum;
+    };
+    const auto store = [&](const std::int32_t i, const double value) {
+        y[i] = (beta == 0.0) ? alpha * value : alpha * value + beta * y[i];
+    };
+
+    // The truncated boundary rows are peeled off so that the interior loop is branch free
+    auto first = begin;
+    auto last = end;
+    if (first < last && first == 0)
+    {
+        store(0, row(0));
+        ++first;
+    }
+    if (first < last && last == n)
+    {
+        store(n - 1, row(n - 1));
+        --last;
+    }
+
+    if (beta == 0.0)
+    {
+        for (auto i = first; i < last; ++i)
+        {
+            y[i] = alpha * scales[i] * (lower_ * x[i - 1] + center_ * x[i] + upper_ * x[i + 1]);
+        }
+    }
+    else
+    {
+        for (auto i = first; i < last; ++i)
+        {
+            y[i] = alpha * scales[i] * (lower_ * x[i - 1] + center_ * x[i] + upper_ * x[i + 1]) + beta * y[i];
+        }
+    }
+}
+
+void StencilOperator1D::Apply(const double alpha,
+                              const std::vector<double>& x,
+                              const double beta,
+                              std::vector<double>& y) const
+{
+    const auto n = NumberOfRows();
+    if (x.size() != static_cast<std::size_t>(n) || y.size() != static_cast<std::size_t>(n))
+    {
+        throw std::length_error("Stencil operator and vector dimensions do not match.");
+    }
+
+    std::int32_t begin{0};
+    for (const auto identity_row : identity_rows_)
+    {
+        ApplyStencilRows(alpha, x.data(), beta, y.data(), begin, identity_row);
+        y[identity_row] =
+            (beta == 0.0) ? alpha * x[identity_row] : alpha * x[identity_row] + beta * y[identity_row];
+        begin = identity_row + 1;
+    }
+    ApplyStencilRows(alpha, x.data(), beta, y.data(), begin, n);
+}
+
+std::vector<double> StencilOperator1D::Diagonal() const
+{
+    std::vector<double> diagonal(row_scales_.size());
+    for (std::size_t i{0}; i < diagonal.size(); ++i)
+    {
+        diagonal[i] = row_scales_[i] * center_;
+    }
+    for (const auto identity_row : identity_rows_)
+    {
+        diagonal[static_cast<std::size_t>(identity_row)] = 1.0;
+    }
+    return diagonal;
+}
+
+double StencilOperator1D::RowDot(const std::int32_t i, const std::vector<double>& x) const
+{
+    if (IsIdentityRow(i))
+    {
+        return x[static_cast<std::size_t>(i)];
+    }
+
+    const auto n = NumberOfRows();
+    double sum = center_ * x[static_cast<std::size_t>(i)];
+    if (i > 0)
+    {
+        sum += lower_ * x[static_cast<std::size_t>(i) - 1];
+    }
+    if (i < n - 1)
+    {
+        sum += upper_ * x[static_cast<std::size_t>(i) + 1];
+    }
+    return row_scales_[static_cast<std::size_t>(i)] * sum;
+}
+
+WorkEstimate StencilOperator1D::ApplyWork() const
+{
+    // Three multiply-adds and the row scale per row, streaming x, the scales and y
+    const auto n = static_cast<double>(NumberOfRows());
+    return {6.0 * n, 24.0 * n};
+}
+
+CsrMatrix StencilOperator1D::ToCsrMatrix() const
+{
+    const auto n = NumberOfRows();
+    CooMatrix coo(n, n);
+    coo.Reserve(3 * static_cast<std::size_t>(n));
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        if (IsIdentityRow(i))
+        {
+            coo.Add(i, i, 1.0);
+            continue;
+        }
+
+        const auto scale = row_scales_[static_cast<std::size_t>(i)];
+        if (i > 0)
+        {
+            coo.Add(i, i - 1, scale * lower_);
+        }
+        coo.Add(i, i, scale * center_);
+        if (i < n - 1)
+        {
+            coo.Add(i, i + 1, scale * upper_);
+        }
+    }
+    return CsrMatrix{coo};
+}
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,77 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Matrix-free three point stencil operator on a 1D grid
+ */
+
+#ifndef MATRIX_SOLVERS_LINEAR_OPERATORS_STENCIL_OPERATOR_H
+#define MATRIX_SOLVERS_LINEAR_OPERATORS_STENCIL_OPERATOR_H
+
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Operator whose row i is row_scales[i] * (lower * x[i - 1] + center * x[i] + upper * x[i + 1])
+///
+/// Neighbours outside of the grid are dropped, matching the truncated first and last rows of an assembled finite
+/// difference matrix. Storage is one scale per row, so applying the operator reads x, writes y and streams the scales
+/// once, without any index arrays.
+class StencilOperator1D : public LinearOperator
+{
+  public:
+    StencilOperator1D() = default;
+
+    /// @param lower: weight of the left neighbour
+    /// @param center: weight of the node itself
+    /// @param upper: weight of the right neighbour
+    /// @param row_scales: per row factor, e.g. 1 / dx^2, its length sets the size of the operator
+    StencilOperator1D(const double lower, const double center, const double upper, std::vector<double> row_scales);
+
+    /// @brief Replaces row i with the identity row, e.g. to impose a Dirichlet boundary condition
+    void SetIdentityRow(const std::int32_t i);
+
+    std::int32_t NumberOfRows() const override { return static_cast<std::int32_t>(row_scales_.size()); }
+    std::int32_t NumberOfColumns() const override { return NumberOfRows(); }
+    void Apply(const double alpha, const std::vector<double>& x, const double beta, std::vector<double>& y)
+        const override;
+    std::vector<double> Diagonal() const override;
+    bool HasRowAccess() const override { return true; }
+    double RowDot(const std::int32_t i, const std::vector<double>& x) const override;
+    WorkEstimate ApplyWork() const override;
+
+    /// @brief Assembles the operator, for direct solvers and for checking the stencil
+    CsrMatrix ToCsrMatrix() const;
+
+  private:
+    bool IsIdentityRow(const std::int32_t i) const;
+
+    /// @brief Stencil rows in [begin, end), none of which is an identity row
+    void ApplyStencilRows(const double alpha,
+                          const double* x,
+                          const double beta,
+                          double* y,
+                          const std::int32_t begin,
+                          const std::int32_t end) const;
+
+    double lower_{0.0};
+    double center_{0.0};
+    double upper_{0.0};
+    std::vector<double> row_scales_{};
+
+    // Sorted, usually only the boundary nodes
+    std::vector<std::int32_t> identity_rows_{};
+};
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_LINEAR_OPERATORS_STENCIL_OPERATOR_H
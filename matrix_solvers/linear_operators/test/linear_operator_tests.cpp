@@ -0,0 +1,130 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/linear_operators/stencil_operator.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/utilities.h"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+class StencilOperatorTestFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        for (std::int32_t i{0}; i < number_of_nodes_; ++i)
+        {
+            row_scales_.push_back(1.0 + 0.1 * i);
+            x_.push_back(static_cast<double>((i * 5) % 7) - 3.0);
+        }
+    }
+
+    /// @brief Checks that A and its assembled matrix agree on Apply, Diagonal and RowDot
+    void ExpectMatchesAssembledMatrix(const StencilOperator1D& A)
+    {
+        const auto assembled = A.ToCsrMatrix();
+        const SparseMatrixOperator reference{assembled};
+
+        std::vector<double> y(x_.size(), 1.0);
+        std::vector<double> y_expected(x_.size(), 1.0);
+        A.Apply(2.0, x_, -0.5, y);
+        reference.Apply(2.0, x_, -0.5, y_expected);
+
+        const auto diagonal = A.Diagonal();
+        const auto diagonal_expected = reference.Diagonal();
+        for (std::int32_t i{0}; i < number_of_nodes_; ++i)
+        {
+            const auto index = static_cast<std::size_t>(i);
+            EXPECT_NEAR(y[index], y_expected[index], tolerance_) << "row " << i;
+            EXPECT_NEAR(diagonal[index], diagonal_expected[index], tolerance_) << "row " << i;
+            EXPECT_NEAR(A.RowDot(i, x_), reference.RowDot(i, x_), tolerance_) << "row " << i;
+        }
+    }
+
+  public:
+    std::int32_t number_of_nodes_{9};
+    std::vector<double> row_scales_{};
+    std::vector<double> x_{};
+    double tolerance_{1e-12};
+};
+
+TEST_F(StencilOperatorTestFixture, GivenThreePointStencil_ExpectSameActionAsAssembledMatrix)
+{
+    // Given
+    const StencilOperator1D A{1.0, -2.0, 0.5, row_scales_};
+
+    // Call & Expect
+    EXPECT_EQ(A.ToCsrMatrix().NumberOfNonZeros(), 3 * number_of_nodes_ - 2);
+    ExpectMatchesAssembledMatrix(A);
+}
+
+TEST_F(StencilOperatorTestFixture, GivenIdentityRows_ExpectBoundaryRowsPassThrough)
+{
+    // Given
+    StencilOperator1D A{1.0, -2.0, 1.0, row_scales_};
+
+    // Call
+    A.SetIdentityRow(number_of_nodes_ - 1);
+    A.SetIdentityRow(0);
+    A.SetIdentityRow(4);
+
+    // Expect
+    std::vector<double> y(x_.size());
+    A.Apply(1.0, x_, 0.0, y);
+    EXPECT_DOUBLE_EQ(y.front(), x_.front());
+    EXPECT_DOUBLE_EQ(y[4], x_[4]);
+    EXPECT_DOUBLE_EQ(y.back(), x_.back());
+    ExpectMatchesAssembledMatrix(A);
+    EXPECT_THROW(A.SetIdentityRow(number_of_nodes_), std::out_of_range);
+}
+
+TEST_F(StencilOperatorTestFixture, GivenVectorOfWrongLength_ExpectException)
+{
+    // Given
+    const StencilOperator1D A{1.0, -2.0, 1.0, row_scales_};
+    std::vector<double> y(x_.size() + 1);
+
+    // Call & Expect
+    EXPECT_THROW(A.Apply(1.0, x_, 0.0, y), std::length_error);
+}
+
+TEST(DenseMatrixOperatorTest, GivenDenseMatrix_ExpectSameActionAsMatrix)
+{
+    // Given
+    Matrix<double> A{{4.0, 1.0, 0.0}, {1.0, 3.0, -1.0}};
+    const DenseMatrixOperator A_operator{A};
+    const std::vector<double> x{1.0, 2.0, 3.0};
+    std::vector<double> y(2);
+
+    // Call
+    A_operator.Apply(1.0, x, 0.0, y);
+
+    // Expect
+    EXPECT_EQ(A_operator.NumberOfRows(), 2);
+    EXPECT_EQ(A_operator.NumberOfColumns(), 3);
+    EXPECT_DOUBLE_EQ(y[0], 6.0);
+    EXPECT_DOUBLE_EQ(y[1], 4.0);
+    EXPECT_DOUBLE_EQ(A_operator.RowDot(1, x), 4.0);
+    EXPECT_EQ(A_operator.Diagonal(), (std::vector<double>{4.0, 3.0}));
+}
+
+}  // namespace
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,289 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/mixed_precision/mixed_precision_solvers.h"
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/operations/vector_kernels.h"
+#include "matrix_solvers/workspace/workspace.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+Matrix<float> ToSinglePrecision(const Matrix<double>& A)
+{
+    Matrix<float> A_float(A.NumberOfRows(), A.NumberOfColumns());
+    const auto size = static_cast<std::size_t>(A.NumberOfRows()) * static_cast<std::size_t>(A.NumberOfColumns());
+    std::transform(A.Data(), A.Data() + size, A_float.Data(), [](const double value) {
+        return static_cast<float>(value);
+    });
+    return A_float;
+}
+
+/// @brief Float values of a CSR matrix, sharing the sparsity pattern of the double matrix
+class SinglePrecisionCsr
+{
+  public:
+    explicit SinglePrecisionCsr(const CsrMatrix& A) : A_(&A), values_(A.Values().cbegin(), A.Values().cend()) {}
+
+    /// @brief y = A * x
+    void Apply(const std::vector<float>& x, std::vector<float>& y) const
+    {
+        const auto* __restrict row_offsets = A_->RowOffsets().data();
+        const auto* __restrict column_indices = A_->ColumnIndices().data();
+        const auto* __restrict values = values_.data();
+        const auto* __restrict x_data = x.data();
+        auto* __restrict y_data = y.data();
+
+        const auto rows = A_->NumberOfRows();
+        for (std::int32_t i{0}; i < rows; ++i)
+        {
+            float sum{0.0F};
+            for (auto k = row_offsets[i]; k < row_offsets[i + 1]; ++k)
+            {
+                sum += values[k] * x_data[column_indices[k]];
+            }
+            y_data[i] = sum;
+        }
+    }
+
+    /// @brief Cost of Apply, the values and vectors move half the bytes of the double product, the indices do not
+    WorkEstimate ApplyWork() const
+    {
+        const auto rows = static_cast<double>(A_->NumberOfRows());
+        const auto columns = static_cast<double>(A_->NumberOfColumns());
+        const auto non_zeros = static_cast<double>(A_->NumberOfNonZeros());
+        return {2.0 * non_zeros, 8.0 * non_zeros + 4.0 * (rows + 1.0) + 4.0 * (rows + columns)};
+    }
+
+  private:
+    const CsrMatrix* A_{nullptr};
+    std::vector<float> values_{};
+};
+
+/// @brief Work of a float dot product or vector update, half the bytes of the double one
+WorkEstimate SinglePrecision(const WorkEstimate& work)
+{
+    return {work.flops, 0.5 * work.bytes};
+}
+
+}  // namespace
+
+MixedPrecisionLUFactorization::MixedPrecisionLUFactorization(const Matrix<double>& A)
+    : A_(A), LU_(ToSinglePrecision(A))
+{
+}
+
+std::int32_t MixedPrecisionLUFactorization::Solve(const std::vector<double>& b,
+                                                  std::vector<double>& x,
+                                                  const double tolerance,
+                                                  const std::int32_t max_refinements,
+                                                  const SolverTelemetry& telemetry) const
+{
+    const auto n = static_cast<std::size_t>(A_.NumberOfRows());
+    if (b.size() != n)
+    {
+        throw std::length_error("MixedPrecisionLUFactorization::Solve: b must have n entries");
+    }
+
+    SolverMonitor monitor{telemetry};
+    monitor.RecordInitialResidual(L2Norm(b));
+
+    auto residual_lease = CurrentWorkspace().Acquire(n);
+    auto& residual_vector = *residual_lease;
+    std::vector<float> correction(n);
+
+    // x starts at zero, so the first refinement is the plain float solve of b
+    x.assign(n, 0.0);
+    std::copy(b.cbegin(), b.cend(), residual_vector.begin());
+
+    const auto rows = static_cast<double>(n);
+    const WorkEstimate residual_work{2.0 * rows * rows, 8.0 * (rows * rows + 3.0 * rows)};
+    const WorkEstimate solve_work{2.0 * rows * rows, 4.0 * (rows * rows + 2.0 * rows)};
+
+    auto residual = L2Norm(residual_vector);
+    std::int32_t refinement{0};
+    while (refinement < max_refinements && residual > tolerance)
+    {
+        {
+            const auto timer = monitor.Time(SolverPhase::kPreconditioner);
+            std::transform(residual_vector.cbegin(), residual_vector.cend(), correction.begin(), [](const double r) {
+                return static_cast<float>(r);
+            });
+            LU_.SolveInPlace(correction);
+        }
+        for (std::size_t i{0}; i < n; ++i)
+        {
+            x[i] += static_cast<double>(correction[i]);
+        }
+
+        {
+            const auto timer = monitor.Time(SolverPhase::kOperator);
+            std::copy(b.cbegin(), b.cend(), residual_vector.begin());
+            Gemv(-1.0, A_, x, 1.0, residual_vector);
+        }
+        const auto new_residual = L2Norm(residual_vector);
+        monitor.AddWork(residual_work + solve_work);
+        monitor.RecordIteration(++refinement, new_residual);
+
+        // A correction that does not reduce the residual means the float factors have no accuracy left to give, the
+        // previous x is the better solution
+        if (!(new_residual < residual))
+        {
+            for (std::size_t i{0}; i < n; ++i)
+            {
+                x[i] -= static_cast<double>(correction[i]);
+            }
+            break;
+        }
+        residual = new_residual;
+    }
+
+    monitor.Finish(refinement, residual <= tolerance);
+    return refinement;
+}
+
+std::vector<double> MixedPrecisionLUSolve(const Matrix<double>& A,
+                                          const std::vector<double>& b,
+                                          const double tolerance,
+                                          const std::int32_t max_refinements,
+                                          const SolverTelemetry& telemetry)
+{
+    std::vector<double> x{};
+    MixedPrecisionLUFactorization{A}.Solve(b, x, tolerance, max_refinements, telemetry);
+    return x;
+}
+
+std::int32_t MixedPrecisionConjugateGradient(const CsrMatrix& A,
+                                             const std::vector<double>& b,
+                                             std::vector<double>& x,
+                                             const double tolerance,
+                                             const std::int32_t max_iterations,
+                                             const SolverTelemetry& telemetry)
+{
+    SolverMonitor monitor{telemetry};
+    const auto n = b.size();
+
+    auto residual_lease = CurrentWorkspace().Acquire(n);
+    auto& residual_vector = *residual_lease;
+    auto candidate_lease = CurrentWorkspace().Acquire(n);
+    auto& candidate = *candidate_lease;
+
+    // r = b - A * x
+    std::copy(b.cbegin(), b.cend(), residual_vector.begin());
+    std::optional<SinglePrecisionCsr> A_float{};
+    {
+        const auto timer = monitor.Time(SolverPhase::kSetup);
+        SpMV(-1.0, A, x, 1.0, residual_vector);
+        A_float.emplace(A);
+    }
+    auto residual = L2Norm(residual_vector);
+    monitor.RecordInitialResidual(residual);
+
+    // The float vectors hold the residual, direction and accumulated correction divided by scale, the norm of the
+    // double residual at the last reliable update, so the float iterates stay of order one as x converges
+    std::vector<float> r(n);
+    std::vector<float> d(n, 0.0F);
+    std::vector<float> p(n);
+    std::vector<float> Ap(n);
+    auto scale = residual;
+    const auto load_residual = [&residual_vector, &r, &scale]() {
+        const auto inverse_scale = 1.0 / scale;
+        std::transform(residual_vector.cbegin(), residual_vector.cend(), r.begin(), [inverse_scale](const double v) {
+            return static_cast<float>(inverse_scale * v);
+        });
+    };
+    if (residual > tolerance)
+    {
+        load_residual();
+    }
+    std::copy(r.cbegin(), r.cend(), p.begin());
+    auto residual_dotted = kernels::Dot(r.data(), r.data(), n);
+    auto update_threshold = kMixedPrecisionReliableUpdateReduction * kMixedPrecisionReliableUpdateReduction;
+
+    // One float product with A, two float dot products and three float vector updates per iteration
+    const auto iteration_work = A_float->ApplyWork() + SinglePrecision(2.0 * DotWork(n) + 3.0 * AxpyWork(n));
+    const auto update_work = SparseMatrixOperator{A}.ApplyWork() + DotWork(n) + AxpyWork(n);
+
+    std::int32_t iteration{0};
+    while (residual > tolerance && iteration < max_iterations)
+    {
+        {
+            const auto timer = monitor.Time(SolverPhase::kOperator);
+            A_float->Apply(p, Ap);
+        }
+        const auto alpha = residual_dotted / kernels::Dot(p.data(), Ap.data(), n);
+        kernels::Axpy(alpha, p.data(), d.data(), n);
+        kernels::Axpy(-alpha, Ap.data(), r.data(), n);
+
+        const auto new_residual_dotted = kernels::Dot(r.data(), r.data(), n);
+        kernels::Axpby(1.0F, r.data(), new_residual_dotted / residual_dotted, p.data(), n);
+        residual_dotted = new_residual_dotted;
+        monitor.AddWork(iteration_work);
+        ++iteration;
+
+        const auto estimated_residual = scale * std::sqrt(static_cast<double>(residual_dotted));
+        if (residual_dotted > update_threshold && estimated_residual > tolerance && iteration < max_iterations)
+        {
+            monitor.RecordIteration(iteration, estimated_residual);
+            continue;
+        }
+
+        // Reliable update, the correction moves into x and the float residual, which drifts from the true one as
+        // float rounding accumulates, is replaced by b - A * x computed in double
+        for (std::size_t i{0}; i < n; ++i)
+        {
+            candidate[i] = x[i] + scale * static_cast<double>(d[i]);
+        }
+        std::copy(b.cbegin(), b.cend(), residual_vector.begin());
+        {
+            const auto timer = monitor.Time(SolverPhase::kOperator);
+            SpMV(-1.0, A, candidate, 1.0, residual_vector);
+        }
+        const auto new_residual = L2Norm(residual_vector);
+        monitor.AddWork(update_work);
+        monitor.RecordIteration(iteration, new_residual);
+
+        // An update that does not reduce the residual means the float iterations have no accuracy left to give, the
+        // previous x is the better solution and is kept, also when the float iterates have overflowed
+        if (!(new_residual < residual))
+        {
+            break;
+        }
+        std::copy(candidate.cbegin(), candidate.cend(), x.begin());
+        std::fill(d.begin(), d.end(), 0.0F);
+        residual = new_residual;
+        if (residual <= tolerance)
+        {
+            break;
+        }
+
+        // The direction is kept, rescaled to the new units, so the Krylov space built so far is not lost
+        kernels::Scale(static_cast<float>(scale / residual), p.data(), p.data(), n);
+        scale = residual;
+        load_residual();
+        residual_dotted = kernels::Dot(r.data(), r.data(), n);
+        update_threshold = kMixedPrecisionReliableUpdateReduction * kMixedPrecisionReliableUpdateReduction *
+                           residual_dotted;
+    }
+
+    monitor.Finish(iteration, residual <= tolerance);
+    return iteration;
+}
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,112 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Solvers that do their O(n^3) or per iteration work in single precision and recover double accuracy by iterative
+ * refinement
+ */
+
+#ifndef MATRIX_SOLVERS_MIXED_PRECISION_MIXED_PRECISION_SOLVERS_H
+#define MATRIX_SOLVERS_MIXED_PRECISION_MIXED_PRECISION_SOLVERS_H
+
+#include "matrix_solvers/decomposition_methods/lu_decomposition.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
+#include "matrix_solvers/utilities.h"
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Single precision LU factorization of a double matrix, solves refined to double accuracy
+///
+/// Every refinement computes the residual r = b - A * x in double, solves A * d = r with the float factors and adds d
+/// to x in double. The error shrinks by a factor of about 6e-8 * cond(A) per refinement, so for cond(A) well below
+/// 1e7 a few refinements reach the accuracy of a double LUFactorization at roughly half the cost of factoring.
+/// Keeps a copy of A for the residuals.
+class MixedPrecisionLUFactorization
+{
+  public:
+    /// @throws std::invalid_argument: when A is not square or is singular in single precision
+    explicit MixedPrecisionLUFactorization(const Matrix<double>& A);
+
+    std::int32_t NumberOfRows() const { return A_.NumberOfRows(); }
+
+    /// @brief Solves Ax = b by iterative refinement
+    ///
+    /// Stops when the residual meets the tolerance or stops decreasing, the latter means A is too ill conditioned for
+    /// single precision factors to make progress and the solve is reported as not converged, x is then the best
+    /// solution found.
+    ///
+    /// @param b: right hand side of length n
+    /// @param x: receives the solution, its previous contents are ignored
+    /// @param tolerance: stopping criterion for the L2 norm of b - A * x, computed in double
+    /// @param max_refinements: maximum number of float solves, the first one solves for b itself
+    /// @param telemetry: optional stats and observer, receives the residual after every refinement. The float
+    /// triangular solves are timed as the preconditioner phase, the double residuals as the operator phase
+    ///
+    /// @return Number of float solves performed
+    ///
+    /// @throws std::length_error: when b does not have n entries
+    std::int32_t Solve(const std::vector<double>& b,
+                       std::vector<double>& x,
+                       const double tolerance = 1e-10,
+                       const std::int32_t max_refinements = 10,
+                       const SolverTelemetry& telemetry = {}) const;
+
+    const BasicLUFactorization<float>& SinglePrecisionFactors() const { return LU_; }
+
+  private:
+    Matrix<double> A_{};
+    BasicLUFactorization<float> LU_{};
+};
+
+/// @brief LUSolve with a single precision factorization, refined to double accuracy
+///
+/// NOTE: Solving several systems with the same A should factor it once with MixedPrecisionLUFactorization
+///
+/// @throws std::invalid_argument: when A is not square or is singular in single precision
+/// @throws std::length_error: when b does not have n entries
+std::vector<double> MixedPrecisionLUSolve(const Matrix<double>& A,
+                                          const std::vector<double>& b,
+                                          const double tolerance = 1e-10,
+                                          const std::int32_t max_refinements = 10,
+                                          const SolverTelemetry& telemetry = {});
+
+/// @brief Conjugate Gradient iterating in single precision, refined to double accuracy
+///
+/// The values of A are copied to float once per solve, the row offsets and column indices are shared, and every
+/// iteration runs in float on half the bytes of a double one, which is what bounds Conjugate Gradient on large sparse
+/// systems. Whenever the float residual has dropped by kMixedPrecisionReliableUpdateReduction, a reliable update adds
+/// the accumulated correction to x in double and replaces the float residual by b - A * x computed in double. The
+/// search direction survives the update, so the iteration count stays close to that of double Conjugate Gradient.
+///
+/// @param A nxn sparse symmetric positive-definite matrix
+/// @param b Right-hand side vector
+/// @param x On input: initial guess; on output: approximate solution
+/// @param tolerance Stopping criterion for the L2 norm of b - A * x, computed in double
+/// @param max_iterations Maximum number of float Conjugate Gradient iterations
+/// @param telemetry Optional stats and observer, receives the residual after every iteration, the float recurrence
+/// estimate scaled back to double units, or b - A * x computed in double when the iteration ends in a reliable update
+///
+/// @return Number of float Conjugate Gradient iterations performed
+std::int32_t MixedPrecisionConjugateGradient(const CsrMatrix& A,
+                                             const std::vector<double>& b,
+                                             std::vector<double>& x,
+                                             const double tolerance = 1e-3,
+                                             const std::int32_t max_iterations = 1000,
+                                             const SolverTelemetry& telemetry = {});
+
+/// Reduction of the float residual between reliable updates of MixedPrecisionConjugateGradient, each update costs one
+/// double product with A while longer stretches let the float residual drift further from the true one
+constexpr float kMixedPrecisionReliableUpdateReduction{0.1F};
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_MIXED_PRECISION_MIXED_PRECISION_SOLVERS_H
@@ -0,0 +1,229 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/mixed_precision/mixed_precision_solvers.h"
+#include "matrix_solvers/direct_solvers/lu_solve.h"
+#include "matrix_solvers/iterative_solvers/conjugate_gradient.h"
+#include "matrix_solvers/operations/operations.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+/// @brief Random diagonally dominant system, conditioned well enough for single precision factors
+Matrix<double> CreateDiagonallyDominantMatrix(const std::int32_t n)
+{
+    std::mt19937 generator{11};
+    std::uniform_real_distribution<double> distribution{-1.0, 1.0};
+    Matrix<double> A(n, n);
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        for (std::int32_t j{0}; j < n; ++j)
+        {
+            A(i, j) = distribution(generator);
+        }
+        A(i, i) += static_cast<double>(n);
+    }
+    return A;
+}
+
+/// @brief 2D Poisson matrix on a side x side grid of interior points
+CsrMatrix CreatePoissonMatrix(const std::int32_t side)
+{
+    const auto n = side * side;
+    CooMatrix coo(n, n);
+    for (std::int32_t row{0}; row < side; ++row)
+    {
+        for (std::int32_t column{0}; column < side; ++column)
+        {
+            const auto i = row * side + column;
+            coo.Add(i, i, 4.0);
+            if (column > 0)
+            {
+                coo.Add(i, i - 1, -1.0);
+            }
+            if (column < side - 1)
+            {
+                coo.Add(i, i + 1, -1.0);
+            }
+            if (row > 0)
+            {
+                coo.Add(i, i - side, -1.0);
+            }
+            if (row < side - 1)
+            {
+                coo.Add(i, i + side, -1.0);
+            }
+        }
+    }
+    return CsrMatrix{coo};
+}
+
+double ResidualNorm(const Matrix<double>& A, const std::vector<double>& x, const std::vector<double>& b)
+{
+    auto residual = b;
+    Gemv(-1.0, A, x, 1.0, residual);
+    return L2Norm(residual);
+}
+
+TEST(MixedPrecisionLUSolveTest, GivenWellConditionedSystem_ExpectDoubleAccuracy)
+{
+    // Given
+    const std::int32_t n{150};
+    const auto A = CreateDiagonallyDominantMatrix(n);
+    const std::vector<double> b(static_cast<std::size_t>(n), 1.0);
+    SolverStats stats{};
+
+    // Call
+    const auto x = MixedPrecisionLUSolve(A, b, 1e-11, 10, {&stats});
+
+    // Expect, a float solve alone leaves a residual of order 1e-6
+    const auto x_double = LUSolve(A, b);
+    EXPECT_TRUE(stats.converged);
+    EXPECT_LE(ResidualNorm(A, x, b), 1e-11);
+    EXPECT_GT(stats.residual_history.front(), 1e-9);
+    for (std::size_t i{0}; i < x.size(); ++i)
+    {
+        EXPECT_NEAR(x[i], x_double[i], 1e-13);
+    }
+}
+
+TEST(MixedPrecisionLUSolveTest, GivenSeveralRightHandSides_ExpectFactorsReused)
+{
+    // Given
+    const std::int32_t n{40};
+    const auto A = CreateDiagonallyDominantMatrix(n);
+    const MixedPrecisionLUFactorization LU{A};
+
+    for (const double value : {1.0, -3.0, 1e4})
+    {
+        const std::vector<double> b(static_cast<std::size_t>(n), value);
+        std::vector<double> x{};
+
+        // Call
+        const auto tolerance = 1e-11 * std::abs(value);
+        const auto refinements = LU.Solve(b, x, tolerance);
+
+        // Expect
+        EXPECT_GT(refinements, 1);
+        EXPECT_LE(ResidualNorm(A, x, b), tolerance);
+    }
+}
+
+TEST(MixedPrecisionLUSolveTest, GivenSystemTooIllConditionedForFloat_ExpectNotConvergedWithBestSolution)
+{
+    // Given, the Hilbert matrix of size 10 has a condition number of about 1e13
+    const std::int32_t n{10};
+    Matrix<double> A(n, n);
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        for (std::int32_t j{0}; j < n; ++j)
+        {
+            A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+        }
+    }
+    const std::vector<double> b(static_cast<std::size_t>(n), 1.0);
+    SolverStats stats{};
+
+    // Call
+    const auto x = MixedPrecisionLUSolve(A, b, 1e-12, 50, {&stats});
+
+    // Expect, refinement stops early once it stagnates and rejects the correction that did not help
+    EXPECT_FALSE(stats.converged);
+    EXPECT_LT(stats.iterations, 50);
+    const auto best = *std::min_element(stats.residual_history.cbegin(), stats.residual_history.cend());
+    EXPECT_LE(ResidualNorm(A, x, b), best * (1.0 + 1e-6));
+}
+
+TEST(MixedPrecisionLUSolveTest, GivenInvalidSystem_ExpectThrow)
+{
+    // Given
+    const Matrix<double> singular{{1.0, 2.0}, {2.0, 4.0}};
+    const MixedPrecisionLUFactorization LU{Matrix<double>{{2.0, 1.0}, {1.0, 3.0}}};
+    std::vector<double> x{};
+
+    // Call and Expect
+    EXPECT_THROW(MixedPrecisionLUSolve(singular, {1.0, 2.0}), std::invalid_argument);
+    EXPECT_THROW(LU.Solve({1.0, 2.0, 3.0}, x), std::length_error);
+}
+
+TEST(MixedPrecisionConjugateGradientTest, GivenPoissonSystem_ExpectDoubleAccuracyWithinTwiceDoubleIterations)
+{
+    // Given
+    const auto A = CreatePoissonMatrix(32);
+    const std::vector<double> b(static_cast<std::size_t>(A.NumberOfRows()), 1.0);
+    std::vector<double> x(b.size(), 0.0);
+    std::vector<double> x_double(b.size(), 0.0);
+    SolverStats stats{};
+
+    // Call
+    const auto iterations = MixedPrecisionConjugateGradient(A, b, x, 1e-10, 2000, {&stats});
+    const auto double_iterations = ConjugateGradient(A, b, x_double, 1e-10, 2000);
+
+    // Expect
+    auto residual = b;
+    SpMV(-1.0, A, x, 1.0, residual);
+    EXPECT_TRUE(stats.converged);
+    EXPECT_EQ(stats.iterations, iterations);
+    EXPECT_EQ(stats.residual_history.size(), static_cast<std::size_t>(iterations));
+    EXPECT_LE(stats.residual_history.back(), 1e-10);
+    EXPECT_LE(L2Norm(residual), 1e-10);
+    EXPECT_LE(iterations, 2 * double_iterations);
+}
+
+TEST(MixedPrecisionConjugateGradientTest, GivenToleranceBelowFloatAccuracy_ExpectNotConvergedWithBestSolution)
+{
+    // Given, a zero tolerance that the float iterations cannot reach
+    const auto A = CreatePoissonMatrix(8);
+    const std::vector<double> b(static_cast<std::size_t>(A.NumberOfRows()), 1.0);
+    std::vector<double> x(b.size(), 0.0);
+    SolverStats stats{};
+
+    // Call
+    MixedPrecisionConjugateGradient(A, b, x, 0.0, 500, {&stats});
+
+    // Expect, the update that stopped reducing the residual is not kept in x
+    auto residual = b;
+    SpMV(-1.0, A, x, 1.0, residual);
+    EXPECT_FALSE(stats.converged);
+    EXPECT_TRUE(std::isfinite(L2Norm(residual)));
+    EXPECT_LE(L2Norm(residual), 1e-4 * L2Norm(b));
+}
+
+TEST(MixedPrecisionConjugateGradientTest, GivenConvergedInitialGuess_ExpectNoIterations)
+{
+    // Given
+    const auto A = CreatePoissonMatrix(4);
+    const std::vector<double> x_exact(static_cast<std::size_t>(A.NumberOfRows()), 1.0);
+    std::vector<double> b(x_exact.size(), 0.0);
+    SpMV(1.0, A, x_exact, 0.0, b);
+    auto x = x_exact;
+
+    // Call
+    const auto iterations = MixedPrecisionConjugateGradient(A, b, x, 1e-12);
+
+    // Expect
+    EXPECT_EQ(iterations, 0);
+    EXPECT_EQ(x, x_exact);
+}
+
+}  // namespace
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,221 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Cache-blocked dense matrix-matrix multiplication kernel
+ *
+ * The loop structure follows the classic Goto/BLIS decomposition:
+ *
+ *     for jc in n step NC        (B panel, L3)
+ *       for pc in k step KC      pack B[pc:pc+KC, jc:jc+NC] into NR wide column slivers
+ *         for ic in m step MC    pack A[ic:ic+MC, pc:pc+KC] into MR tall row slivers (L2)
+ *           for jr, ir           MR x NR micro-kernel, accumulators held in registers
+ */
+
+#include "matrix_solvers/operations/gemm.h"
+#include "matrix_solvers/utilities.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+template <typename T>
+using PackedBuffer = std::vector<T, AlignedAllocator<T>>;
+
+/// @brief Copies an mc x kc block of A into slivers of kMR rows, stored column by column
+template <typename T>
+void PackA(const std::int32_t mc, const std::int32_t kc, const T* A, const std::int32_t lda, T* packed)
+{
+    for (std::int32_t ir{0}; ir < mc; ir += gemm::kMR)
+    {
+        const auto rows = std::min(gemm::kMR, mc - ir);
+        for (std::int32_t p{0}; p < kc; ++p)
+        {
+            for (std::int32_t r{0}; r < gemm::kMR; ++r)
+            {
+                packed[r] = (r < rows) ? A[static_cast<std::ptrdiff_t>(ir + r) * lda + p] : T{0};
+            }
+            packed += gemm::kMR;
+        }
+    }
+}
+
+/// @brief Copies a kc x nc block of B into slivers of kNR columns, stored row by row
+template <typename T>
+void PackB(const std::int32_t kc, const std::int32_t nc, const T* B, const std::int32_t ldb, T* packed)
+{
+    for (std::int32_t jr{0}; jr < nc; jr += gemm::kNR)
+    {
+        const auto columns = std::min(gemm::kNR, nc - jr);
+        for (std::int32_t p{0}; p < kc; ++p)
+        {
+            const T* b_row = B + static_cast<std::ptrdiff_t>(p) * ldb + jr;
+            for (std::int32_t c{0}; c < gemm::kNR; ++c)
+            {
+                packed[c] = (c < columns) ? b_row[c] : T{0};
+            }
+            packed += gemm::kNR;
+        }
+    }
+}
+
+/// @brief C[0:rows, 0:columns] += a_sliver * b_sliver, with the full kMR x kNR tile accumulated in registers
+template <typename T>
+void MicroKernel(const std::int32_t kc,
+                 const T* a_sliver,
+                 const T* b_sliver,
+                 T* C,
+                 const std::int32_t ldc,
+                 const std::int32_t rows,
+                 const std::int32_t columns)
+{
+    T accumulator[gemm::kMR][gemm::kNR]{};
+
+    for (std::int32_t p{0}; p < kc; ++p)
+    {
+        for (std::int32_t r{0}; r < gemm::kMR; ++r)
+        {
+            const T a_value = a_sliver[r];
+            for (std::int32_t c{0}; c < gemm::kNR; ++c)
+            {
+                accumulator[r][c] += a_value * b_sliver[c];
+            }
+        }
+        a_sliver += gemm::kMR;
+        b_sliver += gemm::kNR;
+    }
+
+    for (std::int32_t r{0}; r < rows; ++r)
+    {
+        T* c_row = C + static_cast<std::ptrdiff_t>(r) * ldc;
+        for (std::int32_t c{0}; c < columns; ++c)
+        {
+            c_row[c] += accumulator[r][c];
+        }
+    }
+}
+
+/// @brief Straightforward i-k-j product for problems too small to amortize packing
+template <typename T>
+void SmallGemm(const std::int32_t m,
+               const std::int32_t n,
+               const std::int32_t k,
+               const T* A,
+               const std::int32_t lda,
+               const T* B,
+               const std::int32_t ldb,
+               T* C,
+               const std::int32_t ldc)
+{
+    for (std::int32_t i{0}; i < m; ++i)
+    {
+        T* c_row = C + static_cast<std::ptrdiff_t>(i) * ldc;
+        for (std::int32_t p{0}; p < k; ++p)
+        {
+            const T a_ip = A[static_cast<std::ptrdiff_t>(i) * lda + p];
+            const T* b_row = B + static_cast<std::ptrdiff_t>(p) * ldb;
+            for (std::int32_t j{0}; j < n; ++j)
+            {
+                c_row[j] += a_ip * b_row[j];
+            }
+        }
+    }
+}
+
+std::int32_t RoundUp(const std::int32_t value, const std::int32_t multiple)
+{
+    return ((value + multiple - 1) / multiple) * multiple;
+}
+
+}  // namespace
+
+template <typename T>
+void Gemm(const std::int32_t m,
+          const std::int32_t n,
+          const std::int32_t k,
+          const T* A,
+          const std::int32_t lda,
+          const T* B,
+          const std::int32_t ldb,
+          T* C,
+          const std::int32_t ldc)
+{
+    if ((m <= 0) || (n <= 0) || (k <= 0))
+    {
+        return;
+    }
+
+    if (static_cast<std::int64_t>(m) * n * k <= gemm::kSmallProblemSize)
+    {
+        SmallGemm(m, n, k, A, lda, B, ldb, C, ldc);
+        return;
+    }
+
+    const auto kc_max = std::min(gemm::kKC, k);
+    PackedBuffer<T> packed_a(static_cast<std::size_t>(RoundUp(std::min(gemm::kMC, m), gemm::kMR)) * kc_max);
+    PackedBuffer<T> packed_b(static_cast<std::size_t>(RoundUp(std::min(gemm::kNC, n), gemm::kNR)) * kc_max);
+
+    for (std::int32_t jc{0}; jc < n; jc += gemm::kNC)
+    {
+        const auto nc = std::min(gemm::kNC, n - jc);
+
+        for (std::int32_t pc{0}; pc < k; pc += gemm::kKC)
+        {
+            const auto kc = std::min(gemm::kKC, k - pc);
+            PackB(kc, nc, B + static_cast<std::ptrdiff_t>(pc) * ldb + jc, ldb, packed_b.data());
+
+            for (std::int32_t ic{0}; ic < m; ic += gemm::kMC)
+            {
+                const auto mc = std::min(gemm::kMC, m - ic);
+                PackA(mc, kc, A + static_cast<std::ptrdiff_t>(ic) * lda + pc, lda, packed_a.data());
+
+                for (std::int32_t jr{0}; jr < nc; jr += gemm::kNR)
+                {
+                    const T* b_sliver = packed_b.data() + static_cast<std::ptrdiff_t>(jr) * kc;
+                    for (std::int32_t ir{0}; ir < mc; ir += gemm::kMR)
+                    {
+                        MicroKernel(kc,
+                                    packed_a.data() + static_cast<std::ptrdiff_t>(ir) * kc,
+                                    b_sliver,
+                                    C + static_cast<std::ptrdiff_t>(ic + ir) * ldc + jc + jr,
+                                    ldc,
+                                    std::min(gemm::kMR, mc - ir),
+                                    std::min(gemm::kNR, nc - jr));
+                    }
+                }
+            }
+        }
+    }
+}
+
+template void Gemm<float>(const std::int32_t m,
+                         const std::int32_t n,
+                         const std::int32_t k,
+                         const float* A,
+                         const std::int32_t lda,
+                         const float* B,
+                         const std::int32_t ldb,
+                         float* C,
+                         const std::int32_t ldc);
+template void Gemm<double>(const std::int32_t m,
+                           const std::int32_t n,
+                           const std::int32_t k,
+                           const double* A,
+                           const std::int32_t lda,
+                           const double* B,
+                           const std::int32_t ldb,
+                           double* C,
+                           const std::int32_t ldc);
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,67 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Cache-blocked dense matrix-matrix multiplication kernel
+ */
+
+#ifndef MATRIX_SOLVERS_OPERATIONS_GEMM_H
+#define MATRIX_SOLVERS_OPERATIONS_GEMM_H
+
+#include <cstdint>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace gemm
+{
+
+/// Register block of the micro-kernel: an MR x NR tile of C is kept in registers while sweeping over k
+constexpr std::int32_t kMR{4};
+constexpr std::int32_t kNR{8};
+
+/// Cache blocks: a KC x NR sliver of B stays in L1, an MC x KC block of A in L2 and a KC x NC panel of B in L3
+constexpr std::int32_t kKC{256};
+constexpr std::int32_t kMC{96};
+constexpr std::int32_t kNC{2048};
+
+/// Below this many multiply-adds packing does not pay off and a plain loop is used instead
+constexpr std::int64_t kSmallProblemSize{32 * 32 * 32};
+
+}  // namespace gemm
+
+/// @brief Accumulates the product of two row-major matrices, C += A * B
+///
+/// A and B are copied block by block into packed, contiguous panels so that the inner micro-kernel only ever
+/// streams through memory with unit stride. Partial tiles at the matrix edges are zero padded during packing.
+///
+/// @param m: number of rows of A and C
+/// @param n: number of columns of B and C
+/// @param k: number of columns of A and rows of B
+/// @param A: pointer to the first element of the m x k matrix A
+/// @param lda: distance between consecutive rows of A
+/// @param B: pointer to the first element of the k x n matrix B
+/// @param ldb: distance between consecutive rows of B
+/// @param C: pointer to the first element of the m x n matrix C
+/// @param ldc: distance between consecutive rows of C
+///
+/// @param T: template-parameter-typename, instantiated for float and double
+template <typename T>
+void Gemm(const std::int32_t m,
+          const std::int32_t n,
+          const std::int32_t k,
+          const T* A,
+          const std::int32_t lda,
+          const T* B,
+          const std::int32_t ldb,
+          T* C,
+          const std::int32_t ldc);
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_OPERATIONS_GEMM_H
@@ -7,15 +7,13 @@
 
 #include "matrix_solvers/operations/operations.h"
 #include "matrix_solvers/decomposition_methods/lu_decomposition.h"
-#include "matrix_solvers/direct_solvers/backwards_substitution.h"
-#include "matrix_solvers/direct_solvers/forward_substitution.h"
+#include "matrix_solvers/operations/gemm.h"
+#include "matrix_solvers/operations/vector_kernels.h"
 #include "matrix_solvers/utilities.h"
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
-#include <cstdlib>
-#include <numeric>
-#include <tuple>
+#include <stdexcept>
 #include <vector>
 
 namespace nm
@@ -26,86 +24,82 @@ namespace matrix
 
 Matrix<double> MatMult(const Matrix<double>& A, const Matrix<double>& B)
 {
-    const auto m = static_cast<std::int32_t>(A.size());
-    const auto n = static_cast<std::int32_t>(B.size());
+    Matrix<double> result{};
+    MatMult(A, B, result);
+    return result;
+}
+
+void MatMult(const Matrix<double>& A, const Matrix<double>& B, Matrix<double>& result)
+{
+    const auto m = A.NumberOfRows();
+    const auto n = B.NumberOfRows();
 
     if ((m <= 0) || (n <= 0))
     {
         throw std::length_error("The size of the matrices must be greater 0");
     }
-    const auto p = static_cast<std::int32_t>(B.at(0).size());
+    const auto p = B.NumberOfColumns();
 
-    if ((static_cast<std::int32_t>(A.at(0).size()) != n))
+    if (A.NumberOfColumns() != n)
     {
         throw std::length_error("Input matrix dimension mismatch. Are your matrices compatible?");
     }
 
-    Matrix<double> result{};
-    result.resize(m);
-    for (auto& row : result)
+    // result is cleared before Gemm reads A and B
+    if ((&result == &A) || (&result == &B))
     {
-        row.resize(p);
+        throw std::invalid_argument("MatMult: result must not alias A or B");
     }
 
-    double sum{0.0};
-    for (std::int32_t i = 0; i < m; ++i)
+    if ((result.NumberOfRows() == m) && (result.NumberOfColumns() == p))
     {
-        for (std::int32_t j = 0; j < p; ++j)
-        {
-            sum = 0.0;
-            for (std::int32_t k = 0; k < n; ++k)
-            {
-                sum += A.at(i).at(k) * B.at(k).at(j);
-            }
-            result.at(i).at(j) = sum;
-        }
+        result.Fill(0.0);
     }
-    return result;
+    else
+    {
+        result.Resize(m, p);
+    }
+
+    Gemm(m, p, n, A.Data(), n, B.Data(), p, result.Data(), p);
 }
 
 std::vector<double> MatMult(const Matrix<double>& A, const std::vector<double>& b)
 {
     assert(!A.empty());
-    const auto m = static_cast<std::int32_t>(A.size());
-    const auto n = static_cast<std::int32_t>(A.at(0).size());
-    const auto p = static_cast<std::int32_t>(b.size());
+    std::vector<double> result(A.size());
+    Gemv(1.0, A, b, 0.0, result);
+    return result;
+}
+
+void Gemv(const double alpha,
+          const Matrix<double>& A,
+          const std::vector<double>& x,
+          const double beta,
+          std::vector<double>& y)
+{
+    const auto m = A.NumberOfRows();
+    const auto n = A.NumberOfColumns();
 
     if ((m <= 0) || (n <= 0))
     {
         throw std::length_error("The size of the matrices must be greater 0");
     }
 
-    if (n != p)
+    if ((n != static_cast<std::int32_t>(x.size())) || (m != static_cast<std::int32_t>(y.size())))
     {
         throw std::length_error("Input matrix dimension mismatch. Are your matrices compatible?");
     }
 
-    std::vector<double> result{};
-    result.resize(m);
-
-    double sum{0.0};
     for (std::int32_t i = 0; i < m; ++i)
     {
-        sum = 0.0;
-        for (std::int32_t k = 0; k < n; ++k)
-        {
-            sum += A.at(i).at(k) * b.at(k);
-        }
-        result.at(i) = sum;
+        const auto row_times_x = alpha * kernels::Dot(&A(i, 0), x.data(), static_cast<std::size_t>(n));
+        y[i] = (beta == 0.0) ? row_times_x : row_times_x + beta * y[i];
     }
-    return result;
 }
 
 double L2Norm(const std::vector<double>& vector)
 {
-    std::vector<double> vector_squared{};
-
-    std::transform(
-        std::cbegin(vector), std::cend(vector), std::back_inserter(vector_squared), [](const auto& vector_element) {
-            return vector_element * vector_element;
-        });
-
-    return std::sqrt(std::accumulate(std::cbegin(vector_squared), std::cend(vector_squared), 0.0));
+    return std::sqrt(kernels::SumOfSquares(vector.data(), vector.size()));
 }
 
 double Dot(const std::vector<double>& vector_1, const std::vector<double>& vector_2)
@@ -126,16 +120,7 @@ double Dot(const std::vector<double>& vector_1, const std::vector<double>& vecto
         throw std::length_error("Vectors are not of the same length");
     }
 
-    std::vector<double> vectors_multiplied{};
-
-    std::ignore = std::transform(
-        std::cbegin(vector_1),
-        std::cend(vector_1),
-        std::cbegin(vector_2),
-        std::back_inserter(vectors_multiplied),
-        [](const auto& vector_1_element, const auto& vector_2_element) { return vector_1_element * vector_2_element; });
-
-    return std::accumulate(std::cbegin(vectors_multiplied), std::cend(vectors_multiplied), 0.0);
+    return kernels::Dot(vector_1.data(), vector_2.data(), vector_1.size());
 }
 
 std::vector<double> CalculateResidual(const Matrix<double>& A,
@@ -156,11 +141,11 @@ std::vector<double> CalculateResidual(const Matrix<double>& A,
 Matrix<double> ScalarProduct(const Matrix<double>& A, const double value)
 {
     Matrix<double> result{A};
-    for (std::int32_t i{0}; i < static_cast<std::int32_t>(A.size()); ++i)
+    for (std::int32_t i{0}; i < A.NumberOfRows(); ++i)
     {
-        for (std::int32_t j{0}; j < static_cast<std::int32_t>(A.size()); ++j)
+        for (std::int32_t j{0}; j < A.NumberOfColumns(); ++j)
         {
-            result.at(i).at(j) = A.at(i).at(j) * value;
+            result(i, j) = A(i, j) * value;
         }
     }
     return result;
@@ -178,62 +163,35 @@ std::vector<double> ScalarProduct(const std::vector<double>& A, const double val
 
 Matrix<double> KroneckerProduct(const Matrix<double>& A, const Matrix<double>& B)
 {
-    const std::int32_t m = static_cast<std::int32_t>(A.size());
-    const std::int32_t n = static_cast<std::int32_t>(A.at(0).size());
-    const std::int32_t p = static_cast<std::int32_t>(B.size());
-    const std::int32_t q = static_cast<std::int32_t>(B.at(0).size());
+    const std::int32_t m = A.NumberOfRows();
+    const std::int32_t n = A.NumberOfColumns();
+    const std::int32_t p = B.NumberOfRows();
+    const std::int32_t q = B.NumberOfColumns();
 
-    auto C = static_cast<double*>(malloc(m * n * p * q * sizeof(double)));
-    std::int32_t indx{};
+    Matrix<double> C(m * p, n * q);
 
     for (std::int32_t i{0}; i < m; ++i)
     {
         for (std::int32_t j{0}; j < n; ++j)
         {
+            const auto a_ij = A(i, j);
             for (std::int32_t k{0}; k < p; ++k)
             {
                 for (std::int32_t l{0}; l < q; ++l)
                 {
-                    indx = (l + p * j) + (q * n) * (k + p * i);
-                    const auto product = A.at(i).at(j) * B.at(k).at(l);
-                    C[indx] = product;
+                    C(i * p + k, j * q + l) = a_ij * B(k, l);
                 }
             }
         }
     }
 
-    return Matrix<double>(C, m * p, n * q);
+    return C;
 }
 
 Matrix<double> InvertWithLU(const Matrix<double>& A)
 {
-    // Decompose A into the product of an upper and lower triangular matrices
-    const auto LU = Doolittle(A);
-    const auto L = LU.first;
-    const auto U = LU.second;
-    const auto n = static_cast<std::int32_t>(A.size());
-
-    // Transpose Identity Matrix to solve column by column
-    const auto I = CreateIdentityMatrix<double>(n);
-
-    // Solve for U inverse column by column by backwards substitution
-    Matrix<double> X(n, n);
-    for (std::int32_t i{0}; i < n; ++i)
-    {
-        X.at(i) = BackwardsSubstitution(U, I.at(i));
-    }
-    X.TransposeInPlace();
-
-    // Solve for L inverse column by column by forwards substitution
-    Matrix<double> Y(n, n);
-    for (std::int32_t i{0}; i < n; ++i)
-    {
-        Y.at(i) = ForwardSubstitution(L, I.at(i));
-    }
-    Y.TransposeInPlace();
-
-    const auto Ainv = MatMult(X, Y);
-    return Ainv;
+    // Factor once and solve for all columns of the identity together
+    return LUFactorization{A}.Inverse();
 }
 
 }  // namespace matrix
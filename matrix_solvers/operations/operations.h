@@ -34,6 +34,33 @@ Matrix<double> MatMult(const Matrix<double>& A, const Matrix<double>& B);
 /// @return
 std::vector<double> MatMult(const Matrix<double>& A, const std::vector<double>& b);
 
+/// @brief Matrix Multiplication Function writing into a caller provided Matrix
+///
+/// The result is only reallocated when its shape does not already match mxp, so repeated products of the same
+/// shape do not allocate.
+///
+/// @param A: mxn Matrix of doubles
+/// @param B: nxp Matrix of doubles
+/// @param result: Matrix receiving the mxp product, must not alias A or B
+///
+/// @throws std::invalid_argument: when result is A or B
+void MatMult(const Matrix<double>& A, const Matrix<double>& B, Matrix<double>& result);
+
+/// @brief General matrix-vector product into a caller provided vector, y = alpha * A * x + beta * y
+///
+/// When beta is zero y is only written, so it may hold uninitialized or NaN values on entry.
+///
+/// @param alpha: scalar multiplier of A * x
+/// @param A: mxn Matrix of doubles
+/// @param x: nx1 std::vector of doubles
+/// @param beta: scalar multiplier of y
+/// @param y: mx1 std::vector of doubles receiving the result, must not alias x
+void Gemv(const double alpha,
+          const Matrix<double>& A,
+          const std::vector<double>& x,
+          const double beta,
+          std::vector<double>& y);
+
 /// @brief Calculate the L2 norm of a vector
 ///
 /// @param vector: std::vector of doubles
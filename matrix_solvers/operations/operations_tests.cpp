@@ -7,8 +7,11 @@
 #include "matrix_solvers/operations/operations.h"
 #include "matrix_solvers/utilities.h"
 #include "matrix_solvers/utilities_tests.h"
+#include <cstddef>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace nm
@@ -209,6 +212,136 @@ TEST_F(MatrixMultiplicationTestFixture, GivenOneMatrixAndOneVector_ExpectExactSo
     }
 }
 
+TEST_F(MatrixMultiplicationTestFixture, GivenPreallocatedOutput_ExpectSameResultAsAllocatingVersion)
+{
+    // Given, stale values in the output must not leak into the product
+    Matrix<double> C(static_cast<std::int32_t>(A_.size()), static_cast<std::int32_t>(B_.at(0).size()));
+    C.Fill(99.0);
+
+    // Call
+    MatMult(A_, B_, C);
+
+    // Expect
+    const auto expected = MatMult(A_, B_);
+    EXPECT_EQ(C.NumberOfRows(), expected.NumberOfRows());
+    EXPECT_EQ(C.NumberOfColumns(), expected.NumberOfColumns());
+    for (std::int32_t i = 0; i < C.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j = 0; j < C.NumberOfColumns(); ++j)
+        {
+            EXPECT_NEAR(C(i, j), expected(i, j), tolerance_);
+        }
+    }
+}
+
+TEST_F(MatrixMultiplicationTestFixture, GivenOutputAliasingAnInput_ExpectException)
+{
+    // Given
+    Matrix<double> A{{1.0, 2.0}, {3.0, 4.0}};
+    Matrix<double> B{{5.0, 6.0}, {7.0, 8.0}};
+
+    // Call & Expect
+    EXPECT_THROW(MatMult(A, A, A), std::invalid_argument);
+    EXPECT_THROW(MatMult(A, B, B), std::invalid_argument);
+    EXPECT_EQ(B(1, 1), 8.0);
+}
+
+TEST_F(MatrixMultiplicationTestFixture, GivenAlphaAndBeta_ExpectScaledMatrixVectorProductAccumulatedIntoY)
+{
+    // Given
+    const std::vector<double> x = {1, 2, 3};
+    std::vector<double> y = {1, 1, 1};
+    const std::vector<double> y_expected = {2 * 8 - 1, 2 * 11 - 1, 2 * 14 - 1};
+
+    // Call
+    Gemv(2.0, B_, x, -1.0, y);
+
+    // Expect
+    for (std::size_t i = 0; i < y.size(); ++i)
+    {
+        EXPECT_NEAR(y.at(i), y_expected.at(i), tolerance_);
+    }
+}
+
+TEST_F(MatrixMultiplicationTestFixture, GivenOutputVectorOfWrongLength_ExpectException)
+{
+    // Given
+    const std::vector<double> x = {1, 2, 3};
+    std::vector<double> y = {1, 1};
+
+    // Call & Expect
+    EXPECT_THROW(Gemv(1.0, B_, x, 0.0, y), std::length_error);
+}
+
+struct BlockedMatrixMultiplicationTestParameter
+{
+    std::int32_t m{};
+    std::int32_t k{};
+    std::int32_t n{};
+    std::string test_name{};
+};
+
+class BlockedMatrixMultiplicationTestFixture
+    : public ::testing::TestWithParam<BlockedMatrixMultiplicationTestParameter>
+{
+  public:
+    static Matrix<double> CreateTestMatrix(const std::int32_t rows, const std::int32_t columns, const std::int32_t seed)
+    {
+        // Small integer entries keep every partial sum exact, independent of the summation order
+        Matrix<double> matrix(rows, columns);
+        for (std::int32_t i{0}; i < rows; ++i)
+        {
+            for (std::int32_t j{0}; j < columns; ++j)
+            {
+                matrix(i, j) = static_cast<double>((i * 7 + j * 3 + seed) % 11 - 5);
+            }
+        }
+        return matrix;
+    }
+
+    double tolerance_{1e-9};
+};
+
+TEST_P(BlockedMatrixMultiplicationTestFixture, GivenMatricesSpanningSeveralBlocks_ExpectSameResultAsNaiveProduct)
+{
+    // Given
+    const auto param = GetParam();
+    const auto A = CreateTestMatrix(param.m, param.k, 1);
+    const auto B = CreateTestMatrix(param.k, param.n, 2);
+
+    // Call
+    const auto C = MatMult(A, B);
+
+    // Expect
+    ASSERT_EQ(C.NumberOfRows(), param.m);
+    ASSERT_EQ(C.NumberOfColumns(), param.n);
+    for (std::int32_t i{0}; i < param.m; ++i)
+    {
+        for (std::int32_t j{0}; j < param.n; ++j)
+        {
+            double expected{0.0};
+            for (std::int32_t p{0}; p < param.k; ++p)
+            {
+                expected += A(i, p) * B(p, j);
+            }
+            EXPECT_NEAR(C(i, j), expected, tolerance_);
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(BlockedMatrixMultiplicationTests,
+                         BlockedMatrixMultiplicationTestFixture,
+                         ::testing::Values(
+                             // clang-format off
+                         BlockedMatrixMultiplicationTestParameter{.m = 5, .k = 7, .n = 3, .test_name = "SmallProblem"},
+                         BlockedMatrixMultiplicationTestParameter{.m = 67, .k = 300, .n = 45, .test_name = "PartialTiles"},
+                         BlockedMatrixMultiplicationTestParameter{.m = 130, .k = 17, .n = 2061, .test_name = "SeveralPanels"}
+                             // clang-format on
+                             ),
+                         [](const ::testing::TestParamInfo<BlockedMatrixMultiplicationTestParameter>& info) {
+                             return info.param.test_name;
+                         });
+
 struct InvertMatrixTestParameter
 {
     Matrix<double> matrix{};
@@ -0,0 +1,227 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Expression templates for lazy, fused element-wise arithmetic on vectors and matrices
+ */
+
+#ifndef MATRIX_SOLVERS_OPERATIONS_VECTOR_EXPRESSIONS_H
+#define MATRIX_SOLVERS_OPERATIONS_VECTOR_EXPRESSIONS_H
+
+#include "matrix_solvers/utilities.h"
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// Element-wise arithmetic is recorded as a tree of small expression objects instead of being computed, and the
+/// whole tree is evaluated by Assign in a single loop. E.g.
+///
+///     namespace expressions = nm::matrix::expressions;
+///     expressions::Assign(u, expressions::Lazy(u) + dt / 6 * (expressions::Lazy(k1) + 2.0 * expressions::Lazy(k2)));
+///
+/// reads u, k1 and k2 once and writes u once, where AddVectors and ScalarMultiply would make a temporary and a full
+/// memory pass per call. Expressions hold pointers to their operands, so they must be assigned before any operand
+/// is resized or destroyed. The target may be one of the operands, every element only depends on the same element
+/// of the operands.
+namespace expressions
+{
+
+/// @brief Base of every expression node, E is the node type itself
+template <typename E>
+class VectorExpression
+{
+  public:
+    const E& Self() const { return static_cast<const E&>(*this); }
+    std::size_t size() const { return Self().size(); }
+};
+
+/// @brief Leaf of an expression, the entries of a vector or of a matrix in storage order
+class VectorReference : public VectorExpression<VectorReference>
+{
+  public:
+    VectorReference(const double* data, const std::size_t size) : data_(data), size_(size) {}
+
+    double operator[](const std::size_t i) const { return data_[i]; }
+    std::size_t size() const { return size_; }
+
+  private:
+    const double* data_;
+    std::size_t size_;
+};
+
+struct Plus
+{
+    static double Apply(const double a, const double b) { return a + b; }
+};
+
+struct Minus
+{
+    static double Apply(const double a, const double b) { return a - b; }
+};
+
+struct Times
+{
+    static double Apply(const double a, const double b) { return a * b; }
+};
+
+/// @brief Element-wise Operation of two expressions of the same size
+template <typename Left, typename Right, typename Operation>
+class BinaryExpression : public VectorExpression<BinaryExpression<Left, Right, Operation>>
+{
+  public:
+    /// @throws std::length_error: when the operands do not have the same size
+    BinaryExpression(const Left& left, const Right& right) : left_(left), right_(right)
+    {
+        if (left_.size() != right_.size())
+        {
+            throw std::length_error("Vectors are not of the same length");
+        }
+    }
+
+    double operator[](const std::size_t i) const { return Operation::Apply(left_[i], right_[i]); }
+    std::size_t size() const { return left_.size(); }
+
+  private:
+    // Nodes are held by value, they are a few pointers and scalars and the temporaries of a full expression do not
+    // outlive the statement it is written in
+    Left left_;
+    Right right_;
+};
+
+/// @brief Expression multiplied by a scalar
+template <typename Operand>
+class ScaledExpression : public VectorExpression<ScaledExpression<Operand>>
+{
+  public:
+    ScaledExpression(const double scalar_value, const Operand& operand) : scalar_value_(scalar_value), operand_(operand)
+    {
+    }
+
+    double operator[](const std::size_t i) const { return scalar_value_ * operand_[i]; }
+    std::size_t size() const { return operand_.size(); }
+
+  private:
+    double scalar_value_;
+    Operand operand_;
+};
+
+/// @brief Starts an expression from a vector, nothing is computed until it is assigned
+template <typename Allocator>
+VectorReference Lazy(const std::vector<double, Allocator>& a)
+{
+    return VectorReference{a.data(), a.size()};
+}
+
+/// @brief Starts an expression from the entries of a matrix, only element-wise operations are expressed
+inline VectorReference Lazy(const Matrix<double>& A)
+{
+    return VectorReference{A.Data(), A.size() * static_cast<std::size_t>(A.NumberOfColumns())};
+}
+
+template <typename Left, typename Right>
+BinaryExpression<Left, Right, Plus> operator+(const VectorExpression<Left>& left, const VectorExpression<Right>& right)
+{
+    return {left.Self(), right.Self()};
+}
+
+template <typename Left, typename Right>
+BinaryExpression<Left, Right, Minus> operator-(const VectorExpression<Left>& left, const VectorExpression<Right>& right)
+{
+    return {left.Self(), right.Self()};
+}
+
+/// @brief Element-wise (Hadamard) product
+template <typename Left, typename Right>
+BinaryExpression<Left, Right, Times> Hadamard(const VectorExpression<Left>& left, const VectorExpression<Right>& right)
+{
+    return {left.Self(), right.Self()};
+}
+
+template <typename Operand>
+ScaledExpression<Operand> operator*(const double scalar_value, const VectorExpression<Operand>& operand)
+{
+    return {scalar_value, operand.Self()};
+}
+
+template <typename Operand>
+ScaledExpression<Operand> operator*(const VectorExpression<Operand>& operand, const double scalar_value)
+{
+    return {scalar_value, operand.Self()};
+}
+
+template <typename Operand>
+ScaledExpression<Operand> operator/(const VectorExpression<Operand>& operand, const double scalar_value)
+{
+    return {1.0 / scalar_value, operand.Self()};
+}
+
+template <typename Operand>
+ScaledExpression<Operand> operator-(const VectorExpression<Operand>& operand)
+{
+    return {-1.0, operand.Self()};
+}
+
+namespace detail
+{
+
+template <typename E>
+void Evaluate(const VectorExpression<E>& expression, double* result)
+{
+    const auto& self = expression.Self();
+    const auto size = self.size();
+    for (std::size_t i{0}; i < size; ++i)
+    {
+        result[i] = self[i];
+    }
+}
+
+}  // namespace detail
+
+/// @brief Evaluates the expression into result in a single pass, result may be one of its operands
+///
+/// @throws std::length_error: when result does not have the size of the expression
+template <typename Allocator, typename E>
+void Assign(std::vector<double, Allocator>& result, const VectorExpression<E>& expression)
+{
+    if (result.size() != expression.size())
+    {
+        throw std::length_error("Vectors are not of the same length");
+    }
+    detail::Evaluate(expression, result.data());
+}
+
+/// @brief Evaluates the expression into the entries of A in a single pass, A may be one of its operands
+///
+/// @throws std::length_error: when A does not have as many entries as the expression
+template <typename E>
+void Assign(Matrix<double>& A, const VectorExpression<E>& expression)
+{
+    if (A.size() * static_cast<std::size_t>(A.NumberOfColumns()) != expression.size())
+    {
+        throw std::length_error("Matrix and expression sizes do not match");
+    }
+    detail::Evaluate(expression, A.Data());
+}
+
+/// @brief Evaluates the expression into a new vector
+template <typename E>
+std::vector<double> Evaluate(const VectorExpression<E>& expression)
+{
+    std::vector<double> result(expression.size());
+    detail::Evaluate(expression, result.data());
+    return result;
+}
+
+}  // namespace expressions
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_OPERATIONS_VECTOR_EXPRESSIONS_H
@@ -0,0 +1,114 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/operations/vector_expressions.h"
+#include "matrix_solvers/utilities.h"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace expressions
+{
+
+namespace
+{
+
+TEST(VectorExpressionsTest, GivenRungeKutta4Update_ExpectSameResultAsAxpyChain)
+{
+    // Given
+    const std::vector<double> u{1.0, -2.0, 3.0, 0.5, 4.0};
+    const std::vector<double> k1{0.1, 0.2, 0.3, 0.4, 0.5};
+    const std::vector<double> k2{-1.0, 1.0, -1.0, 1.0, -1.0};
+    const std::vector<double> k3{2.0, 0.0, 2.0, 0.0, 2.0};
+    const std::vector<double> k4{0.25, 0.5, 0.75, 1.0, 1.25};
+    const double dt{0.3};
+    std::vector<double> result(u.size());
+
+    // Call
+    Assign(result, Lazy(u) + dt / 6 * (Lazy(k1) + 2.0 * Lazy(k2) + 2.0 * Lazy(k3) + Lazy(k4)));
+
+    // Expect
+    for (std::size_t i{0}; i < u.size(); ++i)
+    {
+        const auto expected = u[i] + dt / 6 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+        EXPECT_DOUBLE_EQ(result[i], expected);
+    }
+}
+
+TEST(VectorExpressionsTest, GivenTargetAmongOperands_ExpectElementWiseUpdate)
+{
+    // Given
+    std::vector<double> u{1.0, 2.0, 3.0};
+    const std::vector<double> v{3.0, 2.0, 1.0};
+
+    // Call, u = (u - v) / 2 - u
+    Assign(u, (Lazy(u) - Lazy(v)) / 2.0 - Lazy(u));
+
+    // Expect
+    EXPECT_DOUBLE_EQ(u[0], -2.0);
+    EXPECT_DOUBLE_EQ(u[1], -2.0);
+    EXPECT_DOUBLE_EQ(u[2], -2.0);
+}
+
+TEST(VectorExpressionsTest, GivenExpression_ExpectNothingComputedBeforeAssignment)
+{
+    // Given
+    std::vector<double> u{1.0, 2.0};
+    const std::vector<double> v{10.0, 20.0};
+
+    // Call
+    const auto expression = -Lazy(u) + Hadamard(Lazy(v), Lazy(v)) * 0.5;
+    u[0] = 3.0;
+    const auto result = Evaluate(expression);
+
+    // Expect, u is read when the expression is evaluated, not when it is built
+    EXPECT_DOUBLE_EQ(result[0], 47.0);
+    EXPECT_DOUBLE_EQ(result[1], 198.0);
+}
+
+TEST(VectorExpressionsTest, GivenMatrices_ExpectElementWiseCombination)
+{
+    // Given
+    const Matrix<double> A{{1.0, 2.0}, {3.0, 4.0}};
+    const Matrix<double> B{{4.0, 3.0}, {2.0, 1.0}};
+    Matrix<double> C(2, 2);
+
+    // Call
+    Assign(C, 2.0 * Lazy(A) - Lazy(B));
+
+    // Expect
+    EXPECT_DOUBLE_EQ(C(0, 0), -2.0);
+    EXPECT_DOUBLE_EQ(C(0, 1), 1.0);
+    EXPECT_DOUBLE_EQ(C(1, 0), 4.0);
+    EXPECT_DOUBLE_EQ(C(1, 1), 7.0);
+}
+
+TEST(VectorExpressionsTest, GivenOperandsOfDifferentLengths_ExpectThrow)
+{
+    // Given
+    const std::vector<double> a{1.0, 2.0, 3.0};
+    const std::vector<double> b{1.0, 2.0};
+    std::vector<double> result(2);
+
+    // Call, Expect
+    EXPECT_THROW(Lazy(a) + Lazy(b), std::length_error);
+    EXPECT_THROW(Assign(result, 2.0 * Lazy(a)), std::length_error);
+}
+
+}  // namespace
+
+}  // namespace expressions
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,738 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Vectorized BLAS level 1 kernels with runtime instruction set dispatch
+ *
+ * Every kernel is compiled once per instruction set using function level target attributes, so the library itself
+ * does not need to be built with -mavx2 or -mavx512f. The first call picks the widest variant the CPU supports.
+ */
+
+#include "matrix_solvers/operations/vector_kernels.h"
+#include <cstddef>
+#include <string>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define NM_MATRIX_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace kernels
+{
+
+namespace
+{
+
+template <typename T>
+struct KernelTable
+{
+    T (*dot)(const T*, const T*, std::size_t);
+    T (*sum_of_squares)(const T*, std::size_t);
+    void (*add)(const T*, const T*, T*, std::size_t);
+    void (*scale)(T, const T*, T*, std::size_t);
+    void (*axpy)(T, const T*, T*, std::size_t);
+    void (*axpby)(T, const T*, T, T*, std::size_t);
+};
+
+namespace scalar
+{
+
+template <typename T>
+T Dot(const T* a, const T* b, const std::size_t size)
+{
+    T sum{0};
+    for (std::size_t i{0}; i < size; ++i)
+    {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+template <typename T>
+T SumOfSquares(const T* a, const std::size_t size)
+{
+    return Dot(a, a, size);
+}
+
+template <typename T>
+void Add(const T* a, const T* b, T* result, const std::size_t size)
+{
+    for (std::size_t i{0}; i < size; ++i)
+    {
+        result[i] = a[i] + b[i];
+    }
+}
+
+template <typename T>
+void Scale(const T scalar_value, const T* a, T* result, const std::size_t size)
+{
+    for (std::size_t i{0}; i < size; ++i)
+    {
+        result[i] = scalar_value * a[i];
+    }
+}
+
+template <typename T>
+void Axpy(const T alpha, const T* x, T* y, const std::size_t size)
+{
+    for (std::size_t i{0}; i < size; ++i)
+    {
+        y[i] += alpha * x[i];
+    }
+}
+
+template <typename T>
+void Axpby(const T alpha, const T* x, const T beta, T* y, const std::size_t size)
+{
+    for (std::size_t i{0}; i < size; ++i)
+    {
+        y[i] = alpha * x[i] + beta * y[i];
+    }
+}
+
+template <typename T>
+constexpr KernelTable<T> kTable{&Dot<T>, &SumOfSquares<T>, &Add<T>, &Scale<T>, &Axpy<T>, &Axpby<T>};
+
+}  // namespace scalar
+
+#ifdef NM_MATRIX_KERNELS_X86
+
+namespace avx2
+{
+
+__attribute__((target("avx2,fma"))) double HorizontalSum(const __m256d value)
+{
+    const __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+}
+
+__attribute__((target("avx2,fma"))) double Dot(const double* a, const double* b, const std::size_t size)
+{
+    // Four independent accumulators hide the latency of the fused multiply-add
+    __m256d sum_0 = _mm256_setzero_pd();
+    __m256d sum_1 = _mm256_setzero_pd();
+    __m256d sum_2 = _mm256_setzero_pd();
+    __m256d sum_3 = _mm256_setzero_pd();
+
+    std::size_t i{0};
+    for (; i + 16 <= size; i += 16)
+    {
+        sum_0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), sum_0);
+        sum_1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4), sum_1);
+        sum_2 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 8), _mm256_loadu_pd(b + i + 8), sum_2);
+        sum_3 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 12), _mm256_loadu_pd(b + i + 12), sum_3);
+    }
+    for (; i + 4 <= size; i += 4)
+    {
+        sum_0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), sum_0);
+    }
+
+    double sum = HorizontalSum(_mm256_add_pd(_mm256_add_pd(sum_0, sum_1), _mm256_add_pd(sum_2, sum_3)));
+    for (; i < size; ++i)
+    {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+__attribute__((target("avx2,fma"))) double SumOfSquares(const double* a, const std::size_t size)
+{
+    return Dot(a, a, size);
+}
+
+__attribute__((target("avx2,fma"))) void Add(const double* a, const double* b, double* result, const std::size_t size)
+{
+    std::size_t i{0};
+    for (; i + 4 <= size; i += 4)
+    {
+        _mm256_storeu_pd(result + i, _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+    }
+    for (; i < size; ++i)
+    {
+        result[i] = a[i] + b[i];
+    }
+}
+
+__attribute__((target("avx2,fma"))) void Scale(const double scalar_value,
+                                               const double* a,
+                                               double* result,
+                                               const std::size_t size)
+{
+    const __m256d scalar = _mm256_set1_pd(scalar_value);
+    std::size_t i{0};
+    for (; i + 4 <= size; i += 4)
+    {
+        _mm256_storeu_pd(result + i, _mm256_mul_pd(scalar, _mm256_loadu_pd(a + i)));
+    }
+    for (; i < size; ++i)
+    {
+        result[i] = scalar_value * a[i];
+    }
+}
+
+__attribute__((target("avx2,fma"))) void Axpy(const double alpha, const double* x, double* y, const std::size_t size)
+{
+    const __m256d alpha_vector = _mm256_set1_pd(alpha);
+    std::size_t i{0};
+    for (; i + 4 <= size; i += 4)
+    {
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(alpha_vector, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+    }
+    for (; i < size; ++i)
+    {
+        y[i] += alpha * x[i];
+    }
+}
+
+__attribute__((target("avx2,fma"))) void Axpby(const double alpha,
+                                               const double* x,
+                                               const double beta,
+                                               double* y,
+                                               const std::size_t size)
+{
+    const __m256d alpha_vector = _mm256_set1_pd(alpha);
+    const __m256d beta_vector = _mm256_set1_pd(beta);
+    std::size_t i{0};
+    for (; i + 4 <= size; i += 4)
+    {
+        const __m256d beta_y = _mm256_mul_pd(beta_vector, _mm256_loadu_pd(y + i));
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(alpha_vector, _mm256_loadu_pd(x + i), beta_y));
+    }
+    for (; i < size; ++i)
+    {
+        y[i] = alpha * x[i] + beta * y[i];
+    }
+}
+
+constexpr KernelTable<double> kTable{&Dot, &SumOfSquares, &Add, &Scale, &Axpy, &Axpby};
+
+// Single precision, twice the lanes per register
+
+__attribute__((target("avx2,fma"))) float HorizontalSum(const __m256 value)
+{
+    const __m128 quad = _mm_add_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+    const __m128 pair = _mm_add_ps(quad, _mm_movehl_ps(quad, quad));
+    return _mm_cvtss_f32(_mm_add_ss(pair, _mm_shuffle_ps(pair, pair, 0x55)));
+}
+
+__attribute__((target("avx2,fma"))) float Dot(const float* a, const float* b, const std::size_t size)
+{
+    __m256 sum_0 = _mm256_setzero_ps();
+    __m256 sum_1 = _mm256_setzero_ps();
+    __m256 sum_2 = _mm256_setzero_ps();
+    __m256 sum_3 = _mm256_setzero_ps();
+
+    std::size_t i{0};
+    for (; i + 32 <= size; i += 32)
+    {
+        sum_0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum_0);
+        sum_1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), sum_1);
+        sum_2 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 16), _mm256_loadu_ps(b + i + 16), sum_2);
+        sum_3 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 24), _mm256_loadu_ps(b + i + 24), sum_3);
+    }
+    for (; i + 8 <= size; i += 8)
+    {
+        sum_0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), sum_0);
+    }
+
+    float sum = HorizontalSum(_mm256_add_ps(_mm256_add_ps(sum_0, sum_1), _mm256_add_ps(sum_2, sum_3)));
+    for (; i < size; ++i)
+    {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+__attribute__((target("avx2,fma"))) float SumOfSquares(const float* a, const std::size_t size)
+{
+    return Dot(a, a, size);
+}
+
+__attribute__((target("avx2,fma"))) void Add(const float* a, const float* b, float* result, const std::size_t size)
+{
+    std::size_t i{0};
+    for (; i + 8 <= size; i += 8)
+    {
+        _mm256_storeu_ps(result + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    for (; i < size; ++i)
+    {
+        result[i] = a[i] + b[i];
+    }
+}
+
+__attribute__((target("avx2,fma"))) void Scale(const float scalar_value,
+                                               const float* a,
+                                               float* result,
+                                               const std::size_t size)
+{
+    const __m256 scalar = _mm256_set1_ps(scalar_value);
+    std::size_t i{0};
+    for (; i + 8 <= size; i += 8)
+    {
+        _mm256_storeu_ps(result + i, _mm256_mul_ps(scalar, _mm256_loadu_ps(a + i)));
+    }
+    for (; i < size; ++i)
+    {
+        result[i] = scalar_value * a[i];
+    }
+}
+
+__attribute__((target("avx2,fma"))) void Axpy(const float alpha, const float* x, float* y, const std::size_t size)
+{
+    const __m256 alpha_vector = _mm256_set1_ps(alpha);
+    std::size_t i{0};
+    for (; i + 8 <= size; i += 8)
+    {
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(alpha_vector, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i)));
+    }
+    for (; i < size; ++i)
+    {
+        y[i] += alpha * x[i];
+    }
+}
+
+__attribute__((target("avx2,fma"))) void Axpby(const float alpha,
+                                               const float* x,
+                                               const float beta,
+                                               float* y,
+                                               const std::size_t size)
+{
+    const __m256 alpha_vector = _mm256_set1_ps(alpha);
+    const __m256 beta_vector = _mm256_set1_ps(beta);
+    std::size_t i{0};
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m256 beta_y = _mm256_mul_ps(beta_vector, _mm256_loadu_ps(y + i));
+        _mm256_storeu_ps(y + i, _mm256_fmadd_ps(alpha_vector, _mm256_loadu_ps(x + i), beta_y));
+    }
+    for (; i < size; ++i)
+    {
+        y[i] = alpha * x[i] + beta * y[i];
+    }
+}
+
+constexpr KernelTable<float> kFloatTable{&Dot, &SumOfSquares, &Add, &Scale, &Axpy, &Axpby};
+
+}  // namespace avx2
+
+namespace avx512
+{
+
+__attribute__((target("avx512f"))) __mmask8 TailMask(const std::size_t remaining)
+{
+    return static_cast<__mmask8>((1U << remaining) - 1U);
+}
+
+__attribute__((target("avx512f"))) double HorizontalSum(const __m512d value)
+{
+    // Same as _mm512_reduce_add_pd, spelled out because GCC 12 flags its undefined upper half as uninitialized
+    const __m256d lower = _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), 0xFF, value, 0);
+    const __m256d upper = _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), 0xFF, value, 1);
+    const __m256d quad = _mm256_add_pd(lower, upper);
+    const __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(quad), _mm256_extractf128_pd(quad, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+}
+
+__attribute__((target("avx512f"))) double Dot(const double* a, const double* b, const std::size_t size)
+{
+    __m512d sum_0 = _mm512_setzero_pd();
+    __m512d sum_1 = _mm512_setzero_pd();
+    __m512d sum_2 = _mm512_setzero_pd();
+    __m512d sum_3 = _mm512_setzero_pd();
+
+    std::size_t i{0};
+    for (; i + 32 <= size; i += 32)
+    {
+        sum_0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), sum_0);
+        sum_1 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 8), _mm512_loadu_pd(b + i + 8), sum_1);
+        sum_2 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 16), _mm512_loadu_pd(b + i + 16), sum_2);
+        sum_3 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i + 24), _mm512_loadu_pd(b + i + 24), sum_3);
+    }
+    for (; i + 8 <= size; i += 8)
+    {
+        sum_0 = _mm512_fmadd_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i), sum_0);
+    }
+    if (i < size)
+    {
+        // Masked loads read only the remaining elements, no scalar tail loop required
+        const auto mask = TailMask(size - i);
+        sum_1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a + i), _mm512_maskz_loadu_pd(mask, b + i), sum_1);
+    }
+
+    return HorizontalSum(_mm512_add_pd(_mm512_add_pd(sum_0, sum_1), _mm512_add_pd(sum_2, sum_3)));
+}
+
+__attribute__((target("avx512f"))) double SumOfSquares(const double* a, const std::size_t size)
+{
+    return Dot(a, a, size);
+}
+
+__attribute__((target("avx512f"))) void Add(const double* a, const double* b, double* result, const std::size_t size)
+{
+    std::size_t i{0};
+    for (; i + 8 <= size; i += 8)
+    {
+        _mm512_storeu_pd(result + i, _mm512_add_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+    }
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_pd(
+            result + i, mask, _mm512_add_pd(_mm512_maskz_loadu_pd(mask, a + i), _mm512_maskz_loadu_pd(mask, b + i)));
+    }
+}
+
+__attribute__((target("avx512f"))) void Scale(const double scalar_value,
+                                              const double* a,
+                                              double* result,
+                                              const std::size_t size)
+{
+    const __m512d scalar = _mm512_set1_pd(scalar_value);
+    std::size_t i{0};
+    for (; i + 8 <= size; i += 8)
+    {
+        _mm512_storeu_pd(result + i, _mm512_mul_pd(scalar, _mm512_loadu_pd(a + i)));
+    }
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        _mm512_mask_storeu_pd(result + i, mask, _mm512_mul_pd(scalar, _mm512_maskz_loadu_pd(mask, a + i)));
+    }
+}
+
+__attribute__((target("avx512f"))) void Axpy(const double alpha, const double* x, double* y, const std::size_t size)
+{
+    const __m512d alpha_vector = _mm512_set1_pd(alpha);
+    std::size_t i{0};
+    for (; i + 8 <= size; i += 8)
+    {
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(alpha_vector, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i)));
+    }
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        const __m512d result =
+            _mm512_fmadd_pd(alpha_vector, _mm512_maskz_loadu_pd(mask, x + i), _mm512_maskz_loadu_pd(mask, y + i));
+        _mm512_mask_storeu_pd(y + i, mask, result);
+    }
+}
+
+__attribute__((target("avx512f"))) void Axpby(const double alpha,
+                                              const double* x,
+                                              const double beta,
+                                              double* y,
+                                              const std::size_t size)
+{
+    const __m512d alpha_vector = _mm512_set1_pd(alpha);
+    const __m512d beta_vector = _mm512_set1_pd(beta);
+    std::size_t i{0};
+    for (; i + 8 <= size; i += 8)
+    {
+        const __m512d beta_y = _mm512_mul_pd(beta_vector, _mm512_loadu_pd(y + i));
+        _mm512_storeu_pd(y + i, _mm512_fmadd_pd(alpha_vector, _mm512_loadu_pd(x + i), beta_y));
+    }
+    if (i < size)
+    {
+        const auto mask = TailMask(size - i);
+        const __m512d beta_y = _mm512_mul_pd(beta_vector, _mm512_maskz_loadu_pd(mask, y + i));
+        _mm512_mask_storeu_pd(y + i, mask, _mm512_fmadd_pd(alpha_vector, _mm512_maskz_loadu_pd(mask, x + i), beta_y));
+    }
+}
+
+constexpr KernelTable<double> kTable{&Dot, &SumOfSquares, &Add, &Scale, &Axpy, &Axpby};
+
+// Single precision, twice the lanes per register
+
+__attribute__((target("avx512f"))) __mmask16 FloatTailMask(const std::size_t remaining)
+{
+    return static_cast<__mmask16>((1U << remaining) - 1U);
+}
+
+__attribute__((target("avx512f"))) float HorizontalSum(const __m512 value)
+{
+    // Halves are extracted through the double precision view, extracting 8 floats directly needs AVX-512DQ
+    const __m512d value_as_double = _mm512_castps_pd(value);
+    const __m256 lower = _mm256_castpd_ps(_mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), 0xFF, value_as_double, 0));
+    const __m256 upper = _mm256_castpd_ps(_mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), 0xFF, value_as_double, 1));
+    const __m256 octet = _mm256_add_ps(lower, upper);
+    const __m128 quad = _mm_add_ps(_mm256_castps256_ps128(octet), _mm256_extractf128_ps(octet, 1));
+    const __m128 pair = _mm_add_ps(quad, _mm_movehl_ps(quad, quad));
+    return _mm_cvtss_f32(_mm_add_ss(pair, _mm_shuffle_ps(pair, pair, 0x55)));
+}
+
+__attribute__((target("avx512f"))) float Dot(const float* a, const float* b, const std::size_t size)
+{
+    __m512 sum_0 = _mm512_setzero_ps();
+    __m512 sum_1 = _mm512_setzero_ps();
+    __m512 sum_2 = _mm512_setzero_ps();
+    __m512 sum_3 = _mm512_setzero_ps();
+
+    std::size_t i{0};
+    for (; i + 64 <= size; i += 64)
+    {
+        sum_0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), sum_0);
+        sum_1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16), sum_1);
+        sum_2 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 32), _mm512_loadu_ps(b + i + 32), sum_2);
+        sum_3 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 48), _mm512_loadu_ps(b + i + 48), sum_3);
+    }
+    for (; i + 16 <= size; i += 16)
+    {
+        sum_0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), sum_0);
+    }
+    if (i < size)
+    {
+        const auto mask = FloatTailMask(size - i);
+        sum_1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i), sum_1);
+    }
+
+    return HorizontalSum(_mm512_add_ps(_mm512_add_ps(sum_0, sum_1), _mm512_add_ps(sum_2, sum_3)));
+}
+
+__attribute__((target("avx512f"))) float SumOfSquares(const float* a, const std::size_t size)
+{
+    return Dot(a, a, size);
+}
+
+__attribute__((target("avx512f"))) void Add(const float* a, const float* b, float* result, const std::size_t size)
+{
+    std::size_t i{0};
+    for (; i + 16 <= size; i += 16)
+    {
+        _mm512_storeu_ps(result + i, _mm512_add_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i)));
+    }
+    if (i < size)
+    {
+        const auto mask = FloatTailMask(size - i);
+        _mm512_mask_storeu_ps(
+            result + i, mask, _mm512_add_ps(_mm512_maskz_loadu_ps(mask, a + i), _mm512_maskz_loadu_ps(mask, b + i)));
+    }
+}
+
+__attribute__((target("avx512f"))) void Scale(const float scalar_value,
+                                              const float* a,
+                                              float* result,
+                                              const std::size_t size)
+{
+    const __m512 scalar = _mm512_set1_ps(scalar_value);
+    std::size_t i{0};
+    for (; i + 16 <= size; i += 16)
+    {
+        _mm512_storeu_ps(result + i, _mm512_mul_ps(scalar, _mm512_loadu_ps(a + i)));
+    }
+    if (i < size)
+    {
+        const auto mask = FloatTailMask(size - i);
+        _mm512_mask_storeu_ps(result + i, mask, _mm512_mul_ps(scalar, _mm512_maskz_loadu_ps(mask, a + i)));
+    }
+}
+
+__attribute__((target("avx512f"))) void Axpy(const float alpha, const float* x, float* y, const std::size_t size)
+{
+    const __m512 alpha_vector = _mm512_set1_ps(alpha);
+    std::size_t i{0};
+    for (; i + 16 <= size; i += 16)
+    {
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(alpha_vector, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i)));
+    }
+    if (i < size)
+    {
+        const auto mask = FloatTailMask(size - i);
+        const __m512 result =
+            _mm512_fmadd_ps(alpha_vector, _mm512_maskz_loadu_ps(mask, x + i), _mm512_maskz_loadu_ps(mask, y + i));
+        _mm512_mask_storeu_ps(y + i, mask, result);
+    }
+}
+
+__attribute__((target("avx512f"))) void Axpby(const float alpha,
+                                              const float* x,
+                                              const float beta,
+                                              float* y,
+                                              const std::size_t size)
+{
+    const __m512 alpha_vector = _mm512_set1_ps(alpha);
+    const __m512 beta_vector = _mm512_set1_ps(beta);
+    std::size_t i{0};
+    for (; i + 16 <= size; i += 16)
+    {
+        const __m512 beta_y = _mm512_mul_ps(beta_vector, _mm512_loadu_ps(y + i));
+        _mm512_storeu_ps(y + i, _mm512_fmadd_ps(alpha_vector, _mm512_loadu_ps(x + i), beta_y));
+    }
+    if (i < size)
+    {
+        const auto mask = FloatTailMask(size - i);
+        const __m512 beta_y = _mm512_mul_ps(beta_vector, _mm512_maskz_loadu_ps(mask, y + i));
+        _mm512_mask_storeu_ps(y + i, mask, _mm512_fmadd_ps(alpha_vector, _mm512_maskz_loadu_ps(mask, x + i), beta_y));
+    }
+}
+
+constexpr KernelTable<float> kFloatTable{&Dot, &SumOfSquares, &Add, &Scale, &Axpy, &Axpby};
+
+}  // namespace avx512
+
+#endif  // NM_MATRIX_KERNELS_X86
+
+template <typename T>
+const KernelTable<T>* SelectTable(const InstructionSet instruction_set);
+
+template <>
+const KernelTable<double>* SelectTable(const InstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+#ifdef NM_MATRIX_KERNELS_X86
+        case InstructionSet::kAvx512:
+            return &avx512::kTable;
+        case InstructionSet::kAvx2:
+            return &avx2::kTable;
+#endif
+        default:
+            return &scalar::kTable<double>;
+    }
+}
+
+template <>
+const KernelTable<float>* SelectTable(const InstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+#ifdef NM_MATRIX_KERNELS_X86
+        case InstructionSet::kAvx512:
+            return &avx512::kFloatTable;
+        case InstructionSet::kAvx2:
+            return &avx2::kFloatTable;
+#endif
+        default:
+            return &scalar::kTable<float>;
+    }
+}
+
+struct Dispatch
+{
+    InstructionSet instruction_set{DetectInstructionSet()};
+    const KernelTable<double>* table{SelectTable<double>(instruction_set)};
+    const KernelTable<float>* float_table{SelectTable<float>(instruction_set)};
+};
+
+Dispatch& ActiveDispatch()
+{
+    static Dispatch dispatch{};
+    return dispatch;
+}
+
+}  // namespace
+
+InstructionSet DetectInstructionSet()
+{
+#ifdef NM_MATRIX_KERNELS_X86
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return InstructionSet::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        return InstructionSet::kAvx2;
+    }
+#endif
+    return InstructionSet::kScalar;
+}
+
+InstructionSet GetInstructionSet()
+{
+    return ActiveDispatch().instruction_set;
+}
+
+InstructionSet SetInstructionSet(const InstructionSet instruction_set)
+{
+    const auto supported = DetectInstructionSet();
+    auto& dispatch = ActiveDispatch();
+    dispatch.instruction_set = (instruction_set > supported) ? supported : instruction_set;
+    dispatch.table = SelectTable<double>(dispatch.instruction_set);
+    dispatch.float_table = SelectTable<float>(dispatch.instruction_set);
+    return dispatch.instruction_set;
+}
+
+std::string ToString(const InstructionSet instruction_set)
+{
+    switch (instruction_set)
+    {
+        case InstructionSet::kAvx512:
+            return "avx512";
+        case InstructionSet::kAvx2:
+            return "avx2";
+        default:
+            return "scalar";
+    }
+}
+
+double Dot(const double* a, const double* b, const std::size_t size)
+{
+    return ActiveDispatch().table->dot(a, b, size);
+}
+
+double SumOfSquares(const double* a, const std::size_t size)
+{
+    return ActiveDispatch().table->sum_of_squares(a, size);
+}
+
+void Add(const double* a, const double* b, double* result, const std::size_t size)
+{
+    ActiveDispatch().table->add(a, b, result, size);
+}
+
+void Scale(const double scalar_value, const double* a, double* result, const std::size_t size)
+{
+    ActiveDispatch().table->scale(scalar_value, a, result, size);
+}
+
+void Axpy(const double alpha, const double* x, double* y, const std::size_t size)
+{
+    ActiveDispatch().table->axpy(alpha, x, y, size);
+}
+
+void Axpby(const double alpha, const double* x, const double beta, double* y, const std::size_t size)
+{
+    ActiveDispatch().table->axpby(alpha, x, beta, y, size);
+}
+
+float Dot(const float* a, const float* b, const std::size_t size)
+{
+    return ActiveDispatch().float_table->dot(a, b, size);
+}
+
+float SumOfSquares(const float* a, const std::size_t size)
+{
+    return ActiveDispatch().float_table->sum_of_squares(a, size);
+}
+
+void Add(const float* a, const float* b, float* result, const std::size_t size)
+{
+    ActiveDispatch().float_table->add(a, b, result, size);
+}
+
+void Scale(const float scalar_value, const float* a, float* result, const std::size_t size)
+{
+    ActiveDispatch().float_table->scale(scalar_value, a, result, size);
+}
+
+void Axpy(const float alpha, const float* x, float* y, const std::size_t size)
+{
+    ActiveDispatch().float_table->axpy(alpha, x, y, size);
+}
+
+void Axpby(const float alpha, const float* x, const float beta, float* y, const std::size_t size)
+{
+    ActiveDispatch().float_table->axpby(alpha, x, beta, y, size);
+}
+
+}  // namespace kernels
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,82 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Vectorized BLAS level 1 kernels with runtime instruction set dispatch
+ */
+
+#ifndef MATRIX_SOLVERS_OPERATIONS_VECTOR_KERNELS_H
+#define MATRIX_SOLVERS_OPERATIONS_VECTOR_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace kernels
+{
+
+/// @brief Instruction sets a kernel implementation can be compiled for, ordered from least to most capable
+enum class InstructionSet : std::uint8_t
+{
+    kScalar = 0,
+    kAvx2 = 1,
+    kAvx512 = 2,
+};
+
+/// @brief Most capable instruction set supported by both the build and the CPU running the program
+InstructionSet DetectInstructionSet();
+
+/// @brief Instruction set the kernels currently dispatch to, defaults to DetectInstructionSet()
+InstructionSet GetInstructionSet();
+
+/// @brief Overrides the dispatch target, e.g. to compare implementations in tests and benchmarks
+///
+/// Requests beyond what DetectInstructionSet() reports are clamped to it. Not thread safe, call it before any
+/// kernel runs concurrently.
+///
+/// @param instruction_set: requested instruction set
+/// @return The instruction set actually selected
+InstructionSet SetInstructionSet(const InstructionSet instruction_set);
+
+std::string ToString(const InstructionSet instruction_set);
+
+/// @brief Sum of a[i] * b[i] for i in [0, size)
+double Dot(const double* a, const double* b, const std::size_t size);
+
+/// @brief Sum of a[i] * a[i] for i in [0, size)
+double SumOfSquares(const double* a, const std::size_t size);
+
+/// @brief result[i] = a[i] + b[i], result may alias a or b
+void Add(const double* a, const double* b, double* result, const std::size_t size);
+
+/// @brief result[i] = scalar_value * a[i], result may alias a
+void Scale(const double scalar_value, const double* a, double* result, const std::size_t size);
+
+/// @brief y[i] += alpha * x[i]
+void Axpy(const double alpha, const double* x, double* y, const std::size_t size);
+
+/// @brief y[i] = alpha * x[i] + beta * y[i]
+void Axpby(const double alpha, const double* x, const double beta, double* y, const std::size_t size);
+
+/// Single precision overloads, same semantics with twice the elements per vector register. Dot products accumulate
+/// in float.
+float Dot(const float* a, const float* b, const std::size_t size);
+float SumOfSquares(const float* a, const std::size_t size);
+void Add(const float* a, const float* b, float* result, const std::size_t size);
+void Scale(const float scalar_value, const float* a, float* result, const std::size_t size);
+void Axpy(const float alpha, const float* x, float* y, const std::size_t size);
+void Axpby(const float alpha, const float* x, const float beta, float* y, const std::size_t size);
+
+}  // namespace kernels
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_OPERATIONS_VECTOR_KERNELS_H
@@ -0,0 +1,242 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/operations/vector_kernels.h"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace kernels
+{
+
+namespace
+{
+
+struct VectorKernelsTestParameter
+{
+    InstructionSet instruction_set{};
+    std::string test_name{};
+};
+
+class VectorKernelsTestFixture : public ::testing::TestWithParam<VectorKernelsTestParameter>
+{
+  public:
+    void SetUp() override
+    {
+        const auto requested = GetParam().instruction_set;
+        if (SetInstructionSet(requested) != requested)
+        {
+            GTEST_SKIP() << ToString(requested) << " is not supported on this machine";
+        }
+    }
+
+    void TearDown() override { SetInstructionSet(DetectInstructionSet()); }
+
+    static std::vector<double> CreateTestVector(const std::size_t size, const double offset)
+    {
+        std::vector<double> vector(size);
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            vector[i] = offset + 0.25 * static_cast<double>(i % 13) - 1.5;
+        }
+        return vector;
+    }
+
+    // Covers empty input, sizes smaller than one register and every possible remainder after the unrolled loops
+    const std::vector<std::size_t> sizes_{0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 63, 100, 1001};
+    double tolerance_{1e-9};
+};
+
+TEST_P(VectorKernelsTestFixture, GivenVectorsOfAnyLength_ExpectDotMatchesScalarSum)
+{
+    for (const auto size : sizes_)
+    {
+        // Given
+        const auto a = CreateTestVector(size, 0.5);
+        const auto b = CreateTestVector(size, -0.25);
+        double expected{0.0};
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            expected += a[i] * b[i];
+        }
+
+        // Call
+        const auto result = Dot(a.data(), b.data(), size);
+
+        // Expect
+        EXPECT_NEAR(result, expected, tolerance_) << "size " << size;
+    }
+}
+
+TEST_P(VectorKernelsTestFixture, GivenVectorsOfAnyLength_ExpectSumOfSquaresMatchesScalarSum)
+{
+    for (const auto size : sizes_)
+    {
+        // Given
+        const auto a = CreateTestVector(size, 0.5);
+        double expected{0.0};
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            expected += a[i] * a[i];
+        }
+
+        // Call
+        const auto result = SumOfSquares(a.data(), size);
+
+        // Expect
+        EXPECT_NEAR(result, expected, tolerance_) << "size " << size;
+    }
+}
+
+TEST_P(VectorKernelsTestFixture, GivenVectorsOfAnyLength_ExpectElementWiseSumWithoutTouchingPadding)
+{
+    for (const auto size : sizes_)
+    {
+        // Given
+        const auto a = CreateTestVector(size, 0.5);
+        const auto b = CreateTestVector(size, -0.25);
+        std::vector<double> result(size + 1, 42.0);
+
+        // Call
+        Add(a.data(), b.data(), result.data(), size);
+
+        // Expect
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            EXPECT_DOUBLE_EQ(result[i], a[i] + b[i]);
+        }
+        EXPECT_DOUBLE_EQ(result[size], 42.0);
+    }
+}
+
+TEST_P(VectorKernelsTestFixture, GivenVectorsOfAnyLength_ExpectInPlaceScaling)
+{
+    for (const auto size : sizes_)
+    {
+        // Given
+        const auto a = CreateTestVector(size, 0.5);
+        auto result = a;
+        result.push_back(42.0);
+
+        // Call
+        Scale(-3.0, result.data(), result.data(), size);
+
+        // Expect
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            EXPECT_DOUBLE_EQ(result[i], -3.0 * a[i]);
+        }
+        EXPECT_DOUBLE_EQ(result[size], 42.0);
+    }
+}
+
+TEST_P(VectorKernelsTestFixture, GivenVectorsOfAnyLength_ExpectAxpyAccumulatesIntoY)
+{
+    for (const auto size : sizes_)
+    {
+        // Given
+        const auto x = CreateTestVector(size, 0.5);
+        const auto y_initial = CreateTestVector(size, -0.25);
+        auto y = y_initial;
+        y.push_back(42.0);
+
+        // Call
+        Axpy(2.5, x.data(), y.data(), size);
+
+        // Expect
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            EXPECT_NEAR(y[i], y_initial[i] + 2.5 * x[i], tolerance_);
+        }
+        EXPECT_DOUBLE_EQ(y[size], 42.0);
+    }
+}
+
+TEST_P(VectorKernelsTestFixture, GivenVectorsOfAnyLength_ExpectAxpbyScalesBothOperands)
+{
+    for (const auto size : sizes_)
+    {
+        // Given
+        const auto x = CreateTestVector(size, 0.5);
+        const auto y_initial = CreateTestVector(size, -0.25);
+        auto y = y_initial;
+        y.push_back(42.0);
+
+        // Call
+        Axpby(-1.5, x.data(), 0.75, y.data(), size);
+
+        // Expect
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            EXPECT_NEAR(y[i], -1.5 * x[i] + 0.75 * y_initial[i], tolerance_);
+        }
+        EXPECT_DOUBLE_EQ(y[size], 42.0);
+    }
+}
+
+TEST_P(VectorKernelsTestFixture, GivenFloatVectorsOfAnyLength_ExpectSameResultsAsDoubleToSinglePrecision)
+{
+    for (const auto size : sizes_)
+    {
+        // Given
+        const auto a = CreateTestVector(size, 0.5);
+        const auto b = CreateTestVector(size, -0.25);
+        const std::vector<float> a_float(a.cbegin(), a.cend());
+        const std::vector<float> b_float(b.cbegin(), b.cend());
+        std::vector<float> sum(size + 1, 42.0F);
+        std::vector<float> y(b_float);
+        y.push_back(42.0F);
+        std::vector<float> z(b_float);
+
+        // Call
+        const auto dot = Dot(a_float.data(), b_float.data(), size);
+        const auto sum_of_squares = SumOfSquares(a_float.data(), size);
+        Add(a_float.data(), b_float.data(), sum.data(), size);
+        Axpy(2.5F, a_float.data(), y.data(), size);
+        Axpby(-1.5F, a_float.data(), 0.75F, z.data(), size);
+        Scale(-3.0F, z.data(), z.data(), size);
+
+        // Expect, the test vectors hold multiples of 0.25 so every entry is exact in float, only the sums round
+        EXPECT_NEAR(dot, Dot(a.data(), b.data(), size), 1e-5 * static_cast<double>(size + 1)) << "size " << size;
+        EXPECT_NEAR(sum_of_squares, SumOfSquares(a.data(), size), 1e-5 * static_cast<double>(size + 1));
+        for (std::size_t i{0}; i < size; ++i)
+        {
+            EXPECT_FLOAT_EQ(sum[i], a_float[i] + b_float[i]);
+            EXPECT_FLOAT_EQ(y[i], b_float[i] + 2.5F * a_float[i]);
+            EXPECT_FLOAT_EQ(z[i], -3.0F * (-1.5F * a_float[i] + 0.75F * b_float[i]));
+        }
+        EXPECT_FLOAT_EQ(sum[size], 42.0F);
+        EXPECT_FLOAT_EQ(y[size], 42.0F);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(VectorKernelsTests,
+                         VectorKernelsTestFixture,
+                         ::testing::Values(
+                             // clang-format off
+                         VectorKernelsTestParameter{.instruction_set = InstructionSet::kScalar, .test_name = "Scalar"},
+                         VectorKernelsTestParameter{.instruction_set = InstructionSet::kAvx2, .test_name = "Avx2"},
+                         VectorKernelsTestParameter{.instruction_set = InstructionSet::kAvx512, .test_name = "Avx512"}
+                             // clang-format on
+                             ),
+                         [](const ::testing::TestParamInfo<VectorKernelsTestParameter>& info) {
+                             return info.param.test_name;
+                         });
+
+}  // namespace
+
+}  // namespace kernels
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,73 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/parallel/thread_pool.h"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+TEST(ThreadPoolTest, GivenMoreIterationsThanThreads_ExpectEveryIterationVisitedOnce)
+{
+    // Given
+    ThreadPool pool{4};
+    std::vector<std::int32_t> visits(103, 0);
+    std::vector<std::int32_t> chunks_per_thread(static_cast<std::size_t>(pool.NumberOfThreads()), 0);
+
+    // Call, twice to check that the workers pick up a second loop
+    for (std::int32_t loop{0}; loop < 2; ++loop)
+    {
+        pool.ParallelFor(0,
+                         static_cast<std::int32_t>(visits.size()),
+                         [&](const std::int32_t begin, const std::int32_t end, const std::int32_t thread_index) {
+                             for (auto i = begin; i < end; ++i)
+                             {
+                                 ++visits[static_cast<std::size_t>(i)];
+                             }
+                             ++chunks_per_thread[static_cast<std::size_t>(thread_index)];
+                         });
+    }
+
+    // Expect
+    EXPECT_EQ(pool.NumberOfThreads(), 4);
+    for (const auto count : visits)
+    {
+        EXPECT_EQ(count, 2);
+    }
+    EXPECT_EQ(chunks_per_thread, (std::vector<std::int32_t>(4, 2)));
+}
+
+TEST(ThreadPoolTest, GivenThrowingLoopBody_ExpectExceptionInCaller)
+{
+    // Given
+    ThreadPool pool{3};
+    const auto body = [](const std::int32_t begin, const std::int32_t end, const std::int32_t) {
+        if (begin <= 7 && 7 < end)
+        {
+            throw std::runtime_error("iteration 7 failed");
+        }
+    };
+
+    // Call & Expect
+    EXPECT_THROW(pool.ParallelFor(0, 10, body), std::runtime_error);
+    EXPECT_NO_THROW(pool.ParallelFor(0, 5, body));
+    EXPECT_THROW(ThreadPool{0}, std::invalid_argument);
+}
+
+}  // namespace
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,147 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/parallel/thread_pool.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+ThreadPool::ThreadPool(const std::int32_t number_of_threads)
+{
+    if (number_of_threads < 1)
+    {
+        throw std::invalid_argument("A thread pool needs at least one thread.");
+    }
+
+    // The calling thread takes part in every loop, so only number_of_threads - 1 workers are spawned
+    workers_.reserve(static_cast<std::size_t>(number_of_threads) - 1);
+    for (std::int32_t thread_index{1}; thread_index < number_of_threads; ++thread_index)
+    {
+        workers_.emplace_back([this, thread_index]() { WorkerLoop(thread_index); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stop_ = true;
+    }
+    start_condition_.notify_all();
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+std::int32_t ThreadPool::DefaultNumberOfThreads()
+{
+    return std::max(1, static_cast<std::int32_t>(std::thread::hardware_concurrency()));
+}
+
+void ThreadPool::RunChunk(const std::int32_t thread_index)
+{
+    const auto size = static_cast<std::int64_t>(end_) - begin_;
+    const auto number_of_threads = static_cast<std::int64_t>(NumberOfThreads());
+    const auto chunk_begin = begin_ + static_cast<std::int32_t>(size * thread_index / number_of_threads);
+    const auto chunk_end = begin_ + static_cast<std::int32_t>(size * (thread_index + 1) / number_of_threads);
+    if (chunk_begin < chunk_end)
+    {
+        (*body_)(chunk_begin, chunk_end, thread_index);
+    }
+}
+
+void ThreadPool::WorkerLoop(const std::int32_t thread_index)
+{
+    std::uint64_t last_generation{0};
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            start_condition_.wait(lock, [this, last_generation]() { return stop_ || generation_ != last_generation; });
+            if (stop_)
+            {
+                return;
+            }
+            last_generation = generation_;
+        }
+
+        try
+        {
+            RunChunk(thread_index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            if (!exception_)
+            {
+                exception_ = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            --pending_workers_;
+        }
+        done_condition_.notify_one();
+    }
+}
+
+void ThreadPool::ParallelFor(const std::int32_t begin, const std::int32_t end, const ChunkFunction& body)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+    if (workers_.empty())
+    {
+        body(begin, end, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        body_ = &body;
+        begin_ = begin;
+        end_ = end;
+        exception_ = nullptr;
+        pending_workers_ = static_cast<std::int32_t>(workers_.size());
+        ++generation_;
+    }
+    start_condition_.notify_all();
+
+    std::exception_ptr caller_exception{};
+    try
+    {
+        RunChunk(0);
+    }
+    catch (...)
+    {
+        caller_exception = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock{mutex_};
+    done_condition_.wait(lock, [this]() { return pending_workers_ == 0; });
+    body_ = nullptr;
+    if (caller_exception)
+    {
+        std::rethrow_exception(caller_exception);
+    }
+    if (exception_)
+    {
+        std::rethrow_exception(exception_);
+    }
+}
+
+}  // namespace matrix
+
+}  // namespace nm
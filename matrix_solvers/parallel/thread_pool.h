@@ -0,0 +1,79 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Fixed size thread pool with statically partitioned parallel loops
+ */
+
+#ifndef MATRIX_SOLVERS_PARALLEL_THREAD_POOL_H
+#define MATRIX_SOLVERS_PARALLEL_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Pool of persistent worker threads for data parallel loops
+///
+/// Threads are created once and parked between loops, so a parallel sweep only costs a wake up and a join instead
+/// of a thread creation. Iterations are split statically into one contiguous chunk per thread, which keeps each
+/// thread on the same rows, and therefore the same cache lines, from one sweep to the next.
+class ThreadPool
+{
+  public:
+    /// Loop body over the chunk [begin, end), thread_index is in [0, NumberOfThreads())
+    using ChunkFunction =
+        std::function<void(const std::int32_t begin, const std::int32_t end, const std::int32_t thread_index)>;
+
+    /// @throws std::invalid_argument: when number_of_threads is smaller than one
+    explicit ThreadPool(const std::int32_t number_of_threads = DefaultNumberOfThreads());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::int32_t NumberOfThreads() const { return static_cast<std::int32_t>(workers_.size()) + 1; }
+
+    /// @brief Splits [begin, end) into NumberOfThreads() contiguous chunks and runs body on each in parallel
+    ///
+    /// The calling thread works on the first chunk and returns once every chunk is done. An exception thrown by
+    /// body is rethrown here.
+    void ParallelFor(const std::int32_t begin, const std::int32_t end, const ChunkFunction& body);
+
+    /// @brief Number of hardware threads, at least one
+    static std::int32_t DefaultNumberOfThreads();
+
+  private:
+    void WorkerLoop(const std::int32_t thread_index);
+    void RunChunk(const std::int32_t thread_index);
+
+    std::vector<std::thread> workers_{};
+
+    std::mutex mutex_{};
+    std::condition_variable start_condition_{};
+    std::condition_variable done_condition_{};
+
+    // State of the current loop, guarded by mutex_
+    const ChunkFunction* body_{nullptr};
+    std::int32_t begin_{0};
+    std::int32_t end_{0};
+    std::uint64_t generation_{0};
+    std::int32_t pending_workers_{0};
+    std::exception_ptr exception_{};
+    bool stop_{false};
+};
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_PARALLEL_THREAD_POOL_H
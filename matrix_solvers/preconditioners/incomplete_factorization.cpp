@@ -0,0 +1,214 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/preconditioners/incomplete_factorization.h"
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+/// @brief Lower triangle of A including the diagonal, which therefore ends every row
+CsrMatrix LowerTriangle(const CsrMatrix& A)
+{
+    const auto diagonal_positions = FindDiagonalPositions(A);
+    const auto& offsets = A.RowOffsets();
+    const auto& columns = A.ColumnIndices();
+    const auto& values = A.Values();
+    const auto n = A.NumberOfRows();
+
+    std::vector<std::int32_t> lower_offsets(static_cast<std::size_t>(n) + 1, 0);
+    std::vector<std::int32_t> lower_columns{};
+    std::vector<double> lower_values{};
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        const auto begin = offsets[static_cast<std::size_t>(i)];
+        const auto end = diagonal_positions[static_cast<std::size_t>(i)] + 1;
+        lower_columns.insert(lower_columns.end(), columns.begin() + begin, columns.begin() + end);
+        lower_values.insert(lower_values.end(), values.begin() + begin, values.begin() + end);
+        lower_offsets[static_cast<std::size_t>(i) + 1] = static_cast<std::int32_t>(lower_columns.size());
+    }
+    return CsrMatrix{n, n, std::move(lower_offsets), std::move(lower_columns), std::move(lower_values)};
+}
+
+}  // namespace
+
+IncompleteCholeskyPreconditioner::IncompleteCholeskyPreconditioner(const CsrMatrix& A) : L_(LowerTriangle(A))
+{
+    const auto& offsets = L_.RowOffsets();
+    const auto& columns = L_.ColumnIndices();
+    auto& values = L_.Values();
+
+    // Row by row, l_ij = (a_ij - sum_k l_ik * l_jk) / l_jj, where the sum only runs over the common pattern of rows
+    // i and j left of column j
+    for (std::int32_t i{0}; i < L_.NumberOfRows(); ++i)
+    {
+        const auto diagonal_position = offsets[i + 1] - 1;
+        for (auto k_ij = offsets[i]; k_ij < diagonal_position; ++k_ij)
+        {
+            const auto j = columns[k_ij];
+            const auto row_j_diagonal = offsets[j + 1] - 1;
+
+            double sum = values[k_ij];
+            auto k_i = offsets[i];
+            auto k_j = offsets[j];
+            while (k_i < k_ij && k_j < row_j_diagonal)
+            {
+                if (columns[k_i] == columns[k_j])
+                {
+                    sum -= values[k_i++] * values[k_j++];
+                }
+                else if (columns[k_i] < columns[k_j])
+                {
+                    ++k_i;
+                }
+                else
+                {
+                    ++k_j;
+                }
+            }
+            values[k_ij] = sum / values[row_j_diagonal];
+        }
+
+        double pivot = values[diagonal_position];
+        for (auto k = offsets[i]; k < diagonal_position; ++k)
+        {
+            pivot -= values[k] * values[k];
+        }
+        if (pivot <= 0.0)
+        {
+            throw std::invalid_argument("Incomplete Cholesky factorization encountered a non positive pivot.");
+        }
+        values[diagonal_position] = std::sqrt(pivot);
+    }
+}
+
+void IncompleteCholeskyPreconditioner::Apply(const std::vector<double>& r, std::vector<double>& z) const
+{
+    CheckDimensions(r, z);
+    const auto& offsets = L_.RowOffsets();
+    const auto& columns = L_.ColumnIndices();
+    const auto& values = L_.Values();
+    const auto n = NumberOfRows();
+
+    // L y = r
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        const auto diagonal_position = offsets[i + 1] - 1;
+        double sum = r[i];
+        for (auto k = offsets[i]; k < diagonal_position; ++k)
+        {
+            sum -= values[k] * z[columns[k]];
+        }
+        z[i] = sum / values[diagonal_position];
+    }
+
+    // transpose(L) z = y, by columns of transpose(L), i.e. by the rows of L
+    for (auto i = n - 1; i >= 0; --i)
+    {
+        const auto diagonal_position = offsets[i + 1] - 1;
+        z[i] /= values[diagonal_position];
+        for (auto k = offsets[i]; k < diagonal_position; ++k)
+        {
+            z[columns[k]] -= values[k] * z[i];
+        }
+    }
+}
+
+IncompleteLUPreconditioner::IncompleteLUPreconditioner(CsrMatrix A)
+    : LU_(std::move(A)), diagonal_positions_(FindDiagonalPositions(LU_))
+{
+    const auto& offsets = LU_.RowOffsets();
+    const auto& columns = LU_.ColumnIndices();
+    auto& values = LU_.Values();
+    const auto n = LU_.NumberOfRows();
+
+    // position_in_row[j] is the index of a_ij in values for the row i being eliminated, -1 outside of its pattern
+    std::vector<std::int32_t> position_in_row(static_cast<std::size_t>(n), -1);
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        for (auto k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            position_in_row[static_cast<std::size_t>(columns[k])] = k;
+        }
+
+        // IKJ variant, row i is updated by every earlier row k it couples to, dropping fill-in
+        for (auto k_ik = offsets[i]; k_ik < diagonal_positions_[static_cast<std::size_t>(i)]; ++k_ik)
+        {
+            const auto k = columns[k_ik];
+            const auto pivot = values[diagonal_positions_[static_cast<std::size_t>(k)]];
+            if (pivot == 0.0)
+            {
+                throw std::invalid_argument("Incomplete LU factorization encountered a zero pivot.");
+            }
+            values[k_ik] /= pivot;
+            for (auto k_kj = diagonal_positions_[static_cast<std::size_t>(k)] + 1; k_kj < offsets[k + 1]; ++k_kj)
+            {
+                const auto position = position_in_row[static_cast<std::size_t>(columns[k_kj])];
+                if (position >= 0)
+                {
+                    values[position] -= values[k_ik] * values[k_kj];
+                }
+            }
+        }
+
+        for (auto k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            position_in_row[static_cast<std::size_t>(columns[k])] = -1;
+        }
+    }
+
+    for (const auto k : diagonal_positions_)
+    {
+        if (values[static_cast<std::size_t>(k)] == 0.0)
+        {
+            throw std::invalid_argument("Incomplete LU factorization encountered a zero pivot.");
+        }
+    }
+}
+
+void IncompleteLUPreconditioner::Apply(const std::vector<double>& r, std::vector<double>& z) const
+{
+    CheckDimensions(r, z);
+    const auto& offsets = LU_.RowOffsets();
+    const auto& columns = LU_.ColumnIndices();
+    const auto& values = LU_.Values();
+    const auto n = NumberOfRows();
+
+    // L y = r, unit diagonal
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        double sum = r[i];
+        for (auto k = offsets[i]; k < diagonal_positions_[static_cast<std::size_t>(i)]; ++k)
+        {
+            sum -= values[k] * z[columns[k]];
+        }
+        z[i] = sum;
+    }
+
+    // U z = y
+    for (auto i = n - 1; i >= 0; --i)
+    {
+        const auto diagonal_position = diagonal_positions_[static_cast<std::size_t>(i)];
+        double sum = z[i];
+        for (auto k = diagonal_position + 1; k < offsets[i + 1]; ++k)
+        {
+            sum -= values[k] * z[columns[k]];
+        }
+        z[i] = sum / values[diagonal_position];
+    }
+}
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,72 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Zero fill-in incomplete factorization preconditioners
+ */
+
+#ifndef MATRIX_SOLVERS_PRECONDITIONERS_INCOMPLETE_FACTORIZATION_H
+#define MATRIX_SOLVERS_PRECONDITIONERS_INCOMPLETE_FACTORIZATION_H
+
+#include "matrix_solvers/preconditioners/preconditioner.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Incomplete Cholesky IC(0), M = L * transpose(L) where L keeps the sparsity of the lower triangle of A
+///
+/// For symmetric positive definite A. Fill-in outside of the pattern of A is dropped, so L costs no more memory than
+/// A and is exact for tridiagonal A.
+class IncompleteCholeskyPreconditioner : public Preconditioner
+{
+  public:
+    IncompleteCholeskyPreconditioner() = default;
+
+    /// Only the lower triangle of A is read
+    ///
+    /// @throws std::invalid_argument: when a row does not store its diagonal entry or a pivot is not positive
+    explicit IncompleteCholeskyPreconditioner(const CsrMatrix& A);
+
+    std::int32_t NumberOfRows() const override { return L_.NumberOfRows(); }
+    void Apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+    /// @brief Lower triangular factor, the diagonal entry is the last entry of every row
+    const CsrMatrix& LowerFactor() const { return L_; }
+
+  private:
+    CsrMatrix L_{};
+};
+
+/// @brief Incomplete LU ILU(0), M = L * U where L (unit diagonal) and U keep the sparsity of A
+///
+/// For general, including non symmetric, A. Both factors are stored packed in a copy of A.
+class IncompleteLUPreconditioner : public Preconditioner
+{
+  public:
+    IncompleteLUPreconditioner() = default;
+
+    /// @throws std::invalid_argument: when a row does not store its diagonal entry or a pivot is zero
+    explicit IncompleteLUPreconditioner(CsrMatrix A);
+
+    std::int32_t NumberOfRows() const override { return LU_.NumberOfRows(); }
+    void Apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+    /// @brief Strictly lower part holds L, upper part holds U
+    const CsrMatrix& PackedFactors() const { return LU_; }
+
+  private:
+    CsrMatrix LU_{};
+    std::vector<std::int32_t> diagonal_positions_{};
+};
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_PRECONDITIONERS_INCOMPLETE_FACTORIZATION_H
@@ -0,0 +1,135 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/preconditioners/preconditioner.h"
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+void Preconditioner::CheckDimensions(const std::vector<double>& r, const std::vector<double>& z) const
+{
+    const auto n = static_cast<std::size_t>(NumberOfRows());
+    if (r.size() != n || z.size() != n)
+    {
+        throw std::length_error("Preconditioner and vector dimensions do not match.");
+    }
+}
+
+std::vector<std::int32_t> FindDiagonalPositions(const CsrMatrix& A)
+{
+    if (A.NumberOfRows() != A.NumberOfColumns())
+    {
+        throw std::invalid_argument("Preconditioners require a square matrix.");
+    }
+
+    const auto& offsets = A.RowOffsets();
+    const auto& columns = A.ColumnIndices();
+    std::vector<std::int32_t> diagonal_positions(static_cast<std::size_t>(A.NumberOfRows()), -1);
+    for (std::int32_t i{0}; i < A.NumberOfRows(); ++i)
+    {
+        for (auto k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            if (columns[k] == i)
+            {
+                diagonal_positions[static_cast<std::size_t>(i)] = k;
+                break;
+            }
+        }
+        if (diagonal_positions[static_cast<std::size_t>(i)] < 0)
+        {
+            throw std::invalid_argument("Every row of the matrix must store its diagonal entry.");
+        }
+    }
+    return diagonal_positions;
+}
+
+JacobiPreconditioner::JacobiPreconditioner(const std::vector<double>& diagonal) : inverse_diagonal_(diagonal.size())
+{
+    for (std::size_t i{0}; i < diagonal.size(); ++i)
+    {
+        if (diagonal[i] == 0.0)
+        {
+            throw std::invalid_argument("Jacobi preconditioner requires a nonzero diagonal.");
+        }
+        inverse_diagonal_[i] = 1.0 / diagonal[i];
+    }
+}
+
+JacobiPreconditioner::JacobiPreconditioner(const CsrMatrix& A) : JacobiPreconditioner(A.Diagonal()) {}
+
+void JacobiPreconditioner::Apply(const std::vector<double>& r, std::vector<double>& z) const
+{
+    CheckDimensions(r, z);
+    for (std::size_t i{0}; i < r.size(); ++i)
+    {
+        z[i] = inverse_diagonal_[i] * r[i];
+    }
+}
+
+SsorPreconditioner::SsorPreconditioner(CsrMatrix A, const double omega)
+    : A_(std::move(A)), diagonal_positions_(FindDiagonalPositions(A_)), omega_(omega)
+{
+    if (omega <= 0.0 || omega >= 2.0)
+    {
+        throw std::invalid_argument("SSOR relaxation factor must lie in (0, 2).");
+    }
+    for (const auto k : diagonal_positions_)
+    {
+        if (A_.Values()[static_cast<std::size_t>(k)] == 0.0)
+        {
+            throw std::invalid_argument("SSOR preconditioner requires a nonzero diagonal.");
+        }
+    }
+}
+
+void SsorPreconditioner::Apply(const std::vector<double>& r, std::vector<double>& z) const
+{
+    CheckDimensions(r, z);
+    const auto& offsets = A_.RowOffsets();
+    const auto& columns = A_.ColumnIndices();
+    const auto& values = A_.Values();
+    const auto n = NumberOfRows();
+
+    // Forward sweep, (D / omega + L) y = r
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        const auto diagonal_position = diagonal_positions_[static_cast<std::size_t>(i)];
+        double sum = r[i];
+        for (auto k = offsets[i]; k < diagonal_position; ++k)
+        {
+            sum -= values[k] * z[columns[k]];
+        }
+        z[i] = omega_ * sum / values[diagonal_position];
+    }
+
+    // w = (2 - omega) / omega * (D / omega) y, folded into the right hand side of the backward sweep
+    const auto scale = (2.0 - omega_) / (omega_ * omega_);
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        z[i] *= scale * values[diagonal_positions_[static_cast<std::size_t>(i)]];
+    }
+
+    // Backward sweep, (D / omega + U) z = w
+    for (auto i = n - 1; i >= 0; --i)
+    {
+        const auto diagonal_position = diagonal_positions_[static_cast<std::size_t>(i)];
+        double sum = z[i];
+        for (auto k = diagonal_position + 1; k < offsets[i + 1]; ++k)
+        {
+            sum -= values[k] * z[columns[k]];
+        }
+        z[i] = omega_ * sum / values[diagonal_position];
+    }
+}
+
+}  // namespace matrix
+
+}  // namespace nm
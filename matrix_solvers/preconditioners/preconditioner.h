@@ -0,0 +1,92 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Preconditioners for Krylov subspace solvers
+ */
+
+#ifndef MATRIX_SOLVERS_PRECONDITIONERS_PRECONDITIONER_H
+#define MATRIX_SOLVERS_PRECONDITIONERS_PRECONDITIONER_H
+
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Approximation M of a matrix A whose inverse is cheap to apply
+///
+/// Krylov solvers call Apply once per iteration on the current residual, so a preconditioner trades a setup cost and
+/// a cheaper solve with M for fewer iterations.
+class Preconditioner
+{
+  public:
+    virtual ~Preconditioner() = default;
+
+    virtual std::int32_t NumberOfRows() const = 0;
+
+    /// @brief z = inverse(M) * r, z is already sized and never aliases r
+    ///
+    /// @throws std::length_error: when r or z do not have NumberOfRows() entries
+    virtual void Apply(const std::vector<double>& r, std::vector<double>& z) const = 0;
+
+  protected:
+    /// @throws std::length_error: when r or z do not have NumberOfRows() entries
+    void CheckDimensions(const std::vector<double>& r, const std::vector<double>& z) const;
+};
+
+/// @brief M = diag(A)
+class JacobiPreconditioner : public Preconditioner
+{
+  public:
+    JacobiPreconditioner() = default;
+
+    /// @throws std::invalid_argument: when an entry of the diagonal is zero
+    explicit JacobiPreconditioner(const std::vector<double>& diagonal);
+
+    /// @throws std::invalid_argument: when A has a zero or missing diagonal entry
+    explicit JacobiPreconditioner(const CsrMatrix& A);
+
+    std::int32_t NumberOfRows() const override { return static_cast<std::int32_t>(inverse_diagonal_.size()); }
+    void Apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+  private:
+    std::vector<double> inverse_diagonal_{};
+};
+
+/// @brief Symmetric successive over-relaxation, M = omega / (2 - omega) * (D / omega + L) * inverse(D / omega) *
+/// (D / omega + U) with A = L + D + U
+///
+/// Applying it is one forward and one backward Gauss Seidel sweep over A, so it needs no storage besides A itself.
+/// M is symmetric positive definite whenever A is and 0 < omega < 2.
+class SsorPreconditioner : public Preconditioner
+{
+  public:
+    SsorPreconditioner() = default;
+
+    /// @throws std::invalid_argument: when A has a zero or missing diagonal entry or omega is outside of (0, 2)
+    explicit SsorPreconditioner(CsrMatrix A, const double omega = 1.0);
+
+    std::int32_t NumberOfRows() const override { return A_.NumberOfRows(); }
+    void Apply(const std::vector<double>& r, std::vector<double>& z) const override;
+
+  private:
+    CsrMatrix A_{};
+    std::vector<std::int32_t> diagonal_positions_{};
+    double omega_{1.0};
+};
+
+/// @brief Position in A.Values() of the diagonal entry of every row
+///
+/// @throws std::invalid_argument: when A is not square or a row does not store its diagonal entry
+std::vector<std::int32_t> FindDiagonalPositions(const CsrMatrix& A);
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_PRECONDITIONERS_PRECONDITIONER_H
@@ -0,0 +1,181 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/preconditioners/incomplete_factorization.h"
+#include "matrix_solvers/preconditioners/preconditioner.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+class PreconditionerTestFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        // Symmetric positive definite tridiagonal matrix, on which the zero fill-in factorizations are exact
+        CooMatrix coo(number_of_rows_, number_of_rows_);
+        for (std::int32_t i{0}; i < number_of_rows_; ++i)
+        {
+            if (i > 0)
+            {
+                coo.Add(i, i - 1, -1.0);
+            }
+            coo.Add(i, i, 2.5 + 0.1 * i);
+            if (i < number_of_rows_ - 1)
+            {
+                coo.Add(i, i + 1, -1.0);
+            }
+            x_.push_back(static_cast<double>((i * 3) % 5) - 2.0);
+        }
+        A_ = CsrMatrix{coo};
+        Ax_.resize(x_.size());
+        SpMV(1.0, A_, x_, 0.0, Ax_);
+    }
+
+    /// @brief Checks that M is exactly A by recovering x from A * x
+    void ExpectInvertsMatrix(const Preconditioner& M)
+    {
+        std::vector<double> z(x_.size());
+        M.Apply(Ax_, z);
+        for (std::size_t i{0}; i < x_.size(); ++i)
+        {
+            EXPECT_NEAR(z[i], x_[i], tolerance_) << "row " << i;
+        }
+    }
+
+  public:
+    std::int32_t number_of_rows_{8};
+    CsrMatrix A_{};
+    std::vector<double> x_{};
+    std::vector<double> Ax_{};
+    double tolerance_{1e-12};
+};
+
+TEST_F(PreconditionerTestFixture, GivenTridiagonalMatrix_ExpectIncompleteCholeskyIsExact)
+{
+    // Given
+    const IncompleteCholeskyPreconditioner M{A_};
+
+    // Call & Expect
+    EXPECT_EQ(M.LowerFactor().NumberOfNonZeros(), 2 * number_of_rows_ - 1);
+    ExpectInvertsMatrix(M);
+}
+
+TEST_F(PreconditionerTestFixture, GivenTridiagonalMatrix_ExpectIncompleteLUIsExact)
+{
+    // Given
+    const IncompleteLUPreconditioner M{A_};
+
+    // Call & Expect
+    EXPECT_EQ(M.PackedFactors().NumberOfNonZeros(), A_.NumberOfNonZeros());
+    ExpectInvertsMatrix(M);
+}
+
+TEST_F(PreconditionerTestFixture, GivenJacobiPreconditioner_ExpectDivisionByDiagonal)
+{
+    // Given
+    const JacobiPreconditioner M{A_};
+    std::vector<double> z(x_.size());
+
+    // Call
+    M.Apply(x_, z);
+
+    // Expect
+    for (std::int32_t i{0}; i < number_of_rows_; ++i)
+    {
+        const auto index = static_cast<std::size_t>(i);
+        EXPECT_NEAR(z[index], x_[index] / (2.5 + 0.1 * i), tolerance_);
+    }
+}
+
+TEST(SsorPreconditionerTest, GivenDiagonalMatrix_ExpectScaledJacobi)
+{
+    // Given
+    CooMatrix coo(3, 3);
+    coo.Add(0, 0, 2.0);
+    coo.Add(1, 1, 4.0);
+    coo.Add(2, 2, 8.0);
+    const double omega{1.5};
+    const SsorPreconditioner M{CsrMatrix{coo}, omega};
+    const std::vector<double> r{1.0, 1.0, 1.0};
+    std::vector<double> z(3);
+
+    // Call
+    M.Apply(r, z);
+
+    // Expect, without off-diagonal entries M = D / (2 - omega)
+    EXPECT_DOUBLE_EQ(z[0], (2.0 - omega) / 2.0);
+    EXPECT_DOUBLE_EQ(z[1], (2.0 - omega) / 4.0);
+    EXPECT_DOUBLE_EQ(z[2], (2.0 - omega) / 8.0);
+}
+
+TEST(SsorPreconditionerTest, GivenSymmetricMatrix_ExpectSymmetricPreconditioner)
+{
+    // Given
+    CooMatrix coo(3, 3);
+    coo.Add(0, 0, 4.0);
+    coo.Add(0, 1, -1.0);
+    coo.Add(1, 0, -1.0);
+    coo.Add(1, 1, 4.0);
+    coo.Add(1, 2, -1.0);
+    coo.Add(2, 1, -1.0);
+    coo.Add(2, 2, 4.0);
+    const SsorPreconditioner M{CsrMatrix{coo}, 1.2};
+    const std::vector<double> u{1.0, -2.0, 0.5};
+    const std::vector<double> v{0.3, 1.0, 2.0};
+    std::vector<double> Mu(3);
+    std::vector<double> Mv(3);
+
+    // Call
+    M.Apply(u, Mu);
+    M.Apply(v, Mv);
+
+    // Expect
+    EXPECT_NEAR(v[0] * Mu[0] + v[1] * Mu[1] + v[2] * Mu[2], u[0] * Mv[0] + u[1] * Mv[1] + u[2] * Mv[2], 1e-12);
+}
+
+TEST(PreconditionerExceptionTest, GivenInvalidInput_ExpectException)
+{
+    // Given
+    CooMatrix missing_diagonal(2, 2);
+    missing_diagonal.Add(0, 0, 1.0);
+    missing_diagonal.Add(1, 0, 1.0);
+    CooMatrix indefinite(2, 2);
+    indefinite.Add(0, 0, 1.0);
+    indefinite.Add(0, 1, 2.0);
+    indefinite.Add(1, 0, 2.0);
+    indefinite.Add(1, 1, 1.0);
+    CooMatrix identity(2, 2);
+    identity.Add(0, 0, 1.0);
+    identity.Add(1, 1, 1.0);
+    const JacobiPreconditioner M{CsrMatrix{identity}};
+    std::vector<double> z(3);
+
+    // Call & Expect
+    EXPECT_THROW(JacobiPreconditioner{CsrMatrix{missing_diagonal}}, std::invalid_argument);
+    EXPECT_THROW(JacobiPreconditioner(std::vector<double>{1.0, 0.0}), std::invalid_argument);
+    EXPECT_THROW(SsorPreconditioner(CsrMatrix{identity}, 2.0), std::invalid_argument);
+    EXPECT_THROW(IncompleteCholeskyPreconditioner{CsrMatrix{indefinite}}, std::invalid_argument);
+    EXPECT_THROW(IncompleteLUPreconditioner{CsrMatrix{missing_diagonal}}, std::invalid_argument);
+    EXPECT_THROW(M.Apply(std::vector<double>{1.0, 1.0}, z), std::length_error);
+}
+
+}  // namespace
+
+}  // namespace matrix
+
+}  // namespace nm
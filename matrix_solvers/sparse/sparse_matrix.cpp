@@ -0,0 +1,476 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+void CheckDimensions(const std::int32_t rows, const std::int32_t columns)
+{
+    if (rows < 0 || columns < 0)
+    {
+        throw std::invalid_argument("Sparse matrix dimensions must be non-negative.");
+    }
+}
+
+void CheckIndex(const std::int32_t index, const std::int32_t size, const char* name)
+{
+    if (index < 0 || index >= size)
+    {
+        throw std::out_of_range(std::string{name} + " index " + std::to_string(index) + " is outside of [0, " +
+                                std::to_string(size) + ").");
+    }
+}
+
+void CheckNumberOfNonZeros(const std::size_t number_of_nonzeros)
+{
+    if (number_of_nonzeros > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+    {
+        throw std::length_error("Sparse matrix holds more nonzeros than a 32 bit row offset can address.");
+    }
+}
+
+/// @brief Sum of values[k] * x[columns[k]] for k in [begin, end)
+///
+/// Two independent accumulators hide the latency of the gather-dependent additions, which otherwise bounds the
+/// short rows produced by stencil operators.
+inline double SparseRowDot(const std::int32_t* __restrict columns,
+                           const double* __restrict values,
+                           const double* __restrict x,
+                           std::int32_t begin,
+                           const std::int32_t end)
+{
+    double sum0{0.0};
+    double sum1{0.0};
+    for (; begin + 1 < end; begin += 2)
+    {
+        sum0 += values[begin] * x[columns[begin]];
+        sum1 += values[begin + 1] * x[columns[begin + 1]];
+    }
+    if (begin < end)
+    {
+        sum0 += values[begin] * x[columns[begin]];
+    }
+    return sum0 + sum1;
+}
+
+}  // namespace
+
+CooMatrix::CooMatrix(const std::int32_t rows, const std::int32_t columns) : m_(rows), n_(columns)
+{
+    CheckDimensions(rows, columns);
+}
+
+void CooMatrix::Reserve(const std::size_t number_of_entries)
+{
+    row_indices_.reserve(number_of_entries);
+    column_indices_.reserve(number_of_entries);
+    values_.reserve(number_of_entries);
+}
+
+void CooMatrix::Add(const std::int32_t row, const std::int32_t column, const double value)
+{
+    CheckIndex(row, m_, "Row");
+    CheckIndex(column, n_, "Column");
+
+    row_indices_.push_back(row);
+    column_indices_.push_back(column);
+    values_.push_back(value);
+}
+
+CsrMatrix::CsrMatrix(const std::int32_t rows, const std::int32_t columns)
+    : m_(rows), n_(columns), row_offsets_(static_cast<std::size_t>(std::max(rows, 0)) + 1, 0)
+{
+    CheckDimensions(rows, columns);
+}
+
+CsrMatrix::CsrMatrix(const CooMatrix& coo) : CsrMatrix(coo.NumberOfRows(), coo.NumberOfColumns())
+{
+    const auto& rows = coo.RowIndices();
+    const auto& columns = coo.ColumnIndices();
+    const auto& values = coo.Values();
+    const auto number_of_entries = values.size();
+    CheckNumberOfNonZeros(number_of_entries);
+
+    // Counting sort of the triplets by row
+    for (const auto row : rows)
+    {
+        ++row_offsets_[static_cast<std::size_t>(row) + 1];
+    }
+    std::partial_sum(row_offsets_.begin(), row_offsets_.end(), row_offsets_.begin());
+
+    std::vector<std::int32_t> unsorted_columns(number_of_entries);
+    std::vector<double> unsorted_values(number_of_entries);
+    std::vector<std::int32_t> next(row_offsets_.begin(), row_offsets_.end() - 1);
+    for (std::size_t k{0}; k < number_of_entries; ++k)
+    {
+        const auto position = static_cast<std::size_t>(next[static_cast<std::size_t>(rows[k])]++);
+        unsorted_columns[position] = columns[k];
+        unsorted_values[position] = values[k];
+    }
+
+    // Sort every row by column and merge repeated entries, compacting the arrays in place
+    column_indices_.reserve(number_of_entries);
+    values_.reserve(number_of_entries);
+    std::vector<std::pair<std::int32_t, double>> row_entries{};
+    for (std::int32_t i{0}; i < m_; ++i)
+    {
+        const auto begin = static_cast<std::size_t>(row_offsets_[static_cast<std::size_t>(i)]);
+        const auto end = static_cast<std::size_t>(row_offsets_[static_cast<std::size_t>(i) + 1]);
+
+        row_entries.clear();
+        for (auto k = begin; k < end; ++k)
+        {
+            row_entries.emplace_back(unsorted_columns[k], unsorted_values[k]);
+        }
+        std::stable_sort(row_entries.begin(), row_entries.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+
+        row_offsets_[static_cast<std::size_t>(i)] = static_cast<std::int32_t>(values_.size());
+        for (const auto& [column, value] : row_entries)
+        {
+            if (values_.size() > static_cast<std::size_t>(row_offsets_[static_cast<std::size_t>(i)]) &&
+                column_indices_.back() == column)
+            {
+                values_.back() += value;
+            }
+            else
+            {
+                column_indices_.push_back(column);
+                values_.push_back(value);
+            }
+        }
+    }
+    row_offsets_[static_cast<std::size_t>(m_)] = static_cast<std::int32_t>(values_.size());
+}
+
+CsrMatrix::CsrMatrix(const Matrix<double>& dense) : CsrMatrix(dense.NumberOfRows(), dense.NumberOfColumns())
+{
+    for (std::int32_t i{0}; i < m_; ++i)
+    {
+        for (std::int32_t j{0}; j < n_; ++j)
+        {
+            if (dense(i, j) != 0.0)
+            {
+                column_indices_.push_back(j);
+                values_.push_back(dense(i, j));
+            }
+        }
+        CheckNumberOfNonZeros(values_.size());
+        row_offsets_[static_cast<std::size_t>(i) + 1] = static_cast<std::int32_t>(values_.size());
+    }
+}
+
+CsrMatrix::CsrMatrix(const std::int32_t rows,
+                     const std::int32_t columns,
+                     std::vector<std::int32_t> row_offsets,
+                     std::vector<std::int32_t> column_indices,
+                     std::vector<double> values)
+    : m_(rows),
+      n_(columns),
+      row_offsets_(std::move(row_offsets)),
+      column_indices_(std::move(column_indices)),
+      values_(std::move(values))
+{
+    CheckDimensions(rows, columns);
+    CheckNumberOfNonZeros(values_.size());
+
+    if (row_offsets_.size() != static_cast<std::size_t>(m_) + 1 || row_offsets_.front() != 0 ||
+        static_cast<std::size_t>(row_offsets_.back()) != values_.size() || column_indices_.size() != values_.size())
+    {
+        throw std::invalid_argument("CSR arrays do not match the matrix dimensions.");
+    }
+
+    for (std::int32_t i{0}; i < m_; ++i)
+    {
+        const auto begin = row_offsets_[static_cast<std::size_t>(i)];
+        const auto end = row_offsets_[static_cast<std::size_t>(i) + 1];
+        if (end < begin)
+        {
+            throw std::invalid_argument("CSR row offsets must be non-decreasing.");
+        }
+        for (auto k = begin; k < end; ++k)
+        {
+            const auto column = column_indices_[static_cast<std::size_t>(k)];
+            if (column < 0 || column >= n_ || (k > begin && column <= column_indices_[static_cast<std::size_t>(k) - 1]))
+            {
+                throw std::invalid_argument("CSR column indices must be in range and strictly increasing per row.");
+            }
+        }
+    }
+}
+
+double CsrMatrix::operator()(const std::int32_t i, const std::int32_t j) const
+{
+    CheckIndex(i, m_, "Row");
+    CheckIndex(j, n_, "Column");
+
+    const auto begin = column_indices_.cbegin() + row_offsets_[static_cast<std::size_t>(i)];
+    const auto end = column_indices_.cbegin() + row_offsets_[static_cast<std::size_t>(i) + 1];
+    const auto position = std::lower_bound(begin, end, j);
+    if (position == end || *position != j)
+    {
+        return 0.0;
+    }
+    return values_[static_cast<std::size_t>(position - column_indices_.cbegin())];
+}
+
+void CsrMatrix::SetRow(const std::int32_t i,
+                       const std::vector<std::int32_t>& columns,
+                       const std::vector<double>& values)
+{
+    CheckIndex(i, m_, "Row");
+    if (columns.size() != values.size())
+    {
+        throw std::invalid_argument("Row columns and values must have the same length.");
+    }
+    for (std::size_t k{0}; k < columns.size(); ++k)
+    {
+        CheckIndex(columns[k], n_, "Column");
+        if (k > 0 && columns[k] <= columns[k - 1])
+        {
+            throw std::invalid_argument("Row column indices must be strictly increasing.");
+        }
+    }
+
+    const auto begin = static_cast<std::size_t>(row_offsets_[static_cast<std::size_t>(i)]);
+    const auto end = static_cast<std::size_t>(row_offsets_[static_cast<std::size_t>(i) + 1]);
+    const auto old_size = end - begin;
+    CheckNumberOfNonZeros(values_.size() - old_size + values.size());
+
+    if (old_size != values.size())
+    {
+        column_indices_.erase(column_indices_.begin() + begin, column_indices_.begin() + end);
+        values_.erase(values_.begin() + begin, values_.begin() + end);
+        column_indices_.insert(column_indices_.begin() + begin, columns.size(), 0);
+        values_.insert(values_.begin() + begin, values.size(), 0.0);
+
+        const auto shift = static_cast<std::int32_t>(values.size()) - static_cast<std::int32_t>(old_size);
+        for (auto r = static_cast<std::size_t>(i) + 1; r < row_offsets_.size(); ++r)
+        {
+            row_offsets_[r] += shift;
+        }
+    }
+
+    std::copy(columns.cbegin(), columns.cend(), column_indices_.begin() + begin);
+    std::copy(values.cbegin(), values.cend(), values_.begin() + begin);
+}
+
+CsrMatrix& CsrMatrix::operator*=(const double scalar_value)
+{
+    for (auto& value : values_)
+    {
+        value *= scalar_value;
+    }
+    return *this;
+}
+
+std::vector<double> CsrMatrix::Diagonal() const
+{
+    std::vector<double> diagonal(static_cast<std::size_t>(std::min(m_, n_)), 0.0);
+    for (std::int32_t i{0}; i < static_cast<std::int32_t>(diagonal.size()); ++i)
+    {
+        diagonal[static_cast<std::size_t>(i)] = (*this)(i, i);
+    }
+    return diagonal;
+}
+
+CsrMatrix CsrMatrix::Transpose() const
+{
+    std::vector<std::int32_t> row_offsets(static_cast<std::size_t>(n_) + 1, 0);
+    for (const auto column : column_indices_)
+    {
+        ++row_offsets[static_cast<std::size_t>(column) + 1];
+    }
+    std::partial_sum(row_offsets.begin(), row_offsets.end(), row_offsets.begin());
+
+    // Visiting the rows in order leaves the columns of the transpose sorted
+    std::vector<std::int32_t> column_indices(values_.size());
+    std::vector<double> values(values_.size());
+    std::vector<std::int32_t> next(row_offsets.begin(), row_offsets.end() - 1);
+    for (std::int32_t i{0}; i < m_; ++i)
+    {
+        for (auto k = row_offsets_[static_cast<std::size_t>(i)]; k < row_offsets_[static_cast<std::size_t>(i) + 1]; ++k)
+        {
+            const auto column = static_cast<std::size_t>(column_indices_[static_cast<std::size_t>(k)]);
+            const auto position = static_cast<std::size_t>(next[column]++);
+            column_indices[position] = i;
+            values[position] = values_[static_cast<std::size_t>(k)];
+        }
+    }
+
+    return CsrMatrix{n_, m_, std::move(row_offsets), std::move(column_indices), std::move(values)};
+}
+
+Matrix<double> CsrMatrix::ToDense() const
+{
+    Matrix<double> dense(m_, n_);
+    for (std::int32_t i{0}; i < m_; ++i)
+    {
+        for (auto k = row_offsets_[static_cast<std::size_t>(i)]; k < row_offsets_[static_cast<std::size_t>(i) + 1]; ++k)
+        {
+            dense(i, column_indices_[static_cast<std::size_t>(k)]) = values_[static_cast<std::size_t>(k)];
+        }
+    }
+    return dense;
+}
+
+void SpMV(const double alpha,
+          const CsrMatrix& A,
+          const std::vector<double>& x,
+          const double beta,
+          std::vector<double>& y)
+{
+    if (x.size() != static_cast<std::size_t>(A.NumberOfColumns()) ||
+        y.size() != static_cast<std::size_t>(A.NumberOfRows()))
+    {
+        throw std::length_error("Sparse matrix vector product dimensions do not match.");
+    }
+
+    const auto* offsets = A.RowOffsets().data();
+    const auto* columns = A.ColumnIndices().data();
+    const auto* values = A.Values().data();
+    const auto* x_data = x.data();
+    auto* y_data = y.data();
+    const auto m = A.NumberOfRows();
+
+    if (beta == 0.0)
+    {
+        for (std::int32_t i{0}; i < m; ++i)
+        {
+            y_data[i] = alpha * SparseRowDot(columns, values, x_data, offsets[i], offsets[i + 1]);
+        }
+    }
+    else
+    {
+        for (std::int32_t i{0}; i < m; ++i)
+        {
+            y_data[i] = alpha * SparseRowDot(columns, values, x_data, offsets[i], offsets[i + 1]) + beta * y_data[i];
+        }
+    }
+}
+
+void SpMVTranspose(const double alpha,
+                   const CsrMatrix& A,
+                   const std::vector<double>& x,
+                   const double beta,
+                   std::vector<double>& y)
+{
+    if (x.size() != static_cast<std::size_t>(A.NumberOfRows()) ||
+        y.size() != static_cast<std::size_t>(A.NumberOfColumns()))
+    {
+        throw std::length_error("Transposed sparse matrix vector product dimensions do not match.");
+    }
+
+    if (beta == 0.0)
+    {
+        std::fill(y.begin(), y.end(), 0.0);
+    }
+    else if (beta != 1.0)
+    {
+        Scal(beta, y);
+    }
+
+    // Row i of A scatters alpha * x[i] into the entries of y its columns point at
+    const auto* offsets = A.RowOffsets().data();
+    const auto* __restrict columns = A.ColumnIndices().data();
+    const auto* __restrict values = A.Values().data();
+    auto* __restrict y_data = y.data();
+    for (std::int32_t i{0}; i < A.NumberOfRows(); ++i)
+    {
+        const auto scaled_x = alpha * x[static_cast<std::size_t>(i)];
+        for (auto k = offsets[i]; k < offsets[i + 1]; ++k)
+        {
+            y_data[columns[k]] += values[k] * scaled_x;
+        }
+    }
+}
+
+std::vector<double> MatMult(const CsrMatrix& A, const std::vector<double>& x)
+{
+    std::vector<double> result(static_cast<std::size_t>(A.NumberOfRows()));
+    SpMV(1.0, A, x, 0.0, result);
+    return result;
+}
+
+CsrMatrix MatMult(const CsrMatrix& A, const CsrMatrix& B)
+{
+    if (A.NumberOfColumns() != B.NumberOfRows())
+    {
+        throw std::length_error("Sparse matrix product dimensions do not match.");
+    }
+
+    const auto& a_offsets = A.RowOffsets();
+    const auto& a_columns = A.ColumnIndices();
+    const auto& a_values = A.Values();
+    const auto& b_offsets = B.RowOffsets();
+    const auto& b_columns = B.ColumnIndices();
+    const auto& b_values = B.Values();
+
+    std::vector<std::int32_t> row_offsets(static_cast<std::size_t>(A.NumberOfRows()) + 1, 0);
+    std::vector<std::int32_t> column_indices{};
+    std::vector<double> values{};
+
+    // accumulator[j] collects entry (i, j) of the current row, row_of_column[j] marks whether it is already in use
+    std::vector<double> accumulator(static_cast<std::size_t>(B.NumberOfColumns()), 0.0);
+    std::vector<std::int32_t> row_of_column(static_cast<std::size_t>(B.NumberOfColumns()), -1);
+    for (std::int32_t i{0}; i < A.NumberOfRows(); ++i)
+    {
+        const auto row_begin = column_indices.size();
+        for (auto ka = a_offsets[i]; ka < a_offsets[i + 1]; ++ka)
+        {
+            const auto k = a_columns[ka];
+            for (auto kb = b_offsets[k]; kb < b_offsets[k + 1]; ++kb)
+            {
+                const auto j = b_columns[kb];
+                if (row_of_column[j] != i)
+                {
+                    row_of_column[j] = i;
+                    accumulator[j] = 0.0;
+                    column_indices.push_back(j);
+                }
+                accumulator[j] += a_values[ka] * b_values[kb];
+            }
+        }
+
+        std::sort(column_indices.begin() + static_cast<std::ptrdiff_t>(row_begin), column_indices.end());
+        for (auto k = row_begin; k < column_indices.size(); ++k)
+        {
+            values.push_back(accumulator[column_indices[k]]);
+        }
+        row_offsets[static_cast<std::size_t>(i) + 1] = static_cast<std::int32_t>(column_indices.size());
+    }
+
+    return CsrMatrix{
+        A.NumberOfRows(), B.NumberOfColumns(), std::move(row_offsets), std::move(column_indices), std::move(values)};
+}
+
+CsrMatrix ScalarMultiply(const double scalar_value, const CsrMatrix& A)
+{
+    auto result = A;
+    result *= scalar_value;
+    return result;
+}
+
+}  // namespace matrix
+
+}  // namespace nm
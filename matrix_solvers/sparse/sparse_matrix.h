@@ -0,0 +1,166 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Compressed sparse row (CSR) matrix and its coordinate (COO) assembly format
+ */
+
+#ifndef MATRIX_SOLVERS_SPARSE_SPARSE_MATRIX_H
+#define MATRIX_SOLVERS_SPARSE_SPARSE_MATRIX_H
+
+#include "matrix_solvers/utilities.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Sparse matrix stored as unordered (row, column, value) triplets
+///
+/// Meant for assembly only: entries can be added in any order and repeated entries are summed once the matrix is
+/// converted to a CsrMatrix, which is the format every operation works on.
+class CooMatrix
+{
+  public:
+    CooMatrix() = default;
+    CooMatrix(const std::int32_t rows, const std::int32_t columns);
+
+    /// @brief Reserves storage for number_of_entries triplets, avoids reallocation during assembly
+    void Reserve(const std::size_t number_of_entries);
+
+    /// @brief Appends value at (row, column), throws std::out_of_range when outside of the matrix
+    void Add(const std::int32_t row, const std::int32_t column, const double value);
+
+    std::int32_t NumberOfRows() const { return m_; }
+    std::int32_t NumberOfColumns() const { return n_; }
+    std::size_t NumberOfEntries() const { return values_.size(); }
+
+    const std::vector<std::int32_t>& RowIndices() const { return row_indices_; }
+    const std::vector<std::int32_t>& ColumnIndices() const { return column_indices_; }
+    const std::vector<double>& Values() const { return values_; }
+
+  private:
+    std::int32_t m_{0};
+    std::int32_t n_{0};
+    std::vector<std::int32_t> row_indices_{};
+    std::vector<std::int32_t> column_indices_{};
+    std::vector<double> values_{};
+};
+
+/// @brief Sparse matrix in compressed sparse row format
+///
+/// Row i holds the entries values[row_offsets[i], row_offsets[i + 1]) at columns
+/// column_indices[row_offsets[i], row_offsets[i + 1]). Column indices are strictly increasing within each row, so
+/// every stored position is unique. Entries that are not stored are zero.
+class CsrMatrix
+{
+  public:
+    CsrMatrix() = default;
+
+    /// @brief rows x columns matrix without any stored entry, i.e. all zeros
+    CsrMatrix(const std::int32_t rows, const std::int32_t columns);
+
+    /// @brief Converts an assembled COO matrix, summing repeated entries
+    explicit CsrMatrix(const CooMatrix& coo);
+
+    /// @brief Converts a dense matrix, storing only its nonzero entries
+    explicit CsrMatrix(const Matrix<double>& dense);
+
+    /// @brief Takes ownership of already compressed arrays
+    ///
+    /// @throws std::invalid_argument: when the arrays do not describe a valid CSR matrix with sorted, unique columns
+    CsrMatrix(const std::int32_t rows,
+              const std::int32_t columns,
+              std::vector<std::int32_t> row_offsets,
+              std::vector<std::int32_t> column_indices,
+              std::vector<double> values);
+
+    std::int32_t NumberOfRows() const { return m_; }
+    std::int32_t NumberOfColumns() const { return n_; }
+    std::int32_t NumberOfNonZeros() const { return static_cast<std::int32_t>(values_.size()); }
+
+    const std::vector<std::int32_t>& RowOffsets() const { return row_offsets_; }
+    const std::vector<std::int32_t>& ColumnIndices() const { return column_indices_; }
+    const std::vector<double>& Values() const { return values_; }
+
+    /// @brief Stored values, may be modified in place as long as the sparsity pattern is kept
+    std::vector<double>& Values() { return values_; }
+
+    /// @brief Entry (i, j), zero when it is not stored. O(log(nonzeros in row i))
+    double operator()(const std::int32_t i, const std::int32_t j) const;
+
+    /// @brief Replaces the stored entries of row i
+    ///
+    /// Costs O(NumberOfNonZeros()) when the number of entries in the row changes, intended for setup such as
+    /// imposing boundary conditions, not for assembly.
+    ///
+    /// @param i: row to replace
+    /// @param columns: strictly increasing column indices of the new entries
+    /// @param values: new entries, same length as columns
+    void SetRow(const std::int32_t i, const std::vector<std::int32_t>& columns, const std::vector<double>& values);
+
+    CsrMatrix& operator*=(const double scalar_value);
+
+    /// @brief Main diagonal, zero where no diagonal entry is stored
+    std::vector<double> Diagonal() const;
+
+    CsrMatrix Transpose() const;
+
+    Matrix<double> ToDense() const;
+
+  private:
+    std::int32_t m_{0};
+    std::int32_t n_{0};
+    std::vector<std::int32_t> row_offsets_{0};
+    std::vector<std::int32_t> column_indices_{};
+    std::vector<double> values_{};
+};
+
+/// @brief Sparse matrix vector product, y = alpha * A * x + beta * y
+///
+/// @param alpha: scale of the product
+/// @param A: mxn sparse matrix
+/// @param x: vector of length n
+/// @param beta: scale of the previous y, when 0 y is write-only and its previous values are ignored
+/// @param y: vector of length m, must not alias x
+///
+/// @throws std::length_error: when x or y do not match the dimensions of A
+void SpMV(const double alpha,
+          const CsrMatrix& A,
+          const std::vector<double>& x,
+          const double beta,
+          std::vector<double>& y);
+
+/// @brief Transposed sparse matrix vector product, y = alpha * A^T * x + beta * y, without forming A^T
+///
+/// @param x: vector of length m
+/// @param y: vector of length n, must not alias x
+///
+/// @throws std::length_error: when x or y do not match the dimensions of A
+void SpMVTranspose(const double alpha,
+                   const CsrMatrix& A,
+                   const std::vector<double>& x,
+                   const double beta,
+                   std::vector<double>& y);
+
+/// @brief Allocating A * x
+std::vector<double> MatMult(const CsrMatrix& A, const std::vector<double>& x);
+
+/// @brief Sparse matrix product A * B, row by row with a dense accumulator of length B.NumberOfColumns()
+///
+/// Costs O(sum over the entries a_ik of the nonzeros in row k of B). Products that cancel to zero stay stored.
+///
+/// @throws std::length_error: when the columns of A do not match the rows of B
+CsrMatrix MatMult(const CsrMatrix& A, const CsrMatrix& B);
+
+CsrMatrix ScalarMultiply(const double scalar_value, const CsrMatrix& A);
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_SPARSE_SPARSE_MATRIX_H
@@ -0,0 +1,264 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/utilities.h"
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+class SparseMatrixTestFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        dense_.push_back(std::vector<double>{4.0, 0.0, 1.0, 0.0});
+        dense_.push_back(std::vector<double>{0.0, 0.0, 0.0, 0.0});
+        dense_.push_back(std::vector<double>{2.0, -1.0, 3.0, 0.0});
+    }
+
+  public:
+    Matrix<double> dense_{};
+    double tolerance_{1e-12};
+};
+
+TEST_F(SparseMatrixTestFixture, GivenDenseMatrix_ExpectOnlyNonZerosStored)
+{
+    // Call
+    const CsrMatrix A{dense_};
+
+    // Expect
+    EXPECT_EQ(A.NumberOfRows(), 3);
+    EXPECT_EQ(A.NumberOfColumns(), 4);
+    EXPECT_EQ(A.NumberOfNonZeros(), 5);
+    EXPECT_EQ(A.RowOffsets(), (std::vector<std::int32_t>{0, 2, 2, 5}));
+    EXPECT_EQ(A.ColumnIndices(), (std::vector<std::int32_t>{0, 2, 0, 1, 2}));
+    for (std::int32_t i{0}; i < A.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < A.NumberOfColumns(); ++j)
+        {
+            EXPECT_NEAR(A(i, j), dense_(i, j), tolerance_);
+        }
+    }
+}
+
+TEST_F(SparseMatrixTestFixture, GivenUnorderedCooEntries_ExpectSortedCsrWithDuplicatesSummed)
+{
+    // Given
+    CooMatrix coo(3, 4);
+    coo.Add(2, 2, 3.0);
+    coo.Add(0, 2, 1.0);
+    coo.Add(2, 0, 1.5);
+    coo.Add(0, 0, 4.0);
+    coo.Add(2, 1, -1.0);
+    coo.Add(2, 0, 0.5);
+
+    // Call
+    const CsrMatrix A{coo};
+
+    // Expect
+    EXPECT_EQ(A.NumberOfNonZeros(), 5);
+    EXPECT_EQ(A.ColumnIndices(), (std::vector<std::int32_t>{0, 2, 0, 1, 2}));
+    const auto result = A.ToDense();
+    for (std::int32_t i{0}; i < result.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < result.NumberOfColumns(); ++j)
+        {
+            EXPECT_NEAR(result(i, j), dense_(i, j), tolerance_);
+        }
+    }
+}
+
+TEST_F(SparseMatrixTestFixture, GivenEntryOutsideOfMatrix_ExpectException)
+{
+    // Given
+    CooMatrix coo(3, 4);
+
+    // Call & Expect
+    EXPECT_THROW(coo.Add(3, 0, 1.0), std::out_of_range);
+    EXPECT_THROW(coo.Add(0, -1, 1.0), std::out_of_range);
+}
+
+TEST_F(SparseMatrixTestFixture, GivenInvalidCompressedArrays_ExpectException)
+{
+    // Given, columns of row 0 are not increasing
+    std::vector<std::int32_t> row_offsets{0, 2};
+    std::vector<std::int32_t> column_indices{1, 0};
+    std::vector<double> values{1.0, 2.0};
+
+    // Call & Expect
+    EXPECT_THROW(CsrMatrix(1, 2, row_offsets, column_indices, values), std::invalid_argument);
+}
+
+TEST_F(SparseMatrixTestFixture, GivenVector_ExpectSpMVMatchesDenseProduct)
+{
+    // Given
+    const CsrMatrix A{dense_};
+    const std::vector<double> x{1.0, 2.0, 3.0, 4.0};
+    std::vector<double> y{1.0, 1.0, 1.0};
+
+    // Call
+    SpMV(2.0, A, x, -1.0, y);
+
+    // Expect
+    const std::vector<double> expected{2.0 * 7.0 - 1.0, -1.0, 2.0 * 9.0 - 1.0};
+    for (std::size_t i{0}; i < y.size(); ++i)
+    {
+        EXPECT_NEAR(y[i], expected[i], tolerance_);
+    }
+}
+
+TEST_F(SparseMatrixTestFixture, GivenVector_ExpectTransposedSpMVMatchesExplicitTranspose)
+{
+    // Given
+    const CsrMatrix A{dense_};
+    const std::vector<double> x{1.0, -2.0, 0.5};
+    std::vector<double> y(4, 7.0);
+
+    // Call
+    SpMVTranspose(1.0, A, x, 0.0, y);
+
+    // Expect
+    const auto expected = MatMult(A.Transpose(), x);
+    ASSERT_EQ(y.size(), expected.size());
+    for (std::size_t i{0}; i < y.size(); ++i)
+    {
+        EXPECT_NEAR(y[i], expected[i], tolerance_);
+    }
+    EXPECT_NEAR(y[0], 5.0, tolerance_);
+    EXPECT_NEAR(y[3], 0.0, tolerance_);
+}
+
+TEST_F(SparseMatrixTestFixture, GivenVectorOfWrongLength_ExpectException)
+{
+    // Given
+    const CsrMatrix A{dense_};
+    const std::vector<double> x{1.0, 2.0, 3.0};
+    std::vector<double> y(3);
+
+    // Call & Expect
+    EXPECT_THROW(SpMV(1.0, A, x, 0.0, y), std::length_error);
+    EXPECT_THROW(SpMVTranspose(1.0, A, y, 0.0, y), std::length_error);
+}
+
+TEST_F(SparseMatrixTestFixture, GivenTwoSparseMatrices_ExpectProductMatchesDenseProduct)
+{
+    // Given
+    const CsrMatrix A{dense_};
+    const auto A_transpose = A.Transpose();
+
+    // Call
+    const auto result = MatMult(A, A_transpose);
+
+    // Expect, row 1 of A is empty so row and column 1 of A * A^T are not stored
+    EXPECT_EQ(result.NumberOfRows(), 3);
+    EXPECT_EQ(result.NumberOfColumns(), 3);
+    EXPECT_EQ(result.NumberOfNonZeros(), 4);
+    const Matrix<double> expected{{17.0, 0.0, 11.0}, {0.0, 0.0, 0.0}, {11.0, 0.0, 14.0}};
+    for (std::int32_t i{0}; i < 3; ++i)
+    {
+        for (std::int32_t j{0}; j < 3; ++j)
+        {
+            EXPECT_NEAR(result(i, j), expected(i, j), tolerance_);
+        }
+    }
+    EXPECT_THROW(MatMult(A, A), std::length_error);
+}
+
+TEST_F(SparseMatrixTestFixture, GivenRowReplacement_ExpectOtherRowsUnchanged)
+{
+    // Given
+    CsrMatrix A{dense_};
+
+    // Call
+    A.SetRow(0, {0}, {1.0});
+    A.SetRow(1, {1, 3}, {5.0, 6.0});
+
+    // Expect
+    EXPECT_EQ(A.NumberOfNonZeros(), 6);
+    EXPECT_NEAR(A(0, 0), 1.0, tolerance_);
+    EXPECT_NEAR(A(0, 2), 0.0, tolerance_);
+    EXPECT_NEAR(A(1, 3), 6.0, tolerance_);
+    EXPECT_NEAR(A(2, 1), -1.0, tolerance_);
+    EXPECT_EQ(A.Diagonal(), (std::vector<double>{1.0, 5.0, 3.0}));
+}
+
+struct SparseLaplacianTestParameter
+{
+    std::int32_t number_of_nodes{};
+    std::string test_name{};
+};
+
+class SparseLaplacianTestFixture : public ::testing::TestWithParam<SparseLaplacianTestParameter>
+{
+};
+
+TEST_P(SparseLaplacianTestFixture, GivenTridiagonalStencil_ExpectLinearStorageAndExactProduct)
+{
+    // Given
+    const auto n = GetParam().number_of_nodes;
+    CooMatrix coo(n, n);
+    coo.Reserve(3 * static_cast<std::size_t>(n));
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        if (i > 0)
+        {
+            coo.Add(i, i - 1, -1.0);
+        }
+        coo.Add(i, i, 2.0);
+        if (i < n - 1)
+        {
+            coo.Add(i, i + 1, -1.0);
+        }
+    }
+    const CsrMatrix A{coo};
+
+    // Call, the discrete Laplacian of a linear function is zero away from the boundaries
+    std::vector<double> x(static_cast<std::size_t>(n));
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        x[static_cast<std::size_t>(i)] = static_cast<double>(i);
+    }
+    const auto y = MatMult(A, x);
+
+    // Expect
+    EXPECT_EQ(A.NumberOfNonZeros(), 3 * n - 2);
+    EXPECT_DOUBLE_EQ(y.front(), -1.0);
+    EXPECT_DOUBLE_EQ(y.back(), static_cast<double>(n));
+    for (std::int32_t i{1}; i < n - 1; ++i)
+    {
+        ASSERT_DOUBLE_EQ(y[static_cast<std::size_t>(i)], 0.0) << "row " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(SparseLaplacianTests,
+                         SparseLaplacianTestFixture,
+                         ::testing::Values(
+                             // clang-format off
+                         SparseLaplacianTestParameter{.number_of_nodes = 5, .test_name = "SmallGrid"},
+                         SparseLaplacianTestParameter{.number_of_nodes = 1000000, .test_name = "MillionNodeGrid"}
+                             // clang-format on
+                             ),
+                         [](const ::testing::TestParamInfo<SparseLaplacianTestParameter>& info) {
+                             return info.param.test_name;
+                         });
+
+}  // namespace
+
+}  // namespace matrix
+
+}  // namespace nm
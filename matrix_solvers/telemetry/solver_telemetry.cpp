@@ -0,0 +1,91 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/telemetry/solver_telemetry.h"
+
+namespace nm
+{
+
+namespace matrix
+{
+
+SolverMonitor::PhaseTimer::PhaseTimer(SolverMonitor* monitor, const SolverPhase phase)
+    : monitor_(monitor), phase_(phase)
+{
+    if (monitor_)
+    {
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+SolverMonitor::PhaseTimer::~PhaseTimer()
+{
+    if (monitor_)
+    {
+        monitor_->AddPhaseTime(phase_, std::chrono::steady_clock::now() - start_);
+    }
+}
+
+SolverMonitor::SolverMonitor(const SolverTelemetry& telemetry)
+    : telemetry_(telemetry), is_active_(telemetry.stats != nullptr || static_cast<bool>(telemetry.observer))
+{
+    if (!IsActive())
+    {
+        return;
+    }
+
+    if (telemetry_.stats)
+    {
+        auto& stats = *telemetry_.stats;
+        stats.iterations = 0;
+        stats.converged = false;
+        stats.initial_residual.reset();
+        stats.residual_history.clear();
+        stats.phase_seconds.fill(0.0);
+        stats.total_seconds = 0.0;
+        stats.work = {};
+    }
+    start_ = std::chrono::steady_clock::now();
+}
+
+void SolverMonitor::RecordIterationImpl(const std::int32_t iteration, const double residual)
+{
+    if (telemetry_.stats)
+    {
+        telemetry_.stats->residual_history.push_back(residual);
+    }
+    if (telemetry_.observer)
+    {
+        telemetry_.observer(IterationReport{iteration, residual, ElapsedSeconds()});
+    }
+}
+
+void SolverMonitor::FinishImpl(const std::int32_t iterations, const bool converged)
+{
+    if (telemetry_.stats)
+    {
+        telemetry_.stats->iterations = iterations;
+        telemetry_.stats->converged = converged;
+        telemetry_.stats->total_seconds = ElapsedSeconds();
+    }
+}
+
+void SolverMonitor::AddPhaseTime(const SolverPhase phase, const std::chrono::steady_clock::duration duration)
+{
+    if (telemetry_.stats)
+    {
+        telemetry_.stats->phase_seconds[static_cast<std::size_t>(phase)] +=
+            std::chrono::duration<double>(duration).count();
+    }
+}
+
+double SolverMonitor::ElapsedSeconds() const
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+}
+
+}  // namespace matrix
+
+}  // namespace nm
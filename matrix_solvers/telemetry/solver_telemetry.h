@@ -0,0 +1,196 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Convergence history, timing and cost estimates of the iterative solvers and root finders
+ */
+
+#ifndef MATRIX_SOLVERS_TELEMETRY_SOLVER_TELEMETRY_H
+#define MATRIX_SOLVERS_TELEMETRY_SOLVER_TELEMETRY_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+// Building with DISABLE_SOLVER_TELEMETRY turns every SolverMonitor call into a no-op the compiler removes, solvers
+// then leave SolverStats untouched and never call the observer
+#ifdef DISABLE_SOLVER_TELEMETRY
+constexpr bool kSolverTelemetryEnabled{false};
+#else
+constexpr bool kSolverTelemetryEnabled{true};
+#endif
+
+/// @brief Parts of a solve that are timed separately, the remainder of the total time is spent in vector updates
+enum class SolverPhase : std::int8_t
+{
+    // Work done once before the first iteration, such as the initial residual, a colouring or a Jacobian
+    kSetup = 0,
+    // Products with the matrix or operator, for root finders evaluations of the function and its derivatives
+    kOperator = 1,
+    kPreconditioner = 2,
+};
+
+constexpr std::size_t kNumberOfSolverPhases{3};
+
+/// @brief Floating point operations and bytes moved to or from memory, counting every operand once
+///
+/// These are estimates for roofline style comparisons, caches and the reuse of operands are not modelled.
+struct WorkEstimate
+{
+    double flops{0.0};
+    double bytes{0.0};
+};
+
+inline WorkEstimate operator+(const WorkEstimate& lhs, const WorkEstimate& rhs)
+{
+    return {lhs.flops + rhs.flops, lhs.bytes + rhs.bytes};
+}
+
+inline WorkEstimate operator*(const double scale, const WorkEstimate& work)
+{
+    return {scale * work.flops, scale * work.bytes};
+}
+
+/// @brief Work of a dot product or a norm of vectors of length n
+inline WorkEstimate DotWork(const std::size_t n)
+{
+    return {2.0 * static_cast<double>(n), 16.0 * static_cast<double>(n)};
+}
+
+/// @brief Work of y = alpha * x + y or y = alpha * x + beta * y on vectors of length n
+inline WorkEstimate AxpyWork(const std::size_t n)
+{
+    return {2.0 * static_cast<double>(n), 24.0 * static_cast<double>(n)};
+}
+
+/// @brief Summary of one solve
+///
+/// A stats object may be reused, every solve resets it first while keeping the capacity of residual_history.
+struct SolverStats
+{
+    std::int32_t iterations{0};
+    bool converged{false};
+
+    // Residual of the initial guess, only for solvers that compute it before the first iteration
+    std::optional<double> initial_residual{};
+
+    // One entry per iteration, measured the way the stopping criterion of the solver measures it, e.g. the L2 norm of
+    // b - A * x for Krylov methods or of the last update for Jacobi, Gauss Seidel and the root finders
+    std::vector<double> residual_history{};
+
+    std::array<double, kNumberOfSolverPhases> phase_seconds{};
+    double total_seconds{0.0};
+
+    WorkEstimate work{};
+
+    double PhaseSeconds(const SolverPhase phase) const { return phase_seconds[static_cast<std::size_t>(phase)]; }
+};
+
+/// @brief What the observer is told after every iteration
+struct IterationReport
+{
+    std::int32_t iteration{0};
+    double residual{0.0};
+    double elapsed_seconds{0.0};
+};
+
+using IterationObserver = std::function<void(const IterationReport&)>;
+
+/// @brief Where a solver reports to, both members are optional and an empty telemetry costs one branch per iteration
+struct SolverTelemetry
+{
+    SolverStats* stats{nullptr};
+    IterationObserver observer{};
+};
+
+/// @brief Records into a SolverTelemetry from inside a solver
+///
+/// Every method returns immediately when the telemetry has neither stats nor an observer, so the clock is only read
+/// when somebody asked for the result.
+class SolverMonitor
+{
+  public:
+    /// @brief Times one phase for as long as it is alive
+    class PhaseTimer
+    {
+      public:
+        PhaseTimer(SolverMonitor* monitor, const SolverPhase phase);
+        ~PhaseTimer();
+
+        PhaseTimer(const PhaseTimer&) = delete;
+        PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+      private:
+        SolverMonitor* monitor_{nullptr};
+        SolverPhase phase_{};
+        std::chrono::steady_clock::time_point start_{};
+    };
+
+    /// @brief Resets telemetry.stats and starts the clock of the total time
+    explicit SolverMonitor(const SolverTelemetry& telemetry);
+
+    bool IsActive() const { return kSolverTelemetryEnabled && is_active_; }
+
+    void RecordInitialResidual(const double residual)
+    {
+        if (IsActive() && telemetry_.stats)
+        {
+            telemetry_.stats->initial_residual = residual;
+        }
+    }
+
+    /// @brief Appends residual to the history and calls the observer
+    void RecordIteration(const std::int32_t iteration, const double residual)
+    {
+        if (IsActive())
+        {
+            RecordIterationImpl(iteration, residual);
+        }
+    }
+
+    void AddWork(const WorkEstimate& work)
+    {
+        if (IsActive() && telemetry_.stats)
+        {
+            telemetry_.stats->work = telemetry_.stats->work + work;
+        }
+    }
+
+    /// @brief Times phase until the returned timer goes out of scope
+    PhaseTimer Time(const SolverPhase phase) { return PhaseTimer{IsActive() ? this : nullptr, phase}; }
+
+    /// @brief Stores the outcome and the total time of the solve
+    void Finish(const std::int32_t iterations, const bool converged)
+    {
+        if (IsActive())
+        {
+            FinishImpl(iterations, converged);
+        }
+    }
+
+  private:
+    void RecordIterationImpl(const std::int32_t iteration, const double residual);
+    void FinishImpl(const std::int32_t iterations, const bool converged);
+    void AddPhaseTime(const SolverPhase phase, const std::chrono::steady_clock::duration duration);
+    double ElapsedSeconds() const;
+
+    const SolverTelemetry& telemetry_;
+    bool is_active_{false};
+    std::chrono::steady_clock::time_point start_{};
+};
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_TELEMETRY_SOLVER_TELEMETRY_H
@@ -0,0 +1,133 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/telemetry/solver_telemetry.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+TEST(SolverMonitorTest, GivenStatsAndObserver_ExpectEveryIterationRecorded)
+{
+    // Given
+    SolverStats stats{};
+    std::vector<IterationReport> reports{};
+    const SolverTelemetry telemetry{&stats, [&reports](const IterationReport& report) { reports.push_back(report); }};
+
+    // Call
+    SolverMonitor monitor{telemetry};
+    monitor.RecordInitialResidual(8.0);
+    for (std::int32_t iteration{1}; iteration <= 3; ++iteration)
+    {
+        monitor.AddWork({10.0, 80.0});
+        monitor.RecordIteration(iteration, 8.0 / (2 << iteration));
+    }
+    monitor.Finish(3, true);
+
+    // Expect
+    EXPECT_EQ(stats.iterations, 3);
+    EXPECT_TRUE(stats.converged);
+    ASSERT_TRUE(stats.initial_residual.has_value());
+    EXPECT_DOUBLE_EQ(*stats.initial_residual, 8.0);
+    EXPECT_EQ(stats.residual_history, (std::vector<double>{2.0, 1.0, 0.5}));
+    EXPECT_DOUBLE_EQ(stats.work.flops, 30.0);
+    EXPECT_DOUBLE_EQ(stats.work.bytes, 240.0);
+    EXPECT_GE(stats.total_seconds, 0.0);
+
+    ASSERT_EQ(reports.size(), 3U);
+    for (std::size_t i{0}; i < reports.size(); ++i)
+    {
+        EXPECT_EQ(reports[i].iteration, static_cast<std::int32_t>(i) + 1);
+        EXPECT_DOUBLE_EQ(reports[i].residual, stats.residual_history[i]);
+    }
+    EXPECT_LE(reports.front().elapsed_seconds, reports.back().elapsed_seconds);
+}
+
+TEST(SolverMonitorTest, GivenReusedStats_ExpectPreviousSolveCleared)
+{
+    // Given
+    SolverStats stats{};
+    stats.iterations = 7;
+    stats.converged = true;
+    stats.initial_residual = 1.0;
+    stats.residual_history = {1.0, 0.1};
+    stats.phase_seconds.fill(1.0);
+    stats.work = {1.0, 1.0};
+
+    const SolverTelemetry telemetry{&stats};
+
+    // Call
+    const SolverMonitor monitor{telemetry};
+
+    // Expect
+    EXPECT_EQ(stats.iterations, 0);
+    EXPECT_FALSE(stats.converged);
+    EXPECT_FALSE(stats.initial_residual.has_value());
+    EXPECT_TRUE(stats.residual_history.empty());
+    EXPECT_DOUBLE_EQ(stats.PhaseSeconds(SolverPhase::kSetup), 0.0);
+    EXPECT_DOUBLE_EQ(stats.work.flops, 0.0);
+}
+
+TEST(SolverMonitorTest, GivenPhaseTimers_ExpectTimeAddedToTheirPhaseOnly)
+{
+    // Given
+    SolverStats stats{};
+    const SolverTelemetry telemetry{&stats};
+    SolverMonitor monitor{telemetry};
+
+    // Call
+    volatile double sink{0.0};
+    for (std::int32_t repeat{0}; repeat < 2; ++repeat)
+    {
+        const auto timer = monitor.Time(SolverPhase::kOperator);
+        for (std::int32_t i{0}; i < 100000; ++i)
+        {
+            sink = sink + 1.0;
+        }
+    }
+
+    // Expect
+    EXPECT_GT(stats.PhaseSeconds(SolverPhase::kOperator), 0.0);
+    EXPECT_DOUBLE_EQ(stats.PhaseSeconds(SolverPhase::kSetup), 0.0);
+    EXPECT_DOUBLE_EQ(stats.PhaseSeconds(SolverPhase::kPreconditioner), 0.0);
+}
+
+TEST(SolverMonitorTest, GivenEmptyTelemetry_ExpectInactiveMonitor)
+{
+    // Given
+    const SolverTelemetry telemetry{};
+
+    // Call
+    SolverMonitor monitor{telemetry};
+    monitor.RecordIteration(1, 1.0);
+    monitor.Finish(1, true);
+
+    // Expect
+    EXPECT_FALSE(monitor.IsActive());
+}
+
+TEST(WorkEstimateTest, GivenVectorKernels_ExpectOperandsCountedOnce)
+{
+    // Call
+    const auto work = DotWork(10) + 2.0 * AxpyWork(10);
+
+    // Expect
+    EXPECT_DOUBLE_EQ(work.flops, 20.0 + 40.0);
+    EXPECT_DOUBLE_EQ(work.bytes, 160.0 + 480.0);
+}
+
+}  // namespace
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -6,9 +6,11 @@
  */
 
 #include "matrix_solvers/utilities.h"
+#include "matrix_solvers/operations/vector_kernels.h"
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <stdexcept>
 #include <vector>
 
 namespace nm
@@ -19,10 +21,11 @@ namespace matrix
 
 std::vector<double> Vectorize(const Matrix<double>& A)
 {
-    const auto m = static_cast<std::int32_t>(A.size());
-    const auto n = static_cast<std::int32_t>(A.at(0).size());
+    const auto m = A.NumberOfRows();
+    const auto n = A.NumberOfColumns();
 
     std::vector<double> result{};
+    result.reserve(static_cast<std::size_t>(m) * n);
 
     // Loop through columns
     for (std::int32_t j{0}; j < n; ++j)
@@ -30,7 +33,7 @@ std::vector<double> Vectorize(const Matrix<double>& A)
         // Within each column grab the corresponding value in that row
         for (std::int32_t i{0}; i < m; ++i)
         {
-            result.emplace_back(A.at(i).at(j));
+            result.emplace_back(A(i, j));
         }
     }
     return result;
@@ -39,47 +42,62 @@ std::vector<double> Vectorize(const Matrix<double>& A)
 std::vector<double> AddVectors(const std::vector<double>& a, const std::vector<double>& b)
 {
     // assert(a.size() != b.size());
-    std::vector<double> result{a};
-    for (std::int32_t i{0}; i < static_cast<int32_t>(a.size()); ++i)
-    {
-        result[i] += b[i];
-    }
+    std::vector<double> result(a.size());
+    kernels::Add(a.data(), b.data(), result.data(), a.size());
     return result;
 }
 
 std::vector<double> ScalarMultiply(const double scalar_value, const std::vector<double>& a)
 {
-    std::vector<double> result{a};
-    for (std::int32_t i{0}; i < static_cast<int32_t>(a.size()); ++i)
+    std::vector<double> result(a.size());
+    kernels::Scale(scalar_value, a.data(), result.data(), a.size());
+    return result;
+}
+
+void Axpy(const double alpha, const std::vector<double>& x, std::vector<double>& y)
+{
+    if (x.size() != y.size())
     {
-        result[i] *= scalar_value;
+        throw std::length_error("Vectors are not of the same length");
     }
-    return result;
+    kernels::Axpy(alpha, x.data(), y.data(), x.size());
 }
 
-nm::matrix::Matrix<double> ScalarMultiply(const double scalar_value, const nm::matrix::Matrix<double>& A)
+void Axpby(const double alpha, const std::vector<double>& x, const double beta, std::vector<double>& y)
 {
-    nm::matrix::Matrix<double> result{A};
-    for (std::int32_t i{0}; i < static_cast<int32_t>(A.size()); ++i)
+    if (x.size() != y.size())
     {
-        for (std::int32_t j{0}; j < static_cast<std::int32_t>(A.at(0).size()); ++j)
-        {
-            result.at(i).at(j) *= scalar_value;
-        }
+        throw std::length_error("Vectors are not of the same length");
     }
+    kernels::Axpby(alpha, x.data(), beta, y.data(), x.size());
+}
+
+void Scal(const double alpha, std::vector<double>& x)
+{
+    kernels::Scale(alpha, x.data(), x.data(), x.size());
+}
+
+nm::matrix::Matrix<double> ScalarMultiply(const double scalar_value, const nm::matrix::Matrix<double>& A)
+{
+    nm::matrix::Matrix<double> result{A};
+    const auto number_of_elements = static_cast<std::size_t>(A.NumberOfRows()) * A.NumberOfColumns();
+    kernels::Scale(scalar_value, result.Data(), result.Data(), number_of_elements);
     return result;
 }
 
 Matrix<double> Devectorize(const std::vector<double>& a, const std::int32_t column_length)
 {
-    Matrix<double> result{};
-    const auto number_of_columns = a.size() / column_length;
-    result.resize(number_of_columns);
-    for (std::int32_t i{0}; i < number_of_columns; ++i)
+    const auto number_of_columns = static_cast<std::int32_t>(a.size()) / column_length;
+    Matrix<double> result(column_length, number_of_columns);
+
+    // Consecutive chunks of length column_length of a are the columns of the result
+    for (std::int32_t j{0}; j < number_of_columns; ++j)
     {
-        result.at(i) = {a.cbegin() + (i * column_length), a.cbegin() + (i * column_length + column_length)};
+        for (std::int32_t i{0}; i < column_length; ++i)
+        {
+            result(i, j) = a[static_cast<std::size_t>(j) * column_length + i];
+        }
     }
-    result.TransposeInPlace();
     return result;
 }
 
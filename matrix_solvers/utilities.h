@@ -10,8 +10,14 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -35,206 +41,551 @@ std::vector<double> AddVectors(const std::vector<double>& a, const std::vector<d
 /// @return std::vector<double> The scaled vector
 std::vector<double> ScalarMultiply(const double scalar_value, const std::vector<double>& a);
 
-/// @brief Matrix alias template
+/// @brief In-place scaled vector addition, y = alpha * x + y
+///
+/// @param alpha The scalar multiplier of x
+/// @param x The std::vector of doubles to be scaled and added
+/// @param y The std::vector of doubles receiving the result, must have the same length as x
+void Axpy(const double alpha, const std::vector<double>& x, std::vector<double>& y);
+
+/// @brief In-place linear combination of two vectors, y = alpha * x + beta * y
+///
+/// @param alpha The scalar multiplier of x
+/// @param x The std::vector of doubles to be scaled and added
+/// @param beta The scalar multiplier of y
+/// @param y The std::vector of doubles receiving the result, must have the same length as x
+void Axpby(const double alpha, const std::vector<double>& x, const double beta, std::vector<double>& y);
+
+/// @brief In-place vector scaling, x = alpha * x
+///
+/// @param alpha The scalar multiplier
+/// @param x The std::vector of doubles to be scaled
+void Scal(const double alpha, std::vector<double>& x);
+
+/// @brief Byte alignment of the matrix storage buffer (one cache line, wide enough for AVX-512 loads)
+constexpr std::size_t kMatrixAlignment{64};
+
+/// @brief Minimal allocator handing out storage aligned to Alignment bytes
 ///
 /// @param T: template-parameter-typename
+/// @param Alignment: required alignment in bytes
+template <typename T, std::size_t Alignment = kMatrixAlignment>
+class AlignedAllocator
+{
+  public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+    {
+    }
+
+    T* allocate(const std::size_t n)
+    {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* ptr, const std::size_t) noexcept { ::operator delete(ptr, std::align_val_t{Alignment}); }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept
+    {
+        return false;
+    }
+};
+
+/// @brief Random access iterator walking a buffer with a fixed stride
+///
+/// @param T: template-parameter-typename (may be const qualified)
 template <typename T>
-// using Matrix = std::vector<std::vector<T>>;
-class Matrix : public std::vector<std::vector<T>>
+class StridedIterator
 {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    StridedIterator() = default;
+    StridedIterator(T* ptr, const std::ptrdiff_t stride) : ptr_(ptr), stride_(stride) {}
+
+    reference operator*() const { return *ptr_; }
+    pointer operator->() const { return ptr_; }
+    reference operator[](const difference_type n) const { return ptr_[n * stride_]; }
+
+    StridedIterator& operator++()
+    {
+        ptr_ += stride_;
+        return *this;
+    }
+    StridedIterator operator++(int)
+    {
+        auto tmp = *this;
+        ptr_ += stride_;
+        return tmp;
+    }
+    StridedIterator& operator--()
+    {
+        ptr_ -= stride_;
+        return *this;
+    }
+    StridedIterator operator--(int)
+    {
+        auto tmp = *this;
+        ptr_ -= stride_;
+        return tmp;
+    }
+    StridedIterator& operator+=(const difference_type n)
+    {
+        ptr_ += n * stride_;
+        return *this;
+    }
+    StridedIterator& operator-=(const difference_type n)
+    {
+        ptr_ -= n * stride_;
+        return *this;
+    }
+    StridedIterator operator+(const difference_type n) const { return StridedIterator(ptr_ + n * stride_, stride_); }
+    StridedIterator operator-(const difference_type n) const { return StridedIterator(ptr_ - n * stride_, stride_); }
+    friend StridedIterator operator+(const difference_type n, const StridedIterator& it) { return it + n; }
+    difference_type operator-(const StridedIterator& other) const { return (ptr_ - other.ptr_) / stride_; }
+
+    bool operator==(const StridedIterator& other) const { return ptr_ == other.ptr_; }
+    bool operator!=(const StridedIterator& other) const { return ptr_ != other.ptr_; }
+    bool operator<(const StridedIterator& other) const { return ptr_ < other.ptr_; }
+    bool operator>(const StridedIterator& other) const { return ptr_ > other.ptr_; }
+    bool operator<=(const StridedIterator& other) const { return ptr_ <= other.ptr_; }
+    bool operator>=(const StridedIterator& other) const { return ptr_ >= other.ptr_; }
+
   private:
-    std::int32_t m_{};
-    std::int32_t n_{};
-    std::int32_t p_{};
+    T* ptr_{nullptr};
+    std::ptrdiff_t stride_{1};
+};
 
+/// @brief Non-owning, stride aware view over a row or column of a Matrix
+///
+/// Rows have a stride of 1, columns a stride equal to the number of columns of the parent matrix. The view
+/// mirrors the subset of the std::vector interface used throughout the library so that code written against
+/// the old vector-of-vectors matrix keeps compiling.
+///
+/// @param T: template-parameter-typename (const qualified for read-only views)
+template <typename T>
+class VectorView
+{
   public:
-    // Default constructor
-    Matrix() = default;
+    using value_type = std::remove_const_t<T>;
+    using iterator = StridedIterator<T>;
+    using const_iterator = StridedIterator<const T>;
+
+    VectorView(T* data, const std::int32_t size, const std::int32_t stride = 1)
+        : data_(data), size_(size), stride_(stride)
+    {
+    }
+    VectorView(const VectorView& other) = default;
+
+    std::size_t size() const { return static_cast<std::size_t>(size_); }
+    bool empty() const { return size_ == 0; }
+    std::int32_t Stride() const { return stride_; }
+    T* data() const { return data_; }
+
+    T& operator[](const std::int32_t i) const { return data_[static_cast<std::ptrdiff_t>(i) * stride_]; }
+    T& at(const std::int32_t i) const
+    {
+        if (i < 0 || i >= size_)
+        {
+            throw std::out_of_range("VectorView index out of range.");
+        }
+        return (*this)[i];
+    }
+    T& front() const { return (*this)[0]; }
+    T& back() const { return (*this)[size_ - 1]; }
 
-    // Initializer-list constructor
-    Matrix(std::initializer_list<std::vector<T>> init) : std::vector<std::vector<T>>(init)
+    iterator begin() const { return iterator(data_, stride_); }
+    iterator end() const { return iterator(data_ + static_cast<std::ptrdiff_t>(size_) * stride_, stride_); }
+    const_iterator cbegin() const { return const_iterator(data_, stride_); }
+    const_iterator cend() const
     {
-        m_ = static_cast<std::int32_t>(this->size());
-        if (!this->at(0).empty())
+        return const_iterator(data_ + static_cast<std::ptrdiff_t>(size_) * stride_, stride_);
+    }
+
+    operator std::vector<value_type>() const { return std::vector<value_type>(cbegin(), cend()); }
+
+    template <typename InputIterator>
+    void assign(InputIterator first, InputIterator last)
+    {
+        static_assert(!std::is_const<T>::value, "Cannot assign through a read-only view");
+        if (std::distance(first, last) != static_cast<std::ptrdiff_t>(size_))
         {
-            n_ = this->at(0).size();
+            throw std::invalid_argument("Assigned range must match the length of the view.");
         }
-        else
+        std::copy(first, last, begin());
+    }
+
+    // Assignment copies elements into the viewed storage, it never rebinds the view
+    VectorView& operator=(const VectorView& other)
+    {
+        assign(other.cbegin(), other.cend());
+        return *this;
+    }
+
+    template <typename U>
+    VectorView& operator=(const VectorView<U>& other)
+    {
+        assign(other.cbegin(), other.cend());
+        return *this;
+    }
+
+    VectorView& operator=(const std::vector<value_type>& other)
+    {
+        assign(other.cbegin(), other.cend());
+        return *this;
+    }
+
+  private:
+    T* data_{nullptr};
+    std::int32_t size_{0};
+    std::int32_t stride_{1};
+};
+
+/// @brief Dense row-major matrix backed by a single contiguous, aligned buffer
+///
+/// Element (i, j) lives at Data()[i * NumberOfColumns() + j]. Rows and columns are exposed as VectorView's so
+/// that the row based interface of the previous vector-of-vectors implementation (at(i).at(j), push_back,
+/// range-for over rows) still works, while a matrix costs a single heap allocation.
+///
+/// @param T: template-parameter-typename
+template <typename T>
+class Matrix
+{
+  public:
+    using value_type = T;
+    using Storage = std::vector<T, AlignedAllocator<T>>;
+    using RowView = VectorView<T>;
+    using ConstRowView = VectorView<const T>;
+
+    template <typename MatrixType, typename ViewType>
+    class RowIterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ViewType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = ViewType;
+
+        RowIterator(MatrixType* matrix, const std::int32_t row) : matrix_(matrix), row_(row) {}
+        ViewType operator*() const { return matrix_->Row(row_); }
+        RowIterator& operator++()
+        {
+            ++row_;
+            return *this;
+        }
+        RowIterator operator++(int)
+        {
+            auto tmp = *this;
+            ++row_;
+            return tmp;
+        }
+        bool operator==(const RowIterator& other) const { return row_ == other.row_; }
+        bool operator!=(const RowIterator& other) const { return row_ != other.row_; }
+
+      private:
+        MatrixType* matrix_{nullptr};
+        std::int32_t row_{0};
+    };
+
+    using iterator = RowIterator<Matrix<T>, RowView>;
+    using const_iterator = RowIterator<const Matrix<T>, ConstRowView>;
+
+  public:
+    // Default constructor
+    Matrix() = default;
+
+    // Initializer-list constructor, one std::vector per row
+    Matrix(std::initializer_list<std::vector<T>> init)
+    {
+        const auto columns = init.size() > 0 ? static_cast<std::int32_t>(init.begin()->size()) : 0;
+        Reserve(static_cast<std::int32_t>(init.size()), columns);
+        for (const auto& row : init)
         {
-            n_ = 1;
+            push_back(row);
         }
     }
 
-    // Resize constuctor
+    // Resize constuctor, all elements are value initialized
     Matrix(const std::int32_t rows, const std::int32_t columns)
     {
         assert(rows > 0);
         assert(columns > 0);
 
-        this->resize(rows);
-        for (std::int32_t i{0}; i < rows; ++i)
+        Resize(rows, columns);
+    }
+
+    // Construct from a vector of row vectors
+    Matrix(const std::vector<std::vector<T>>& other)
+    {
+        const auto columns = other.empty() ? 0 : static_cast<std::int32_t>(other.front().size());
+        Reserve(static_cast<std::int32_t>(other.size()), columns);
+        for (const auto& row : other)
+        {
+            push_back(row);
+        }
+    }
+
+    // Construct by copying a row-major array
+    Matrix(const T* array_ptr, const std::int32_t number_of_rows, const std::int32_t number_of_columns)
+        : data_(array_ptr, array_ptr + static_cast<std::size_t>(number_of_rows) * number_of_columns),
+          m_(number_of_rows),
+          n_(number_of_columns)
+    {
+        assert(array_ptr != nullptr);
+        assert(number_of_rows > 0);
+        assert(number_of_columns > 0);
+    }
+
+    Matrix(const Matrix& other) = default;
+    Matrix(Matrix&& other) noexcept
+        : data_(std::move(other.data_)), m_(std::exchange(other.m_, 0)), n_(std::exchange(other.n_, 0))
+    {
+    }
+    Matrix& operator=(const Matrix& other) = default;
+    Matrix& operator=(Matrix&& other) noexcept
+    {
+        if (this != &other)
         {
-            this->at(i).resize(columns);
+            data_ = std::move(other.data_);
+            m_ = std::exchange(other.m_, 0);
+            n_ = std::exchange(other.n_, 0);
         }
+        return *this;
+    }
+    ~Matrix() = default;
+
+  public:
+    std::int32_t NumberOfRows() const { return m_; }
+    std::int32_t NumberOfColumns() const { return n_; }
+
+    /// @brief Raw access to the row-major buffer
+    T* Data() { return data_.data(); }
+    const T* Data() const { return data_.data(); }
+
+    /// @brief Unchecked element access, prefer this over at(i).at(j) in hot loops
+    T& operator()(const std::int32_t i, const std::int32_t j)
+    {
+        assert(i >= 0 && i < m_);
+        assert(j >= 0 && j < n_);
+        return data_[static_cast<std::size_t>(i) * n_ + j];
+    }
+    const T& operator()(const std::int32_t i, const std::int32_t j) const
+    {
+        assert(i >= 0 && i < m_);
+        assert(j >= 0 && j < n_);
+        return data_[static_cast<std::size_t>(i) * n_ + j];
+    }
+
+    RowView Row(const std::int32_t i) { return RowView(data_.data() + static_cast<std::size_t>(i) * n_, n_); }
+    ConstRowView Row(const std::int32_t i) const
+    {
+        return ConstRowView(data_.data() + static_cast<std::size_t>(i) * n_, n_);
+    }
+    RowView Column(const std::int32_t j) { return RowView(data_.data() + j, m_, n_); }
+    ConstRowView Column(const std::int32_t j) const { return ConstRowView(data_.data() + j, m_, n_); }
+
+    /// @brief Reshape to rows x columns, discarding the contents and zero initializing all elements
+    void Resize(const std::int32_t rows, const std::int32_t columns)
+    {
+        data_.assign(static_cast<std::size_t>(rows) * columns, T{});
         m_ = rows;
         n_ = columns;
     }
 
-    // Copy constructor
-    Matrix(const Matrix& other) : std::vector<std::vector<T>>(other)
+    /// @brief Fill every element with value
+    void Fill(const T& value) { std::fill(data_.begin(), data_.end(), value); }
+
+    // std::vector style row interface
+    std::size_t size() const { return static_cast<std::size_t>(m_); }
+    bool empty() const { return m_ == 0; }
+    void clear()
+    {
+        data_.clear();
+        m_ = 0;
+        n_ = 0;
+    }
+
+    /// @brief Changes the number of rows, keeping the number of columns
+    void resize(const std::int32_t rows)
+    {
+        data_.resize(static_cast<std::size_t>(rows) * n_);
+        m_ = rows;
+    }
+
+    /// @brief Appends a row, the first row appended to an empty matrix fixes the number of columns
+    template <typename Row>
+    void push_back(const Row& row)
     {
-        m_ = static_cast<std::int32_t>(this->size());
-        if (m_ > 0)
+        const auto row_size = static_cast<std::int32_t>(std::size(row));
+        if (m_ == 0)
         {
-            n_ = static_cast<std::int32_t>(this->at(0).size());
+            n_ = row_size;
         }
-        else
+        else if (row_size != n_)
         {
-            n_ = 1;
+            throw std::invalid_argument("All rows of a matrix must have the same length.");
         }
+        data_.insert(data_.end(), std::cbegin(row), std::cend(row));
+        ++m_;
     }
 
-    // Copy assignment operator
-    Matrix& operator=(const Matrix& other)
+    RowView at(const std::int32_t i)
     {
-        std::vector<std::vector<T>>::operator=(other);
-        m_ = static_cast<std::int32_t>(this->size());
-        if (!this->at(0).empty())
+        CheckRowIndex(i);
+        return Row(i);
+    }
+    ConstRowView at(const std::int32_t i) const
+    {
+        CheckRowIndex(i);
+        return Row(i);
+    }
+    RowView operator[](const std::int32_t i) { return Row(i); }
+    ConstRowView operator[](const std::int32_t i) const { return Row(i); }
+    RowView front() { return Row(0); }
+    ConstRowView front() const { return Row(0); }
+    RowView back() { return Row(m_ - 1); }
+    ConstRowView back() const { return Row(m_ - 1); }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_); }
+
+    Matrix<T>& operator+=(const Matrix<T>& other)
+    {
+        if (m_ != other.m_ || n_ != other.n_)
         {
-            n_ = this->at(0).size();
+            throw std::invalid_argument("Matrix dimensions must match for addition.");
         }
-        else
+        for (std::size_t k{0}; k < data_.size(); ++k)
         {
-            n_ = 1;
+            data_[k] += other.data_[k];
         }
         return *this;
     }
 
-    // Move Constructor
-    Matrix(Matrix<T>&& other) noexcept : std::vector<std::vector<T>>(std::move(other))
+    Matrix<T>& operator-=(const Matrix<T>& other)
     {
-        m_ = static_cast<std::int32_t>(this->size());
-        if (!this->empty())
+        if (m_ != other.m_ || n_ != other.n_)
         {
-            n_ = this->at(0).size();
+            throw std::invalid_argument("Matrix dimensions must match for addition.");
         }
-        else
+        for (std::size_t k{0}; k < data_.size(); ++k)
         {
-            n_ = 0;
+            data_[k] -= other.data_[k];
         }
+        return *this;
     }
 
-    // Other constructors and operators
-    Matrix(const std::vector<std::vector<T>>& other) { this->assign(other.begin(), other.end()); }
-    Matrix(T* array_ptr, const std::int32_t number_of_rows, const std::int32_t number_of_columns)
+    Matrix<T>& operator*=(const T& scalar_value)
     {
-        assert(array_ptr != nullptr);
-        assert(number_of_rows > 0);
-        assert(number_of_columns > 0);
-
-        this->resize(number_of_rows);
-        for (std::int32_t i{0}; i < number_of_rows; ++i)
+        for (auto& element : data_)
         {
-            this->at(i).resize(number_of_columns);
-            this->at(i) = std::vector<T>(array_ptr + (number_of_columns * i),
-                                         array_ptr + (number_of_columns * i + number_of_columns));
+            element *= scalar_value;
         }
+        return *this;
     }
 
-    std::int32_t NumberOfRows() const { return m_; }
-    std::int32_t NumberOfColumns() const { return n_; }
-
     Matrix<T> operator+(const Matrix<T>& other) const
     {
-        const auto m = static_cast<std::int32_t>(this->size());
-        const auto n = static_cast<std::int32_t>(this->at(0).size());
-        const auto other_m = static_cast<std::int32_t>(other.size());
-        const auto other_n = static_cast<std::int32_t>(other.at(0).size());
-        if (m != other_m || n != other_n)
-        {
-            throw std::invalid_argument("Matrix dimensions must match for addition.");
-        }
         Matrix<T> result = *this;
-        for (std::int32_t i{0}; i < m; ++i)
-        {
-            result.at(i) = AddVectors(this->at(i), other.at(i));
-        }
+        result += other;
         return result;
     }
 
     Matrix<T> operator-(const Matrix<T>& other) const
     {
-        const auto m = static_cast<std::int32_t>(this->size());
-        const auto n = static_cast<std::int32_t>(this->at(0).size());
-        const auto other_m = static_cast<std::int32_t>(other.size());
-        const auto other_n = static_cast<std::int32_t>(other.at(0).size());
-
-        if (m != other_m || n != other_n)
-        {
-            throw std::invalid_argument("Matrix dimensions must match for addition.");
-        }
         Matrix<T> result = *this;
-        for (std::int32_t i{0}; i < m; ++i)
-        {
-            result.at(i) = AddVectors(this->at(i), ScalarMultiply(-1, other.at(i)));
-        }
+        result -= other;
         return result;
     }
 
     void TransposeInPlace()
     {
-        const auto rows = static_cast<std::int32_t>(this->size());
-        assert(rows > 0);
+        assert(m_ > 0);
+        assert(n_ > 0);
 
-        const auto columns = static_cast<std::int32_t>(this->at(0).size());
-        assert(columns > 0);
+        if (m_ != n_)
+        {
+            *this = Transpose();
+            return;
+        }
 
-        for (std::int32_t i{0}; i < rows; ++i)
+        for (std::int32_t i{0}; i < m_; ++i)
         {
-            for (std::int32_t j{i}; j < columns; ++j)
+            for (std::int32_t j{i + 1}; j < n_; ++j)
             {
-                if (i == j)
-                {
-                    continue;
-                }
-                else
-                {
-                    const auto tmp = this->at(i).at(j);
-                    this->at(i).at(j) = this->at(j).at(i);
-                    this->at(j).at(i) = tmp;
-                }
+                std::swap((*this)(i, j), (*this)(j, i));
             }
         }
     }
 
     Matrix<T> Transpose() const
     {
-        const auto rows = static_cast<std::int32_t>(this->size());
-        assert(rows > 0);
+        assert(m_ > 0);
+        assert(n_ > 0);
 
-        const auto columns = static_cast<std::int32_t>(this->at(0).size());
-        assert(columns > 0);
-
-        Matrix<T> result{};
-        result.resize(columns);
-
-        for (std::int32_t i{0}; i < rows; ++i)
+        // Walk the matrix in square tiles so that both the reads and the writes stay in cache
+        constexpr std::int32_t kTile{32};
+        Matrix<T> result(n_, m_);
+        for (std::int32_t ii{0}; ii < m_; ii += kTile)
         {
-            for (std::int32_t j{0}; j < columns; ++j)
+            const auto i_end = std::min(ii + kTile, m_);
+            for (std::int32_t jj{0}; jj < n_; jj += kTile)
             {
-                result.at(j).resize(rows);
-                if (i == j)
+                const auto j_end = std::min(jj + kTile, n_);
+                for (std::int32_t i{ii}; i < i_end; ++i)
                 {
-                    result.at(i).at(j) = this->at(i).at(j);
-                }
-                else
-                {
-                    result.at(j).at(i) = this->at(i).at(j);
+                    for (std::int32_t j{jj}; j < j_end; ++j)
+                    {
+                        result(j, i) = (*this)(i, j);
+                    }
                 }
             }
         }
         return result;
     }
+
+  private:
+    void Reserve(const std::int32_t rows, const std::int32_t columns)
+    {
+        data_.reserve(static_cast<std::size_t>(rows) * columns);
+    }
+
+    void CheckRowIndex(const std::int32_t i) const
+    {
+        if (i < 0 || i >= m_)
+        {
+            throw std::out_of_range("Matrix row index out of range.");
+        }
+    }
+
+  private:
+    Storage data_{};
+    std::int32_t m_{};
+    std::int32_t n_{};
 };
 
 /// @brief Identity Square Matrix Constructor
@@ -253,17 +604,17 @@ Matrix<T> CreateIdentityMatrix(const std::int32_t size)
     Matrix<T> I(size, size);
     for (std::int32_t i{0}; i < size; ++i)
     {
-        I.at(i).at(i) = static_cast<T>(1);
+        I(i, i) = static_cast<T>(1);
     }
 
     return I;
 }
 
-/// @brief Print a std vector
+/// @brief Print a std vector or a matrix row/column view
 ///
-/// @param vector: a std::vector
-template <typename T>
-void PrintVector(const std::vector<T>& vector)
+/// @param vector: a std::vector or VectorView
+template <typename Vector>
+void PrintVector(const Vector& vector)
 {
     for (const auto& element : vector)
     {
@@ -278,7 +629,7 @@ void PrintVector(const std::vector<T>& vector)
 template <typename T>
 void PrintMatrix(const Matrix<T>& matrix)
 {
-    for (const auto& row : matrix)
+    for (const auto row : matrix)
     {
         PrintVector(row);
     }
@@ -307,21 +658,14 @@ Matrix<double> ScalarMultiply(const double scalar_value, const nm::matrix::Matri
 template <typename T>
 std::vector<T> ToStdVectorRowBased(const Matrix<T>& A)
 {
-    const auto m = static_cast<std::int32_t>(A.size());
+    const auto m = A.NumberOfRows();
     assert(m > 0);
 
-    const auto n = static_cast<std::int32_t>(A.at(0).size());
+    const auto n = A.NumberOfColumns();
     assert(n > 0);
 
-    std::vector<T> result{};
-    result.reserve(m * n);
-
-    for (std::int32_t i{0}; i < m; ++i)
-    {
-        std::transform(
-            A.at(i).cbegin(), A.at(i).cend(), std::back_inserter(result), [](const T& value) { return value; });
-    }
-    return result;
+    // Storage is already row-major, so this is a single contiguous copy
+    return std::vector<T>(A.Data(), A.Data() + static_cast<std::size_t>(m) * n);
 }
 
 }  // namespace matrix
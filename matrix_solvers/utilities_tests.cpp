@@ -9,6 +9,7 @@
 #include "matrix_solvers/utilities.h"
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <stdexcept>
 #include <vector>
 
 namespace nm
@@ -278,6 +279,131 @@ TEST(DevectorizeTests, GivenVectorAndColumnHeight_ExpectCorrectMatrix)
     EXPECT_NEAR(result.at(1).at(1), 5, tolerance);
 }
 
+TEST_F(MatrixUtilitiesTestFixture, GivenMatrix_ExpectContiguousRowMajorStorage)
+{
+    // Call
+    const auto* data = A_.Data();
+
+    // Expect
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(data) % kMatrixAlignment, 0U);
+    for (std::int32_t i{0}; i < A_.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < A_.NumberOfColumns(); ++j)
+        {
+            EXPECT_EQ(&A_(i, j), data + i * A_.NumberOfColumns() + j);
+            EXPECT_NEAR(A_(i, j), A_.at(i).at(j), tolerance_);
+        }
+    }
+}
+
+TEST_F(MatrixUtilitiesTestFixture, GivenColumnView_ExpectStridedAccessIntoMatrix)
+{
+    // Call
+    auto column = A_.Column(2);
+    column[1] = 7.0;
+
+    // Expect
+    const std::vector<double> expected_column{1.0, 7.0, 1.0, 2.0};
+    EXPECT_EQ(static_cast<std::vector<double>>(column), expected_column);
+    EXPECT_NEAR(A_.at(1).at(2), 7.0, tolerance_);
+}
+
+TEST_F(MatrixUtilitiesTestFixture, GivenRowAssignment_ExpectElementsCopiedIntoMatrix)
+{
+    // Call
+    A_.at(0) = B_.at(2);
+
+    // Expect
+    EXPECT_NEAR(A_(0, 0), 4.0, tolerance_);
+    EXPECT_NEAR(A_(0, 1), 2.0, tolerance_);
+    EXPECT_NEAR(A_(0, 2), 2.0, tolerance_);
+    EXPECT_NEAR(B_(2, 0), 4.0, tolerance_);
+}
+
+TEST_F(MatrixUtilitiesTestFixture, GivenRowsOfDifferentLengths_ExpectException)
+{
+    // Call and Expect
+    const std::vector<double> short_row{1.0, 2.0};
+    EXPECT_THROW(A_.push_back(short_row), std::invalid_argument);
+    EXPECT_THROW(A_.at(0) = short_row, std::invalid_argument);
+    EXPECT_THROW(A_.at(4), std::out_of_range);
+}
+
+TEST_F(MatrixUtilitiesTestFixture, GivenNonSquareMatrix_ExpectTransposeInPlaceSwapsDimensions)
+{
+    // Call
+    A_.TransposeInPlace();
+
+    // Expect
+    ASSERT_EQ(A_.NumberOfRows(), 3);
+    ASSERT_EQ(A_.NumberOfColumns(), 4);
+    EXPECT_NEAR(A_(0, 1), 2.0, tolerance_);
+    EXPECT_NEAR(A_(2, 3), 2.0, tolerance_);
+}
+
+TEST_F(MatrixUtilitiesTestFixture, GivenMatricesOfSameShape_ExpectCompoundAssignmentInPlace)
+{
+    // Given
+    Matrix<double> C = B_;
+    const auto* data = C.Data();
+
+    // Call
+    C += B_;
+    C *= 0.5;
+    C -= B_;
+
+    // Expect
+    EXPECT_EQ(C.Data(), data);
+    for (std::int32_t i{0}; i < C.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < C.NumberOfColumns(); ++j)
+        {
+            EXPECT_NEAR(C(i, j), 0.0, tolerance_);
+        }
+    }
+    EXPECT_THROW(A_ += B_, std::invalid_argument);
+}
+
+TEST(VectorUpdateTests, GivenVectors_ExpectAxpyAxpbyAndScalUpdateInPlace)
+{
+    // Given
+    const std::vector<double> x{1.0, 2.0, 3.0};
+    std::vector<double> y{1.0, 1.0, 1.0};
+    const double tolerance{1e-12};
+
+    // Call
+    Axpy(2.0, x, y);
+
+    // Expect
+    EXPECT_NEAR(y.at(0), 3.0, tolerance);
+    EXPECT_NEAR(y.at(2), 7.0, tolerance);
+
+    // Call
+    Axpby(1.0, x, -1.0, y);
+
+    // Expect
+    EXPECT_NEAR(y.at(0), -2.0, tolerance);
+    EXPECT_NEAR(y.at(2), -4.0, tolerance);
+
+    // Call
+    Scal(-0.5, y);
+
+    // Expect
+    EXPECT_NEAR(y.at(0), 1.0, tolerance);
+    EXPECT_NEAR(y.at(2), 2.0, tolerance);
+}
+
+TEST(VectorUpdateTests, GivenVectorsOfDifferentLengths_ExpectException)
+{
+    // Given
+    const std::vector<double> x{1.0, 2.0, 3.0};
+    std::vector<double> y{1.0, 1.0};
+
+    // Call & Expect
+    EXPECT_THROW(Axpy(1.0, x, y), std::length_error);
+    EXPECT_THROW(Axpby(1.0, x, 1.0, y), std::length_error);
+}
+
 struct ToStdVectorTestParameter
 {
     Matrix<double> matrix{};
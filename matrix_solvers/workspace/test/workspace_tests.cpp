@@ -0,0 +1,214 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/iterative_solvers/conjugate_gradient.h"
+#include "matrix_solvers/iterative_solvers/gmres.h"
+#include "matrix_solvers/iterative_solvers/jacobi.h"
+#include "matrix_solvers/linear_operators/linear_operator.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/workspace/workspace.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+TEST(WorkspaceTest, GivenReleasedBuffer_ExpectReuseWithoutAllocation)
+{
+    // Given
+    Workspace workspace{};
+    const double* first_data{nullptr};
+    {
+        auto lease = workspace.Acquire(100);
+        (*lease)[3] = 7.0;
+        first_data = lease->data();
+    }
+
+    // Call
+    auto lease = workspace.Acquire(80);
+
+    // Expect, the same buffer handed out again, zeroed like a new vector
+    EXPECT_EQ(lease->data(), first_data);
+    EXPECT_EQ(lease->size(), 80U);
+    EXPECT_EQ((*lease)[3], 0.0);
+    EXPECT_EQ(workspace.Stats().acquisitions, 2U);
+    EXPECT_EQ(workspace.Stats().allocations, 1U);
+}
+
+TEST(WorkspaceTest, GivenSeveralIdleBuffers_ExpectSmallestSufficientOneReused)
+{
+    // Given
+    Workspace workspace{};
+    const double* small_data{nullptr};
+    {
+        auto large = workspace.Acquire(1000);
+        auto small = workspace.Acquire(10);
+        small_data = small->data();
+    }
+
+    // Call
+    auto lease = workspace.Acquire(10);
+
+    // Expect
+    EXPECT_EQ(lease->data(), small_data);
+    EXPECT_EQ(workspace.Stats().allocations, 2U);
+}
+
+TEST(WorkspaceTest, GivenNestedLeases_ExpectHighWaterMarkOfPeakUse)
+{
+    // Given
+    Workspace workspace{};
+
+    // Call
+    {
+        auto a = workspace.Acquire(10);
+        {
+            auto b = workspace.Acquire(20);
+            auto c = workspace.Acquire(30);
+        }
+        auto d = workspace.Acquire(5);
+    }
+
+    // Expect
+    const auto& stats = workspace.Stats();
+    EXPECT_EQ(stats.buffers_in_use, 0U);
+    EXPECT_EQ(stats.bytes_in_use, 0U);
+    EXPECT_EQ(stats.high_water_mark_buffers, 3U);
+    EXPECT_EQ(stats.high_water_mark_bytes, 60 * sizeof(double));
+    EXPECT_EQ(stats.bytes_reserved, 60 * sizeof(double));
+    EXPECT_EQ(stats.allocations, 3U);
+
+    // Call
+    workspace.Release();
+
+    // Expect
+    EXPECT_EQ(workspace.Stats().bytes_reserved, 0U);
+}
+
+TEST(WorkspaceTest, GivenMovedLease_ExpectBufferReturnedOnce)
+{
+    // Given
+    Workspace workspace{};
+
+    // Call
+    {
+        auto lease = workspace.Acquire(8);
+        auto moved = std::move(lease);
+        EXPECT_EQ(workspace.Stats().buffers_in_use, 1U);
+    }
+
+    // Expect
+    EXPECT_EQ(workspace.Stats().buffers_in_use, 0U);
+    EXPECT_EQ(workspace.Stats().bytes_reserved, 8 * sizeof(double));
+}
+
+TEST(WorkspaceTest, GivenScopedWorkspace_ExpectCurrentWorkspaceRedirectedPerThread)
+{
+    // Given
+    Workspace workspace{};
+    auto* const default_workspace = &CurrentWorkspace();
+
+    // Call, Expect
+    {
+        const ScopedWorkspace scope{workspace};
+        EXPECT_EQ(&CurrentWorkspace(), &workspace);
+
+        Workspace* other_thread_workspace{nullptr};
+        std::thread thread{[&other_thread_workspace]() { other_thread_workspace = &CurrentWorkspace(); }};
+        thread.join();
+        EXPECT_NE(other_thread_workspace, &workspace);
+    }
+    EXPECT_EQ(&CurrentWorkspace(), default_workspace);
+}
+
+/// @brief The 1D Poisson matrix
+CsrMatrix CreatePoissonMatrix(const std::int32_t n)
+{
+    CooMatrix coo(n, n);
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        coo.Add(i, i, 2.0);
+        if (i > 0)
+        {
+            coo.Add(i, i - 1, -1.0);
+            coo.Add(i - 1, i, -1.0);
+        }
+    }
+    return CsrMatrix{coo};
+}
+
+TEST(WorkspaceTest, GivenRepeatedSolves_ExpectOnlyFirstSolveAllocates)
+{
+    // Given
+    constexpr std::int32_t n{50};
+    const auto A = CreatePoissonMatrix(n);
+    const std::vector<double> b(n, 1.0);
+    Workspace workspace{};
+    const ScopedWorkspace scope{workspace};
+
+    // Call
+    std::vector<double> x(n, 0.0);
+    ConjugateGradient(A, b, x, 1e-10, 1000);
+    const auto first_solve = workspace.Stats();
+    for (std::int32_t solve{0}; solve < 5; ++solve)
+    {
+        std::vector<double> x_again(n, 0.0);
+        ConjugateGradient(A, b, x_again, 1e-10, 1000);
+    }
+
+    // Expect
+    EXPECT_GT(first_solve.allocations, 0U);
+    EXPECT_EQ(workspace.Stats().allocations, first_solve.allocations);
+    EXPECT_EQ(workspace.Stats().acquisitions, 6 * first_solve.acquisitions);
+    EXPECT_EQ(workspace.Stats().high_water_mark_bytes, first_solve.high_water_mark_bytes);
+    EXPECT_EQ(workspace.Stats().buffers_in_use, 0U);
+}
+
+TEST(WorkspaceTest, GivenRepeatedGMRESAndJacobiSolves_ExpectOnlyFirstSolvesAllocate)
+{
+    // Given
+    constexpr std::int32_t n{50};
+    const auto A = CreatePoissonMatrix(n);
+    const SparseMatrixOperator A_operator{A};
+    const std::vector<double> b(n, 1.0);
+    Workspace workspace{};
+    const ScopedWorkspace scope{workspace};
+    const auto solve = [&]() {
+        std::vector<double> x(n, 0.0);
+        GMRES(A, b, x, 1e-10, 1000, 10);
+        std::vector<double> x_jacobi(n, 0.0);
+        Jacobi(A_operator, b, x_jacobi, 10, 1e-10);
+        Jacobi(A_operator, b, x_jacobi);
+    };
+
+    // Call
+    solve();
+    const auto first_solve = workspace.Stats();
+    for (std::int32_t repeat{0}; repeat < 5; ++repeat)
+    {
+        solve();
+    }
+
+    // Expect
+    EXPECT_GT(first_solve.allocations, 0U);
+    EXPECT_EQ(workspace.Stats().allocations, first_solve.allocations);
+    EXPECT_EQ(workspace.Stats().acquisitions, 6 * first_solve.acquisitions);
+    EXPECT_EQ(workspace.Stats().buffers_in_use, 0U);
+}
+
+}  // namespace
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,158 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "matrix_solvers/workspace/workspace.h"
+#include <algorithm>
+#include <utility>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+namespace
+{
+
+// Set by ScopedWorkspace, otherwise the solvers of the thread use its default workspace
+thread_local Workspace* scoped_workspace{nullptr};
+
+std::size_t CapacityInBytes(const std::vector<double>& buffer)
+{
+    return buffer.capacity() * sizeof(double);
+}
+
+}  // namespace
+
+Workspace::Lease::Lease(Workspace* workspace, std::vector<double>&& buffer, const std::size_t leased_bytes)
+    : workspace_(workspace), buffer_(std::move(buffer)), leased_bytes_(leased_bytes)
+{
+}
+
+Workspace::Lease::Lease(Lease&& other) noexcept
+    : workspace_(std::exchange(other.workspace_, nullptr)),
+      buffer_(std::move(other.buffer_)),
+      leased_bytes_(other.leased_bytes_)
+{
+}
+
+Workspace::Lease& Workspace::Lease::operator=(Lease&& other) noexcept
+{
+    if (this != &other)
+    {
+        Return();
+        workspace_ = std::exchange(other.workspace_, nullptr);
+        buffer_ = std::move(other.buffer_);
+        leased_bytes_ = other.leased_bytes_;
+    }
+    return *this;
+}
+
+Workspace::Lease::~Lease()
+{
+    Return();
+}
+
+void Workspace::Lease::Return()
+{
+    if (workspace_)
+    {
+        workspace_->Return(std::move(buffer_), leased_bytes_);
+        workspace_ = nullptr;
+    }
+}
+
+Workspace::Lease Workspace::Acquire(const std::size_t size)
+{
+    ++stats_.acquisitions;
+
+    // Best fit among the idle buffers, otherwise the largest one, which is the cheapest to grow
+    auto best_fit = idle_buffers_.end();
+    auto largest = idle_buffers_.end();
+    for (auto it = idle_buffers_.begin(); it != idle_buffers_.end(); ++it)
+    {
+        if (it->capacity() >= size && (best_fit == idle_buffers_.end() || it->capacity() < best_fit->capacity()))
+        {
+            best_fit = it;
+        }
+        if (largest == idle_buffers_.end() || it->capacity() > largest->capacity())
+        {
+            largest = it;
+        }
+    }
+    const auto chosen = (best_fit != idle_buffers_.end()) ? best_fit : largest;
+
+    std::vector<double> buffer{};
+    if (chosen != idle_buffers_.end())
+    {
+        // Moving the last idle buffer into the gap keeps idle_buffers_ dense without shifting it
+        buffer = std::move(*chosen);
+        if (chosen != idle_buffers_.end() - 1)
+        {
+            *chosen = std::move(idle_buffers_.back());
+        }
+        idle_buffers_.pop_back();
+    }
+
+    const auto bytes_before = CapacityInBytes(buffer);
+    buffer.assign(size, 0.0);
+    const auto bytes_after = CapacityInBytes(buffer);
+    if (bytes_after > bytes_before)
+    {
+        ++stats_.allocations;
+    }
+    stats_.bytes_reserved = stats_.bytes_reserved - bytes_before + bytes_after;
+
+    stats_.bytes_in_use += bytes_after;
+    ++stats_.buffers_in_use;
+    stats_.high_water_mark_bytes = std::max(stats_.high_water_mark_bytes, stats_.bytes_in_use);
+    stats_.high_water_mark_buffers = std::max(stats_.high_water_mark_buffers, stats_.buffers_in_use);
+
+    return Lease{this, std::move(buffer), bytes_after};
+}
+
+void Workspace::Return(std::vector<double>&& buffer, const std::size_t leased_bytes)
+{
+    // The capacity may have changed while leased, e.g. when the buffer was swapped with a vector of the caller
+    stats_.bytes_reserved = stats_.bytes_reserved - leased_bytes + CapacityInBytes(buffer);
+    stats_.bytes_in_use -= leased_bytes;
+    --stats_.buffers_in_use;
+    idle_buffers_.push_back(std::move(buffer));
+}
+
+void Workspace::ResetStats()
+{
+    stats_.acquisitions = 0;
+    stats_.allocations = 0;
+    stats_.high_water_mark_bytes = stats_.bytes_in_use;
+    stats_.high_water_mark_buffers = stats_.buffers_in_use;
+}
+
+void Workspace::Release()
+{
+    idle_buffers_.clear();
+    idle_buffers_.shrink_to_fit();
+    stats_.bytes_reserved = stats_.bytes_in_use;
+}
+
+Workspace& CurrentWorkspace()
+{
+    thread_local Workspace default_workspace{};
+    return scoped_workspace ? *scoped_workspace : default_workspace;
+}
+
+ScopedWorkspace::ScopedWorkspace(Workspace& workspace) : previous_(scoped_workspace)
+{
+    scoped_workspace = &workspace;
+}
+
+ScopedWorkspace::~ScopedWorkspace()
+{
+    scoped_workspace = previous_;
+}
+
+}  // namespace matrix
+
+}  // namespace nm
@@ -0,0 +1,124 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Pool of scratch vectors reused by the solvers from one solve to the next
+ */
+
+#ifndef MATRIX_SOLVERS_WORKSPACE_WORKSPACE_H
+#define MATRIX_SOLVERS_WORKSPACE_WORKSPACE_H
+
+#include <cstddef>
+#include <vector>
+
+namespace nm
+{
+
+namespace matrix
+{
+
+/// @brief Usage of a Workspace since it was created or last reset, sizes are in bytes of buffer capacity
+struct WorkspaceStats
+{
+    // Buffers handed out by Acquire
+    std::size_t acquisitions{0};
+    // Acquisitions no idle buffer was large enough for, each one allocated a buffer or grew one
+    std::size_t allocations{0};
+
+    // Capacity of every buffer the workspace owns, idle or leased
+    std::size_t bytes_reserved{0};
+    std::size_t bytes_in_use{0};
+    std::size_t buffers_in_use{0};
+
+    // Largest bytes_in_use and buffers_in_use seen, what a solver needs at its peak
+    std::size_t high_water_mark_bytes{0};
+    std::size_t high_water_mark_buffers{0};
+};
+
+/// @brief Arena of std::vector<double> scratch buffers, sized by the first solve and reused by every later one
+///
+/// A solver acquires its residuals, directions and stage vectors here instead of constructing them, and returns them
+/// when its leases go out of scope. Once the workspace has seen the largest solve of a simulation, later solves find
+/// an idle buffer of sufficient capacity for every request and the allocation count stays flat. A workspace is not
+/// thread safe, every thread has its own CurrentWorkspace().
+class Workspace
+{
+  public:
+    /// @brief Exclusive use of one buffer of the workspace, returned to it on destruction
+    ///
+    /// A lease must not outlive its workspace.
+    class Lease
+    {
+      public:
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        ~Lease();
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        std::vector<double>& operator*() { return buffer_; }
+        std::vector<double>* operator->() { return &buffer_; }
+
+      private:
+        friend class Workspace;
+        Lease(Workspace* workspace, std::vector<double>&& buffer, const std::size_t leased_bytes);
+        void Return();
+
+        Workspace* workspace_{nullptr};
+        std::vector<double> buffer_{};
+        // Capacity when leased, what the buffer added to WorkspaceStats::bytes_in_use
+        std::size_t leased_bytes_{0};
+    };
+
+    Workspace() = default;
+
+    Workspace(const Workspace&) = delete;
+    Workspace& operator=(const Workspace&) = delete;
+
+    /// @brief A buffer of size zeros, the same contents as std::vector<double>(size)
+    ///
+    /// The smallest idle buffer of sufficient capacity is reused, only when none is left a buffer is allocated or the
+    /// largest idle one is grown.
+    Lease Acquire(const std::size_t size);
+
+    const WorkspaceStats& Stats() const { return stats_; }
+
+    /// @brief Zeroes the counters and restarts the high water marks from the current use, keeps every buffer
+    void ResetStats();
+
+    /// @brief Frees the idle buffers, e.g. after a solve much larger than the ones that follow
+    void Release();
+
+  private:
+    void Return(std::vector<double>&& buffer, const std::size_t leased_bytes);
+
+    std::vector<std::vector<double>> idle_buffers_{};
+    WorkspaceStats stats_{};
+};
+
+/// @brief Workspace the solvers of the calling thread acquire their scratch vectors from
+///
+/// A thread local default unless a ScopedWorkspace is alive on the thread.
+Workspace& CurrentWorkspace();
+
+/// @brief Makes workspace the CurrentWorkspace() of the calling thread for as long as it is alive, e.g. to measure the
+/// scratch memory of one part of a simulation or to free it together with that part
+class ScopedWorkspace
+{
+  public:
+    explicit ScopedWorkspace(Workspace& workspace);
+    ~ScopedWorkspace();
+
+    ScopedWorkspace(const ScopedWorkspace&) = delete;
+    ScopedWorkspace& operator=(const ScopedWorkspace&) = delete;
+
+  private:
+    Workspace* previous_{nullptr};
+};
+
+}  // namespace matrix
+
+}  // namespace nm
+
+#endif  // MATRIX_SOLVERS_WORKSPACE_WORKSPACE_H
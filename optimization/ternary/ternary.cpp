@@ -5,7 +5,6 @@
  */
 
 #include "optimization/ternary/ternary.h"
-#include <iostream>
 
 namespace nm
 {
@@ -50,13 +49,8 @@ double ternary_min_search(std::function<double(double)>& function,
 
         if (residual < tolerance)
         {
-            std::cout << "Ternary search converged in " << iteration + 1 << " iterations\n";
             return (upper_bound + lower_bound) / 2.0;
         }
-        if (iteration == max_iterations)
-        {
-            std::cout << "WARNING: Ternary search reached max iterations\n";
-        }
     }
     return (upper_bound + lower_bound) / 2.0;
 }
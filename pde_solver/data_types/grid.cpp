@@ -5,6 +5,12 @@
 ///
 
 #include "pde_solver/data_types/grid.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <utility>
 
 namespace pde
 {
@@ -12,14 +18,124 @@ namespace pde
 namespace geometry
 {
 
+Grid::Grid(std::vector<std::int32_t> connectivity,
+           const std::int32_t nodes_per_element,
+           std::vector<double> x,
+           std::vector<double> y,
+           std::vector<double> z)
+    : x_(std::move(x)),
+      y_(std::move(y)),
+      z_(std::move(z)),
+      connectivity_(std::move(connectivity)),
+      nodes_per_element_(nodes_per_element)
+{
+    if (nodes_per_element_ <= 0)
+    {
+        throw std::invalid_argument("Grid: elements need at least one node");
+    }
+    if (y_.empty() && !z_.empty())
+    {
+        throw std::invalid_argument("Grid: a 3D grid needs y coordinates");
+    }
+    if ((!y_.empty() && y_.size() != x_.size()) || (!z_.empty() && z_.size() != x_.size()))
+    {
+        throw std::length_error("Grid: every coordinate array needs one entry per node");
+    }
+    if (connectivity_.size() % static_cast<std::size_t>(nodes_per_element_) != 0)
+    {
+        throw std::length_error("Grid: the connectivity is not a whole number of elements");
+    }
+    const auto number_of_nodes = GetNumberOfNodes();
+    if (std::any_of(connectivity_.cbegin(),
+                    connectivity_.cend(),
+                    [number_of_nodes](const std::int32_t node) { return node < 0 || node >= number_of_nodes; }))
+    {
+        throw std::invalid_argument("Grid: the connectivity refers to a node that does not exist");
+    }
+
+    dimension_ = static_cast<std::int8_t>(x_.empty() ? 0 : (z_.empty() ? (y_.empty() ? 1 : 2) : 3));
+    boundary_nodes_.assign(x_.size(), false);
+    boundary_elements_.assign(static_cast<std::size_t>(GetNumberOfElements()), false);
+}
+
+Grid::Grid(const std::vector<Element>& elements)
+{
+    if (elements.empty())
+    {
+        return;
+    }
+    nodes_per_element_ = static_cast<std::int32_t>(elements.front().GetNodes().size());
+    if (nodes_per_element_ == 0)
+    {
+        throw std::invalid_argument("Grid: every element needs the same, non zero, number of nodes");
+    }
+    const auto first_values = elements.front().GetNodes().front().GetValues();
+    dimension_ = static_cast<std::int8_t>(
+        std::count_if(first_values.cbegin(), first_values.cend(), [](const auto& value) { return value.has_value(); }));
+
+    std::map<std::array<double, 3>, std::int32_t> node_indices{};
+    connectivity_.reserve(elements.size() * static_cast<std::size_t>(nodes_per_element_));
+    boundary_elements_.reserve(elements.size());
+    for (const auto& element : elements)
+    {
+        if (element.GetNodes().size() != static_cast<std::size_t>(nodes_per_element_))
+        {
+            throw std::invalid_argument("Grid: every element needs the same, non zero, number of nodes");
+        }
+        boundary_elements_.push_back(element.IsOnBoundary());
+        for (const auto& node : element.GetNodes())
+        {
+            const auto values = node.GetValues();
+            const std::array<double, 3> coordinates{
+                values[0].value_or(0.0), values[1].value_or(0.0), values[2].value_or(0.0)};
+            const auto inserted = node_indices.emplace(coordinates, GetNumberOfNodes());
+            if (inserted.second)
+            {
+                x_.push_back(coordinates[0]);
+                if (dimension_ >= 2)
+                {
+                    y_.push_back(coordinates[1]);
+                }
+                if (dimension_ == 3)
+                {
+                    z_.push_back(coordinates[2]);
+                }
+                boundary_nodes_.push_back(false);
+            }
+            const auto index = inserted.first->second;
+            connectivity_.push_back(index);
+            if (node.IsOnBoundary())
+            {
+                boundary_nodes_[static_cast<std::size_t>(index)] = true;
+            }
+        }
+    }
+}
+
 std::int32_t Grid::GetNumberOfElements() const
 {
-    return static_cast<std::int32_t>(elements_.size());
+    return static_cast<std::int32_t>(connectivity_.size() / static_cast<std::size_t>(nodes_per_element_));
+}
+
+double Grid::GetElementLength(const std::int32_t element) const
+{
+    return std::abs(x_[static_cast<std::size_t>(GetElementNode(element, 1))] -
+                    x_[static_cast<std::size_t>(GetElementNode(element, 0))]);
+}
+
+void Grid::SetBoundaryNode(const std::int32_t node, const bool is_on_boundary)
+{
+    boundary_nodes_[static_cast<std::size_t>(node)] = is_on_boundary;
+}
+
+void Grid::SetBoundaryElement(const std::int32_t element, const bool is_on_boundary)
+{
+    boundary_elements_[static_cast<std::size_t>(element)] = is_on_boundary;
 }
 
-std::int32_t Grid::GetNumberOfNodes() const
+std::int32_t Grid::GetNumberOfBoundaryNodes() const
 {
-    return static_cast<std::int32_t>(elements_.size() + 1);
+    return static_cast<std::int32_t>(std::count(boundary_nodes_.cbegin(), boundary_nodes_.cend(), true));
 }
 
 const std::vector<std::optional<double>> Node::GetValues() const
@@ -9,6 +9,7 @@
 #ifndef PDE_SOLVER_DATA_TYPES_GRID_H
 #define PDE_SOLVER_DATA_TYPES_GRID_H
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <ostream>
@@ -83,7 +84,7 @@ class Element
         return os;
     }
 
-    ElementEntity GetNodes() const { return nodes_; };
+    const ElementEntity& GetNodes() const { return nodes_; };
     std::int8_t GetDimension() const { return dimension_; };
     FiniteElementOrder GetOrder() const { return order_; };
     const bool IsOnBoundary() const;
@@ -96,24 +97,79 @@ class Element
     bool is_on_boundary_{false};
 };
 
+/// @brief Unstructured grid of elements that share their nodes
+///
+/// Node coordinates are stored once per node as struct of arrays x[], y[] and z[], y and z are empty below two and
+/// three dimensions. Elements only hold node indices: node l of element e is GetConnectivity()[e * n + l] with n the
+/// nodes per element, so an interior node of a 1D grid is stored once instead of once in each of its two elements.
+/// Boundary flags of nodes and elements are bitsets. Every accessor returns a reference or a value, none allocates.
 class Grid
 {
   public:
     Grid() {};
-    Grid(std::vector<Element> elements) : elements_(elements) {};
+
+    /// @param connectivity: node indices of every element, nodes_per_element consecutive entries per element
+    /// @param nodes_per_element: number of nodes of every element
+    /// @param x: x coordinate of every node, a 1D grid when y and z are empty
+    /// @param y: y coordinate of every node, a 2D grid when z is empty
+    /// @param z: z coordinate of every node
+    ///
+    /// @throws std::length_error: when y or z are not empty and differ in size from x, or the connectivity is not a
+    /// whole number of elements
+    /// @throws std::invalid_argument: when nodes_per_element is not positive, z is given without y or a node index
+    /// is outside of [0, x.size())
+    Grid(std::vector<std::int32_t> connectivity,
+         const std::int32_t nodes_per_element,
+         std::vector<double> x,
+         std::vector<double> y = {},
+         std::vector<double> z = {});
+
+    /// @brief Builds the shared node storage from elements that own their nodes
+    ///
+    /// Nodes with identical coordinates become one node, in order of first appearance. A node is on the boundary
+    /// when any of its copies is.
+    ///
+    /// @throws std::invalid_argument: when the elements do not all have the same, non zero, number of nodes
+    explicit Grid(const std::vector<Element>& elements);
 
   public:
     std::int8_t GetDimension() const { return dimension_; }
-    void SetDimension(const std::int8_t& dimension) { dimension_ = dimension; }
     std::int32_t GetNumberOfElements() const;
-    std::int32_t GetNumberOfNodes() const;
+    std::int32_t GetNumberOfNodes() const { return static_cast<std::int32_t>(x_.size()); }
+    std::int32_t GetNodesPerElement() const { return nodes_per_element_; }
+
+    const std::vector<double>& GetX() const { return x_; }
+    const std::vector<double>& GetY() const { return y_; }
+    const std::vector<double>& GetZ() const { return z_; }
+    const std::vector<std::int32_t>& GetConnectivity() const { return connectivity_; }
+
+    /// @brief Index of node local_node of element
+    std::int32_t GetElementNode(const std::int32_t element, const std::int32_t local_node) const
+    {
+        return connectivity_[static_cast<std::size_t>(element) * static_cast<std::size_t>(nodes_per_element_) +
+                             static_cast<std::size_t>(local_node)];
+    }
+
+    /// @brief Distance along x between the first two nodes of element, the spacing of a 1D element
+    double GetElementLength(const std::int32_t element) const;
 
-    std::vector<Element> GetElementsMutable() const { return elements_; }
-    const std::vector<Element>& GetElements() const { return elements_; }
-    std::int32_t number_of_boundaries_{};
+    bool IsBoundaryNode(const std::int32_t node) const { return boundary_nodes_[static_cast<std::size_t>(node)]; }
+    bool IsBoundaryElement(const std::int32_t element) const
+    {
+        return boundary_elements_[static_cast<std::size_t>(element)];
+    }
+    void SetBoundaryNode(const std::int32_t node, const bool is_on_boundary);
+    void SetBoundaryElement(const std::int32_t element, const bool is_on_boundary);
+    std::int32_t GetNumberOfBoundaryNodes() const;
 
   private:
-    std::vector<Element> elements_{};
+    std::vector<double> x_{};
+    std::vector<double> y_{};
+    std::vector<double> z_{};
+    std::vector<std::int32_t> connectivity_{};
+    std::vector<bool> boundary_nodes_{};
+    std::vector<bool> boundary_elements_{};
+    std::int32_t nodes_per_element_{2};
     std::int8_t dimension_{};
 };
 
@@ -8,17 +8,55 @@
  */
 
 #include "pde_solver/data_types/spatial_variable.h"
-#include "matrix_solvers/direct_solvers/lu_solve.h"
+#include "matrix_solvers/banded/banded_matrix.h"
+#include "matrix_solvers/decomposition_methods/lu_decomposition.h"
+#include "matrix_solvers/direct_solvers/banded_solve.h"
+#include "matrix_solvers/iterative_solvers/bicgstab.h"
 #include "matrix_solvers/iterative_solvers/conjugate_gradient.h"
 #include "matrix_solvers/iterative_solvers/gauss_seidel.h"
+#include "matrix_solvers/iterative_solvers/gmres.h"
 #include "matrix_solvers/iterative_solvers/jacobi.h"
+#include "matrix_solvers/iterative_solvers/multigrid.h"
 #include "pde_solver/data_types/finite_difference_schemas.h"
 #include <cassert>
 #include <iostream>
+#include <optional>
+#include <utility>
 
 namespace pde
 {
 
+namespace
+{
+
+/// @brief Direct solve picking the cheapest factorization for the structure of K
+///
+/// Finite difference stiffness matrices are usually tridiagonal or narrowly banded, where the Thomas algorithm and
+/// banded LU solve in O(n) instead of the O(n^3) of a dense LU decomposition. The dense factors are kept in
+/// lu_factorization so that later solves with the same K only cost O(n^2).
+std::vector<double> DirectSolve(const nm::matrix::CsrMatrix& K,
+                                const std::vector<double>& f,
+                                std::optional<nm::matrix::LUFactorization>& lu_factorization)
+{
+    if (nm::matrix::IsTridiagonal(K))
+    {
+        return nm::matrix::ThomasSolve(nm::matrix::TridiagonalMatrix{K}, f);
+    }
+
+    const auto bandwidth = nm::matrix::GetBandwidth(K);
+    if (K.NumberOfRows() == K.NumberOfColumns() && 4 * (bandwidth.lower + bandwidth.upper + 1) <= K.NumberOfRows())
+    {
+        return nm::matrix::BandedLUSolve(nm::matrix::BandedMatrix{K}, f);
+    }
+    if (!lu_factorization)
+    {
+        lu_factorization.emplace(K.ToDense());
+    }
+    return lu_factorization->Solve(f);
+}
+
+}  // namespace
+
 SpatialDiscretizationMethod SpatialVariable::GetSpatialDiscretizationMethod() const
 {
     return spatial_discretization_method_;
@@ -34,19 +72,22 @@ void SpatialVariable::SetDiscretizationSchema(FiniteDifferenceSchema discretizat
     discretization_schema_ = discretization_schema;
 }
 
-void SpatialVariable::SetGrid(const pde::geometry::Grid& grid)
+void SpatialVariable::SetGrid(pde::geometry::Grid grid)
 {
-    spatial_grid_ = grid;
+    spatial_grid_ = std::move(grid);
     discretized_variable_.resize(spatial_grid_.GetNumberOfNodes());
-    // K_.resize(spatial_grid_.GetNumberOfNodes() - spatial_grid_.number_of_boundaries_);
-    // C_.resize(spatial_grid_.GetNumberOfNodes() - spatial_grid_.number_of_boundaries_);
-    // f_.resize(spatial_grid_.GetNumberOfNodes() - spatial_grid_.number_of_boundaries_);
-    K_.resize(spatial_grid_.GetNumberOfNodes());
-    C_.resize(spatial_grid_.GetNumberOfNodes());
+    // K_.resize(spatial_grid_.GetNumberOfNodes() - spatial_grid_.GetNumberOfBoundaryNodes());
+    // C_.resize(spatial_grid_.GetNumberOfNodes() - spatial_grid_.GetNumberOfBoundaryNodes());
+    // f_.resize(spatial_grid_.GetNumberOfNodes() - spatial_grid_.GetNumberOfBoundaryNodes());
+    const auto number_of_nodes = static_cast<std::int32_t>(spatial_grid_.GetNumberOfNodes());
+    K_ = nm::matrix::CsrMatrix(number_of_nodes, number_of_nodes);
+    lu_factorization_.reset();
+    multigrid_.reset();
+    C_ = nm::matrix::CsrMatrix(number_of_nodes, number_of_nodes);
     f_.resize(spatial_grid_.GetNumberOfNodes());
 }
 
-geometry::Grid SpatialVariable::GetGrid() const
+const geometry::Grid& SpatialVariable::GetGrid() const
 {
     return spatial_grid_;
 }
@@ -62,12 +103,11 @@ void SpatialVariable::SetDirichletBoundaryCondition(const double value, const st
 
     discretized_variable_.at(boundary_index) = value;
 
-    if (!K_.empty())
+    if (K_.NumberOfRows() > 0)
     {
-        std::vector<double> boundary_row{};
-        boundary_row.resize(spatial_grid_.GetNumberOfNodes());
-        boundary_row.at(boundary_index) = 1.0;
-        K_.at(boundary_index) = boundary_row;
+        K_.SetRow(boundary_index, {boundary_index}, {1.0});
+        lu_factorization_.reset();
+        multigrid_.reset();
     }
     else
     {
@@ -88,14 +128,28 @@ void SpatialVariable::SetDirichletBoundaryCondition(const double value, const st
     }
 }
 
-void SpatialVariable::SetStiffnessMatrix(nm::matrix::Matrix<double> K)
+void SpatialVariable::SetStiffnessMatrix(nm::matrix::CsrMatrix K)
+{
+    K_ = std::move(K);
+    lu_factorization_.reset();
+    multigrid_.reset();
+}
+
+void SpatialVariable::SetStiffnessMatrix(const nm::matrix::Matrix<double>& K)
 {
-    K_ = K;
+    K_ = nm::matrix::CsrMatrix{K};
+    lu_factorization_.reset();
+    multigrid_.reset();
 }
 
-void SpatialVariable::SetDampingMatrix(nm::matrix::Matrix<double> C)
+void SpatialVariable::SetDampingMatrix(nm::matrix::CsrMatrix C)
 {
-    C_ = C;
+    C_ = std::move(C);
+}
+
+void SpatialVariable::SetDampingMatrix(const nm::matrix::Matrix<double>& C)
+{
+    C_ = nm::matrix::CsrMatrix{C};
 }
 
 void SpatialVariable::SetForceVector(std::vector<double> f)
@@ -111,7 +165,7 @@ void SpatialVariable::SetMatrixSolver(const MatrixSolverEnum matrix_solver)
 void SpatialVariable::Solve(const std::int32_t max_iterations, const double tolerance)
 {
     assert(matrix_solver_ != MatrixSolverEnum::kInvalid);
-    assert(!K_.empty());
+    assert(K_.NumberOfRows() > 0);
     assert(!f_.empty());
 
     // std::vector<double>::iterator first_unknown_iterator{discretized_variable_.begin() + 1};
@@ -130,7 +184,24 @@ void SpatialVariable::Solve(const std::int32_t max_iterations, const double tole
             nm::matrix::ConjugateGradient(K_, f_, discretized_variable_, tolerance, max_iterations);
             break;
         case MatrixSolverEnum::kLUSolve:
-            discretized_variable_ = nm::matrix::LUSolve(K_, f_);
+            discretized_variable_ = DirectSolve(K_, f_, lu_factorization_);
+            break;
+        case MatrixSolverEnum::kThomas:
+            discretized_variable_ = nm::matrix::ThomasSolve(nm::matrix::TridiagonalMatrix{K_}, f_);
+            break;
+        case MatrixSolverEnum::kMultigrid:
+            if (!multigrid_)
+            {
+                // Nodes of the 1D grid are numbered left to right, which is the ordering the hierarchy coarsens
+                multigrid_.emplace(K_, nm::matrix::GridShape{.nx = K_.NumberOfRows()});
+            }
+            multigrid_->Solve(f_, discretized_variable_, tolerance, max_iterations);
+            break;
+        case MatrixSolverEnum::kGMRES:
+            nm::matrix::GMRES(K_, f_, discretized_variable_, tolerance, max_iterations);
+            break;
+        case MatrixSolverEnum::kBiCGSTAB:
+            nm::matrix::BiCGSTAB(K_, f_, discretized_variable_, tolerance, max_iterations);
             break;
         default:
             std::cout << "No matrix_solver found!\n";
@@ -9,10 +9,14 @@
 #ifndef PDE_SOLVER_DATA_TYPES_SPATIAL_VARIABLE_H
 #define PDE_SOLVER_DATA_TYPES_SPATIAL_VARIABLE_H
 
+#include "matrix_solvers/decomposition_methods/lu_decomposition.h"
+#include "matrix_solvers/iterative_solvers/multigrid.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
 #include "matrix_solvers/utilities.h"
 #include "pde_solver/data_types/discretization_methods.h"
 #include "pde_solver/data_types/finite_difference_schemas.h"
 #include "pde_solver/data_types/grid.h"
+#include <optional>
 #include <vector>
 
 namespace pde
@@ -25,6 +29,10 @@ enum class MatrixSolverEnum : std::int16_t
     kGaussSeidel = 1,
     kConjugateGradient = 2,
     kLUSolve = 3,
+    kThomas = 4,
+    kMultigrid = 5,
+    kGMRES = 6,
+    kBiCGSTAB = 7,
     kInvalid = 255,
 };
 
@@ -46,6 +54,22 @@ inline MatrixSolverEnum MatrixSolverEnumFromString(const std::string& str)
     {
         return MatrixSolverEnum::kLUSolve;
     }
+    if (str == "Thomas")
+    {
+        return MatrixSolverEnum::kThomas;
+    }
+    if (str == "Multigrid")
+    {
+        return MatrixSolverEnum::kMultigrid;
+    }
+    if (str == "GMRES")
+    {
+        return MatrixSolverEnum::kGMRES;
+    }
+    if (str == "BiCGSTAB")
+    {
+        return MatrixSolverEnum::kBiCGSTAB;
+    }
     return MatrixSolverEnum::kInvalid;
 };
 
@@ -61,6 +85,14 @@ inline std::string MatrixSolverEnumToString(const MatrixSolverEnum method)
             return "ConjugateGradient";
         case MatrixSolverEnum::kLUSolve:
             return "LUSolve";
+        case MatrixSolverEnum::kThomas:
+            return "Thomas";
+        case MatrixSolverEnum::kMultigrid:
+            return "Multigrid";
+        case MatrixSolverEnum::kGMRES:
+            return "GMRES";
+        case MatrixSolverEnum::kBiCGSTAB:
+            return "BiCGSTAB";
         default:
             return "Invalid";
     }
@@ -80,7 +112,9 @@ class SpatialVariable
           C_(other.C_),
           f_(other.f_),
           matrix_solver_(other.matrix_solver_),
-          spatial_grid_(other.spatial_grid_) {};
+          spatial_grid_(other.spatial_grid_),
+          lu_factorization_(other.lu_factorization_),
+          multigrid_(other.multigrid_) {};
     SpatialVariable(SpatialVariable&& other) noexcept
         : spatial_discretization_method_(std::move(other.spatial_discretization_method_)),
           discretization_schema_(std::move(other.discretization_schema_)),
@@ -89,7 +123,9 @@ class SpatialVariable
           C_(std::move(other.C_)),
           f_(std::move(other.f_)),
           matrix_solver_(std::move(other.matrix_solver_)),
-          spatial_grid_(std::move(other.spatial_grid_)) {};
+          spatial_grid_(std::move(other.spatial_grid_)),
+          lu_factorization_(std::move(other.lu_factorization_)),
+          multigrid_(std::move(other.multigrid_)) {};
     SpatialVariable& operator=(const SpatialVariable& other)
     {
         if (this != &other)
@@ -102,6 +138,8 @@ class SpatialVariable
             f_ = other.f_;
             matrix_solver_ = other.matrix_solver_;
             spatial_grid_ = other.spatial_grid_;
+            lu_factorization_ = other.lu_factorization_;
+            multigrid_ = other.multigrid_;
         }
         return *this;
     }
@@ -117,6 +155,8 @@ class SpatialVariable
             f_ = std::move(other.f_);
             matrix_solver_ = std::move(other.matrix_solver_);
             spatial_grid_ = std::move(other.spatial_grid_);
+            lu_factorization_ = std::move(other.lu_factorization_);
+            multigrid_ = std::move(other.multigrid_);
         }
         return *this;
     }
@@ -130,18 +170,22 @@ class SpatialVariable
 
     const std::vector<double>& GetDiscretizedVariable() const { return discretized_variable_; };
 
-    void SetGrid(const pde::geometry::Grid& grid);
-    geometry::Grid GetGrid() const;
+    /// @brief Takes the grid by value, pass an rvalue to move a large grid in without copying it
+    void SetGrid(pde::geometry::Grid grid);
+    const geometry::Grid& GetGrid() const;
 
     void SetDirichletBoundaryCondition(const double value, const std::string_view& boundary_name);
     void SetDirichletBoundaryCondition(const double value, const std::int32_t boundary_index);
 
-    void SetStiffnessMatrix(nm::matrix::Matrix<double> K);
-    void SetDampingMatrix(nm::matrix::Matrix<double> C);
+    /// The stiffness and damping matrices are stored in CSR format, dense inputs keep only their nonzero entries
+    void SetStiffnessMatrix(nm::matrix::CsrMatrix K);
+    void SetStiffnessMatrix(const nm::matrix::Matrix<double>& K);
+    void SetDampingMatrix(nm::matrix::CsrMatrix C);
+    void SetDampingMatrix(const nm::matrix::Matrix<double>& C);
     void SetForceVector(std::vector<double> f);
 
-    nm::matrix::Matrix<double> GetStiffnessMatrix() const { return K_; }
-    nm::matrix::Matrix<double> GetDampingMatrix() const { return C_; }
+    const nm::matrix::CsrMatrix& GetStiffnessMatrix() const { return K_; }
+    const nm::matrix::CsrMatrix& GetDampingMatrix() const { return C_; }
     std::vector<double> GetForceVector() const { return f_; };
 
     void SetMatrixSolver(const MatrixSolverEnum matrix_solver);
@@ -152,11 +196,17 @@ class SpatialVariable
     SpatialDiscretizationMethod spatial_discretization_method_{};
     FiniteDifferenceSchema discretization_schema_{};
     std::vector<double> discretized_variable_{};
-    nm::matrix::Matrix<double> K_{};
-    nm::matrix::Matrix<double> C_{};
+    nm::matrix::CsrMatrix K_{};
+    nm::matrix::CsrMatrix C_{};
     std::vector<double> f_{};
     MatrixSolverEnum matrix_solver_{MatrixSolverEnum::kInvalid};
     geometry::Grid spatial_grid_{};
+
+    // Dense LU factors of K_, reused by every direct solve until K_ changes
+    std::optional<nm::matrix::LUFactorization> lu_factorization_{};
+
+    // Multigrid hierarchy of K_ on the grid, reused by every multigrid solve until K_ changes
+    std::optional<nm::matrix::Multigrid> multigrid_{};
 };
 
 }  // namespace pde
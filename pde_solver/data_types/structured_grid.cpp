@@ -0,0 +1,123 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "pde_solver/data_types/structured_grid.h"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace pde
+{
+
+namespace geometry
+{
+
+namespace
+{
+
+void ValidateAxis(const std::vector<double>& coordinates)
+{
+    if (coordinates.size() < 2)
+    {
+        throw std::invalid_argument("StructuredGrid: every axis needs at least two nodes");
+    }
+    if (std::adjacent_find(coordinates.cbegin(), coordinates.cend(), std::greater_equal<double>{}) !=
+        coordinates.cend())
+    {
+        throw std::invalid_argument("StructuredGrid: coordinates must be strictly increasing");
+    }
+}
+
+}  // namespace
+
+StructuredGrid::StructuredGrid(std::vector<double> x, std::vector<double> y, std::vector<double> z)
+{
+    if (y.empty() && !z.empty())
+    {
+        throw std::invalid_argument("StructuredGrid: a 3D grid needs y coordinates");
+    }
+
+    ValidateAxis(x);
+    coordinates_[0] = std::move(x);
+    dimension_ = 1;
+    if (!y.empty())
+    {
+        ValidateAxis(y);
+        coordinates_[1] = std::move(y);
+        dimension_ = 2;
+    }
+    if (!z.empty())
+    {
+        ValidateAxis(z);
+        coordinates_[2] = std::move(z);
+        dimension_ = 3;
+    }
+}
+
+std::int32_t StructuredGrid::GetNumberOfNodes() const
+{
+    if (dimension_ == 0)
+    {
+        return 0;
+    }
+    return GetNumberOfNodes(Axis::kX) * GetNumberOfNodes(Axis::kY) * GetNumberOfNodes(Axis::kZ);
+}
+
+std::int32_t StructuredGrid::GetStride(const Axis axis) const
+{
+    switch (axis)
+    {
+        case Axis::kY:
+            return GetNumberOfNodes(Axis::kX);
+        case Axis::kZ:
+            return GetNumberOfNodes(Axis::kX) * GetNumberOfNodes(Axis::kY);
+        case Axis::kX:
+        default:
+            return 1;
+    }
+}
+
+bool StructuredGrid::IsOnBoundary(const std::int32_t i, const std::int32_t j, const std::int32_t k) const
+{
+    const std::array<std::int32_t, 3> indices{i, j, k};
+    for (std::int8_t axis{0}; axis < dimension_; ++axis)
+    {
+        const auto index = indices[static_cast<std::size_t>(axis)];
+        if (index == 0 || index == GetNumberOfNodes(static_cast<Axis>(axis)) - 1)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<std::int32_t> StructuredGrid::GetBoundaryNodes() const
+{
+    const auto nx = GetNumberOfNodes(Axis::kX);
+    const auto ny = GetNumberOfNodes(Axis::kY);
+    const auto nz = GetNumberOfNodes(Axis::kZ);
+
+    std::vector<std::int32_t> boundary_nodes{};
+    for (std::int32_t k{0}; k < nz && dimension_ > 0; ++k)
+    {
+        for (std::int32_t j{0}; j < ny; ++j)
+        {
+            // Interior x lines only contribute their two end nodes
+            const auto whole_line = (dimension_ >= 2 && (j == 0 || j == ny - 1)) ||
+                                    (dimension_ == 3 && (k == 0 || k == nz - 1));
+            const auto step = whole_line ? 1 : nx - 1;
+            for (std::int32_t i{0}; i < nx; i += step)
+            {
+                boundary_nodes.push_back(GetNodeIndex(i, j, k));
+            }
+        }
+    }
+    return boundary_nodes;
+}
+
+}  // namespace geometry
+
+}  // namespace pde
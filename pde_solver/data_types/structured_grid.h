@@ -0,0 +1,94 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Cartesian structured grid of one to three dimensions with implicit (i, j, k) node indexing
+ */
+
+#ifndef PDE_SOLVER_DATA_TYPES_STRUCTURED_GRID_H
+#define PDE_SOLVER_DATA_TYPES_STRUCTURED_GRID_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pde
+{
+
+namespace geometry
+{
+
+enum class Axis : std::int8_t
+{
+    kX = 0,
+    kY = 1,
+    kZ = 2,
+};
+
+/// @brief Tensor product grid stored as one coordinate array per axis
+///
+/// Node (i, j, k) sits at (x[i], y[j], z[k]) and has the index i + nx * (j + ny * k), so x varies fastest and the
+/// nodes of an x line are contiguous, the same row order as nm::matrix::GridShape. Nothing is stored per node, a grid
+/// of nx * ny * nz nodes holds nx + ny + nz coordinates. Axes beyond the dimension of the grid have the single
+/// coordinate 0, which keeps the index formula the same in 1D, 2D and 3D.
+class StructuredGrid
+{
+  public:
+    StructuredGrid() = default;
+
+    /// @param x: coordinates along x, a 1D grid when y and z are empty
+    /// @param y: coordinates along y, a 2D grid when z is empty
+    /// @param z: coordinates along z
+    ///
+    /// @throws std::invalid_argument: when a used axis has fewer than two coordinates or they are not strictly
+    /// increasing, or when z is given without y
+    explicit StructuredGrid(std::vector<double> x, std::vector<double> y = {}, std::vector<double> z = {});
+
+    std::int8_t GetDimension() const { return dimension_; }
+
+    /// @brief Total number of nodes, 0 for a default constructed grid
+    std::int32_t GetNumberOfNodes() const;
+    std::int32_t GetNumberOfNodes(const Axis axis) const
+    {
+        return static_cast<std::int32_t>(Coordinates(axis).size());
+    }
+
+    const std::vector<double>& GetCoordinates(const Axis axis) const { return Coordinates(axis); }
+
+    /// @brief Distance between node i and node i + 1 along axis
+    double GetSpacing(const Axis axis, const std::int32_t i) const
+    {
+        return Coordinates(axis)[static_cast<std::size_t>(i) + 1] - Coordinates(axis)[static_cast<std::size_t>(i)];
+    }
+
+    /// @brief Distance between consecutive node indices along axis, 1 for x, nx for y and nx * ny for z
+    std::int32_t GetStride(const Axis axis) const;
+
+    std::int32_t GetNodeIndex(const std::int32_t i, const std::int32_t j = 0, const std::int32_t k = 0) const
+    {
+        return i + GetNumberOfNodes(Axis::kX) * (j + GetNumberOfNodes(Axis::kY) * k);
+    }
+
+    /// @brief Whether node (i, j, k) is the first or last node along any axis of the grid
+    bool IsOnBoundary(const std::int32_t i, const std::int32_t j = 0, const std::int32_t k = 0) const;
+
+    /// @brief Indices of all boundary nodes in increasing order, e.g. the rows to impose Dirichlet conditions on
+    std::vector<std::int32_t> GetBoundaryNodes() const;
+
+  private:
+    const std::vector<double>& Coordinates(const Axis axis) const
+    {
+        return coordinates_[static_cast<std::size_t>(axis)];
+    }
+
+    std::array<std::vector<double>, 3> coordinates_{
+        std::vector<double>{0.0}, std::vector<double>{0.0}, std::vector<double>{0.0}};
+    std::int8_t dimension_{0};
+};
+
+}  // namespace geometry
+
+}  // namespace pde
+
+#endif  // PDE_SOLVER_DATA_TYPES_STRUCTURED_GRID_H
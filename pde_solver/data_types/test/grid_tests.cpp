@@ -10,7 +10,12 @@
  */
 
 #include "pde_solver/data_types/grid.h"
+#include <cstddef>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace pde
 {
@@ -39,14 +44,66 @@ TEST_F(BaseClassFixture, GivenValidGrid_ExpectCorrectDisplay)
     grid_ = Grid(elements);
 
     // Act
-    const auto& elements_vector = grid_.GetElements();
-    for (const auto& element : elements_vector)
-    {
-        std::cout << "Element: " << element << std::endl;  // Should invoke operator<<
-    }
+    const auto& connectivity = grid_.GetConnectivity();
+    std::cout << "Element: " << element << std::endl;  // Should invoke operator<<
 
     // Assert
-    EXPECT_EQ(elements_vector.size(), 1);
+    EXPECT_EQ(grid_.GetNumberOfElements(), 1);
+    EXPECT_EQ(connectivity.size(), 2U);
+}
+
+TEST(GridTest, GivenElementsWithCopiedNodes_ExpectSharedNodes)
+{
+    // Given
+    Node boundary_node(0.0);
+    boundary_node.SetBoundaryBoolean(true);
+    const std::vector<Element> elements{Element({boundary_node, Node(0.5)}), Element({Node(0.5), Node(1.5)})};
+
+    // Call
+    const Grid grid{elements};
+
+    // Expect
+    EXPECT_EQ(grid.GetDimension(), 1);
+    EXPECT_EQ(grid.GetNumberOfNodes(), 3);
+    EXPECT_EQ(grid.GetConnectivity(), (std::vector<std::int32_t>{0, 1, 1, 2}));
+    EXPECT_EQ(grid.GetX(), (std::vector<double>{0.0, 0.5, 1.5}));
+    EXPECT_TRUE(grid.GetY().empty());
+    EXPECT_TRUE(grid.IsBoundaryNode(0));
+    EXPECT_FALSE(grid.IsBoundaryNode(1));
+    EXPECT_DOUBLE_EQ(grid.GetElementLength(1), 1.0);
+}
+
+TEST(GridTest, GivenTwoDimensionalConnectivity_ExpectZeroCopyAccess)
+{
+    // Given, two triangles sharing the diagonal of the unit square
+    std::vector<double> x{0.0, 1.0, 1.0, 0.0};
+    std::vector<double> y{0.0, 0.0, 1.0, 1.0};
+    const auto* x_data = x.data();
+
+    // Call
+    Grid grid{{0, 1, 2, 0, 2, 3}, 3, std::move(x), std::move(y)};
+    grid.SetBoundaryElement(1, true);
+
+    // Expect
+    EXPECT_EQ(grid.GetDimension(), 2);
+    EXPECT_EQ(grid.GetNumberOfElements(), 2);
+    EXPECT_EQ(grid.GetNodesPerElement(), 3);
+    EXPECT_EQ(grid.GetElementNode(1, 2), 3);
+    EXPECT_EQ(grid.GetX().data(), x_data);
+    EXPECT_DOUBLE_EQ(grid.GetY()[static_cast<std::size_t>(grid.GetElementNode(0, 2))], 1.0);
+    EXPECT_TRUE(grid.IsBoundaryElement(1));
+    EXPECT_EQ(grid.GetNumberOfBoundaryNodes(), 0);
+}
+
+TEST(GridTest, GivenInvalidConnectivity_ExpectThrow)
+{
+    // Call and Expect
+    EXPECT_THROW((Grid{{0, 1, 2}, 2, {0.0, 1.0, 2.0}}), std::length_error);
+    EXPECT_THROW((Grid{{0, 3}, 2, {0.0, 1.0, 2.0}}), std::invalid_argument);
+    EXPECT_THROW((Grid{{0, 1}, 2, {0.0, 1.0}, {0.0}}), std::length_error);
+    EXPECT_THROW((Grid{{0, 1}, 0, {0.0, 1.0}}), std::invalid_argument);
+    const std::vector<Element> mixed_elements{Element({Node(0.0), Node(1.0)}), Element({Node(1.0)})};
+    EXPECT_THROW(Grid{mixed_elements}, std::invalid_argument);
 }
 
 }  // namespace
@@ -0,0 +1,76 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "pde_solver/data_types/structured_grid.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+namespace pde
+{
+
+namespace geometry
+{
+
+namespace
+{
+
+TEST(StructuredGridTests, GivenThreeAxes_ExpectXFastestIndexingAndStrides)
+{
+    // Given
+    const StructuredGrid grid{{0.0, 1.0, 2.0, 3.0}, {0.0, 0.5, 1.0}, {0.0, 2.0}};
+
+    // Call, Expect
+    EXPECT_EQ(grid.GetDimension(), 3);
+    EXPECT_EQ(grid.GetNumberOfNodes(), 24);
+    EXPECT_EQ(grid.GetNodeIndex(1, 2, 1), 1 + 4 * (2 + 3 * 1));
+    EXPECT_EQ(grid.GetStride(Axis::kX), 1);
+    EXPECT_EQ(grid.GetStride(Axis::kY), 4);
+    EXPECT_EQ(grid.GetStride(Axis::kZ), 12);
+    EXPECT_DOUBLE_EQ(grid.GetSpacing(Axis::kY, 1), 0.5);
+    EXPECT_DOUBLE_EQ(grid.GetSpacing(Axis::kZ, 0), 2.0);
+}
+
+TEST(StructuredGridTests, GivenTwoDimensionalGrid_ExpectBoundaryNodesOfTheFourEdges)
+{
+    // Given
+    const StructuredGrid grid{{0.0, 1.0, 2.0, 3.0}, {0.0, 1.0, 2.0}};
+
+    // Call
+    const auto boundary_nodes = grid.GetBoundaryNodes();
+
+    // Expect, every node but the two interior ones (1, 1) and (2, 1)
+    const std::vector<std::int32_t> expected{0, 1, 2, 3, 4, 7, 8, 9, 10, 11};
+    EXPECT_EQ(boundary_nodes, expected);
+    EXPECT_FALSE(grid.IsOnBoundary(1, 1));
+    EXPECT_TRUE(grid.IsOnBoundary(3, 1));
+    EXPECT_EQ(grid.GetNumberOfNodes(Axis::kZ), 1);
+}
+
+TEST(StructuredGridTests, GivenOneDimensionalGrid_ExpectOnlyEndNodesOnBoundary)
+{
+    // Given
+    const StructuredGrid grid{{0.0, 0.1, 0.3, 0.7}};
+
+    // Call, Expect
+    EXPECT_EQ(grid.GetDimension(), 1);
+    EXPECT_EQ(grid.GetBoundaryNodes(), (std::vector<std::int32_t>{0, 3}));
+    EXPECT_EQ(StructuredGrid{}.GetNumberOfNodes(), 0);
+}
+
+TEST(StructuredGridTests, GivenInvalidCoordinates_ExpectThrow)
+{
+    // Call, Expect
+    EXPECT_THROW(StructuredGrid({0.0}), std::invalid_argument);
+    EXPECT_THROW(StructuredGrid({0.0, 1.0, 1.0}), std::invalid_argument);
+    EXPECT_THROW(StructuredGrid({0.0, 1.0}, {}, {0.0, 1.0}), std::invalid_argument);
+}
+
+}  // namespace
+
+}  // namespace geometry
+
+}  // namespace pde
@@ -0,0 +1,187 @@
+/*
+ * @brief Checks that steady-state time stepping does not touch the heap.
+ * @details The global allocation functions are replaced by counting versions, which is why these tests live in
+ *          their own binary instead of time_variable_tests.cpp.
+ * @date October 18, 2026
+ * @author Alejandro Valencia
+ */
+
+#include "matrix_solvers/utilities.h"
+#include "pde_solver/data_types/time_variable.h"
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <new>
+#include <string>
+
+// free() is the matching release for the malloc()/aligned_alloc() calls below, GCC only sees the paired new/delete
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace
+{
+
+std::atomic<bool> count_allocations{false};
+std::atomic<std::int64_t> number_of_allocations{0};
+
+void* CountedAllocate(const std::size_t size, const std::size_t alignment)
+{
+    if (count_allocations.load(std::memory_order_relaxed))
+    {
+        number_of_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void* ptr{nullptr};
+    if (alignment <= alignof(std::max_align_t))
+    {
+        ptr = std::malloc(size == 0 ? 1 : size);
+    }
+    else
+    {
+        // aligned_alloc requires the size to be a multiple of the alignment
+        ptr = std::aligned_alloc(alignment, ((size + alignment - 1) / alignment) * alignment);
+    }
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size)
+{
+    return CountedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace pde
+{
+
+namespace
+{
+
+struct TimeStepAllocationTestParameter
+{
+    TimeDiscretizationMethod method{};
+    std::string test_name{};
+};
+
+class TimeStepAllocationTestFixture : public ::testing::TestWithParam<TimeStepAllocationTestParameter>
+{
+  public:
+    void SetUp() override
+    {
+        // Spring mass damper system, x'' = -c/m x' - k/m x
+        const double m{10.0};
+        const double k{50.0};
+        const double c{0.3 * (2 * std::sqrt(k * m))};
+
+        nm::matrix::Matrix<double> rhs{{-c / m, -k / m}, {1.0, 0.0}};
+        uu_.SetRightHandSideMatrix(rhs);
+        uu_.SetInitialCondition({0, 1});
+        uu_.SetTimeStep(0.01);
+        uu_.SetTimeDiscretizationMethod(GetParam().method);
+    }
+
+  public:
+    TimeVariable uu_{};
+    std::int32_t number_of_steps_{100};
+};
+
+TEST_P(TimeStepAllocationTestFixture, GivenWarmedUpTimeVariable_ExpectStepsWithoutHeapAllocations)
+{
+    // Given, the first step sizes the stage buffers
+    uu_.StepOnce();
+
+    // Call
+    number_of_allocations = 0;
+    count_allocations = true;
+    for (std::int32_t n{0}; n < number_of_steps_; ++n)
+    {
+        uu_.StepOnce();
+    }
+    count_allocations = false;
+
+    // Expect
+    EXPECT_EQ(number_of_allocations.load(), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(TimeStepAllocationTests,
+                         TimeStepAllocationTestFixture,
+                         ::testing::Values(
+                             // clang-format off
+                         TimeStepAllocationTestParameter{.method = TimeDiscretizationMethod::kEulerStep, .test_name = "EulerStep"},
+                         TimeStepAllocationTestParameter{.method = TimeDiscretizationMethod::kRungeKutta2, .test_name = "RungeKutta2"},
+                         TimeStepAllocationTestParameter{.method = TimeDiscretizationMethod::kRungeKutta4, .test_name = "RungeKutta4"},
+                         TimeStepAllocationTestParameter{.method = TimeDiscretizationMethod::kDormandPrince54, .test_name = "DormandPrince54"},
+                         TimeStepAllocationTestParameter{.method = TimeDiscretizationMethod::kBogackiShampine32, .test_name = "BogackiShampine32"}
+                             // clang-format on
+                             ),
+                         [](const ::testing::TestParamInfo<TimeStepAllocationTestParameter>& info) {
+                             return info.param.test_name;
+                         });
+
+}  // namespace
+
+}  // namespace pde
@@ -18,6 +18,8 @@
 #include <cmath>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
 
 namespace pde
 {
@@ -124,6 +126,17 @@ class SpringMassDamperSystemTestFixture : public ::testing::Test
         uu_.SetTimeStep(0.1);
     }
 
+    /// Position of the mass released at rest from x = 1
+    double ExactPosition(const double t) const
+    {
+        const auto natural_frequency = std::sqrt(k_ / m_);
+        const auto damping_ratio = c_ / (2 * std::sqrt(k_ * m_));
+        const auto damped_frequency = natural_frequency * std::sqrt(1 - damping_ratio * damping_ratio);
+        return std::exp(-damping_ratio * natural_frequency * t) *
+               (std::cos(damped_frequency * t) +
+                damping_ratio * natural_frequency / damped_frequency * std::sin(damped_frequency * t));
+    }
+
   public:
     double m_{};
     double k_{};
@@ -168,6 +181,107 @@ TEST_F(SpringMassDamperSystemTestFixture, WithFourthOrderRungeKutta_ExpectValidR
     EXPECT_NEAR(uu_.GetTimeVariable().at(1), -0.1365, 0.001);
 }
 
+TEST_F(SpringMassDamperSystemTestFixture, WithDormandPrince_ExpectExactSolutionWithinTolerance)
+{
+    // With, no first step given so the step size is picked automatically
+    uu_.SetTimeDiscretizationMethod(TimeDiscretizationMethod::kDormandPrince54);
+    uu_.SetTimeStep(0.0);
+    uu_.SetTolerances(1e-10, 1e-8);
+
+    // Call
+    uu_.Run();
+
+    // Expect, far fewer steps than a fixed step method needs for this accuracy
+    EXPECT_NEAR(uu_.GetTimeVariable().at(1), ExactPosition(1.0), 1e-7);
+    EXPECT_LT(uu_.GetNumberOfAcceptedSteps(), 60);
+}
+
+TEST_F(SpringMassDamperSystemTestFixture, WithBogackiShampine_ExpectExactSolutionWithinTolerance)
+{
+    // With
+    uu_.SetTimeDiscretizationMethod(TimeDiscretizationMethod::kBogackiShampine32);
+    uu_.SetTolerances(1e-8, 1e-6);
+
+    // Call
+    uu_.Run();
+
+    // Expect
+    EXPECT_NEAR(uu_.GetTimeVariable().at(1), ExactPosition(1.0), 1e-5);
+}
+
+TEST_F(SpringMassDamperSystemTestFixture, WithOutputTimes_ExpectInterpolatedSolutionAtExactlyThoseTimes)
+{
+    for (const auto method :
+         {TimeDiscretizationMethod::kDormandPrince54, TimeDiscretizationMethod::kBogackiShampine32})
+    {
+        // With
+        uu_.SetInitialCondition({0, 1});
+        uu_.SetTimeDiscretizationMethod(method);
+        uu_.SetTolerances(1e-10, 1e-8);
+        uu_.SetOutputTimes({0.0, 0.123, 0.5, 0.77, 1.0});
+        std::vector<double> times{};
+        std::vector<double> positions{};
+
+        // Call
+        uu_.Run([&](const std::int32_t, const double time, const std::vector<double>& u) {
+            times.push_back(time);
+            positions.push_back(u.at(1));
+        });
+
+        // Expect
+        ASSERT_EQ(times, (std::vector<double>{0.0, 0.123, 0.5, 0.77, 1.0}));
+        for (std::size_t i = 0; i < times.size(); ++i)
+        {
+            EXPECT_NEAR(positions[i], ExactPosition(times[i]), 1e-6);
+        }
+    }
+}
+
+TEST(AdaptiveTimeStepTests, GivenStiffSystemWithoutFirstStep_ExpectStableStartAndFewRejections)
+{
+    // Given, u' = -u and u' = -1000 u, an explicit method needs steps below about 3e-3 to stay stable
+    TimeVariable uu{};
+    uu.SetRightHandSideMatrix(nm::matrix::Matrix<double>{{-1.0, 0.0}, {0.0, -1000.0}});
+    uu.SetInitialCondition({1.0, 1.0});
+    uu.SetTimeDiscretizationMethod(TimeDiscretizationMethod::kDormandPrince54);
+    uu.SetStartTime(0.0);
+    uu.SetEndTime(1.0);
+    std::vector<double> steps{};
+    double previous_time{0.0};
+
+    // Call
+    uu.Run([&](const std::int32_t step, const double time, const std::vector<double>&) {
+        if (step > 0)
+        {
+            steps.push_back(time - previous_time);
+        }
+        previous_time = time;
+    });
+
+    // Expect
+    ASSERT_FALSE(steps.empty());
+    EXPECT_LE(steps.front(), 3.3 / 1000.0);
+    EXPECT_DOUBLE_EQ(previous_time, 1.0);
+    EXPECT_NEAR(uu.GetTimeVariable().at(0), std::exp(-1.0), 1e-5);
+    EXPECT_NEAR(uu.GetTimeVariable().at(1), 0.0, 1e-5);
+    EXPECT_LT(uu.GetNumberOfRejectedSteps(), uu.GetNumberOfAcceptedSteps() / 4);
+}
+
+TEST(AdaptiveTimeStepTests, GivenGrowingSolution_ExpectThrowWhenStepSizeUnderflows)
+{
+    // Given, the tolerances cannot be met by any step above 1e-12 of the time span
+    TimeVariable uu{};
+    uu.SetRightHandSideMatrix(nm::matrix::Matrix<double>{{1e300}});
+    uu.SetInitialCondition({1e300});
+    uu.SetTimeDiscretizationMethod(TimeDiscretizationMethod::kBogackiShampine32);
+    uu.SetStartTime(0.0);
+    uu.SetEndTime(1.0);
+    uu.SetTimeStep(0.1);
+
+    // Call and Expect
+    EXPECT_THROW(uu.Run(), std::runtime_error);
+}
+
 }  // namespace
 
 }  // namespace pde
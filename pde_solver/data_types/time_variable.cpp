@@ -8,16 +8,65 @@
  */
 
 #include "pde_solver/data_types/time_variable.h"
-#include "matrix_solvers/operations/operations.h"
+#include "matrix_solvers/operations/vector_expressions.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include "matrix_solvers/utilities.h"
 #include "pde_solver/data_types/spatial_variable.h"
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstdint>
 #include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace pde
 {
 
+namespace
+{
+
+// Step size controller, the factor by which a step may change is kept in [kMinimumStepFactor, kMaximumStepFactor]
+constexpr double kSafetyFactor{0.9};
+constexpr double kMinimumStepFactor{0.2};
+constexpr double kMaximumStepFactor{5.0};
+constexpr double kMinimumPreviousError{1e-4};
+constexpr double kMinimumStepFraction{1e-12};
+
+/// @brief Order of the error estimate, the embedded lower order solution, plus one, the step size controller exponent
+double ControllerOrder(const TimeDiscretizationMethod method)
+{
+    return method == TimeDiscretizationMethod::kDormandPrince54 ? 5.0 : 3.0;
+}
+
+/// @brief Extent of the stability region along the negative real axis
+double StabilityLimit(const TimeDiscretizationMethod method)
+{
+    return method == TimeDiscretizationMethod::kDormandPrince54 ? 3.3 : 2.5;
+}
+
+/// @brief Gershgorin bound on the spectral radius of R, the largest absolute row sum
+double SpectralRadiusBound(const nm::matrix::CsrMatrix& R)
+{
+    const auto& row_offsets = R.RowOffsets();
+    const auto& values = R.Values();
+    double bound{0.0};
+    for (std::int32_t i{0}; i < R.NumberOfRows(); ++i)
+    {
+        double row_sum{0.0};
+        for (auto k = row_offsets[static_cast<std::size_t>(i)]; k < row_offsets[static_cast<std::size_t>(i) + 1]; ++k)
+        {
+            row_sum += std::abs(values[static_cast<std::size_t>(k)]);
+        }
+        bound = std::max(bound, row_sum);
+    }
+    return bound;
+}
+
+}  // namespace
+
 TimeVariable::TimeVariable(const SpatialVariable& u)
     : ux_(u), time_discretization_method_(TimeDiscretizationMethod::kInvalid)
 {
@@ -30,12 +79,14 @@ void TimeVariable::InitializeWithSpatialVariable(const SpatialVariable& u)
     ux_ = u;
     u_current_ = u.GetDiscretizedVariable();
     u_previous_ = u.GetDiscretizedVariable();
+    first_same_as_last_ = false;
 }
 
 void TimeVariable::SetInitialCondition(const std::vector<double>& u_initial)
 {
     u_previous_ = u_initial;
     u_current_ = u_previous_;
+    first_same_as_last_ = false;
 }
 
 TimeDiscretizationMethod TimeVariable::GetTimeDiscretizationMethod() const
@@ -46,11 +97,25 @@ TimeDiscretizationMethod TimeVariable::GetTimeDiscretizationMethod() const
 void TimeVariable::SetTimeDiscretizationMethod(TimeDiscretizationMethod time_discretization_method)
 {
     time_discretization_method_ = time_discretization_method;
+    first_same_as_last_ = false;
 }
 
 void TimeVariable::SetRightHandSideMatrix(const nm::matrix::Matrix<double>& rhs_matrix)
 {
-    rhs_matrix_ = rhs_matrix;
+    rhs_matrix_ = nm::matrix::CsrMatrix{rhs_matrix};
+    first_same_as_last_ = false;
+}
+
+void TimeVariable::SetRightHandSideMatrix(nm::matrix::CsrMatrix rhs_matrix)
+{
+    rhs_matrix_ = std::move(rhs_matrix);
+    first_same_as_last_ = false;
+}
+
+void TimeVariable::SetTolerances(const double absolute_tolerance, const double relative_tolerance)
+{
+    absolute_tolerance_ = absolute_tolerance;
+    relative_tolerance_ = relative_tolerance;
 }
 
 void TimeVariable::Step(const std::vector<double>& wave_speeds)
@@ -73,121 +138,384 @@ void TimeVariable::Step(const std::vector<double>& wave_speeds)
 }
 
 void TimeVariable::Run()
+{
+    Run(StepObserver{});
+}
+
+void TimeVariable::Run(const StepObserver& observer)
 {
     assert(start_time_ != end_time_);
-    assert(delta_t_ != 0.0);
     assert(time_discretization_method_ != TimeDiscretizationMethod::kInvalid);
 
+    if (IsAdaptive())
+    {
+        RunAdaptive(observer);
+        return;
+    }
+    assert(delta_t_ != 0.0);
+
     const auto number_of_steps = static_cast<std::int32_t>((end_time_ - start_time_) / delta_t_);
 
-    if (time_discretization_method_ == TimeDiscretizationMethod::kEulerStep)
+    if (observer)
     {
-        for (std::int32_t n = 0; n < number_of_steps; ++n)
+        observer(0, start_time_, u_current_);
+    }
+    for (std::int32_t n = 0; n < number_of_steps; ++n)
+    {
+        StepOnce();
+        if (observer)
         {
-            const auto rhs_multiplied = nm::matrix::MatMult(rhs_matrix_, u_previous_);
-            const auto rhs_delta_t = nm::matrix::ScalarMultiply(delta_t_, rhs_multiplied);
-            u_current_ = nm::matrix::AddVectors(u_previous_, rhs_delta_t);
-            u_previous_ = u_current_;
+            observer(n + 1, start_time_ + (n + 1) * delta_t_, u_current_);
         }
     }
-    else if (time_discretization_method_ == TimeDiscretizationMethod::kRungeKutta2)
+}
+
+void TimeVariable::StepOnce()
+{
+    namespace expressions = nm::matrix::expressions;
+    using expressions::Lazy;
+
+    ResizeWorkspace();
+
+    if (IsAdaptive())
     {
-        for (std::int32_t n = 0; n < number_of_steps; ++n)
+        if (next_delta_t_ <= 0.0)
         {
-            const auto rhs_multiplied = nm::matrix::MatMult(rhs_matrix_, u_previous_);
-            const auto k1 = nm::matrix::ScalarMultiply(delta_t_, rhs_multiplied);
+            StartAdaptiveRun();
+        }
+        AdaptiveStep(std::numeric_limits<double>::infinity());
+        u_previous_ = u_current_;
+        return;
+    }
+    assert(delta_t_ != 0.0);
 
-            const auto u_hat = nm::matrix::AddVectors(u_previous_, k1);
-            const auto u_hat_multiplied = nm::matrix::MatMult(rhs_matrix_, u_hat);
-            const auto k2 = nm::matrix::ScalarMultiply(delta_t_, u_hat_multiplied);
+    if (time_discretization_method_ == TimeDiscretizationMethod::kEulerStep)
+    {
+        // u_n+1 = u_n + dt * R * u_n
+        u_current_ = u_previous_;
+        nm::matrix::SpMV(delta_t_, rhs_matrix_, u_previous_, 1.0, u_current_);
+        u_previous_ = u_current_;
+    }
+    else if (time_discretization_method_ == TimeDiscretizationMethod::kRungeKutta2)
+    {
+        // k1 = dt * R * u_n, k2 = dt * R * (u_n + k1), u_n+1 = u_n + (k1 + k2) / 2
+        nm::matrix::SpMV(delta_t_, rhs_matrix_, u_previous_, 0.0, k1_);
 
-            const auto k1_plus_k2 = nm::matrix::AddVectors(k1, k2);
-            const auto k1_plus_k2_by_2 = nm::matrix::ScalarMultiply(0.5, k1_plus_k2);
+        expressions::Assign(u_stage_, Lazy(u_previous_) + Lazy(k1_));
+        nm::matrix::SpMV(delta_t_, rhs_matrix_, u_stage_, 0.0, k2_);
 
-            u_current_ = nm::matrix::AddVectors(u_previous_, k1_plus_k2_by_2);
-            u_previous_ = u_current_;
-        }
+        expressions::Assign(u_current_, Lazy(u_previous_) + 0.5 * (Lazy(k1_) + Lazy(k2_)));
+        u_previous_ = u_current_;
     }
     else if (time_discretization_method_ == TimeDiscretizationMethod::kRungeKutta4)
     {
-        for (std::int32_t n = 0; n < number_of_steps; ++n)
-        {
-            const auto k1 = nm::matrix::MatMult(rhs_matrix_, u_previous_);
-            const auto k1_x_delta_t_by_2 = nm::matrix::ScalarMultiply(delta_t_ / 2, k1);
+        nm::matrix::SpMV(1.0, rhs_matrix_, u_previous_, 0.0, k1_);
 
-            const auto u_hat_k1 = nm::matrix::AddVectors(u_previous_, k1_x_delta_t_by_2);
-            const auto k2 = nm::matrix::MatMult(rhs_matrix_, u_hat_k1);
+        expressions::Assign(u_stage_, Lazy(u_previous_) + delta_t_ / 2 * Lazy(k1_));
+        nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k2_);
 
-            const auto k2_x_delta_t_by_2 = nm::matrix::ScalarMultiply(delta_t_ / 2, k2);
-            const auto u_hat_k2 = nm::matrix::AddVectors(u_previous_, k2_x_delta_t_by_2);
-            const auto k3 = nm::matrix::MatMult(rhs_matrix_, u_hat_k2);
+        expressions::Assign(u_stage_, Lazy(u_previous_) + delta_t_ / 2 * Lazy(k2_));
+        nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k3_);
 
-            const auto k3_x_delta_t = nm::matrix::ScalarMultiply(delta_t_, k3);
-            const auto u_hat_k3 = nm::matrix::AddVectors(u_previous_, k3_x_delta_t);
-            const auto k4 = nm::matrix::MatMult(rhs_matrix_, u_hat_k3);
+        expressions::Assign(u_stage_, Lazy(u_previous_) + delta_t_ * Lazy(k3_));
+        nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k4_);
 
-            const auto sum1 = nm::matrix::AddVectors(k1, nm::matrix::ScalarMultiply(2.0, k2));
-            const auto sum2 = nm::matrix::AddVectors(sum1, nm::matrix::ScalarMultiply(2.0, k3));
-            const auto sum3 = nm::matrix::AddVectors(sum2, k4);
+        // u_n+1 = u_n + dt / 6 * (k1 + 2 * k2 + 2 * k3 + k4), fused into a single pass over the five vectors
+        expressions::Assign(u_current_,
+                            Lazy(u_previous_) +
+                                delta_t_ / 6 * (Lazy(k1_) + 2.0 * Lazy(k2_) + 2.0 * Lazy(k3_) + Lazy(k4_)));
+        u_previous_ = u_current_;
+    }
+}
 
-            const auto update = nm::matrix::ScalarMultiply(delta_t_ / 6, sum3);
+void TimeVariable::ResizeWorkspace()
+{
+    const auto n = u_previous_.size();
+    if (k1_.size() == n && (!IsAdaptive() || k7_.size() == n))
+    {
+        return;
+    }
 
-            u_current_ = nm::matrix::AddVectors(u_previous_, update);
-            u_previous_ = u_current_;
-        }
+    k1_.assign(n, 0.0);
+    k2_.assign(n, 0.0);
+    k3_.assign(n, 0.0);
+    k4_.assign(n, 0.0);
+    u_stage_.assign(n, 0.0);
+    if (IsAdaptive())
+    {
+        k5_.assign(n, 0.0);
+        k6_.assign(n, 0.0);
+        k7_.assign(n, 0.0);
+        u_dense_.assign(n, 0.0);
     }
+    first_same_as_last_ = false;
 }
 
-void TimeVariable::StepOnce()
+bool TimeVariable::IsAdaptive() const
 {
-    assert(delta_t_ != 0.0);
+    return time_discretization_method_ == TimeDiscretizationMethod::kDormandPrince54 ||
+           time_discretization_method_ == TimeDiscretizationMethod::kBogackiShampine32;
+}
 
-    if (time_discretization_method_ == TimeDiscretizationMethod::kEulerStep)
+void TimeVariable::RunAdaptive(const StepObserver& observer)
+{
+    ResizeWorkspace();
+    StartAdaptiveRun();
+
+    const auto time_tolerance = kMinimumStepFraction * std::abs(end_time_ - start_time_);
+    auto next_output = std::lower_bound(output_times_.cbegin(), output_times_.cend(), start_time_ - time_tolerance);
+    std::int32_t report{0};
+    if (observer && output_times_.empty())
+    {
+        observer(report++, start_time_, u_current_);
+    }
+    for (; observer && next_output != output_times_.cend() && *next_output <= start_time_ + time_tolerance;
+         ++next_output)
+    {
+        observer(report++, *next_output, u_current_);
+    }
+
+    auto time = start_time_;
+    while (end_time_ - time > time_tolerance)
     {
-        const auto rhs_multiplied = nm::matrix::MatMult(rhs_matrix_, u_previous_);
-        const auto rhs_delta_t = nm::matrix::ScalarMultiply(delta_t_, rhs_multiplied);
-        u_current_ = nm::matrix::AddVectors(u_previous_, rhs_delta_t);
+        const auto remaining = end_time_ - time;
+        AdaptiveStep(remaining);
+        const auto step_start = time;
+        time = last_delta_t_ >= remaining ? end_time_ : time + last_delta_t_;
+
+        if (observer && output_times_.empty())
+        {
+            observer(report++, time, u_current_);
+        }
+        for (; observer && next_output != output_times_.cend() && *next_output <= time + time_tolerance; ++next_output)
+        {
+            InterpolateLastStep(std::min((*next_output - step_start) / last_delta_t_, 1.0));
+            observer(report++, *next_output, u_dense_);
+        }
         u_previous_ = u_current_;
     }
-    else if (time_discretization_method_ == TimeDiscretizationMethod::kRungeKutta2)
+}
+
+void TimeVariable::StartAdaptiveRun()
+{
+    namespace expressions = nm::matrix::expressions;
+    using expressions::Lazy;
+
+    number_of_accepted_steps_ = 0;
+    number_of_rejected_steps_ = 0;
+    previous_error_ = 1.0;
+    first_same_as_last_ = false;
+
+    const auto span = std::abs(end_time_ - start_time_) > 0.0 ? std::abs(end_time_ - start_time_)
+                                                                : std::numeric_limits<double>::infinity();
+    if (delta_t_ > 0.0)
     {
-        const auto rhs_multiplied = nm::matrix::MatMult(rhs_matrix_, u_previous_);
-        const auto k1 = nm::matrix::ScalarMultiply(delta_t_, rhs_multiplied);
+        next_delta_t_ = std::min(delta_t_, span);
+        return;
+    }
 
-        const auto u_hat = nm::matrix::AddVectors(u_previous_, k1);
-        const auto u_hat_multiplied = nm::matrix::MatMult(rhs_matrix_, u_hat);
-        const auto k2 = nm::matrix::ScalarMultiply(delta_t_, u_hat_multiplied);
+    // Explicit methods need |lambda| * dt inside the stability region for every eigenvalue lambda of R
+    const auto spectral_radius = SpectralRadiusBound(rhs_matrix_);
+    const auto stable_delta_t = spectral_radius > 0.0 ? StabilityLimit(time_discretization_method_) / spectral_radius
+                                                       : std::numeric_limits<double>::infinity();
+
+    // Hairer, Norsett and Wanner, Solving Ordinary Differential Equations I, II.4: a step over which an explicit Euler
+    // step changes u by about 1% of its scale, then refined with the change of R * u over that step
+    const auto n = u_previous_.size();
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_previous_, 0.0, k1_);
+    double u_norm{0.0};
+    double rate_norm{0.0};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto scale = absolute_tolerance_ + relative_tolerance_ * std::abs(u_previous_[i]);
+        u_norm += (u_previous_[i] / scale) * (u_previous_[i] / scale);
+        rate_norm += (k1_[i] / scale) * (k1_[i] / scale);
+    }
+    u_norm = std::sqrt(u_norm / static_cast<double>(std::max<std::size_t>(n, 1)));
+    rate_norm = std::sqrt(rate_norm / static_cast<double>(std::max<std::size_t>(n, 1)));
 
-        const auto k1_plus_k2 = nm::matrix::AddVectors(k1, k2);
-        const auto k1_plus_k2_by_2 = nm::matrix::ScalarMultiply(0.5, k1_plus_k2);
+    auto trial_delta_t = (u_norm < 1e-5 || rate_norm < 1e-5) ? 1e-6 : 0.01 * u_norm / rate_norm;
+    trial_delta_t = std::min({trial_delta_t, stable_delta_t, span});
 
-        u_current_ = nm::matrix::AddVectors(u_previous_, k1_plus_k2_by_2);
-        u_previous_ = u_current_;
+    expressions::Assign(u_stage_, Lazy(u_previous_) + trial_delta_t * Lazy(k1_));
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k2_);
+    double change_norm{0.0};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto scale = absolute_tolerance_ + relative_tolerance_ * std::abs(u_previous_[i]);
+        change_norm += ((k2_[i] - k1_[i]) / scale) * ((k2_[i] - k1_[i]) / scale);
     }
-    else if (time_discretization_method_ == TimeDiscretizationMethod::kRungeKutta4)
+    change_norm = std::sqrt(change_norm / static_cast<double>(std::max<std::size_t>(n, 1))) / trial_delta_t;
+
+    const auto largest_norm = std::max(rate_norm, change_norm);
+    const auto order = ControllerOrder(time_discretization_method_);
+    const auto refined_delta_t =
+        largest_norm <= 1e-15 ? std::max(1e-6, trial_delta_t * 1e-3) : std::pow(0.01 / largest_norm, 1.0 / order);
+    next_delta_t_ = std::min({100.0 * trial_delta_t, refined_delta_t, stable_delta_t, span});
+}
+
+void TimeVariable::AdaptiveStep(const double max_step)
+{
+    const auto method = time_discretization_method_;
+    auto& last_stage = method == TimeDiscretizationMethod::kDormandPrince54 ? k7_ : k4_;
+    if (first_same_as_last_)
+    {
+        std::swap(k1_, last_stage);
+    }
+    else
+    {
+        nm::matrix::SpMV(1.0, rhs_matrix_, u_previous_, 0.0, k1_);
+    }
+    first_same_as_last_ = false;
+
+    const auto order = ControllerOrder(method);
+    const auto minimum_delta_t =
+        std::max(kMinimumStepFraction * std::abs(end_time_ - start_time_), std::numeric_limits<double>::min());
+    auto delta_t = std::min(next_delta_t_, max_step);
+    auto rejected = false;
+    while (true)
+    {
+        const auto error = method == TimeDiscretizationMethod::kDormandPrince54 ? DormandPrinceStep(delta_t)
+                                                                                  : BogackiShampineStep(delta_t);
+        if (error <= 1.0)
+        {
+            // PI controller, Gustafsson's weights 0.7 and 0.4 damp the oscillation of the pure error based step size
+            auto factor = kSafetyFactor * std::pow(std::max(error, kMinimumPreviousError), -0.7 / order) *
+                          std::pow(previous_error_, 0.4 / order);
+            factor = std::clamp(factor, kMinimumStepFactor, rejected ? 1.0 : kMaximumStepFactor);
+
+            previous_error_ = std::max(error, kMinimumPreviousError);
+            last_delta_t_ = delta_t;
+            next_delta_t_ = delta_t * factor;
+            first_same_as_last_ = true;
+            ++number_of_accepted_steps_;
+            return;
+        }
+
+        ++number_of_rejected_steps_;
+        rejected = true;
+        // NaN errors fail the comparison above as well and shrink the step until it underflows
+        const auto factor = std::isnan(error)
+                                ? kMinimumStepFactor
+                                : std::max(kMinimumStepFactor, kSafetyFactor * std::pow(error, -1.0 / order));
+        delta_t *= factor;
+        if (delta_t < minimum_delta_t)
+        {
+            throw std::runtime_error("TimeVariable: the adaptive step size underflowed, the tolerances cannot be met");
+        }
+    }
+}
+
+
+double TimeVariable::DormandPrinceStep(const double delta_t)
+{
+    namespace expressions = nm::matrix::expressions;
+    using expressions::Lazy;
+    const auto h = delta_t;
+
+    // Dormand and Prince, A family of embedded Runge-Kutta formulae, 1980. k1 = R * u_n is already set
+    expressions::Assign(u_stage_, Lazy(u_previous_) + h / 5.0 * Lazy(k1_));
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k2_);
+
+    expressions::Assign(u_stage_, Lazy(u_previous_) + h * (3.0 / 40.0 * Lazy(k1_) + 9.0 / 40.0 * Lazy(k2_)));
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k3_);
+
+    expressions::Assign(u_stage_,
+                        Lazy(u_previous_) +
+                            h * (44.0 / 45.0 * Lazy(k1_) - 56.0 / 15.0 * Lazy(k2_) + 32.0 / 9.0 * Lazy(k3_)));
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k4_);
+
+    expressions::Assign(u_stage_,
+                        Lazy(u_previous_) + h * (19372.0 / 6561.0 * Lazy(k1_) - 25360.0 / 2187.0 * Lazy(k2_) +
+                                                 64448.0 / 6561.0 * Lazy(k3_) - 212.0 / 729.0 * Lazy(k4_)));
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k5_);
+
+    expressions::Assign(u_stage_,
+                        Lazy(u_previous_) + h * (9017.0 / 3168.0 * Lazy(k1_) - 355.0 / 33.0 * Lazy(k2_) +
+                                                 46732.0 / 5247.0 * Lazy(k3_) + 49.0 / 176.0 * Lazy(k4_) -
+                                                 5103.0 / 18656.0 * Lazy(k5_)));
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k6_);
+
+    // Fifth order solution, its R * u_n+1 is the seventh stage and the first of the next step
+    expressions::Assign(u_current_,
+                        Lazy(u_previous_) + h * (35.0 / 384.0 * Lazy(k1_) + 500.0 / 1113.0 * Lazy(k3_) +
+                                                 125.0 / 192.0 * Lazy(k4_) - 2187.0 / 6784.0 * Lazy(k5_) +
+                                                 11.0 / 84.0 * Lazy(k6_)));
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_current_, 0.0, k7_);
+
+    // Difference to the embedded fourth order solution, in units of the tolerance
+    double error{0.0};
+    for (std::size_t i = 0; i < u_current_.size(); ++i)
     {
-        const auto k1 = nm::matrix::MatMult(rhs_matrix_, u_previous_);
-        const auto k1_x_delta_t_by_2 = nm::matrix::ScalarMultiply(delta_t_ / 2, k1);
+        const auto local_error = h * (71.0 / 57600.0 * k1_[i] - 71.0 / 16695.0 * k3_[i] + 71.0 / 1920.0 * k4_[i] -
+                                      17253.0 / 339200.0 * k5_[i] + 22.0 / 525.0 * k6_[i] - 1.0 / 40.0 * k7_[i]);
+        const auto scale =
+            absolute_tolerance_ + relative_tolerance_ * std::max(std::abs(u_previous_[i]), std::abs(u_current_[i]));
+        error += (local_error / scale) * (local_error / scale);
+    }
+    return std::sqrt(error / static_cast<double>(std::max<std::size_t>(u_current_.size(), 1)));
+}
 
-        const auto u_hat_k1 = nm::matrix::AddVectors(u_previous_, k1_x_delta_t_by_2);
-        const auto k2 = nm::matrix::MatMult(rhs_matrix_, u_hat_k1);
+double TimeVariable::BogackiShampineStep(const double delta_t)
+{
+    namespace expressions = nm::matrix::expressions;
+    using expressions::Lazy;
+    const auto h = delta_t;
 
-        const auto k2_x_delta_t_by_2 = nm::matrix::ScalarMultiply(delta_t_ / 2, k2);
-        const auto u_hat_k2 = nm::matrix::AddVectors(u_previous_, k2_x_delta_t_by_2);
-        const auto k3 = nm::matrix::MatMult(rhs_matrix_, u_hat_k2);
+    // Bogacki and Shampine, A 3(2) pair of Runge-Kutta formulas, 1989. k1 = R * u_n is already set
+    expressions::Assign(u_stage_, Lazy(u_previous_) + h / 2.0 * Lazy(k1_));
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k2_);
 
-        const auto k3_x_delta_t = nm::matrix::ScalarMultiply(delta_t_, k3);
-        const auto u_hat_k3 = nm::matrix::AddVectors(u_previous_, k3_x_delta_t);
-        const auto k4 = nm::matrix::MatMult(rhs_matrix_, u_hat_k3);
+    expressions::Assign(u_stage_, Lazy(u_previous_) + 3.0 * h / 4.0 * Lazy(k2_));
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_stage_, 0.0, k3_);
 
-        const auto sum1 = nm::matrix::AddVectors(k1, nm::matrix::ScalarMultiply(2.0, k2));
-        const auto sum2 = nm::matrix::AddVectors(sum1, nm::matrix::ScalarMultiply(2.0, k3));
-        const auto sum3 = nm::matrix::AddVectors(sum2, k4);
+    // Third order solution, its R * u_n+1 is the fourth stage and the first of the next step
+    expressions::Assign(
+        u_current_, Lazy(u_previous_) + h * (2.0 / 9.0 * Lazy(k1_) + 1.0 / 3.0 * Lazy(k2_) + 4.0 / 9.0 * Lazy(k3_)));
+    nm::matrix::SpMV(1.0, rhs_matrix_, u_current_, 0.0, k4_);
 
-        const auto update = nm::matrix::ScalarMultiply(delta_t_ / 6, sum3);
+    // Difference to the embedded second order solution, in units of the tolerance
+    double error{0.0};
+    for (std::size_t i = 0; i < u_current_.size(); ++i)
+    {
+        const auto local_error =
+            h * (-5.0 / 72.0 * k1_[i] + 1.0 / 12.0 * k2_[i] + 1.0 / 9.0 * k3_[i] - 1.0 / 8.0 * k4_[i]);
+        const auto scale =
+            absolute_tolerance_ + relative_tolerance_ * std::max(std::abs(u_previous_[i]), std::abs(u_current_[i]));
+        error += (local_error / scale) * (local_error / scale);
+    }
+    return std::sqrt(error / static_cast<double>(std::max<std::size_t>(u_current_.size(), 1)));
+}
 
-        u_current_ = nm::matrix::AddVectors(u_previous_, update);
-        u_previous_ = u_current_;
+void TimeVariable::InterpolateLastStep(const double theta)
+{
+    const auto h = last_delta_t_;
+    const auto s = theta;
+    const auto s1 = 1.0 - theta;
+
+    if (time_discretization_method_ == TimeDiscretizationMethod::kDormandPrince54)
+    {
+        // Fourth order continuous extension of Shampine, 1986, in the form of Hairer's DOPRI5
+        for (std::size_t i = 0; i < u_dense_.size(); ++i)
+        {
+            const auto difference = u_current_[i] - u_previous_[i];
+            const auto b = h * k1_[i] - difference;
+            const auto c = difference - h * k7_[i] - b;
+            const auto d = h * (-12715105075.0 / 11282082432.0 * k1_[i] + 87487479700.0 / 32700410799.0 * k3_[i] -
+                                10690763975.0 / 1880347072.0 * k4_[i] + 701980252875.0 / 199316789632.0 * k5_[i] -
+                                1453857185.0 / 822651844.0 * k6_[i] + 69997945.0 / 29380423.0 * k7_[i]);
+            u_dense_[i] = u_previous_[i] + s * (difference + s1 * (b + s * (c + s1 * d)));
+        }
+    }
+    else
+    {
+        // Cubic Hermite interpolation of u and R * u at both ends, third order like the step
+        for (std::size_t i = 0; i < u_dense_.size(); ++i)
+        {
+            const auto difference = u_current_[i] - u_previous_[i];
+            u_dense_[i] = u_previous_[i] + s * difference -
+                          s * s1 * ((1.0 - 2.0 * s) * difference - s1 * h * k1_[i] + s * h * k4_[i]);
+        }
     }
 }
 
@@ -195,8 +523,19 @@ void TimeVariable::Reset()
 {
     u_current_.clear();
     u_previous_.clear();
-    rhs_matrix_.clear();
+    rhs_matrix_ = nm::matrix::CsrMatrix{};
     M_.clear();
+    k1_.clear();
+    k2_.clear();
+    k3_.clear();
+    k4_.clear();
+    u_stage_.clear();
+    k5_.clear();
+    k6_.clear();
+    k7_.clear();
+    u_dense_.clear();
+    next_delta_t_ = 0.0;
+    first_same_as_last_ = false;
 }
 
 }  // namespace pde
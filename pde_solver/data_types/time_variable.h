@@ -9,7 +9,11 @@
 #ifndef PDE_SOLVER_DATA_TYPES_TIME_VARIABLE_H
 #define PDE_SOLVER_DATA_TYPES_TIME_VARIABLE_H
 
+#include "matrix_solvers/sparse/sparse_matrix.h"
 #include "pde_solver/data_types/spatial_variable.h"
+#include <cstdint>
+#include <functional>
+#include <utility>
 #include <vector>
 
 namespace pde
@@ -20,12 +24,19 @@ enum class TimeDiscretizationMethod
     kEulerStep = 0,
     kRungeKutta4,
     kRungeKutta2,
+    // Embedded pairs with adaptive step size, delta_t is only the first step tried, see SetTolerances
+    kDormandPrince54,
+    kBogackiShampine32,
     kInvalid,
 };
 
 class TimeVariable
 {
   public:
+    /// Told the step number, the time start + step * delta_t and the solution, e.g. to hand snapshots to a writer
+    using StepObserver =
+        std::function<void(const std::int32_t step, const double time, const std::vector<double>& u)>;
+
     TimeVariable() : time_discretization_method_{TimeDiscretizationMethod::kInvalid} {}
     TimeVariable(const SpatialVariable& u);
 
@@ -38,7 +49,10 @@ class TimeVariable
           M_(other.M_),
           start_time_(other.start_time_),
           end_time_(other.end_time_),
-          delta_t_(other.delta_t_)
+          delta_t_(other.delta_t_),
+          absolute_tolerance_(other.absolute_tolerance_),
+          relative_tolerance_(other.relative_tolerance_),
+          output_times_(other.output_times_)
     {
     }
 
@@ -59,6 +73,9 @@ class TimeVariable
             start_time_ = other.start_time_;
             end_time_ = other.end_time_;
             delta_t_ = other.delta_t_;
+            absolute_tolerance_ = other.absolute_tolerance_;
+            relative_tolerance_ = other.relative_tolerance_;
+            output_times_ = other.output_times_;
         }
 
         return *this;
@@ -71,11 +88,34 @@ class TimeVariable
     void SetStartTime(const double start_time) { start_time_ = start_time; };
     void SetEndTime(const double end_time) { end_time_ = end_time; };
     void SetTimeStep(const double delta_t) { delta_t_ = delta_t; };
+
+    /// @brief Error allowed per step of the adaptive methods, absolute + relative * |u| for every unknown
+    ///
+    /// Steps whose error estimate exceeds it are repeated with a smaller step. Defaults to 1e-8 and 1e-6.
+    void SetTolerances(const double absolute_tolerance, const double relative_tolerance);
+
+    /// @brief Times, in increasing order, at which Run of an adaptive method reports the solution
+    ///
+    /// The solution at these times is interpolated within the steps that cover them, so the step sizes stay the ones
+    /// the error control picks. Without output times Run reports the solution after every accepted step.
+    void SetOutputTimes(std::vector<double> output_times) { output_times_ = std::move(output_times); }
     void SetInitialCondition(const std::vector<double>& u_initial);
     void SetDirichletBoundaryCondition();
     void SetRightHandSideMatrix(const nm::matrix::Matrix<double>& rhs);
+    void SetRightHandSideMatrix(nm::matrix::CsrMatrix rhs);
     void Step(const std::vector<double>& wave_speeds);
     void Run();
+
+    /// @brief Run that reports the initial condition as step 0 and the solution after every step to observer
+    ///
+    /// With output times set, adaptive methods instead report the solution at these times and step numbers the
+    /// reports from 0. The solution is only valid during the call, an observer that keeps it copies it.
+    ///
+    /// @throws std::runtime_error: when an adaptive method cannot meet the tolerances with a step above 1e-12 of the
+    /// time span, e.g. because the solution blows up
+    void Run(const StepObserver& observer);
+
+    /// @brief Advances by delta_t, or by one accepted step of the adaptive methods
     void StepOnce();
     void GenerateMassMatrix();
     void InitializeWithSpatialVariable(const SpatialVariable& u);
@@ -84,15 +124,62 @@ class TimeVariable
 
     std::vector<double>& GetTimeVariable() { return u_current_; }
 
+    /// @brief Steps of the last adaptive Run that met the tolerances and that had to be repeated
+    std::int32_t GetNumberOfAcceptedSteps() const { return number_of_accepted_steps_; }
+    std::int32_t GetNumberOfRejectedSteps() const { return number_of_rejected_steps_; }
+
   private:
+    /// @brief Sizes the stage buffers to the current solution, a no-op once they match
+    void ResizeWorkspace();
+
+    bool IsAdaptive() const;
+    void RunAdaptive(const StepObserver& observer);
+
+    /// @brief Resets the step size controller and picks the first step, delta_t when set and otherwise from the
+    /// scale of u and R * u, capped by the explicit stability limit of R
+    void StartAdaptiveRun();
+
+    /// @brief Takes one step of at most max_step that meets the tolerances, from u_previous_ into u_current_
+    void AdaptiveStep(const double max_step);
+
+    /// @brief Stages of a step of size delta_t from u_previous_, returns the error estimate relative to the tolerances
+    double DormandPrinceStep(const double delta_t);
+    double BogackiShampineStep(const double delta_t);
+
+    /// @brief Solution at u_previous_ + theta * step of the last accepted step, theta in [0, 1], into u_dense_
+    void InterpolateLastStep(const double theta);
+
     TimeDiscretizationMethod time_discretization_method_;
     std::vector<double> u_current_{};
     std::vector<double> u_previous_{};
-    nm::matrix::Matrix<double> rhs_matrix_{};
+    nm::matrix::CsrMatrix rhs_matrix_{};
     nm::matrix::Matrix<double> M_{};
     double start_time_{};
     double end_time_{};
     double delta_t_{};
+
+    // Runge-Kutta stage buffers, reused by every step so that stepping does not allocate
+    std::vector<double> k1_{};
+    std::vector<double> k2_{};
+    std::vector<double> k3_{};
+    std::vector<double> k4_{};
+    std::vector<double> u_stage_{};
+
+    // Adaptive methods, k5_ to k7_ are the remaining Dormand-Prince stages and u_dense_ the interpolated solution
+    double absolute_tolerance_{1e-8};
+    double relative_tolerance_{1e-6};
+    std::vector<double> output_times_{};
+    std::vector<double> k5_{};
+    std::vector<double> k6_{};
+    std::vector<double> k7_{};
+    std::vector<double> u_dense_{};
+    double next_delta_t_{0.0};
+    double last_delta_t_{0.0};
+    double previous_error_{1.0};
+    // The last stage of the accepted step is R * u_previous_, the first stage of the next step
+    bool first_same_as_last_{false};
+    std::int32_t number_of_accepted_steps_{0};
+    std::int32_t number_of_rejected_steps_{0};
 };
 
 }  // namespace pde
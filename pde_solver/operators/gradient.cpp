@@ -5,6 +5,11 @@
  */
 
 #include "pde_solver/operators/gradient.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace pde
 {
@@ -23,51 +28,97 @@ void GradientOperator::GenerateMatrixForSpatialVariable(SpatialVariable& u)
 {
 
     // Get spatial variable
-    matrix_size_ = u.GetGrid().GetNumberOfNodes();
-    const auto grid_dimension = u.GetGrid().GetDimension();
+    const auto& grid = u.GetGrid();
+    matrix_size_ = grid.GetNumberOfNodes();
+    const auto grid_dimension = grid.GetDimension();
 
-    const auto elements = u.GetGrid().GetElementsMutable();
-
-    double delta_x{};
     if (grid_dimension == 1)
     {
 
-        // Generate the gradient matrix
-        nm::matrix::Matrix<double> gradient_matrix{};
-
-        gradient_matrix.resize(matrix_size_);
+        // Generate the gradient matrix, a two point upwind stencil written in CSR order
+        std::vector<std::int32_t> row_offsets(static_cast<std::size_t>(matrix_size_) + 1);
+        std::vector<std::int32_t> column_indices{};
+        std::vector<double> values{};
+        column_indices.reserve(2 * static_cast<std::size_t>(matrix_size_));
+        values.reserve(2 * static_cast<std::size_t>(matrix_size_));
 
-        // Fill the gradient matrix with finite difference coefficients
+        // Fill the gradient matrix with finite difference coefficients, row i takes the spacing of the element to
+        // its left and the first row that of the first element
         for (std::int32_t i = 0; i < matrix_size_; ++i)
         {
-            gradient_matrix.at(i).resize(matrix_size_);
+            const auto delta_x = grid.GetElementLength((i == 0) ? 0 : i - 1);
+            if (i > 0)
+            {
+                column_indices.push_back(i - 1);
+                values.push_back(-wave_speed_ / delta_x);
+            }
+            column_indices.push_back(i);
+            values.push_back(wave_speed_ / delta_x);
+            row_offsets[static_cast<std::size_t>(i) + 1] = static_cast<std::int32_t>(column_indices.size());
+        }
 
-            if (i == 0)
+        u.SetStiffnessMatrix(nm::matrix::CsrMatrix{matrix_size_,
+                                                   matrix_size_,
+                                                   std::move(row_offsets),
+                                                   std::move(column_indices),
+                                                   std::move(values)});
+    }
+}
+
+nm::matrix::CsrMatrix GradientOperator::GenerateMatrixForStructuredGrid(const geometry::StructuredGrid& grid,
+                                                                        const geometry::Axis axis) const
+{
+    if (static_cast<std::int8_t>(axis) >= grid.GetDimension())
+    {
+        throw std::invalid_argument("GradientOperator: the axis is beyond the dimension of the grid");
+    }
+
+    const auto number_of_nodes = grid.GetNumberOfNodes();
+    const auto n = grid.GetNumberOfNodes(axis);
+    const auto stride = grid.GetStride(axis);
+    const auto backward = wave_speed_ >= 0.0;
+
+    std::vector<std::int32_t> row_offsets{};
+    std::vector<std::int32_t> column_indices{};
+    std::vector<double> values{};
+    row_offsets.reserve(static_cast<std::size_t>(number_of_nodes) + 1);
+    column_indices.reserve(2 * static_cast<std::size_t>(number_of_nodes));
+    values.reserve(2 * static_cast<std::size_t>(number_of_nodes));
+    row_offsets.push_back(0);
+
+    for (std::int32_t row{0}; row < number_of_nodes; ++row)
+    {
+        const auto p = (row / stride) % n;
+        if (backward)
+        {
+            const auto delta_x = grid.GetSpacing(axis, (p > 0) ? p - 1 : p);
+            if (p > 0)
             {
-                delta_x = std::abs(elements.at(i).GetNodes().at(0).GetValues().at(0).value() -
-                                   elements.at(i).GetNodes().at(1).GetValues().at(0).value());
-                gradient_matrix.at(i).at(i) = wave_speed_ / delta_x;
-                gradient_matrix.at(i).at(i + 1) = 0.0;
-                continue;
+                column_indices.push_back(row - stride);
+                values.push_back(-wave_speed_ / delta_x);
             }
-            if (i == matrix_size_ - 1)
+            column_indices.push_back(row);
+            values.push_back(wave_speed_ / delta_x);
+        }
+        else
+        {
+            const auto delta_x = grid.GetSpacing(axis, (p < n - 1) ? p : p - 1);
+            column_indices.push_back(row);
+            values.push_back(-wave_speed_ / delta_x);
+            if (p < n - 1)
             {
-                delta_x = std::abs(elements.at(i - 1).GetNodes().at(0).GetValues().at(0).value() -
-                                   elements.at(i - 1).GetNodes().at(1).GetValues().at(0).value());
-                gradient_matrix.at(i).at(i - 1) = -wave_speed_ / delta_x;
-                gradient_matrix.at(i).at(i) = wave_speed_ / delta_x;
-                continue;
+                column_indices.push_back(row + stride);
+                values.push_back(wave_speed_ / delta_x);
             }
-
-            delta_x = std::abs(elements.at(i - 1).GetNodes().at(0).GetValues().at(0).value() -
-                               elements.at(i - 1).GetNodes().at(1).GetValues().at(0).value());
-            gradient_matrix.at(i).at(i - 1) = -wave_speed_ / delta_x;
-            gradient_matrix.at(i).at(i) = wave_speed_ / delta_x;
-            gradient_matrix.at(i).at(i + 1) = 0.0;
         }
-
-        u.SetStiffnessMatrix(gradient_matrix);
+        row_offsets.push_back(static_cast<std::int32_t>(column_indices.size()));
     }
+
+    return nm::matrix::CsrMatrix{number_of_nodes,
+                                 number_of_nodes,
+                                 std::move(row_offsets),
+                                 std::move(column_indices),
+                                 std::move(values)};
 }
 
 }  // namespace operators
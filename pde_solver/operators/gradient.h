@@ -7,8 +7,10 @@
 #ifndef PDE_SOLVER_OPERATORS_GRADIENT_H
 #define PDE_SOLVER_OPERATORS_GRADIENT_H
 
+#include "matrix_solvers/sparse/sparse_matrix.h"
 #include "matrix_solvers/utilities.h"
 #include "pde_solver/data_types/spatial_variable.h"
+#include "pde_solver/data_types/structured_grid.h"
 #include <cstdint>
 
 namespace pde
@@ -22,6 +24,16 @@ class GradientOperator
   public:
     const nm::matrix::Matrix<double> GenerateMatrix();
     void GenerateMatrixForSpatialVariable(SpatialVariable& u);
+
+    /// @brief Assembles wave_speed * du/d(axis) on a structured grid with the first order upwind difference
+    ///
+    /// A positive wave speed takes the backward difference (u_i - u_i-1) / h like GenerateMatrixForSpatialVariable,
+    /// a negative one the forward difference (u_i+1 - u_i) / h. Nodes on the inflow boundary drop their upwind
+    /// neighbour. Summing the matrices of every axis gives the advection operator of a constant velocity.
+    ///
+    /// @throws std::invalid_argument: when axis is beyond the dimension of the grid
+    nm::matrix::CsrMatrix GenerateMatrixForStructuredGrid(const geometry::StructuredGrid& grid,
+                                                          const geometry::Axis axis) const;
     void SetSpatialVariable(const SpatialVariable& u_in);
     void SetWaveSpeed(const double wave_speed);
 
@@ -5,7 +5,12 @@
  */
 
 #include "pde_solver/operators/laplace.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace pde
@@ -14,6 +19,36 @@ namespace pde
 namespace operators
 {
 
+namespace
+{
+
+/// @brief Weights of the neighbours before and after every node along one axis of a structured grid
+struct AxisWeights
+{
+    std::vector<double> minus{};
+    std::vector<double> plus{};
+};
+
+AxisWeights CreateSecondDifferenceWeights(const geometry::StructuredGrid& grid,
+                                          const geometry::Axis axis,
+                                          const double scale)
+{
+    const auto n = grid.GetNumberOfNodes(axis);
+    AxisWeights weights{};
+    weights.minus.resize(static_cast<std::size_t>(n));
+    weights.plus.resize(static_cast<std::size_t>(n));
+    for (std::int32_t p{0}; p < n; ++p)
+    {
+        const auto h_minus = grid.GetSpacing(axis, (p > 0) ? p - 1 : p);
+        const auto h_plus = grid.GetSpacing(axis, (p < n - 1) ? p : p - 1);
+        weights.minus[static_cast<std::size_t>(p)] = scale * 2.0 / (h_minus * (h_minus + h_plus));
+        weights.plus[static_cast<std::size_t>(p)] = scale * 2.0 / (h_plus * (h_minus + h_plus));
+    }
+    return weights;
+}
+
+}  // namespace
+
 LaplaceOperator::LaplaceOperator(const SpatialVariable& u_in) : u_(&u_in)
 {
     dimension_ = static_cast<std::int8_t>(u_->GetGrid().GetDimension());
@@ -35,27 +70,27 @@ const nm::matrix::Matrix<double> LaplaceOperator::GenerateMatrix()
     nm::matrix::Matrix<double> output_matrix{};
     const std::vector<double> matrix_entries{-1.0, 2.0, -1.0};
 
-    const auto n = static_cast<std::int32_t>(u_->GetGrid().GetNumberOfNodes()) - u_->GetGrid().number_of_boundaries_;
+    const auto& grid = u_->GetGrid();
+    const auto n = grid.GetNumberOfNodes() - grid.GetNumberOfBoundaryNodes();
 
-    output_matrix.resize(n);
+    output_matrix.Resize(n, n);
     for (std::int32_t i{0}; i < n; ++i)
     {
-        output_matrix.at(i).resize(n);
         if (i == 0)
         {
-            output_matrix.at(i).at(i) = matrix_entries.at(1);
-            output_matrix.at(i).at(i + 1) = matrix_entries.at(2);
+            output_matrix(i, i) = matrix_entries.at(1);
+            output_matrix(i, i + 1) = matrix_entries.at(2);
         }
         else if (i == n - 1)
         {
-            output_matrix.at(i).at(i - 1) = matrix_entries.at(2);
-            output_matrix.at(i).at(i) = matrix_entries.at(1);
+            output_matrix(i, i - 1) = matrix_entries.at(2);
+            output_matrix(i, i) = matrix_entries.at(1);
         }
         else
         {
-            output_matrix.at(i).at(i - 1) = matrix_entries.at(0);
-            output_matrix.at(i).at(i) = matrix_entries.at(1);
-            output_matrix.at(i).at(i + 1) = matrix_entries.at(2);
+            output_matrix(i, i - 1) = matrix_entries.at(0);
+            output_matrix(i, i) = matrix_entries.at(1);
+            output_matrix(i, i + 1) = matrix_entries.at(2);
         }
     }
     return output_matrix;
@@ -63,42 +98,129 @@ const nm::matrix::Matrix<double> LaplaceOperator::GenerateMatrix()
 
 void LaplaceOperator::GenerateMatrixForSpatialVariable(SpatialVariable& u)
 {
-    const auto grid = u.GetGrid();
+    const auto& grid = u.GetGrid();
     matrix_size_ = static_cast<std::int32_t>(grid.GetNumberOfNodes());
-    nm::matrix::Matrix<double> output_matrix{};
-    const auto elements = u.GetGrid().GetElements();
 
-    output_matrix.resize(matrix_size_);
     if (grid.GetDimension() == 1)
     {
+        // Three point stencil, at most three entries per row written in CSR order, row i takes the spacing of
+        // element i and the last row that of the last element
+        std::vector<std::int32_t> row_offsets(static_cast<std::size_t>(matrix_size_) + 1);
+        std::vector<std::int32_t> column_indices{};
+        std::vector<double> values{};
+        column_indices.reserve(3 * static_cast<std::size_t>(matrix_size_));
+        values.reserve(3 * static_cast<std::size_t>(matrix_size_));
         for (std::int32_t i{0}; i < matrix_size_; ++i)
         {
-            output_matrix.at(i).resize(matrix_size_);
-            if (i == 0)
+            const auto delta_x = grid.GetElementLength((i == matrix_size_ - 1) ? i - 1 : i);
+            const auto weight = constant_diffusion_ / (delta_x * delta_x);
+            if (i > 0)
             {
-                const auto delta_x = std::abs(elements.at(i).GetNodes().at(0).GetValues().at(0).value() -
-                                              elements.at(i).GetNodes().at(1).GetValues().at(0).value());
-                output_matrix.at(i).at(i) = constant_diffusion_ / (delta_x * delta_x) * -2.0;
-                output_matrix.at(i).at(i + 1) = constant_diffusion_ / (delta_x * delta_x);
+                column_indices.push_back(i - 1);
+                values.push_back(weight);
             }
-            else if (i == matrix_size_ - 1)
+            column_indices.push_back(i);
+            values.push_back(weight * -2.0);
+            if (i < matrix_size_ - 1)
             {
-                const auto delta_x = std::abs(elements.at(i - 1).GetNodes().at(0).GetValues().at(0).value() -
-                                              elements.at(i - 1).GetNodes().at(1).GetValues().at(0).value());
-                output_matrix.at(i).at(i - 1) = constant_diffusion_ / (delta_x * delta_x);
-                output_matrix.at(i).at(i) = constant_diffusion_ / (delta_x * delta_x) * -2.0;
+                column_indices.push_back(i + 1);
+                values.push_back(weight);
             }
-            else
+            row_offsets[static_cast<std::size_t>(i) + 1] = static_cast<std::int32_t>(column_indices.size());
+        }
+        u.SetStiffnessMatrix(nm::matrix::CsrMatrix{matrix_size_,
+                                                   matrix_size_,
+                                                   std::move(row_offsets),
+                                                   std::move(column_indices),
+                                                   std::move(values)});
+    }
+}
+
+nm::matrix::StencilOperator1D LaplaceOperator::GenerateOperatorForSpatialVariable(const SpatialVariable& u) const
+{
+    const auto& grid = u.GetGrid();
+    if (grid.GetDimension() != 1)
+    {
+        throw std::invalid_argument("The matrix-free Laplace operator only supports 1D grids.");
+    }
+
+    const auto number_of_nodes = static_cast<std::int32_t>(grid.GetNumberOfNodes());
+
+    // Same element spacing per row as GenerateMatrixForSpatialVariable
+    std::vector<double> row_scales(static_cast<std::size_t>(number_of_nodes));
+    for (std::int32_t i{0}; i < number_of_nodes; ++i)
+    {
+        const auto delta_x = grid.GetElementLength((i == number_of_nodes - 1) ? i - 1 : i);
+        row_scales[static_cast<std::size_t>(i)] = constant_diffusion_ / (delta_x * delta_x);
+    }
+
+    return nm::matrix::StencilOperator1D{1.0, -2.0, 1.0, std::move(row_scales)};
+}
+
+nm::matrix::CsrMatrix LaplaceOperator::GenerateMatrixForStructuredGrid(const geometry::StructuredGrid& grid) const
+{
+    const auto dimension = static_cast<std::size_t>(grid.GetDimension());
+    const auto number_of_nodes = grid.GetNumberOfNodes();
+    const std::array<geometry::Axis, 3> axes{geometry::Axis::kX, geometry::Axis::kY, geometry::Axis::kZ};
+
+    // One weight pair per node and axis, nx + ny + nz of them, instead of recomputing spacings for every row
+    std::array<AxisWeights, 3> weights{};
+    std::array<std::int32_t, 3> sizes{};
+    std::array<std::int32_t, 3> strides{};
+    for (std::size_t a{0}; a < dimension; ++a)
+    {
+        weights[a] = CreateSecondDifferenceWeights(grid, axes[a], constant_diffusion_);
+        sizes[a] = grid.GetNumberOfNodes(axes[a]);
+        strides[a] = grid.GetStride(axes[a]);
+    }
+
+    std::vector<std::int32_t> row_offsets{};
+    std::vector<std::int32_t> column_indices{};
+    std::vector<double> values{};
+    row_offsets.reserve(static_cast<std::size_t>(number_of_nodes) + 1);
+    column_indices.reserve(static_cast<std::size_t>(number_of_nodes) * (2 * dimension + 1));
+    values.reserve(column_indices.capacity());
+    row_offsets.push_back(0);
+
+    std::array<std::int32_t, 3> position{};
+    for (std::int32_t row{0}; row < number_of_nodes; ++row)
+    {
+        // The neighbours before the node along z, y and x have increasing columns, those after it along x, y and z too
+        double diagonal{0.0};
+        for (auto a = dimension; a-- > 0;)
+        {
+            const auto p = static_cast<std::size_t>(position[a]);
+            diagonal -= weights[a].minus[p] + weights[a].plus[p];
+            if (position[a] > 0)
+            {
+                column_indices.push_back(row - strides[a]);
+                values.push_back(weights[a].minus[p]);
+            }
+        }
+        column_indices.push_back(row);
+        values.push_back(diagonal);
+        for (std::size_t a{0}; a < dimension; ++a)
+        {
+            if (position[a] < sizes[a] - 1)
             {
-                const auto delta_x = std::abs(elements.at(i).GetNodes().at(0).GetValues().at(0).value() -
-                                              elements.at(i).GetNodes().at(1).GetValues().at(0).value());
-                output_matrix.at(i).at(i - 1) = constant_diffusion_ / (delta_x * delta_x);
-                output_matrix.at(i).at(i) = constant_diffusion_ / (delta_x * delta_x) * -2.0;
-                output_matrix.at(i).at(i + 1) = constant_diffusion_ / (delta_x * delta_x);
+                column_indices.push_back(row + strides[a]);
+                values.push_back(weights[a].plus[static_cast<std::size_t>(position[a])]);
             }
         }
-        u.SetStiffnessMatrix(output_matrix);
+        row_offsets.push_back(static_cast<std::int32_t>(column_indices.size()));
+
+        // Advance (i, j, k) in row order, x fastest
+        for (std::size_t a{0}; a < dimension && ++position[a] == sizes[a]; ++a)
+        {
+            position[a] = 0;
+        }
     }
+
+    return nm::matrix::CsrMatrix{number_of_nodes,
+                                 number_of_nodes,
+                                 std::move(row_offsets),
+                                 std::move(column_indices),
+                                 std::move(values)};
 }
 
 }  // namespace operators
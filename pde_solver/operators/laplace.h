@@ -7,8 +7,11 @@
 #ifndef PDE_SOLVER_OPERATORS_LAPLACE_H
 #define PDE_SOLVER_OPERATORS_LAPLACE_H
 
+#include "matrix_solvers/linear_operators/stencil_operator.h"
+#include "matrix_solvers/sparse/sparse_matrix.h"
 #include "matrix_solvers/utilities.h"
 #include "pde_solver/data_types/spatial_variable.h"
+#include "pde_solver/data_types/structured_grid.h"
 #include <cstdint>
 
 namespace pde
@@ -22,6 +25,21 @@ class LaplaceOperator
   public:
     const nm::matrix::Matrix<double> GenerateMatrix();
     void GenerateMatrixForSpatialVariable(SpatialVariable& u);
+
+    /// @brief Matrix-free counterpart of GenerateMatrixForSpatialVariable, stores one scale per node
+    ///
+    /// Rows match the assembled stiffness matrix, the iterative solvers accept the result directly.
+    ///
+    /// @throws std::invalid_argument: when the grid of u is not one dimensional
+    nm::matrix::StencilOperator1D GenerateOperatorForSpatialVariable(const SpatialVariable& u) const;
+
+    /// @brief Assembles diffusion * laplacian(u) on a structured grid, the 3, 5 or 7 point stencil in 1D, 2D or 3D
+    ///
+    /// Along every axis a row holds 2 / (h_minus + h_plus) * ((u_plus - u) / h_plus - (u - u_minus) / h_minus),
+    /// the usual second difference on uniform spacing. Neighbours outside of the grid are dropped and a boundary node
+    /// takes its missing spacing equal to the present one, the same truncated rows GenerateMatrixForSpatialVariable
+    /// builds in 1D. Rows are written in CSR order directly, the columns of a row are already sorted.
+    nm::matrix::CsrMatrix GenerateMatrixForStructuredGrid(const geometry::StructuredGrid& grid) const;
     void SetSpatialVariable(const SpatialVariable& u_in);
     void SetConstantDiffusion(const double constant_diffusion) { constant_diffusion_ = constant_diffusion; };
 
@@ -10,8 +10,10 @@
 #include "pde_solver/data_types/grid.h"
 #include "pde_solver/data_types/spatial_variable.h"
 #include "pde_solver/operators/gradient.h"
+#include "pde_solver/data_types/structured_grid.h"
 #include "pde_solver/utilities/grid_generator.h"
 #include <gtest/gtest.h>
+#include <stdexcept>
 
 namespace pde
 {
@@ -57,7 +59,47 @@ TEST_F(BaseClassFixture, GivenValidSetup_ExpectCorrectMatrixGeneration)
     const auto stiffness_matrix = u_.GetStiffnessMatrix();
 
     // Expect
-    EXPECT_NEAR(stiffness_matrix.at(1).at(1), 1.0 / delta_x, tolerance_);
+    EXPECT_NEAR(stiffness_matrix(1, 1), 1.0 / delta_x, tolerance_);
+}
+
+TEST_F(BaseClassFixture, GivenOneDimensionalStructuredGrid_ExpectSameMatrixAsSpatialVariable)
+{
+    // Given
+    const geometry::StructuredGrid grid{{0.0, 0.25, 0.5, 0.75, 1.0}};
+    nabla_.GenerateMatrixForSpatialVariable(u_);
+
+    // Call
+    const auto result = nabla_.GenerateMatrixForStructuredGrid(grid, geometry::Axis::kX);
+
+    // Expect
+    const auto& expected = u_.GetStiffnessMatrix();
+    ASSERT_EQ(result.NumberOfNonZeros(), expected.NumberOfNonZeros());
+    for (std::int32_t i{0}; i < expected.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < expected.NumberOfColumns(); ++j)
+        {
+            EXPECT_NEAR(result(i, j), expected(i, j), tolerance_);
+        }
+    }
+}
+
+TEST(GradientOperatorStructuredGridTests, GivenNegativeWaveSpeedAlongY_ExpectForwardDifferenceAcrossRows)
+{
+    // Given, spacing 0.5 along y
+    geometry::GridGenerator grid_generator{};
+    const auto grid = grid_generator.Create2DStructuredGrid({4, 0.0, 1.0}, {3, 0.0, 1.0});
+    const operators::GradientOperator nabla{-2.0};
+
+    // Call
+    const auto result = nabla.GenerateMatrixForStructuredGrid(grid, geometry::Axis::kY);
+
+    // Expect, the last row of nodes is the inflow boundary and keeps only its diagonal
+    const auto node = grid.GetNodeIndex(1, 1);
+    EXPECT_EQ(result.NumberOfNonZeros(), 12 + 8);
+    EXPECT_NEAR(result(node, node), 4.0, 1e-12);
+    EXPECT_NEAR(result(node, node + 4), -4.0, 1e-12);
+    EXPECT_NEAR(result(node, node - 4), 0.0, 1e-12);
+    EXPECT_THROW(nabla.GenerateMatrixForStructuredGrid(grid, geometry::Axis::kZ), std::invalid_argument);
 }
 
 }  // namespace
@@ -11,7 +11,10 @@
 #include "pde_solver/data_types/spatial_variable.h"
 #include "pde_solver/operators/laplace.h"
 #include "pde_solver/utilities/grid_generator.h"
+#include "pde_solver/data_types/structured_grid.h"
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <vector>
 
 namespace pde
 {
@@ -65,8 +68,153 @@ TEST(GivenValidSetup, CallGenerateMatrixForSpatialVariable_ExpectCorrectMatrix)
     laplace.GenerateMatrixForSpatialVariable(u);
 
     // Expect
-    const auto result = u.GetStiffnessMatrix();
-    EXPECT_NEAR(result.at(0).at(0), -32, 0.001);
+    const auto& result = u.GetStiffnessMatrix();
+    EXPECT_NEAR(result(0, 0), -32, 0.001);
+}
+
+TEST(GivenValidSetup, CallGenerateOperatorForSpatialVariable_ExpectSameRowsAsStiffnessMatrix)
+{
+    // Given
+    geometry::GridGenerator grid_generator{};
+    const auto grid = grid_generator.Create1DLinearGrid(7, 0, 1);
+
+    SpatialVariable u{};
+    u.SetGrid(grid);
+    operators::LaplaceOperator laplace{};
+    laplace.SetConstantDiffusion(0.5);
+    laplace.GenerateMatrixForSpatialVariable(u);
+
+    // Call
+    const auto laplace_operator = laplace.GenerateOperatorForSpatialVariable(u);
+
+    // Expect
+    const auto& expected = u.GetStiffnessMatrix();
+    const auto result = laplace_operator.ToCsrMatrix();
+    ASSERT_EQ(result.NumberOfRows(), expected.NumberOfRows());
+    for (std::int32_t i{0}; i < expected.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < expected.NumberOfColumns(); ++j)
+        {
+            EXPECT_NEAR(result(i, j), expected(i, j), 1e-9);
+        }
+    }
+}
+
+TEST(GivenMillionNodeGrid, CallGenerateMatrixForSpatialVariable_ExpectSparseStiffnessMatrix)
+{
+    // Given, a dense stiffness matrix of this grid would need 8 TB
+    const std::int32_t number_of_nodes{1000000};
+    geometry::GridGenerator grid_generator{};
+    const auto grid = grid_generator.Create1DLinearGrid(number_of_nodes, 0, 1);
+
+    SpatialVariable u{};
+    u.SetGrid(grid);
+
+    // Call
+    operators::LaplaceOperator laplace{};
+    laplace.GenerateMatrixForSpatialVariable(u);
+
+    // Expect
+    const auto& result = u.GetStiffnessMatrix();
+    const double delta_x{1.0 / (number_of_nodes - 1)};
+    EXPECT_EQ(result.NumberOfRows(), number_of_nodes);
+    EXPECT_EQ(result.NumberOfNonZeros(), 3 * number_of_nodes - 2);
+    EXPECT_NEAR(result(number_of_nodes / 2, number_of_nodes / 2) * delta_x * delta_x, -2.0, 1e-3);
+}
+
+TEST(GivenOneDimensionalStructuredGrid, CallGenerateMatrixForStructuredGrid_ExpectSameRowsAsStiffnessMatrix)
+{
+    // Given
+    geometry::GridGenerator grid_generator{};
+    SpatialVariable u{};
+    u.SetGrid(grid_generator.Create1DLinearGrid(6, 0, 1));
+    const geometry::StructuredGrid grid{{0.0, 0.2, 0.4, 0.6, 0.8, 1.0}};
+    operators::LaplaceOperator laplace{};
+    laplace.SetConstantDiffusion(0.5);
+    laplace.GenerateMatrixForSpatialVariable(u);
+
+    // Call
+    const auto result = laplace.GenerateMatrixForStructuredGrid(grid);
+
+    // Expect
+    const auto& expected = u.GetStiffnessMatrix();
+    ASSERT_EQ(result.NumberOfNonZeros(), expected.NumberOfNonZeros());
+    for (std::int32_t i{0}; i < expected.NumberOfRows(); ++i)
+    {
+        for (std::int32_t j{0}; j < expected.NumberOfColumns(); ++j)
+        {
+            EXPECT_NEAR(result(i, j), expected(i, j), 1e-9);
+        }
+    }
+}
+
+TEST(GivenTwoDimensionalStructuredGrid, CallGenerateMatrixForStructuredGrid_ExpectFivePointStencil)
+{
+    // Given, spacing 0.25 along x and 0.5 along y
+    geometry::GridGenerator grid_generator{};
+    const auto grid = grid_generator.Create2DStructuredGrid({5, 0.0, 1.0}, {3, 0.0, 1.0});
+
+    // Call
+    const auto result = operators::LaplaceOperator{}.GenerateMatrixForStructuredGrid(grid);
+
+    // Expect
+    const auto center = grid.GetNodeIndex(2, 1);
+    EXPECT_EQ(result.NumberOfRows(), 15);
+    EXPECT_EQ(result.NumberOfNonZeros(), 15 + 2 * (4 * 3) + 2 * (5 * 2));
+    EXPECT_NEAR(result(center, center), -2.0 / 0.0625 - 2.0 / 0.25, 1e-9);
+    EXPECT_NEAR(result(center, center - 1), 16.0, 1e-9);
+    EXPECT_NEAR(result(center, center + 1), 16.0, 1e-9);
+    EXPECT_NEAR(result(center, center - 5), 4.0, 1e-9);
+    EXPECT_NEAR(result(center, center + 5), 4.0, 1e-9);
+
+    // A quadratic in x and y has the exact discrete Laplacian at every interior node
+    const auto& x = grid.GetCoordinates(geometry::Axis::kX);
+    const auto& y = grid.GetCoordinates(geometry::Axis::kY);
+    std::vector<double> u(static_cast<std::size_t>(grid.GetNumberOfNodes()));
+    for (std::int32_t j{0}; j < 3; ++j)
+    {
+        for (std::int32_t i{0}; i < 5; ++i)
+        {
+            u[static_cast<std::size_t>(grid.GetNodeIndex(i, j))] = x[i] * x[i] + 3.0 * y[j] * y[j];
+        }
+    }
+    std::vector<double> laplacian(u.size(), 0.0);
+    nm::matrix::SpMV(1.0, result, u, 0.0, laplacian);
+    for (std::int32_t i{1}; i < 4; ++i)
+    {
+        EXPECT_NEAR(laplacian[static_cast<std::size_t>(grid.GetNodeIndex(i, 1))], 8.0, 1e-9);
+    }
+}
+
+TEST(GivenNonUniformThreeDimensionalGrid, CallGenerateMatrixForStructuredGrid_ExpectSevenPointStencil)
+{
+    // Given
+    const geometry::StructuredGrid grid{{0.0, 0.1, 0.3, 0.6}, {0.0, 0.5, 1.0}, {-1.0, 0.0, 2.0}};
+    operators::LaplaceOperator laplace{};
+    laplace.SetConstantDiffusion(2.0);
+
+    // Call
+    const auto result = laplace.GenerateMatrixForStructuredGrid(grid);
+
+    // Expect, the quadratic x^2 + y^2 + z^2 has the Laplacian 6 also on non-uniform spacing
+    const auto center = grid.GetNodeIndex(1, 1, 1);
+    EXPECT_EQ(result.NumberOfRows(), 36);
+    EXPECT_EQ(result.NumberOfNonZeros(), 36 + 2 * (3 * 3 * 3) + 2 * (4 * 2 * 3) + 2 * (4 * 3 * 2));
+    double laplacian{0.0};
+    for (std::int32_t k{0}; k < 3; ++k)
+    {
+        for (std::int32_t j{0}; j < 3; ++j)
+        {
+            for (std::int32_t i{0}; i < 4; ++i)
+            {
+                const auto x = grid.GetCoordinates(geometry::Axis::kX)[i];
+                const auto y = grid.GetCoordinates(geometry::Axis::kY)[j];
+                const auto z = grid.GetCoordinates(geometry::Axis::kZ)[k];
+                laplacian += result(center, grid.GetNodeIndex(i, j, k)) * (x * x + y * y + z * z);
+            }
+        }
+    }
+    EXPECT_NEAR(laplacian, 2.0 * 6.0, 1e-9);
 }
 
 }  // namespace
@@ -157,6 +157,36 @@ INSTANTIATE_TEST_SUITE_P(LinearAdvectionTestFixtureTests,
                                  .matrix_solver = MatrixSolverEnum::kJacobi,
                                  .expected_value = 10.0,
                                  .test_name = "JacobiSolveWithSlopeSeven",
+                             },
+                             SteadyStateLinearAdvectionTestParameter{
+                                 .number_of_grid_points = 11,
+                                 .xf = 1.0,
+                                 .max_iterations = 1000,
+                                 .iterative_solver_tolerance = 1e-10,
+                                 .wave_speed = 2.0,
+                                 .forcing_term = 5.0,
+                                 .dirichlet_boundary_value = 2.5,
+                                 .boundary_index = 0,
+                                 .spatial_discretization_method = SpatialDiscretizationMethod::kFiniteDifferenceMethod,
+                                 .spatial_discretization_schema = FiniteDifferenceSchema::kBackwardsDifference,
+                                 .matrix_solver = MatrixSolverEnum::kGMRES,
+                                 .expected_value = 5.0,
+                                 .test_name = "GMRESSolveWithSlopeFiveHalves",
+                             },
+                             SteadyStateLinearAdvectionTestParameter{
+                                 .number_of_grid_points = 11,
+                                 .xf = 1.0,
+                                 .max_iterations = 1000,
+                                 .iterative_solver_tolerance = 1e-10,
+                                 .wave_speed = 2.0,
+                                 .forcing_term = 5.0,
+                                 .dirichlet_boundary_value = 2.5,
+                                 .boundary_index = 0,
+                                 .spatial_discretization_method = SpatialDiscretizationMethod::kFiniteDifferenceMethod,
+                                 .spatial_discretization_schema = FiniteDifferenceSchema::kBackwardsDifference,
+                                 .matrix_solver = MatrixSolverEnum::kBiCGSTAB,
+                                 .expected_value = 5.0,
+                                 .test_name = "BiCGSTABSolveWithSlopeFiveHalves",
                              }),
                          [](const ::testing::TestParamInfo<SteadyStateLinearAdvectionTestParameter>& info)
                              -> std::string { return info.param.test_name; });
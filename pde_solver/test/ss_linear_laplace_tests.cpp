@@ -161,6 +161,42 @@ INSTANTIATE_TEST_SUITE_P(LinearDiffusionTestFixtureTests,
                                  .matrix_solver = MatrixSolverEnum::kLUSolve,
                                  .expected_value = 380.0,
                                  .test_name = "LUDecompositionSolve",
+                             },
+                             SteadyStateLinearDiffusionTestParameter{
+                                 .number_of_grid_points = 11,
+                                 .xf = 1.0,
+                                 .max_iterations = 1000,
+                                 .dirichlet_boundary_pairs = {{200, 0}, {400, 10}},
+                                 .spatial_discretization_method = SpatialDiscretizationMethod::kFiniteDifferenceMethod,
+                                 .spatial_discretization_schema = FiniteDifferenceSchema::kCentralDifference,
+                                 .matrix_solver = MatrixSolverEnum::kThomas,
+                                 .expected_value = 380.0,
+                                 .test_name = "ThomasSolve",
+                             },
+                             SteadyStateLinearDiffusionTestParameter{
+                                 .number_of_grid_points = 33,
+                                 .xf = 1.0,
+                                 .max_iterations = 100,
+                                 .iterative_solver_tolerance = 1e-8,
+                                 .dirichlet_boundary_pairs = {{200, 0}, {400, 32}},
+                                 .spatial_discretization_method = SpatialDiscretizationMethod::kFiniteDifferenceMethod,
+                                 .spatial_discretization_schema = FiniteDifferenceSchema::kCentralDifference,
+                                 .matrix_solver = MatrixSolverEnum::kMultigrid,
+                                 .expected_value = 393.75,
+                                 .test_name = "MultigridSolve",
+                             },
+                             SteadyStateLinearDiffusionTestParameter{
+                                 // An even number of nodes, a dense solve of this size would take minutes
+                                 .number_of_grid_points = 10000,
+                                 .xf = 1.0,
+                                 .max_iterations = 100,
+                                 .iterative_solver_tolerance = 1e-8,
+                                 .dirichlet_boundary_pairs = {{200, 0}, {400, 9999}},
+                                 .spatial_discretization_method = SpatialDiscretizationMethod::kFiniteDifferenceMethod,
+                                 .spatial_discretization_schema = FiniteDifferenceSchema::kCentralDifference,
+                                 .matrix_solver = MatrixSolverEnum::kMultigrid,
+                                 .expected_value = 399.98,
+                                 .test_name = "MultigridSolveEvenNumberOfNodes",
                              }),
                          [](const ::testing::TestParamInfo<SteadyStateLinearDiffusionTestParameter>& info)
                              -> std::string { return info.param.test_name; });
@@ -6,6 +6,11 @@
 
 #include "pde_solver/utilities/grid_generator.h"
 #include "pde_solver/data_types/grid.h"
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace pde
 {
@@ -13,31 +18,59 @@ namespace pde
 namespace geometry
 {
 
+namespace
+{
+
+std::vector<double> CreateAxisCoordinates(const GridAxis& axis)
+{
+    if (axis.size < 2)
+    {
+        throw std::invalid_argument("GridGenerator: every axis needs at least two nodes");
+    }
+
+    // start + i * step rather than a running sum, so the last node lands on end without accumulated rounding
+    std::vector<double> coordinates(static_cast<std::size_t>(axis.size));
+    const auto step_size = (axis.end - axis.start) / static_cast<double>(axis.size - 1);
+    for (std::size_t i{0}; i < coordinates.size(); ++i)
+    {
+        coordinates[i] = axis.start + static_cast<double>(i) * step_size;
+    }
+    coordinates.back() = axis.end;
+    return coordinates;
+}
+
+}  // namespace
+
 Grid GridGenerator::Create1DLinearGrid(const std::uint64_t& size, const double& start, const double& end)
 {
-    std::vector<Element> elements{};
-    const auto step_size = (end - start) / (size - 1);
+    auto x = CreateAxisCoordinates({size, start, end});
+    const auto number_of_elements = static_cast<std::int32_t>(x.size()) - 1;
 
-    auto current_point = start;
-    for (std::uint64_t idx = 0; idx < size - 1; ++idx)
+    // Element e joins nodes e and e + 1, every interior node is shared by two elements
+    std::vector<std::int32_t> connectivity(2 * static_cast<std::size_t>(number_of_elements));
+    for (std::int32_t element{0}; element < number_of_elements; ++element)
     {
-        Node start_node{current_point};
-        if (idx == 0 || idx == (size - 1))
-        {
-            start_node.SetBoundaryBoolean(true);
-        }
-
-        Node end_node{current_point + step_size};
-        elements.push_back(std::vector<Node>{start_node, end_node});
-        current_point += step_size;
+        connectivity[2 * static_cast<std::size_t>(element)] = element;
+        connectivity[2 * static_cast<std::size_t>(element) + 1] = element + 1;
     }
 
-    Grid grid{elements};
-    grid.SetDimension(1);
-    grid.number_of_boundaries_ = 2;
+    Grid grid{std::move(connectivity), 2, std::move(x)};
+    grid.SetBoundaryNode(0, true);
+    grid.SetBoundaryNode(number_of_elements, true);
+    grid.SetBoundaryElement(0, true);
+    grid.SetBoundaryElement(number_of_elements - 1, true);
 
     return grid;
-    // comment for clang-tidy check
+}
+
+StructuredGrid GridGenerator::Create2DStructuredGrid(const GridAxis& x, const GridAxis& y) const
+{
+    return StructuredGrid{CreateAxisCoordinates(x), CreateAxisCoordinates(y)};
+}
+
+StructuredGrid GridGenerator::Create3DStructuredGrid(const GridAxis& x, const GridAxis& y, const GridAxis& z) const
+{
+    return StructuredGrid{CreateAxisCoordinates(x), CreateAxisCoordinates(y), CreateAxisCoordinates(z)};
 }
 
 }  // namespace geometry
@@ -8,6 +8,8 @@
 #define PDE_SOLVER_UTILITIES_GRID_GENERATOR_H
 
 #include "pde_solver/data_types/grid.h"
+#include "pde_solver/data_types/structured_grid.h"
+#include <cstdint>
 
 namespace pde
 {
@@ -15,12 +17,34 @@ namespace pde
 namespace geometry
 {
 
+/// @brief Uniformly spaced nodes of one axis of a structured grid, size nodes from start to end inclusive
+struct GridAxis
+{
+    std::uint64_t size{2};
+    double start{0.0};
+    double end{1.0};
+};
+
 class GridGenerator
 {
   public:
-    Grid GetGrid() { return grid_; };
+    const Grid& GetGrid() const { return grid_; };
+
+    /// @brief size uniformly spaced nodes from start to end joined by size - 1 two node elements
+    ///
+    /// @throws std::invalid_argument: when size is smaller than two
     Grid Create1DLinearGrid(const std::uint64_t& size, const double& start, const double& end);
 
+    /// @brief Uniform x.size by y.size grid, node (i, j) has the index i + x.size * j
+    ///
+    /// @throws std::invalid_argument: when an axis has fewer than two nodes or end <= start
+    StructuredGrid Create2DStructuredGrid(const GridAxis& x, const GridAxis& y) const;
+
+    /// @brief Uniform x.size by y.size by z.size grid, node (i, j, k) has the index i + x.size * (j + y.size * k)
+    ///
+    /// @throws std::invalid_argument: when an axis has fewer than two nodes or end <= start
+    StructuredGrid Create3DStructuredGrid(const GridAxis& x, const GridAxis& y, const GridAxis& z) const;
+
   private:
     Grid grid_{};
 };
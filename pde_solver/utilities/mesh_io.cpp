@@ -0,0 +1,739 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "pde_solver/utilities/mesh_io.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace pde
+{
+
+namespace geometry
+{
+
+namespace
+{
+
+/// @brief Gmsh element type number with its number of nodes and dimension
+struct GmshElementType
+{
+    std::int32_t type{};
+    std::int32_t nodes{};
+    std::int8_t dimension{};
+};
+
+constexpr std::array<GmshElementType, 14> kGmshElementTypes{{
+    {1, 2, 1},    // 2 node line
+    {2, 3, 2},    // 3 node triangle
+    {3, 4, 2},    // 4 node quadrangle
+    {4, 4, 3},    // 4 node tetrahedron
+    {5, 8, 3},    // 8 node hexahedron
+    {6, 6, 3},    // 6 node prism
+    {7, 5, 3},    // 5 node pyramid
+    {8, 3, 1},    // 3 node line
+    {9, 6, 2},    // 6 node triangle
+    {10, 9, 2},   // 9 node quadrangle
+    {11, 10, 3},  // 10 node tetrahedron
+    {15, 1, 0},   // 1 node point
+    {16, 8, 2},   // 8 node quadrangle
+    {17, 20, 3},  // 20 node hexahedron
+}};
+
+const GmshElementType& FindGmshElementType(const std::int32_t type)
+{
+    const auto found = std::find_if(kGmshElementTypes.cbegin(),
+                                    kGmshElementTypes.cend(),
+                                    [type](const GmshElementType& element_type) { return element_type.type == type; });
+    if (found == kGmshElementTypes.cend())
+    {
+        throw std::invalid_argument("Gmsh: unsupported element type " + std::to_string(type));
+    }
+    return *found;
+}
+
+/// @brief Whitespace separated tokens of a file held in memory, numbers are converted without copying them
+class GmshTokenizer
+{
+  public:
+    explicit GmshTokenizer(const std::string_view text) : current_(text.data()), end_(text.data() + text.size()) {}
+
+    bool AtEnd()
+    {
+        SkipWhitespace();
+        return current_ == end_;
+    }
+
+    std::string_view Next()
+    {
+        SkipWhitespace();
+        if (current_ == end_)
+        {
+            throw std::invalid_argument("Gmsh: unexpected end of file");
+        }
+        const auto* begin = current_;
+        while (current_ != end_ && !IsWhitespace(*current_))
+        {
+            ++current_;
+        }
+        return std::string_view{begin, static_cast<std::size_t>(current_ - begin)};
+    }
+
+    template <typename T>
+    T NextNumber()
+    {
+        const auto token = Next();
+        T value{};
+        const auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (result.ec != std::errc{} || result.ptr != token.data() + token.size())
+        {
+            throw std::invalid_argument("Gmsh: expected a number instead of " + std::string{token});
+        }
+        return value;
+    }
+
+    void Expect(const std::string_view word)
+    {
+        if (Next() != word)
+        {
+            throw std::invalid_argument("Gmsh: expected " + std::string{word});
+        }
+    }
+
+    /// @brief Skips the rest of a section whose $name was just read, up to and including $Endname
+    void SkipSection(const std::string_view name)
+    {
+        const auto end_of_section = "$End" + std::string{name.substr(1)};
+        while (Next() != end_of_section)
+        {
+        }
+    }
+
+  private:
+    static bool IsWhitespace(const char character)
+    {
+        return character == ' ' || character == '\n' || character == '\r' || character == '\t';
+    }
+
+    void SkipWhitespace()
+    {
+        while (current_ != end_ && IsWhitespace(*current_))
+        {
+            ++current_;
+        }
+    }
+
+    const char* current_{};
+    const char* end_{};
+};
+
+std::string ReadFile(const std::string& path)
+{
+    std::ifstream file{path, std::ios::binary | std::ios::ate};
+    if (!file)
+    {
+        throw std::runtime_error("Mesh: cannot open " + path);
+    }
+    std::string text(static_cast<std::size_t>(file.tellg()), '\0');
+    file.seekg(0);
+    if (!file.read(text.data(), static_cast<std::streamsize>(text.size())))
+    {
+        throw std::runtime_error("Mesh: cannot read " + path);
+    }
+    return text;
+}
+
+/// @brief Nodes of a Gmsh file, coordinates in file order and the index of every node tag, -1 for unused tags
+struct GmshNodes
+{
+    std::vector<double> x{};
+    std::vector<double> y{};
+    std::vector<double> z{};
+    std::vector<std::int32_t> indices{};
+};
+
+GmshNodes ReadGmshNodes(GmshTokenizer& tokens)
+{
+    const auto number_of_blocks = tokens.NextNumber<std::size_t>();
+    const auto number_of_nodes = tokens.NextNumber<std::size_t>();
+    tokens.NextNumber<std::size_t>();
+    const auto max_tag = tokens.NextNumber<std::size_t>();
+    if (number_of_nodes > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+    {
+        throw std::invalid_argument("Gmsh: too many nodes for int32 node indices");
+    }
+
+    GmshNodes nodes{};
+    nodes.x.resize(number_of_nodes);
+    nodes.y.resize(number_of_nodes);
+    nodes.z.resize(number_of_nodes);
+    nodes.indices.assign(max_tag + 1, -1);
+
+    std::size_t first{0};
+    for (std::size_t block{0}; block < number_of_blocks; ++block)
+    {
+        const auto entity_dimension = tokens.NextNumber<std::int32_t>();
+        tokens.NextNumber<std::int32_t>();
+        const auto parametric = tokens.NextNumber<std::int32_t>() != 0;
+        const auto count = tokens.NextNumber<std::size_t>();
+        if (count > number_of_nodes - first)
+        {
+            throw std::invalid_argument("Gmsh: the node blocks hold more nodes than announced");
+        }
+
+        // A block lists all of its tags first, then the coordinates in the same order
+        for (std::size_t i{first}; i < first + count; ++i)
+        {
+            const auto tag = tokens.NextNumber<std::size_t>();
+            if (tag > max_tag)
+            {
+                throw std::invalid_argument("Gmsh: node tag beyond the announced maximum");
+            }
+            nodes.indices[tag] = static_cast<std::int32_t>(i);
+        }
+        for (std::size_t i{first}; i < first + count; ++i)
+        {
+            nodes.x[i] = tokens.NextNumber<double>();
+            nodes.y[i] = tokens.NextNumber<double>();
+            nodes.z[i] = tokens.NextNumber<double>();
+            for (std::int32_t u{0}; parametric && u < entity_dimension; ++u)
+            {
+                tokens.NextNumber<double>();
+            }
+        }
+        first += count;
+    }
+    tokens.Expect("$EndNodes");
+    return nodes;
+}
+
+/// @brief Elements of the highest dimension of a Gmsh file, the nodes of all lower dimensional elements as boundary
+struct GmshElements
+{
+    std::vector<std::int32_t> connectivity{};
+    std::int32_t nodes_per_element{0};
+    std::int8_t dimension{-1};
+    std::vector<bool> boundary_nodes{};
+};
+
+GmshElements ReadGmshElements(GmshTokenizer& tokens, const GmshNodes& nodes)
+{
+    const auto number_of_blocks = tokens.NextNumber<std::size_t>();
+    tokens.NextNumber<std::size_t>();
+    tokens.NextNumber<std::size_t>();
+    tokens.NextNumber<std::size_t>();
+
+    GmshElements elements{};
+    elements.boundary_nodes.assign(nodes.x.size(), false);
+    for (std::size_t block{0}; block < number_of_blocks; ++block)
+    {
+        tokens.NextNumber<std::int32_t>();
+        tokens.NextNumber<std::int32_t>();
+        const auto& element_type = FindGmshElementType(tokens.NextNumber<std::int32_t>());
+        const auto count = tokens.NextNumber<std::size_t>();
+
+        // Elements kept so far bound the ones of a higher dimension
+        if (element_type.dimension > elements.dimension)
+        {
+            for (const auto node : elements.connectivity)
+            {
+                elements.boundary_nodes[static_cast<std::size_t>(node)] = true;
+            }
+            elements.connectivity.clear();
+            elements.dimension = element_type.dimension;
+            elements.nodes_per_element = element_type.nodes;
+        }
+        const auto keep = element_type.dimension == elements.dimension;
+        if (keep && element_type.nodes != elements.nodes_per_element)
+        {
+            throw std::invalid_argument("Gmsh: mixed element types of the highest dimension are not supported");
+        }
+        if (keep)
+        {
+            elements.connectivity.reserve(elements.connectivity.size() +
+                                          count * static_cast<std::size_t>(element_type.nodes));
+        }
+
+        for (std::size_t e{0}; e < count; ++e)
+        {
+            tokens.NextNumber<std::size_t>();
+            for (std::int32_t l{0}; l < element_type.nodes; ++l)
+            {
+                const auto tag = tokens.NextNumber<std::size_t>();
+                if (tag >= nodes.indices.size() || nodes.indices[tag] < 0)
+                {
+                    throw std::invalid_argument("Gmsh: element refers to an unknown node tag");
+                }
+                const auto node = nodes.indices[tag];
+                if (keep)
+                {
+                    elements.connectivity.push_back(node);
+                }
+                else
+                {
+                    elements.boundary_nodes[static_cast<std::size_t>(node)] = true;
+                }
+            }
+        }
+    }
+    tokens.Expect("$EndElements");
+    return elements;
+}
+
+const GmshElementType& FindGmshElementType(const std::int8_t dimension, const std::int32_t nodes)
+{
+    const auto found =
+        std::find_if(kGmshElementTypes.cbegin(), kGmshElementTypes.cend(), [&](const GmshElementType& element_type) {
+            return element_type.dimension == dimension && element_type.nodes == nodes;
+        });
+    if (found == kGmshElementTypes.cend())
+    {
+        throw std::invalid_argument("Gmsh: no element type with " + std::to_string(nodes) + " nodes in " +
+                                    std::to_string(dimension) + "D");
+    }
+    return *found;
+}
+
+constexpr std::array<char, 8> kBinaryMeshMagic{'N', 'M', 'M', 'E', 'S', 'H', '\0', '\0'};
+constexpr std::uint32_t kBinaryMeshByteOrder{0x01020304U};
+constexpr std::uint32_t kBinaryMeshVersion{1U};
+
+struct BinaryMeshHeader
+{
+    std::array<char, 8> magic{kBinaryMeshMagic};
+    std::uint32_t byte_order{kBinaryMeshByteOrder};
+    std::uint32_t version{kBinaryMeshVersion};
+    std::int32_t dimension{0};
+    std::int32_t nodes_per_element{0};
+    std::int32_t number_of_nodes{0};
+    std::int32_t number_of_elements{0};
+};
+static_assert(sizeof(BinaryMeshHeader) == 32, "The binary mesh header must be 32 bytes");
+
+/// @brief Byte offsets of the sections of a binary mesh file
+struct BinaryMeshLayout
+{
+    std::array<std::size_t, 3> coordinates{};
+    std::size_t connectivity{};
+    std::size_t boundary_nodes{};
+    std::size_t boundary_elements{};
+    std::size_t size{};
+};
+
+std::size_t AlignTo8(const std::size_t bytes)
+{
+    return (bytes + 7U) & ~static_cast<std::size_t>(7U);
+}
+
+std::size_t NumberOfBitsetWords(const std::int32_t bits)
+{
+    return (static_cast<std::size_t>(bits) + 63U) / 64U;
+}
+
+BinaryMeshLayout ComputeBinaryMeshLayout(const BinaryMeshHeader& header)
+{
+    const auto number_of_nodes = static_cast<std::size_t>(header.number_of_nodes);
+    BinaryMeshLayout layout{};
+    auto offset = sizeof(BinaryMeshHeader);
+    for (std::int32_t axis{0}; axis < header.dimension; ++axis)
+    {
+        layout.coordinates[static_cast<std::size_t>(axis)] = offset;
+        offset += number_of_nodes * sizeof(double);
+    }
+    layout.connectivity = offset;
+    offset += AlignTo8(static_cast<std::size_t>(header.number_of_elements) *
+                       static_cast<std::size_t>(header.nodes_per_element) * sizeof(std::int32_t));
+    layout.boundary_nodes = offset;
+    offset += NumberOfBitsetWords(header.number_of_nodes) * sizeof(std::uint64_t);
+    layout.boundary_elements = offset;
+    offset += NumberOfBitsetWords(header.number_of_elements) * sizeof(std::uint64_t);
+    layout.size = offset;
+    return layout;
+}
+
+void ValidateBinaryMeshHeader(const BinaryMeshHeader& header, const std::size_t file_size)
+{
+    if (header.magic != kBinaryMeshMagic || header.version != kBinaryMeshVersion)
+    {
+        throw std::invalid_argument("MappedMesh: not a binary mesh file");
+    }
+    if (header.byte_order != kBinaryMeshByteOrder)
+    {
+        throw std::invalid_argument("MappedMesh: the file was written with a different byte order");
+    }
+    // Nodes without a dimension would have no coordinate arrays
+    if (header.dimension < 0 || header.dimension > 3 || header.nodes_per_element <= 0 || header.number_of_nodes < 0 ||
+        header.number_of_elements < 0 || (header.number_of_nodes > 0 && header.dimension < 1))
+    {
+        throw std::invalid_argument("MappedMesh: invalid header");
+    }
+    if (ComputeBinaryMeshLayout(header).size > file_size)
+    {
+        throw std::invalid_argument("MappedMesh: the file is truncated");
+    }
+}
+
+template <typename Predicate>
+std::vector<std::uint64_t> CreateBitsetWords(const std::int32_t bits, Predicate is_set)
+{
+    std::vector<std::uint64_t> words(NumberOfBitsetWords(bits), 0U);
+    for (std::int32_t i{0}; i < bits; ++i)
+    {
+        if (is_set(i))
+        {
+            words[static_cast<std::size_t>(i) / 64U] |= std::uint64_t{1} << (static_cast<std::size_t>(i) % 64U);
+        }
+    }
+    return words;
+}
+
+template <typename T>
+void WriteArray(std::ofstream& file, const T* data, const std::size_t size)
+{
+    file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size * sizeof(T)));
+}
+
+}  // namespace
+
+Grid ReadGmshMesh(const std::string& path)
+{
+    const auto text = ReadFile(path);
+    GmshTokenizer tokens{text};
+
+    bool has_format{false};
+    GmshNodes nodes{};
+    GmshElements elements{};
+    while (!tokens.AtEnd())
+    {
+        const auto section = tokens.Next();
+        if (section == "$MeshFormat")
+        {
+            const auto version = tokens.Next();
+            const auto file_type = tokens.NextNumber<std::int32_t>();
+            tokens.NextNumber<std::int32_t>();
+            if (version != "4.1" || file_type != 0)
+            {
+                throw std::invalid_argument("Gmsh: only the ASCII MSH 4.1 format is supported");
+            }
+            tokens.Expect("$EndMeshFormat");
+            has_format = true;
+        }
+        else if (section == "$Nodes")
+        {
+            nodes = ReadGmshNodes(tokens);
+        }
+        else if (section == "$Elements")
+        {
+            elements = ReadGmshElements(tokens, nodes);
+        }
+        else if (section.front() == '$')
+        {
+            tokens.SkipSection(section);
+        }
+        else
+        {
+            throw std::invalid_argument("Gmsh: expected a section instead of " + std::string{section});
+        }
+    }
+    if (!has_format)
+    {
+        throw std::invalid_argument("Gmsh: the file has no $MeshFormat section");
+    }
+    if (elements.dimension < 1)
+    {
+        throw std::invalid_argument("Gmsh: the file has no line, surface or volume elements");
+    }
+
+    if (elements.dimension < 3)
+    {
+        nodes.z = std::vector<double>{};
+    }
+    if (elements.dimension < 2)
+    {
+        nodes.y = std::vector<double>{};
+    }
+    Grid grid{std::move(elements.connectivity),
+              elements.nodes_per_element,
+              std::move(nodes.x),
+              std::move(nodes.y),
+              std::move(nodes.z)};
+
+    for (std::int32_t node{0}; node < grid.GetNumberOfNodes(); ++node)
+    {
+        if (elements.boundary_nodes[static_cast<std::size_t>(node)])
+        {
+            grid.SetBoundaryNode(node, true);
+        }
+    }
+    for (std::int32_t element{0}; element < grid.GetNumberOfElements(); ++element)
+    {
+        for (std::int32_t l{0}; l < grid.GetNodesPerElement(); ++l)
+        {
+            if (grid.IsBoundaryNode(grid.GetElementNode(element, l)))
+            {
+                grid.SetBoundaryElement(element, true);
+                break;
+            }
+        }
+    }
+    return grid;
+}
+
+void WriteGmshMesh(const Grid& grid, const std::string& path)
+{
+    const auto& element_type = FindGmshElementType(grid.GetDimension(), grid.GetNodesPerElement());
+    const auto number_of_nodes = grid.GetNumberOfNodes();
+    const auto number_of_elements = grid.GetNumberOfElements();
+    const auto number_of_boundary_nodes = grid.GetNumberOfBoundaryNodes();
+
+    std::ofstream file{path};
+    if (!file)
+    {
+        throw std::runtime_error("Mesh: cannot open " + path);
+    }
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+    file << "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n";
+
+    // One entity block of all nodes, tagged from 1 in index order
+    file << "$Nodes\n1 " << number_of_nodes << " 1 " << number_of_nodes << '\n';
+    file << static_cast<std::int32_t>(grid.GetDimension()) << " 1 0 " << number_of_nodes << '\n';
+    for (std::int32_t node{0}; node < number_of_nodes; ++node)
+    {
+        file << node + 1 << '\n';
+    }
+    for (std::int32_t node{0}; node < number_of_nodes; ++node)
+    {
+        const auto i = static_cast<std::size_t>(node);
+        file << grid.GetX()[i] << ' ' << (grid.GetY().empty() ? 0.0 : grid.GetY()[i]) << ' '
+             << (grid.GetZ().empty() ? 0.0 : grid.GetZ()[i]) << '\n';
+    }
+    file << "$EndNodes\n";
+
+    const auto number_of_tags = number_of_elements + number_of_boundary_nodes;
+    file << "$Elements\n" << (number_of_boundary_nodes > 0 ? 2 : 1) << ' ' << number_of_tags << " 1 " << number_of_tags
+         << '\n';
+    file << static_cast<std::int32_t>(grid.GetDimension()) << " 1 " << element_type.type << ' ' << number_of_elements
+         << '\n';
+    for (std::int32_t element{0}; element < number_of_elements; ++element)
+    {
+        file << element + 1;
+        for (std::int32_t l{0}; l < grid.GetNodesPerElement(); ++l)
+        {
+            file << ' ' << grid.GetElementNode(element, l) + 1;
+        }
+        file << '\n';
+    }
+    if (number_of_boundary_nodes > 0)
+    {
+        file << "0 1 15 " << number_of_boundary_nodes << '\n';
+        auto tag = number_of_elements;
+        for (std::int32_t node{0}; node < number_of_nodes; ++node)
+        {
+            if (grid.IsBoundaryNode(node))
+            {
+                file << ++tag << ' ' << node + 1 << '\n';
+            }
+        }
+    }
+    file << "$EndElements\n";
+
+    if (!file)
+    {
+        throw std::runtime_error("Mesh: cannot write " + path);
+    }
+}
+
+void WriteBinaryMesh(const Grid& grid, const std::string& path)
+{
+    BinaryMeshHeader header{};
+    header.dimension = grid.GetDimension();
+    header.nodes_per_element = grid.GetNodesPerElement();
+    header.number_of_nodes = grid.GetNumberOfNodes();
+    header.number_of_elements = grid.GetNumberOfElements();
+    const auto layout = ComputeBinaryMeshLayout(header);
+
+    std::ofstream file{path, std::ios::binary};
+    if (!file)
+    {
+        throw std::runtime_error("Mesh: cannot open " + path);
+    }
+    WriteArray(file, &header, 1U);
+
+    const std::array<const std::vector<double>*, 3> coordinates{&grid.GetX(), &grid.GetY(), &grid.GetZ()};
+    for (std::int32_t axis{0}; axis < header.dimension; ++axis)
+    {
+        const auto& values = *coordinates[static_cast<std::size_t>(axis)];
+        WriteArray(file, values.data(), values.size());
+    }
+    const auto& connectivity = grid.GetConnectivity();
+    WriteArray(file, connectivity.data(), connectivity.size());
+    const std::array<char, 8> padding{};
+    file.write(padding.data(), static_cast<std::streamsize>(layout.boundary_nodes - layout.connectivity -
+                                                             connectivity.size() * sizeof(std::int32_t)));
+
+    const auto boundary_nodes = CreateBitsetWords(
+        header.number_of_nodes, [&grid](const std::int32_t node) { return grid.IsBoundaryNode(node); });
+    const auto boundary_elements = CreateBitsetWords(
+        header.number_of_elements, [&grid](const std::int32_t element) { return grid.IsBoundaryElement(element); });
+    WriteArray(file, boundary_nodes.data(), boundary_nodes.size());
+    WriteArray(file, boundary_elements.data(), boundary_elements.size());
+
+    if (!file)
+    {
+        throw std::runtime_error("Mesh: cannot write " + path);
+    }
+}
+
+Grid ReadBinaryMesh(const std::string& path)
+{
+    return MappedMesh{path}.ToGrid();
+}
+
+MappedMesh::MappedMesh(const std::string& path)
+{
+    const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+    {
+        throw std::runtime_error("MappedMesh: cannot open " + path);
+    }
+    struct stat file_status{};
+    if (::fstat(file_descriptor, &file_status) != 0)
+    {
+        ::close(file_descriptor);
+        throw std::runtime_error("MappedMesh: cannot stat " + path);
+    }
+    size_ = static_cast<std::size_t>(file_status.st_size);
+    if (size_ < sizeof(BinaryMeshHeader))
+    {
+        ::close(file_descriptor);
+        throw std::invalid_argument("MappedMesh: not a binary mesh file");
+    }
+    data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    ::close(file_descriptor);
+    if (data_ == MAP_FAILED)
+    {
+        data_ = nullptr;
+        throw std::runtime_error("MappedMesh: cannot map " + path);
+    }
+
+    BinaryMeshHeader header{};
+    std::memcpy(&header, data_, sizeof(BinaryMeshHeader));
+    try
+    {
+        ValidateBinaryMeshHeader(header, size_);
+    }
+    catch (...)
+    {
+        Unmap();
+        throw;
+    }
+
+    const auto layout = ComputeBinaryMeshLayout(header);
+    const auto* bytes = static_cast<const char*>(data_);
+    dimension_ = static_cast<std::int8_t>(header.dimension);
+    number_of_nodes_ = header.number_of_nodes;
+    number_of_elements_ = header.number_of_elements;
+    nodes_per_element_ = header.nodes_per_element;
+    std::array<const double*, 3> coordinates{};
+    for (std::int32_t axis{0}; axis < header.dimension; ++axis)
+    {
+        const auto a = static_cast<std::size_t>(axis);
+        coordinates[a] = reinterpret_cast<const double*>(bytes + layout.coordinates[a]);
+    }
+    x_ = coordinates[0];
+    y_ = coordinates[1];
+    z_ = coordinates[2];
+    connectivity_ = reinterpret_cast<const std::int32_t*>(bytes + layout.connectivity);
+    boundary_nodes_ = reinterpret_cast<const std::uint64_t*>(bytes + layout.boundary_nodes);
+    boundary_elements_ = reinterpret_cast<const std::uint64_t*>(bytes + layout.boundary_elements);
+}
+
+MappedMesh::~MappedMesh()
+{
+    Unmap();
+}
+
+MappedMesh::MappedMesh(MappedMesh&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedMesh& MappedMesh::operator=(MappedMesh&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0U);
+        dimension_ = other.dimension_;
+        number_of_nodes_ = other.number_of_nodes_;
+        number_of_elements_ = other.number_of_elements_;
+        nodes_per_element_ = other.nodes_per_element_;
+        x_ = other.x_;
+        y_ = other.y_;
+        z_ = other.z_;
+        connectivity_ = other.connectivity_;
+        boundary_nodes_ = other.boundary_nodes_;
+        boundary_elements_ = other.boundary_elements_;
+    }
+    return *this;
+}
+
+void MappedMesh::Unmap()
+{
+    if (data_ != nullptr)
+    {
+        ::munmap(data_, size_);
+        data_ = nullptr;
+    }
+}
+
+Grid MappedMesh::ToGrid() const
+{
+    const auto number_of_nodes = static_cast<std::size_t>(number_of_nodes_);
+    const auto copy = [number_of_nodes](const double* values) {
+        return (values == nullptr) ? std::vector<double>{} : std::vector<double>(values, values + number_of_nodes);
+    };
+    const auto connectivity_size =
+        static_cast<std::size_t>(number_of_elements_) * static_cast<std::size_t>(nodes_per_element_);
+
+    Grid grid{std::vector<std::int32_t>(connectivity_, connectivity_ + connectivity_size),
+              nodes_per_element_,
+              copy(x_),
+              copy(y_),
+              copy(z_)};
+    for (std::int32_t node{0}; node < number_of_nodes_; ++node)
+    {
+        if (IsBoundaryNode(node))
+        {
+            grid.SetBoundaryNode(node, true);
+        }
+    }
+    for (std::int32_t element{0}; element < number_of_elements_; ++element)
+    {
+        if (IsBoundaryElement(element))
+        {
+            grid.SetBoundaryElement(element, true);
+        }
+    }
+    return grid;
+}
+
+}  // namespace geometry
+
+}  // namespace pde
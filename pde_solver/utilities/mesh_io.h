@@ -0,0 +1,121 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Mesh reader and writer for the ASCII Gmsh MSH 4.1 format and a native binary format that is memory mapped
+ */
+
+#ifndef PDE_SOLVER_UTILITIES_MESH_IO_H
+#define PDE_SOLVER_UTILITIES_MESH_IO_H
+
+#include "pde_solver/data_types/grid.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace pde
+{
+
+namespace geometry
+{
+
+/// @brief Reads an ASCII Gmsh MSH 4.1 file
+///
+/// The elements of the highest dimension in the file become the elements of the grid, the nodes of every lower
+/// dimensional element (boundary lines of a 2D mesh, end points of a 1D mesh) are flagged as boundary nodes and an
+/// element is a boundary element when it touches one. Nodes keep their order in the file, node tags may have gaps.
+/// The file is read into one buffer and parsed in place, nothing is allocated per node or element.
+///
+/// @throws std::runtime_error: when the file cannot be read
+/// @throws std::invalid_argument: when the file is not MSH 4.1 ASCII, uses an unknown element type, or mixes element
+/// types in its highest dimension
+Grid ReadGmshMesh(const std::string& path);
+
+/// @brief Writes grid as an ASCII Gmsh MSH 4.1 file, boundary nodes as point elements that ReadGmshMesh flags again
+///
+/// @throws std::runtime_error: when the file cannot be written
+/// @throws std::invalid_argument: when the grid has no Gmsh element type of its dimension and nodes per element
+void WriteGmshMesh(const Grid& grid, const std::string& path);
+
+/// @brief Writes grid in the native binary format read by MappedMesh and ReadBinaryMesh
+///
+/// Values are stored in host byte order, little endian on x86-64 and AArch64, and the header records it so a reader
+/// of the other byte order rejects the file. A 32 byte header is followed by x, y and z as double arrays (y and z only
+/// in 2D and 3D), the int32 connectivity, then the node and element boundary bitsets as uint64 words. Every section
+/// starts on an 8 byte boundary, so the arrays of a mapped file are aligned and used in place.
+///
+/// @throws std::runtime_error: when the file cannot be written
+void WriteBinaryMesh(const Grid& grid, const std::string& path);
+
+/// @brief Reads a file written by WriteBinaryMesh, one copy of every array and no parsing
+///
+/// @throws std::runtime_error: when the file cannot be mapped
+/// @throws std::invalid_argument: when the file is not a binary mesh or is truncated
+Grid ReadBinaryMesh(const std::string& path);
+
+/// @brief Read only view of a binary mesh file mapped into memory
+///
+/// Coordinates, connectivity and boundary flags are read straight from the mapping, opening a mesh costs the header
+/// checks only and the pages are loaded on first access. Node indices of the connectivity are not checked, ToGrid
+/// checks them.
+class MappedMesh
+{
+  public:
+    /// @throws std::runtime_error: when the file cannot be opened or mapped
+    /// @throws std::invalid_argument: when the file is not a binary mesh or is truncated
+    explicit MappedMesh(const std::string& path);
+    ~MappedMesh();
+
+    MappedMesh(const MappedMesh& other) = delete;
+    MappedMesh& operator=(const MappedMesh& other) = delete;
+    MappedMesh(MappedMesh&& other) noexcept;
+    MappedMesh& operator=(MappedMesh&& other) noexcept;
+
+    std::int8_t GetDimension() const { return dimension_; }
+    std::int32_t GetNumberOfNodes() const { return number_of_nodes_; }
+    std::int32_t GetNumberOfElements() const { return number_of_elements_; }
+    std::int32_t GetNodesPerElement() const { return nodes_per_element_; }
+
+    /// @brief Coordinate arrays of GetNumberOfNodes() entries, nullptr for y and z beyond the dimension
+    const double* GetX() const { return x_; }
+    const double* GetY() const { return y_; }
+    const double* GetZ() const { return z_; }
+
+    /// @brief GetNumberOfElements() * GetNodesPerElement() node indices, laid out like Grid::GetConnectivity
+    const std::int32_t* GetConnectivity() const { return connectivity_; }
+
+    bool IsBoundaryNode(const std::int32_t node) const { return TestBit(boundary_nodes_, node); }
+    bool IsBoundaryElement(const std::int32_t element) const { return TestBit(boundary_elements_, element); }
+
+    /// @brief Copies the mapped arrays into a Grid
+    ///
+    /// @throws std::invalid_argument: when the connectivity refers to a node that does not exist
+    Grid ToGrid() const;
+
+  private:
+    static bool TestBit(const std::uint64_t* words, const std::int32_t index)
+    {
+        return ((words[static_cast<std::size_t>(index) / 64U] >> (static_cast<std::size_t>(index) % 64U)) & 1U) != 0U;
+    }
+
+    void Unmap();
+
+    void* data_{nullptr};
+    std::size_t size_{0};
+    std::int8_t dimension_{0};
+    std::int32_t number_of_nodes_{0};
+    std::int32_t number_of_elements_{0};
+    std::int32_t nodes_per_element_{0};
+    const double* x_{nullptr};
+    const double* y_{nullptr};
+    const double* z_{nullptr};
+    const std::int32_t* connectivity_{nullptr};
+    const std::uint64_t* boundary_nodes_{nullptr};
+    const std::uint64_t* boundary_elements_{nullptr};
+};
+
+}  // namespace geometry
+
+}  // namespace pde
+
+#endif  // PDE_SOLVER_UTILITIES_MESH_IO_H
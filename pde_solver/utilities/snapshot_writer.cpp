@@ -0,0 +1,390 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "pde_solver/utilities/snapshot_writer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace pde
+{
+
+namespace
+{
+
+constexpr std::array<char, 8> kSnapshotMagic{'N', 'M', 'S', 'N', 'A', 'P', '\0', '\0'};
+constexpr std::uint32_t kSnapshotByteOrder{0x01020304U};
+constexpr std::uint32_t kSnapshotVersion{1U};
+constexpr double kSnapshotTimeTolerance{1e-12};
+
+struct SnapshotFileHeader
+{
+    std::array<char, 8> magic{kSnapshotMagic};
+    std::uint32_t byte_order{kSnapshotByteOrder};
+    std::uint32_t version{kSnapshotVersion};
+    std::int64_t values_per_snapshot{0};
+};
+static_assert(sizeof(SnapshotFileHeader) == 24, "The snapshot file header must be 24 bytes");
+
+/// @brief VTK cell type of the linear elements, the higher order ones number their nodes differently than Gmsh
+std::int32_t VtkCellType(const std::int8_t dimension, const std::int32_t nodes_per_element)
+{
+    struct VtkCell
+    {
+        std::int8_t dimension;
+        std::int32_t nodes;
+        std::int32_t type;
+    };
+    constexpr std::array<VtkCell, 7> kVtkCells{{
+        {1, 2, 3},   // VTK_LINE
+        {2, 3, 5},   // VTK_TRIANGLE
+        {2, 4, 9},   // VTK_QUAD
+        {3, 4, 10},  // VTK_TETRA
+        {3, 8, 12},  // VTK_HEXAHEDRON
+        {3, 6, 13},  // VTK_WEDGE
+        {3, 5, 14},  // VTK_PYRAMID
+    }};
+    const auto found = std::find_if(kVtkCells.cbegin(), kVtkCells.cend(), [&](const VtkCell& cell) {
+        return cell.dimension == dimension && cell.nodes == nodes_per_element;
+    });
+    if (found == kVtkCells.cend())
+    {
+        throw std::invalid_argument("SnapshotWriter: VTK has no linear cell with " +
+                                    std::to_string(nodes_per_element) + " nodes in " + std::to_string(dimension) + "D");
+    }
+    return found->type;
+}
+
+std::string FormatVtkGeometry(const geometry::Grid& grid)
+{
+    const auto type = VtkCellType(grid.GetDimension(), grid.GetNodesPerElement());
+    const auto number_of_nodes = grid.GetNumberOfNodes();
+    const auto number_of_elements = grid.GetNumberOfElements();
+    const auto nodes_per_element = grid.GetNodesPerElement();
+
+    std::ostringstream geometry{};
+    geometry << std::setprecision(std::numeric_limits<double>::max_digits10);
+    geometry << "POINTS " << number_of_nodes << " double\n";
+    for (std::int32_t node{0}; node < number_of_nodes; ++node)
+    {
+        const auto i = static_cast<std::size_t>(node);
+        geometry << grid.GetX()[i] << ' ' << (grid.GetY().empty() ? 0.0 : grid.GetY()[i]) << ' '
+                 << (grid.GetZ().empty() ? 0.0 : grid.GetZ()[i]) << '\n';
+    }
+    geometry << "CELLS " << number_of_elements << ' ' << number_of_elements * (nodes_per_element + 1) << '\n';
+    for (std::int32_t element{0}; element < number_of_elements; ++element)
+    {
+        geometry << nodes_per_element;
+        for (std::int32_t l{0}; l < nodes_per_element; ++l)
+        {
+            geometry << ' ' << grid.GetElementNode(element, l);
+        }
+        geometry << '\n';
+    }
+    geometry << "CELL_TYPES " << number_of_elements << '\n';
+    for (std::int32_t element{0}; element < number_of_elements; ++element)
+    {
+        geometry << type << '\n';
+    }
+    return geometry.str();
+}
+
+}  // namespace
+
+SnapshotWriter::SnapshotWriter(const std::string& path,
+                               const SnapshotFormat format,
+                               SnapshotSchedule schedule,
+                               const geometry::Grid* grid)
+    : path_(path), format_(format), schedule_(std::move(schedule))
+{
+    if (format_ == SnapshotFormat::kVtk)
+    {
+        if (grid == nullptr)
+        {
+            throw std::invalid_argument("SnapshotWriter: VTK output needs the grid");
+        }
+        vtk_geometry_ = FormatVtkGeometry(*grid);
+        values_per_snapshot_ = grid->GetNumberOfNodes();
+    }
+    else
+    {
+        binary_file_.open(path_, std::ios::binary);
+        if (!binary_file_)
+        {
+            throw std::runtime_error("SnapshotWriter: cannot open " + path_);
+        }
+    }
+
+    writer_ = std::thread{[this]() { WriterLoop(); }};
+}
+
+SnapshotWriter::~SnapshotWriter()
+{
+    try
+    {
+        Close();
+    }
+    catch (...)
+    {
+    }
+}
+
+bool SnapshotWriter::IsDue(const std::int32_t step, const double time)
+{
+    auto is_due = schedule_.every_steps > 0 && step % schedule_.every_steps == 0;
+    while (next_time_ < schedule_.times.size())
+    {
+        const auto requested_time = schedule_.times[next_time_];
+        if (time < requested_time - kSnapshotTimeTolerance * std::max(1.0, std::abs(requested_time)))
+        {
+            break;
+        }
+        is_due = true;
+        ++next_time_;
+    }
+    return is_due;
+}
+
+bool SnapshotWriter::Offer(const std::int32_t step, const double time, const std::vector<double>& values)
+{
+    if (!IsDue(step, time))
+    {
+        return false;
+    }
+    Write(step, time, values);
+    return true;
+}
+
+void SnapshotWriter::Write(const std::int32_t step, const double time, const std::vector<double>& values)
+{
+    if (closed_)
+    {
+        throw std::runtime_error("SnapshotWriter: the writer is closed");
+    }
+    if (values_per_snapshot_ < 0)
+    {
+        values_per_snapshot_ = static_cast<std::int64_t>(values.size());
+    }
+    if (static_cast<std::int64_t>(values.size()) != values_per_snapshot_)
+    {
+        throw std::length_error("SnapshotWriter: every snapshot needs the same number of values");
+    }
+
+    // Wait until the writer is done with the buffer written the time before last
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        condition_.wait(lock, [this]() { return writing_index_ != fill_index_ || error_; });
+    }
+    RethrowWriterError();
+
+    auto& buffer = buffers_[static_cast<std::size_t>(fill_index_)];
+    buffer.step = step;
+    buffer.time = time;
+    buffer.values.assign(values.cbegin(), values.cend());
+
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        condition_.wait(lock, [this]() { return ready_index_ < 0 || error_; });
+        ready_index_ = fill_index_;
+    }
+    condition_.notify_all();
+    RethrowWriterError();
+
+    fill_index_ = 1 - fill_index_;
+    ++number_of_snapshots_;
+}
+
+void SnapshotWriter::Close()
+{
+    if (closed_)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stop_ = true;
+    }
+    condition_.notify_all();
+    writer_.join();
+    closed_ = true;
+
+    if (format_ == SnapshotFormat::kBinary)
+    {
+        // A run without snapshots still leaves a valid, empty, file
+        if (!binary_header_written_ && !error_)
+        {
+            WriteBinaryHeader(std::max<std::int64_t>(values_per_snapshot_, 0));
+        }
+        binary_file_.close();
+        if (!binary_file_ && !error_)
+        {
+            error_ = std::make_exception_ptr(std::runtime_error("SnapshotWriter: cannot write " + path_));
+        }
+    }
+    RethrowWriterError();
+}
+
+void SnapshotWriter::WriterLoop()
+{
+    while (true)
+    {
+        std::int32_t index{-1};
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            condition_.wait(lock, [this]() { return ready_index_ >= 0 || stop_; });
+            if (ready_index_ < 0)
+            {
+                return;
+            }
+            index = ready_index_;
+            writing_index_ = index;
+            ready_index_ = -1;
+        }
+        condition_.notify_all();
+
+        try
+        {
+            WriteSnapshot(buffers_[static_cast<std::size_t>(index)]);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            error_ = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            writing_index_ = -1;
+        }
+        condition_.notify_all();
+    }
+}
+
+void SnapshotWriter::WriteSnapshot(const Snapshot& snapshot)
+{
+    if (format_ == SnapshotFormat::kVtk)
+    {
+        WriteVtkSnapshot(snapshot);
+    }
+    else
+    {
+        WriteBinarySnapshot(snapshot);
+    }
+}
+
+void SnapshotWriter::WriteBinaryHeader(const std::int64_t values_per_snapshot)
+{
+    SnapshotFileHeader header{};
+    header.values_per_snapshot = values_per_snapshot;
+    binary_file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    binary_header_written_ = true;
+}
+
+void SnapshotWriter::WriteBinarySnapshot(const Snapshot& snapshot)
+{
+    if (!binary_header_written_)
+    {
+        WriteBinaryHeader(static_cast<std::int64_t>(snapshot.values.size()));
+    }
+
+    const auto step = static_cast<std::int64_t>(snapshot.step);
+    binary_file_.write(reinterpret_cast<const char*>(&step), sizeof(step));
+    binary_file_.write(reinterpret_cast<const char*>(&snapshot.time), sizeof(snapshot.time));
+    binary_file_.write(reinterpret_cast<const char*>(snapshot.values.data()),
+                       static_cast<std::streamsize>(snapshot.values.size() * sizeof(double)));
+    if (!binary_file_)
+    {
+        throw std::runtime_error("SnapshotWriter: cannot write " + path_);
+    }
+}
+
+void SnapshotWriter::WriteVtkSnapshot(const Snapshot& snapshot)
+{
+    std::array<char, 16> step{};
+    std::snprintf(step.data(), step.size(), "%06d", snapshot.step);
+    const auto path = path_ + "_" + step.data() + ".vtk";
+
+    std::ofstream file{path};
+    if (!file)
+    {
+        throw std::runtime_error("SnapshotWriter: cannot open " + path);
+    }
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+    file << "# vtk DataFile Version 3.0\nstep " << snapshot.step << "\nASCII\nDATASET UNSTRUCTURED_GRID\n";
+    file << "FIELD FieldData 1\nTIME 1 1 double\n" << snapshot.time << '\n';
+    file << vtk_geometry_;
+    file << "POINT_DATA " << snapshot.values.size() << "\nSCALARS u double 1\nLOOKUP_TABLE default\n";
+    for (const auto value : snapshot.values)
+    {
+        file << value << '\n';
+    }
+    if (!file)
+    {
+        throw std::runtime_error("SnapshotWriter: cannot write " + path);
+    }
+}
+
+void SnapshotWriter::RethrowWriterError()
+{
+    std::exception_ptr error{};
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        error = error_;
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+std::vector<Snapshot> ReadSnapshots(const std::string& path)
+{
+    std::ifstream file{path, std::ios::binary | std::ios::ate};
+    if (!file)
+    {
+        throw std::runtime_error("ReadSnapshots: cannot open " + path);
+    }
+    const auto size = static_cast<std::size_t>(file.tellg());
+    file.seekg(0);
+
+    SnapshotFileHeader header{};
+    if (size < sizeof(header) || !file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != kSnapshotMagic || header.byte_order != kSnapshotByteOrder ||
+        header.version != kSnapshotVersion || header.values_per_snapshot < 0)
+    {
+        throw std::invalid_argument("ReadSnapshots: not a snapshot file");
+    }
+
+    const auto values_per_snapshot = static_cast<std::size_t>(header.values_per_snapshot);
+    const auto record_size = sizeof(std::int64_t) + sizeof(double) + values_per_snapshot * sizeof(double);
+    if ((size - sizeof(header)) % record_size != 0)
+    {
+        throw std::invalid_argument("ReadSnapshots: the file ends inside a snapshot");
+    }
+
+    std::vector<Snapshot> snapshots((size - sizeof(header)) / record_size);
+    for (auto& snapshot : snapshots)
+    {
+        std::int64_t step{};
+        snapshot.values.resize(values_per_snapshot);
+        file.read(reinterpret_cast<char*>(&step), sizeof(step));
+        file.read(reinterpret_cast<char*>(&snapshot.time), sizeof(snapshot.time));
+        file.read(reinterpret_cast<char*>(snapshot.values.data()),
+                  static_cast<std::streamsize>(values_per_snapshot * sizeof(double)));
+        snapshot.step = static_cast<std::int32_t>(step);
+    }
+    if (!file)
+    {
+        throw std::runtime_error("ReadSnapshots: cannot read " + path);
+    }
+    return snapshots;
+}
+
+}  // namespace pde
@@ -0,0 +1,161 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ *
+ * Background writer of solution snapshots of a time dependent problem, to a chunked binary file or to VTK files
+ */
+
+#ifndef PDE_SOLVER_UTILITIES_SNAPSHOT_WRITER_H
+#define PDE_SOLVER_UTILITIES_SNAPSHOT_WRITER_H
+
+#include "pde_solver/data_types/grid.h"
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pde
+{
+
+enum class SnapshotFormat : std::int8_t
+{
+    // One file of fixed size records, see SnapshotWriter
+    kBinary = 0,
+    // One legacy ASCII VTK unstructured grid file per snapshot with the solution as point data, for ParaView or VisIt
+    kVtk = 1,
+};
+
+/// @brief Which steps are written, a step is written when either rule selects it
+struct SnapshotSchedule
+{
+    // Every every_steps steps starting with the initial condition at step 0, 0 writes no periodic snapshots
+    std::int32_t every_steps{0};
+
+    // The first step at or after each of these times, in increasing order
+    std::vector<double> times{};
+};
+
+struct Snapshot
+{
+    std::int32_t step{0};
+    double time{0.0};
+    std::vector<double> values{};
+};
+
+/// @brief Writes snapshots on a background thread while the caller keeps stepping
+///
+/// Two snapshot buffers alternate: Offer copies the solution into the free one and hands it to the writer thread,
+/// which writes it while the next snapshot is filled. The stepping loop only waits when a snapshot is due before the
+/// writer has finished the one before last, i.e. when the disk is slower than the snapshots are produced, and memory
+/// stays at two snapshots whatever the number of steps.
+///
+/// The binary file starts with a 24 byte header, 8 magic bytes, the uint32 byte order mark 0x01020304, the uint32
+/// version and the int64 number of values per snapshot, followed by one record per snapshot of the int64 step, the
+/// double time and the values. Records all have the same size, so snapshot k is found by seeking to
+/// 24 + k * (16 + 8 * values) without reading the ones before it.
+///
+/// VTK snapshots go to path_<step>.vtk with the step padded to 6 digits, ParaView opens the numbered files as a
+/// series.
+///
+/// Typical use with TimeVariable::Run:
+///
+///     SnapshotWriter writer{"run.snapshots", SnapshotFormat::kBinary, {10, {}}};
+///     uu.Run([&writer](auto step, auto time, const auto& u) { writer.Offer(step, time, u); });
+///     writer.Close();
+class SnapshotWriter
+{
+  public:
+    /// @param path: the file for kBinary, the prefix of the file names for kVtk
+    /// @param grid: nodes and elements of the snapshots, required for kVtk only
+    ///
+    /// @throws std::invalid_argument: when format is kVtk without a grid or the grid has an element type VTK lacks
+    /// @throws std::runtime_error: when the binary file cannot be opened
+    SnapshotWriter(const std::string& path,
+                   const SnapshotFormat format,
+                   SnapshotSchedule schedule,
+                   const geometry::Grid* grid = nullptr);
+
+    /// @brief Writes the pending snapshots, errors are dropped, call Close to see them
+    ~SnapshotWriter();
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    /// @brief Whether the schedule selects the step at time, advances past the requested times it covers
+    ///
+    /// A requested time counts as reached within a relative 1e-12, so start + n * delta_t rounding below it does not
+    /// push the snapshot to the next step.
+    bool IsDue(const std::int32_t step, const double time);
+
+    /// @brief Queues the snapshot when the schedule selects it and returns whether it did
+    ///
+    /// @throws std::length_error: when values differs in size from the first snapshot, or from the grid for kVtk
+    /// @throws std::runtime_error: when writing an earlier snapshot failed or the writer is closed
+    bool Offer(const std::int32_t step, const double time, const std::vector<double>& values);
+
+    /// @brief Queues the snapshot whatever the schedule, e.g. the final state
+    ///
+    /// @throws std::length_error: when values differs in size from the first snapshot, or from the grid for kVtk
+    /// @throws std::runtime_error: when writing an earlier snapshot failed or the writer is closed
+    void Write(const std::int32_t step, const double time, const std::vector<double>& values);
+
+    /// @brief Waits for the queued snapshots to be written and stops the writer thread, later calls do nothing
+    ///
+    /// @throws std::runtime_error: when writing a snapshot failed
+    void Close();
+
+    /// @brief Number of snapshots queued so far
+    std::int32_t GetNumberOfSnapshots() const { return number_of_snapshots_; }
+
+  private:
+    void WriterLoop();
+    void WriteSnapshot(const Snapshot& snapshot);
+    void WriteBinaryHeader(const std::int64_t values_per_snapshot);
+    void WriteBinarySnapshot(const Snapshot& snapshot);
+    void WriteVtkSnapshot(const Snapshot& snapshot);
+    void RethrowWriterError();
+
+    std::string path_{};
+    SnapshotFormat format_{SnapshotFormat::kBinary};
+    SnapshotSchedule schedule_{};
+    std::size_t next_time_{0};
+    std::int32_t number_of_snapshots_{0};
+    std::int64_t values_per_snapshot_{-1};
+
+    bool closed_{false};
+
+    // Owned by the writer thread until Close joins it
+    std::ofstream binary_file_{};
+    bool binary_header_written_{false};
+    // Points and cells of the VTK files, the same for every snapshot and formatted once
+    std::string vtk_geometry_{};
+
+    std::array<Snapshot, 2> buffers_{};
+    std::int32_t fill_index_{0};
+
+    // Hand over between the caller and the writer thread, guarded by mutex_
+    std::mutex mutex_{};
+    std::condition_variable condition_{};
+    std::int32_t ready_index_{-1};
+    std::int32_t writing_index_{-1};
+    bool stop_{false};
+    std::exception_ptr error_{};
+
+    std::thread writer_{};
+};
+
+/// @brief Reads every snapshot of a file written with SnapshotFormat::kBinary
+///
+/// @throws std::runtime_error: when the file cannot be read
+/// @throws std::invalid_argument: when the file is not a snapshot file or ends inside a record
+std::vector<Snapshot> ReadSnapshots(const std::string& path);
+
+}  // namespace pde
+
+#endif  // PDE_SOLVER_UTILITIES_SNAPSHOT_WRITER_H
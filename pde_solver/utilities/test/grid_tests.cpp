@@ -5,8 +5,13 @@
 ///
 
 #include "pde_solver/data_types/grid.h"
+#include "pde_solver/data_types/structured_grid.h"
 #include "pde_solver/utilities/grid_generator.h"
+#include <cstddef>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
 
 namespace pde
 {
@@ -28,15 +33,66 @@ TEST(OneDimensionLinearGridTests, GivenValidStartAndEnd_ExpectValidGrid)
 
     // Call
     const auto result = grid_generator.Create1DLinearGrid(size, start, end);
-    const auto first_node = result.GetElements().at(0).GetNodes().front();
-    const auto first_node_x_value = first_node.GetValues().front();
-
-    ASSERT_TRUE(first_node_x_value.has_value());
+    const auto first_node_x_value = result.GetX().at(static_cast<std::size_t>(result.GetElementNode(0, 0)));
 
     // Expect
     EXPECT_EQ(result.GetNumberOfNodes(), 11);
     EXPECT_EQ(result.GetDimension(), 1);
-    EXPECT_NEAR(*first_node_x_value, 0.0, tolerance);
+    EXPECT_NEAR(first_node_x_value, 0.0, tolerance);
+}
+
+TEST(OneDimensionLinearGridTests, GivenValidStartAndEnd_ExpectElementsShareTheirNodes)
+{
+    // Given
+    GridGenerator grid_generator{};
+
+    // Call
+    const auto result = grid_generator.Create1DLinearGrid(5, 1.0, 2.0);
+
+    // Expect, four elements over five nodes, the end node of one element is the start node of the next
+    EXPECT_EQ(result.GetNumberOfElements(), 4);
+    EXPECT_EQ(result.GetConnectivity(), (std::vector<std::int32_t>{0, 1, 1, 2, 2, 3, 3, 4}));
+    EXPECT_EQ(result.GetX(), (std::vector<double>{1.0, 1.25, 1.5, 1.75, 2.0}));
+    EXPECT_EQ(result.GetNumberOfBoundaryNodes(), 2);
+    EXPECT_TRUE(result.IsBoundaryNode(0));
+    EXPECT_TRUE(result.IsBoundaryNode(4));
+    EXPECT_TRUE(result.IsBoundaryElement(3));
+    EXPECT_FALSE(result.IsBoundaryElement(1));
+    EXPECT_THROW(grid_generator.Create1DLinearGrid(1, 0.0, 1.0), std::invalid_argument);
+}
+
+TEST(StructuredGridGeneratorTests, GivenTwoAxes_ExpectUniformTwoDimensionalGrid)
+{
+    // Given
+    const GridGenerator grid_generator{};
+
+    // Call
+    const auto result = grid_generator.Create2DStructuredGrid({11, 0.0, 1.0}, {5, -1.0, 1.0});
+
+    // Expect
+    EXPECT_EQ(result.GetDimension(), 2);
+    EXPECT_EQ(result.GetNumberOfNodes(), 55);
+    EXPECT_DOUBLE_EQ(result.GetCoordinates(Axis::kX).back(), 1.0);
+    EXPECT_DOUBLE_EQ(result.GetCoordinates(Axis::kY).front(), -1.0);
+    EXPECT_NEAR(result.GetSpacing(Axis::kY, 2), 0.5, 1e-12);
+    EXPECT_EQ(result.GetBoundaryNodes().size(), 55U - 9U * 3U);
+}
+
+TEST(StructuredGridGeneratorTests, GivenThreeAxes_ExpectUniformThreeDimensionalGrid)
+{
+    // Given
+    const GridGenerator grid_generator{};
+
+    // Call
+    const auto result = grid_generator.Create3DStructuredGrid({4, 0.0, 3.0}, {3, 0.0, 1.0}, {6, 0.0, 0.5});
+
+    // Expect
+    EXPECT_EQ(result.GetDimension(), 3);
+    EXPECT_EQ(result.GetNumberOfNodes(), 72);
+    EXPECT_EQ(result.GetBoundaryNodes().size(), 72U - 2U * 1U * 4U);
+    EXPECT_NEAR(result.GetSpacing(Axis::kZ, 4), 0.1, 1e-12);
+    EXPECT_THROW(grid_generator.Create3DStructuredGrid({1, 0.0, 1.0}, {3, 0.0, 1.0}, {3, 0.0, 1.0}),
+                 std::invalid_argument);
 }
 
 }  // namespace
@@ -0,0 +1,198 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "pde_solver/utilities/mesh_io.h"
+#include "pde_solver/data_types/grid.h"
+#include "pde_solver/utilities/grid_generator.h"
+#include <cstdint>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace pde
+{
+
+namespace geometry
+{
+
+namespace
+{
+
+std::string TemporaryPath(const std::string& name)
+{
+    return testing::TempDir() + name;
+}
+
+void WriteText(const std::string& path, const std::string& text)
+{
+    std::ofstream file{path};
+    file << text;
+}
+
+/// @brief Unit square split into two triangles along its diagonal, with some boundary flags set
+Grid CreateTwoTriangleGrid()
+{
+    Grid grid{{0, 1, 2, 0, 2, 3}, 3, {0.0, 1.0, 1.0, 0.0}, {0.0, 0.0, 1.0, 1.0}};
+    grid.SetBoundaryNode(1, true);
+    grid.SetBoundaryNode(3, true);
+    grid.SetBoundaryElement(0, true);
+    return grid;
+}
+
+void ExpectSameGrid(const Grid& result, const Grid& expected)
+{
+    EXPECT_EQ(result.GetDimension(), expected.GetDimension());
+    EXPECT_EQ(result.GetNodesPerElement(), expected.GetNodesPerElement());
+    EXPECT_EQ(result.GetX(), expected.GetX());
+    EXPECT_EQ(result.GetY(), expected.GetY());
+    EXPECT_EQ(result.GetZ(), expected.GetZ());
+    EXPECT_EQ(result.GetConnectivity(), expected.GetConnectivity());
+    for (std::int32_t node{0}; node < expected.GetNumberOfNodes(); ++node)
+    {
+        EXPECT_EQ(result.IsBoundaryNode(node), expected.IsBoundaryNode(node));
+    }
+}
+
+TEST(GmshMeshTests, GivenGeneratedGrid_ExpectSameGridAfterWriteAndRead)
+{
+    // Given, spacings of 1/3 only survive the round trip when all 17 digits are written
+    GridGenerator grid_generator{};
+    const auto grid = grid_generator.Create1DLinearGrid(4, 0.0, 1.0);
+    const auto path = TemporaryPath("line.msh");
+
+    // Call
+    WriteGmshMesh(grid, path);
+    const auto result = ReadGmshMesh(path);
+
+    // Expect, the end points come back as boundary nodes and their elements as boundary elements
+    ExpectSameGrid(result, grid);
+    EXPECT_TRUE(result.IsBoundaryElement(0));
+    EXPECT_FALSE(result.IsBoundaryElement(1));
+    EXPECT_TRUE(result.IsBoundaryElement(2));
+}
+
+TEST(GmshMeshTests, GivenFileWithTagGapsAndBoundaryLines_ExpectSharedNodesAndBoundaryFlags)
+{
+    // Given, a unit square of two triangles as Gmsh writes it, with entities, physical names and sparse node tags
+    const auto path = TemporaryPath("square.msh");
+    WriteText(path,
+              "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n"
+              "$PhysicalNames\n1\n1 1 \"wall\"\n$EndPhysicalNames\n"
+              "$Entities\n0 1 1 0\n1 0 0 0 1 0 0 1 1 0\n1 0 0 0 1 1 0 0 0\n$EndEntities\n"
+              "$Nodes\n2 5 10 50\n"
+              "1 1 0 4\n10\n20\n30\n40\n0 0 0\n1 0 0\n1 1 0\n0 1 0\n"
+              "2 1 0 1\n50\n0.5 0.5 0\n"
+              "$EndNodes\n"
+              "$Elements\n2 4 1 4\n"
+              "1 1 1 2\n1 10 20\n2 20 30\n"
+              "2 1 2 2\n3 10 20 30\n4 10 30 40\n"
+              "$EndElements\n");
+
+    // Call
+    const auto result = ReadGmshMesh(path);
+
+    // Expect, node 50 is stored although no element uses it
+    EXPECT_EQ(result.GetDimension(), 2);
+    EXPECT_EQ(result.GetNumberOfNodes(), 5);
+    EXPECT_EQ(result.GetNumberOfElements(), 2);
+    EXPECT_EQ(result.GetConnectivity(), (std::vector<std::int32_t>{0, 1, 2, 0, 2, 3}));
+    EXPECT_EQ(result.GetY(), (std::vector<double>{0.0, 0.0, 1.0, 1.0, 0.5}));
+    EXPECT_TRUE(result.GetZ().empty());
+    EXPECT_EQ(result.GetNumberOfBoundaryNodes(), 3);
+    EXPECT_FALSE(result.IsBoundaryNode(3));
+    EXPECT_TRUE(result.IsBoundaryElement(1));
+}
+
+TEST(GmshMeshTests, GivenInvalidFiles_ExpectThrow)
+{
+    // Given
+    const auto binary_format = TemporaryPath("binary.msh");
+    const auto mixed_elements = TemporaryPath("mixed.msh");
+    WriteText(binary_format, "$MeshFormat\n4.1 1 8\n$EndMeshFormat\n");
+    WriteText(mixed_elements,
+              "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n"
+              "$Nodes\n1 4 1 4\n2 1 0 4\n1\n2\n3\n4\n0 0 0\n1 0 0\n1 1 0\n0 1 0\n$EndNodes\n"
+              "$Elements\n2 2 1 2\n2 1 2 1\n1 1 2 3\n2 2 3 1\n2 1 2 3 4\n$EndElements\n");
+
+    // Call and Expect
+    EXPECT_THROW(ReadGmshMesh(TemporaryPath("missing.msh")), std::runtime_error);
+    EXPECT_THROW(ReadGmshMesh(binary_format), std::invalid_argument);
+    EXPECT_THROW(ReadGmshMesh(mixed_elements), std::invalid_argument);
+}
+
+TEST(BinaryMeshTests, GivenTwoDimensionalGrid_ExpectMappedArraysAndSameGridAfterRead)
+{
+    // Given
+    const auto grid = CreateTwoTriangleGrid();
+    const auto path = TemporaryPath("square.mesh");
+
+    // Call
+    WriteBinaryMesh(grid, path);
+    const MappedMesh mesh{path};
+    const auto result = ReadBinaryMesh(path);
+
+    // Expect
+    EXPECT_EQ(mesh.GetDimension(), 2);
+    EXPECT_EQ(mesh.GetNumberOfNodes(), 4);
+    EXPECT_EQ(mesh.GetNumberOfElements(), 2);
+    EXPECT_EQ(mesh.GetZ(), nullptr);
+    EXPECT_DOUBLE_EQ(mesh.GetY()[2], 1.0);
+    EXPECT_EQ(mesh.GetConnectivity()[5], 3);
+    EXPECT_TRUE(mesh.IsBoundaryNode(3));
+    EXPECT_FALSE(mesh.IsBoundaryNode(2));
+    EXPECT_TRUE(mesh.IsBoundaryElement(0));
+    ExpectSameGrid(result, grid);
+    EXPECT_FALSE(result.IsBoundaryElement(1));
+}
+
+TEST(BinaryMeshTests, GivenMovedMapping_ExpectViewStaysValid)
+{
+    // Given
+    GridGenerator grid_generator{};
+    const auto path = TemporaryPath("line.mesh");
+    WriteBinaryMesh(grid_generator.Create1DLinearGrid(100, 0.0, 1.0), path);
+    MappedMesh mesh{path};
+
+    // Call
+    const MappedMesh moved{std::move(mesh)};
+
+    // Expect
+    EXPECT_EQ(moved.GetNumberOfNodes(), 100);
+    EXPECT_DOUBLE_EQ(moved.GetX()[99], 1.0);
+    EXPECT_TRUE(moved.IsBoundaryNode(99));
+}
+
+TEST(BinaryMeshTests, GivenInvalidFiles_ExpectThrow)
+{
+    // Given
+    const auto text_file = TemporaryPath("text.mesh");
+    const auto truncated_file = TemporaryPath("truncated.mesh");
+    WriteText(text_file, "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n");
+    WriteBinaryMesh(CreateTwoTriangleGrid(), truncated_file);
+    std::ifstream input{truncated_file, std::ios::binary};
+    std::string bytes((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    input.close();
+    WriteText(truncated_file, bytes.substr(0, bytes.size() - 8));
+    // The int32 dimension follows the 8 magic bytes, the byte order mark and the version
+    const auto dimensionless_file = TemporaryPath("dimensionless.mesh");
+    bytes.replace(16, 4, std::string(4, '\0'));
+    WriteText(dimensionless_file, bytes);
+
+    // Call and Expect
+    EXPECT_THROW(MappedMesh{TemporaryPath("missing.mesh")}, std::runtime_error);
+    EXPECT_THROW(MappedMesh{text_file}, std::invalid_argument);
+    EXPECT_THROW(ReadBinaryMesh(truncated_file), std::invalid_argument);
+    EXPECT_THROW(MappedMesh{dimensionless_file}, std::invalid_argument);
+}
+
+}  // namespace
+
+}  // namespace geometry
+
+}  // namespace pde
@@ -0,0 +1,170 @@
+/*
+ * Author: Alejandro Valencia
+ * Update: October 18, 2026
+ */
+
+#include "pde_solver/utilities/snapshot_writer.h"
+#include "matrix_solvers/utilities.h"
+#include "pde_solver/data_types/time_variable.h"
+#include "pde_solver/utilities/grid_generator.h"
+#include <cstdint>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace pde
+{
+
+namespace
+{
+
+std::string TemporaryPath(const std::string& name)
+{
+    return testing::TempDir() + name;
+}
+
+/// @brief u' = -u on two unknowns with Euler steps of 0.25 from t = 0 to t = 2
+void SetUpDecay(TimeVariable& uu)
+{
+    uu.SetRightHandSideMatrix(nm::matrix::Matrix<double>{{-1.0, 0.0}, {0.0, -1.0}});
+    uu.SetInitialCondition({1.0, 2.0});
+    uu.SetTimeDiscretizationMethod(TimeDiscretizationMethod::kEulerStep);
+    uu.SetStartTime(0.0);
+    uu.SetEndTime(2.0);
+    uu.SetTimeStep(0.25);
+}
+
+TEST(SnapshotWriterTests, GivenEveryThirdStep_ExpectSnapshotsOfTheRunInBinaryFile)
+{
+    // Given
+    TimeVariable uu{};
+    SetUpDecay(uu);
+    const auto path = TemporaryPath("decay.snapshots");
+    SnapshotWriter writer{path, SnapshotFormat::kBinary, {3, {}}};
+
+    // Call
+    uu.Run([&writer](const std::int32_t step, const double time, const std::vector<double>& u) {
+        writer.Offer(step, time, u);
+    });
+    writer.Close();
+    const auto snapshots = ReadSnapshots(path);
+
+    // Expect, steps 0, 3 and 6 of 8, every Euler step multiplies u by 0.75
+    ASSERT_EQ(snapshots.size(), 3U);
+    EXPECT_EQ(writer.GetNumberOfSnapshots(), 3);
+    EXPECT_EQ(snapshots[0].values, (std::vector<double>{1.0, 2.0}));
+    EXPECT_EQ(snapshots[1].step, 3);
+    EXPECT_DOUBLE_EQ(snapshots[1].time, 0.75);
+    EXPECT_DOUBLE_EQ(snapshots[1].values[1], 2.0 * 0.75 * 0.75 * 0.75);
+    EXPECT_EQ(snapshots[2].step, 6);
+    EXPECT_DOUBLE_EQ(snapshots[2].values[0], 0.75 * 0.75 * 0.75 * 0.75 * 0.75 * 0.75);
+}
+
+TEST(SnapshotWriterTests, GivenRequestedTimes_ExpectFirstStepAtOrAfterEach)
+{
+    // Given
+    TimeVariable uu{};
+    SetUpDecay(uu);
+    const auto path = TemporaryPath("times.snapshots");
+    SnapshotWriter writer{path, SnapshotFormat::kBinary, {0, {0.5, 0.6, 0.7, 1.9}}};
+
+    // Call, the final state is written whatever the schedule
+    uu.Run([&writer](const std::int32_t step, const double time, const std::vector<double>& u) {
+        writer.Offer(step, time, u);
+    });
+    writer.Write(8, 2.0, uu.GetTimeVariable());
+    writer.Close();
+    const auto snapshots = ReadSnapshots(path);
+
+    // Expect, 0.6 and 0.7 both land on step 3 at t = 0.75 which is written once
+    ASSERT_EQ(snapshots.size(), 4U);
+    EXPECT_EQ(snapshots[0].step, 2);
+    EXPECT_EQ(snapshots[1].step, 3);
+    EXPECT_EQ(snapshots[2].step, 8);
+    EXPECT_EQ(snapshots[3].step, 8);
+    EXPECT_EQ(snapshots[3].values, uu.GetTimeVariable());
+}
+
+TEST(SnapshotWriterTests, GivenManySnapshots_ExpectAllWrittenInOrder)
+{
+    // Given
+    const auto path = TemporaryPath("many.snapshots");
+    SnapshotWriter writer{path, SnapshotFormat::kBinary, {1, {}}};
+    std::vector<double> u(1000, 0.0);
+
+    // Call, the caller overwrites u right after every Offer while the writer thread is still busy
+    for (std::int32_t step{0}; step < 200; ++step)
+    {
+        u.assign(u.size(), static_cast<double>(step));
+        writer.Offer(step, step * 0.1, u);
+    }
+    writer.Close();
+    const auto snapshots = ReadSnapshots(path);
+
+    // Expect
+    ASSERT_EQ(snapshots.size(), 200U);
+    for (std::int32_t step{0}; step < 200; ++step)
+    {
+        EXPECT_EQ(snapshots[static_cast<std::size_t>(step)].step, step);
+        EXPECT_EQ(snapshots[static_cast<std::size_t>(step)].values.back(), static_cast<double>(step));
+    }
+}
+
+TEST(SnapshotWriterTests, GivenGrid_ExpectVtkFilePerSnapshot)
+{
+    // Given
+    geometry::GridGenerator grid_generator{};
+    const auto grid = grid_generator.Create1DLinearGrid(3, 0.0, 1.0);
+    const auto prefix = TemporaryPath("line");
+    SnapshotWriter writer{prefix, SnapshotFormat::kVtk, {1, {}}, &grid};
+
+    // Call
+    writer.Offer(0, 0.0, {1.0, 2.0, 3.0});
+    writer.Offer(1, 0.5, {4.0, 5.0, 6.0});
+    writer.Close();
+
+    // Expect
+    std::ifstream file{prefix + "_000001.vtk"};
+    std::stringstream text{};
+    text << file.rdbuf();
+    EXPECT_NE(text.str().find("DATASET UNSTRUCTURED_GRID"), std::string::npos);
+    EXPECT_NE(text.str().find("TIME 1 1 double\n0.5\n"), std::string::npos);
+    EXPECT_NE(text.str().find("POINTS 3 double\n0 0 0\n0.5 0 0\n1 0 0\n"), std::string::npos);
+    EXPECT_NE(text.str().find("CELLS 2 6\n2 0 1\n2 1 2\nCELL_TYPES 2\n3\n3\n"), std::string::npos);
+    EXPECT_NE(text.str().find("POINT_DATA 3\nSCALARS u double 1\nLOOKUP_TABLE default\n4\n5\n6\n"),
+              std::string::npos);
+    EXPECT_TRUE(std::ifstream{prefix + "_000000.vtk"}.good());
+}
+
+TEST(SnapshotWriterTests, GivenInvalidUse_ExpectThrow)
+{
+    // Given
+    geometry::GridGenerator grid_generator{};
+    const auto grid = grid_generator.Create1DLinearGrid(3, 0.0, 1.0);
+    SnapshotWriter writer{TemporaryPath("invalid.snapshots"), SnapshotFormat::kBinary, {1, {}}};
+    SnapshotWriter missing_directory{TemporaryPath("missing/line"), SnapshotFormat::kVtk, {1, {}}, &grid};
+
+    // Call and Expect
+    EXPECT_THROW(SnapshotWriter(TemporaryPath("line"), SnapshotFormat::kVtk, {}), std::invalid_argument);
+    EXPECT_THROW(SnapshotWriter(TemporaryPath("missing/run.snapshots"), SnapshotFormat::kBinary, {}),
+                 std::runtime_error);
+    writer.Offer(0, 0.0, {1.0, 2.0});
+    EXPECT_THROW(writer.Offer(1, 0.1, {1.0}), std::length_error);
+    writer.Close();
+    EXPECT_THROW(writer.Write(2, 0.2, {1.0, 2.0}), std::runtime_error);
+    EXPECT_THROW(missing_directory.Offer(0, 0.0, {1.0, 2.0}), std::length_error);
+    EXPECT_THROW(
+        {
+            // The failed write surfaces at the next call to the writer or at the latest at Close
+            missing_directory.Offer(0, 0.0, {1.0, 2.0, 3.0});
+            missing_directory.Close();
+        },
+        std::runtime_error);
+}
+
+}  // namespace
+
+}  // namespace pde
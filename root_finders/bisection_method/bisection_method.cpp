@@ -6,6 +6,8 @@
  */
 
 #include "root_finders/bisection_method/bisection_method.h"
+#include <cmath>
+#include <cstdint>
 
 namespace nm
 {
@@ -15,20 +17,33 @@ namespace root_finders
 double BisectionMethod(const std::function<double(double)>& function,
                        const double a,
                        const double b,
-                       const double tolerance)
+                       const double tolerance,
+                       const matrix::SolverTelemetry& telemetry)
 {
-    const double mid = (a + b) / 2.0;
-    if (std::abs(function(mid)) < tolerance)
-    {
-        return mid;
-    }
-    else if (function(a) * function(mid) < 0)
-    {
-        return BisectionMethod(function, a, mid, tolerance);
-    }
-    else
+    matrix::SolverMonitor monitor{telemetry};
+    double lower{a};
+    double upper{b};
+
+    for (std::int32_t iteration{1};; ++iteration)
     {
-        return BisectionMethod(function, mid, b, tolerance);
+        const auto timer = monitor.Time(matrix::SolverPhase::kOperator);
+        const double mid = (lower + upper) / 2.0;
+        const double f_mid = function(mid);
+
+        monitor.RecordIteration(iteration, std::abs(f_mid));
+        if (std::abs(f_mid) < tolerance)
+        {
+            monitor.Finish(iteration, true);
+            return mid;
+        }
+        else if (function(lower) * f_mid < 0)
+        {
+            upper = mid;
+        }
+        else
+        {
+            lower = mid;
+        }
     }
 }
 
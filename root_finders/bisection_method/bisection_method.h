@@ -8,6 +8,7 @@
 #ifndef ROOT_FINDERS_BISECTION_METHOD_BISECTION_METHOD_H
 #define ROOT_FINDERS_BISECTION_METHOD_BISECTION_METHOD_H
 
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include <functional>
 
 namespace nm
@@ -15,10 +16,14 @@ namespace nm
 namespace root_finders
 {
 
+/// @brief Halves [a, b] until |f(mid)| < tolerance, f(a) and f(b) must have opposite signs
+///
+/// @param telemetry: optional stats and observer, receives |f(mid)| after every halving
 double BisectionMethod(const std::function<double(double)>& function,
                        const double a,
                        const double b,
-                       const double tolerance);
+                       const double tolerance,
+                       const matrix::SolverTelemetry& telemetry = {});
 
 }  // namespace root_finders
 
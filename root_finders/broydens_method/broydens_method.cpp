@@ -8,9 +8,11 @@
 #include "root_finders/broydens_method/broydens_method.h"
 #include "matrix_solvers/operations/operations.h"
 #include "matrix_solvers/utilities.h"
+#include "matrix_solvers/workspace/workspace.h"
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
-#include <iostream>
 #include <vector>
 
 namespace nm
@@ -19,49 +21,48 @@ namespace root_finders
 {
 namespace
 {
-std::vector<double> EvaluateSystem(const std::vector<std::function<double(std::vector<double>)>>& equations,
-                                   const std::vector<double>& arguments)
+/// @brief F(arguments) into Fx, which has one entry per equation
+void EvaluateSystem(const std::vector<std::function<double(std::vector<double>)>>& equations,
+                    const std::vector<double>& arguments,
+                    std::vector<double>& Fx)
 {
-    std::vector<double> Fx{};
-    for (auto& equation : equations)
+    for (std::size_t i{0}; i < equations.size(); ++i)
     {
-        Fx.push_back(equation(arguments));
+        Fx[i] = equations[i](arguments);
     }
-    return Fx;
 }
 
-matrix::Matrix<double> EstimateJacobianInverse(const std::vector<std::function<double(std::vector<double>)>>& equations,
-                                               const std::vector<double>& xk,
-                                               const std::vector<double>& F_x,
-                                               const std::vector<double>& xkp1,
-                                               const matrix::Matrix<double>& JacobianInverse)
+/// @brief Good Broyden update in place, Jinverse += (dx - Jinverse dF) dx' Jinverse / (dx' Jinverse dF)
+///
+/// Jinverse_delta_F and delta_xT_Jinverse are scratch vectors of the size of dx, the update is a rank one correction
+/// and needs no matrix temporaries.
+void UpdateJacobianInverse(const std::vector<double>& delta_x,
+                           const std::vector<double>& delta_F,
+                           std::vector<double>& Jinverse_delta_F,
+                           std::vector<double>& delta_xT_Jinverse,
+                           matrix::Matrix<double>& Jinverse)
 {
-    const auto n = static_cast<std::int32_t>(equations.size());
-    const auto I = matrix::CreateIdentityMatrix<double>(n);
-
-    matrix::Matrix<double> JInverse_kp1(n, n);
-
-    std::vector<double> F_xkp1{};
-    F_xkp1.resize(n);
-    F_xkp1 = EvaluateSystem(equations, xkp1);
-
-    const auto delta_x = matrix::AddVectors(xkp1, matrix::ScalarMultiply(-1, xk));
-    const auto delta_F = matrix::AddVectors(F_xkp1, matrix::ScalarMultiply(-1, F_x));
-
-    const matrix::Matrix<double> numerator{
-        {matrix::AddVectors(delta_x, matrix::ScalarMultiply(-1, matrix::MatMult(JacobianInverse, delta_F)))}};
-
-    matrix::Matrix<double> delta_x_as_matrix{{delta_x}};
-    matrix::Matrix<double> delta_F_as_matrix{{delta_F}};
-    const auto delta_x_J_inv = matrix::MatMult(delta_x_as_matrix, JacobianInverse);
-    const auto denominator = matrix::MatMult(delta_x_J_inv, delta_F_as_matrix.Transpose());
-    const auto coefficient = matrix::ScalarMultiply(1 / denominator.back().back(), numerator);
+    const auto n = static_cast<std::int32_t>(delta_x.size());
+    matrix::Gemv(1.0, Jinverse, delta_F, 0.0, Jinverse_delta_F);
 
-    const auto delta_Jinverse =
-        matrix::MatMult(matrix::MatMult(coefficient.Transpose(), delta_x_as_matrix), JacobianInverse);
+    std::fill(delta_xT_Jinverse.begin(), delta_xT_Jinverse.end(), 0.0);
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        for (std::int32_t j{0}; j < n; ++j)
+        {
+            delta_xT_Jinverse[j] += delta_x[i] * Jinverse(i, j);
+        }
+    }
+    const auto coefficient = 1.0 / matrix::Dot(delta_x, Jinverse_delta_F);
 
-    JInverse_kp1 = JacobianInverse + delta_Jinverse;
-    return JInverse_kp1;
+    for (std::int32_t i{0}; i < n; ++i)
+    {
+        const auto scale = coefficient * (delta_x[i] - Jinverse_delta_F[i]);
+        for (std::int32_t j{0}; j < n; ++j)
+        {
+            Jinverse(i, j) += scale * delta_xT_Jinverse[j];
+        }
+    }
 }
 
 }  // namespace
@@ -99,39 +100,73 @@ std::vector<double> BroydensMethod(const std::vector<std::function<double(std::v
                                    const std::vector<double>& initial_guess,
                                    const double delta,
                                    const double tolerance,
-                                   const std::int32_t max_iterations)
+                                   const std::int32_t max_iterations,
+                                   const matrix::SolverTelemetry& telemetry)
 {
-
-    std::vector<double> xk{initial_guess};
-    std::vector<double> xkp1{};
-    xkp1.resize(initial_guess.size());
-
-    const auto Jacobian = EvaluateJacobian(equations, initial_guess, delta);
-    auto Jinverse = matrix::InvertWithLU(Jacobian);
-    std::vector<double> Fxk{};
+    matrix::SolverMonitor monitor{telemetry};
+
+    // Iterates, function values and the deltas of the inverse update come from the workspace of the thread, so the
+    // iterations below do not allocate and repeated solves of the same size reuse its buffers
+    const auto n = initial_guess.size();
+    auto& workspace = matrix::CurrentWorkspace();
+    auto xk_lease = workspace.Acquire(n);
+    auto xkp1_lease = workspace.Acquire(n);
+    auto Fxk_lease = workspace.Acquire(n);
+    auto Fxkp1_lease = workspace.Acquire(n);
+    auto delta_x_lease = workspace.Acquire(n);
+    auto delta_F_lease = workspace.Acquire(n);
+    auto Jinverse_delta_F_lease = workspace.Acquire(n);
+    auto delta_xT_Jinverse_lease = workspace.Acquire(n);
+    auto& xk = *xk_lease;
+    auto& xkp1 = *xkp1_lease;
+    auto& Fxk = *Fxk_lease;
+    auto& Fxkp1 = *Fxkp1_lease;
+    auto& delta_x = *delta_x_lease;
+    auto& delta_F = *delta_F_lease;
+    auto& Jinverse_delta_F = *Jinverse_delta_F_lease;
+    auto& delta_xT_Jinverse = *delta_xT_Jinverse_lease;
+    std::copy(initial_guess.cbegin(), initial_guess.cend(), xk.begin());
+
+    matrix::Matrix<double> Jinverse{};
+    {
+        const auto timer = monitor.Time(matrix::SolverPhase::kSetup);
+        const auto Jacobian = EvaluateJacobian(equations, initial_guess, delta);
+        Jinverse = matrix::InvertWithLU(Jacobian);
+        EvaluateSystem(equations, xk, Fxk);
+    }
     double residual{};
-    for (std::int32_t k{1}; k < max_iterations; ++k)
+    std::int32_t k{1};
+    for (; k < max_iterations; ++k)
     {
+        // x_k+1 = x_k - Jinverse F(x_k)
+        std::copy(xk.cbegin(), xk.cend(), xkp1.begin());
+        matrix::Gemv(-1.0, Jinverse, Fxk, 1.0, xkp1);
 
-        xkp1 = matrix::AddVectors(xk,
-                                  matrix::ScalarMultiply(-1, matrix::MatMult(Jinverse, EvaluateSystem(equations, xk))));
-
-        const auto delta_x = matrix::AddVectors(xkp1, matrix::ScalarMultiply(-1.0, xk));
+        std::copy(xkp1.cbegin(), xkp1.cend(), delta_x.begin());
+        matrix::Axpy(-1.0, xk, delta_x);
         residual = matrix::L2Norm(delta_x);
+        monitor.RecordIteration(k, residual);
         if (residual < tolerance)
         {
-            std::cout << "Broyden's method converged in " << k << " iterations.\n";
-            break;
+            monitor.Finish(k, true);
+            return xkp1;
         }
-        if (k == max_iterations - 1)
+
+        // F(x_k+1) is evaluated once, for the update and as F(x_k) of the next step
         {
-            std::cout << "Max iterations reached. Residual: " << residual << "\n";
+            const auto timer = monitor.Time(matrix::SolverPhase::kOperator);
+            EvaluateSystem(equations, xkp1, Fxkp1);
         }
+        std::copy(Fxkp1.cbegin(), Fxkp1.cend(), delta_F.begin());
+        matrix::Axpy(-1.0, Fxk, delta_F);
+        UpdateJacobianInverse(delta_x, delta_F, Jinverse_delta_F, delta_xT_Jinverse, Jinverse);
 
-        Jinverse = EstimateJacobianInverse(equations, xk, EvaluateSystem(equations, xk), xkp1, Jinverse);
-        xk = xkp1;
+        xk.swap(xkp1);
+        Fxk.swap(Fxkp1);
     }
-    return xkp1;
+
+    monitor.Finish(k - 1, false);
+    return xk;
 }
 
 }  // namespace root_finders
@@ -8,6 +8,8 @@
 #ifndef ROOT_FINDERS_BROYDENS_METHOD_BROYDENS_METHOD_H
 #define ROOT_FINDERS_BROYDENS_METHOD_BROYDENS_METHOD_H
 
+#include "matrix_solvers/fixed/fixed_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include "matrix_solvers/utilities.h"
 #include <cstdint>
 #include <functional>
@@ -52,13 +54,93 @@ matrix::Matrix<double> EvaluateJacobian(const std::vector<std::function<double(s
  * @param equations_arguments Initial guesses for the variables, as a vector of vectors of doubles.
  * @param tolerance Convergence tolerance for the solution (default: 1e-6).
  * @param max_iterations Maximum number of iterations allowed (default: 1000).
+ * @param telemetry Optional stats and observer, receives the L2 norm of x_k+1 - x_k after every iteration.
  * @return std::vector<double> Solution vector containing the roots of the system.
  */
 std::vector<double> BroydensMethod(const std::vector<std::function<double(std::vector<double>)>>& equations,
                                    const std::vector<double>& initial_guess,
                                    const double delta,
                                    const double tolerance = 1e-3,
-                                   const std::int32_t max_iterations = 1000);
+                                   const std::int32_t max_iterations = 1000,
+                                   const matrix::SolverTelemetry& telemetry = {});
+
+/**
+ * @brief Fixed size overload of BroydensMethod for a system of N equations, runs without any heap allocation.
+ *
+ * The system is a single callable mapping x to F(x), both FixedVector<double, N>, so it is evaluated once per step
+ * instead of once per equation, and the Jacobian inverse lives on the stack. F(x_k+1) of the inverse update is reused
+ * by the next step.
+ *
+ * @param system Callable FixedVector<double, N>(const FixedVector<double, N>&) evaluating every equation.
+ * @param initial_guess Initial guess for the variables.
+ * @param delta Perturbation value used for the finite difference Jacobian at the initial guess.
+ * @param tolerance Convergence tolerance for the solution (default: 1e-3).
+ * @param max_iterations Maximum number of iterations allowed (default: 1000).
+ * @param telemetry Optional stats and observer, receives the L2 norm of x_k+1 - x_k after every iteration.
+ * @return matrix::FixedVector<double, N> Solution vector containing the roots of the system.
+ */
+template <std::int32_t N, typename System>
+matrix::FixedVector<double, N> BroydensMethod(const System& system,
+                                              const matrix::FixedVector<double, N>& initial_guess,
+                                              const double delta,
+                                              const double tolerance = 1e-3,
+                                              const std::int32_t max_iterations = 1000,
+                                              const matrix::SolverTelemetry& telemetry = {})
+{
+    matrix::SolverMonitor monitor{telemetry};
+
+    auto xk = initial_guess;
+    auto xkp1 = initial_guess;
+    matrix::FixedVector<double, N> Fxk{};
+    matrix::FixedMatrix<double, N, N> Jinverse{};
+    {
+        const auto timer = monitor.Time(matrix::SolverPhase::kSetup);
+        Fxk = system(xk);
+        matrix::FixedMatrix<double, N, N> Jacobian{};
+        for (std::int32_t j{0}; j < N; ++j)
+        {
+            auto xpdx = xk;
+            xpdx[j] += delta;
+            const auto F_xpdx = system(xpdx);
+            for (std::int32_t i{0}; i < N; ++i)
+            {
+                Jacobian(i, j) = (F_xpdx[i] - Fxk[i]) / delta;
+            }
+        }
+        Jinverse = matrix::Inverse(Jacobian);
+    }
+
+    std::int32_t k{1};
+    for (; k < max_iterations; ++k)
+    {
+        xkp1 = xk - matrix::MatMult(Jinverse, Fxk);
+
+        const auto delta_x = xkp1 - xk;
+        const auto residual = matrix::L2Norm(delta_x);
+        monitor.RecordIteration(k, residual);
+        if (residual < tolerance)
+        {
+            monitor.Finish(k, true);
+            return xkp1;
+        }
+
+        // Good Broyden update, Jinverse += (dx - Jinverse dF) dx' Jinverse / (dx' Jinverse dF)
+        {
+            const auto timer = monitor.Time(matrix::SolverPhase::kOperator);
+            const auto Fxkp1 = system(xkp1);
+            const auto Jinverse_delta_F = matrix::MatMult(Jinverse, Fxkp1 - Fxk);
+            const auto delta_xT_Jinverse = matrix::MatMult(delta_x.Transpose(), Jinverse);
+            const auto coefficient = 1.0 / matrix::Dot(delta_x, Jinverse_delta_F);
+            const auto update = matrix::MatMult(delta_x - Jinverse_delta_F, delta_xT_Jinverse);
+            Jinverse += matrix::ScalarMultiply(coefficient, update);
+            Fxk = Fxkp1;
+        }
+        xk = xkp1;
+    }
+
+    monitor.Finish(k - 1, false);
+    return xkp1;
+}
 
 }  // namespace root_finders
 
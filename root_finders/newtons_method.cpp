@@ -7,7 +7,6 @@
 #include "root_finders/newtons_method.h"
 #include <cmath>
 #include <cstdint>
-#include <iostream>
 #include <limits>
 
 namespace nm
@@ -28,27 +27,43 @@ double NewtonsMethod(double& x_0,
                      const std::function<double(double)>& function,
                      const std::function<double(double)>& derivative,
                      const double tolerance,
-                     const std::int32_t max_iterations)
+                     const std::int32_t max_iterations,
+                     const matrix::SolverTelemetry& telemetry)
 {
+    matrix::SolverMonitor monitor{telemetry};
     double x_n{};
 
     for (std::int32_t i{0}; i < max_iterations; ++i)
     {
-        if (IsNear(derivative(x_0), 0.0, tolerance))
+        double step{};
+        bool zero_derivative{false};
         {
-            std::cout << "Error: derivative evaluated at x is zero!"
-                      << "\n";
+            const auto timer = monitor.Time(matrix::SolverPhase::kOperator);
+            const auto slope = derivative(x_0);
+            zero_derivative = IsNear(slope, 0.0, tolerance);
+            if (!zero_derivative)
+            {
+                step = function(x_0) / slope;
+            }
         }
+        if (zero_derivative)
+        {
+            monitor.Finish(i + 1, false);
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        x_n = x_0 - step;
 
-        x_n = x_0 - (function(x_0) / derivative(x_0));
-
-        if (std::abs(x_n - x_0) < tolerance)
+        const auto update = std::abs(x_n - x_0);
+        monitor.RecordIteration(i + 1, update);
+        if (update < tolerance)
         {
-            break;
+            monitor.Finish(i + 1, true);
+            return x_n;
         }
         x_0 = x_n;
     }
 
+    monitor.Finish(max_iterations, false);
     return x_n;
 }
 
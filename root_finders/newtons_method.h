@@ -4,6 +4,7 @@
  * Update : 12 March, 2023
  */
 
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include <cstdint>
 #include <functional>
 
@@ -16,11 +17,17 @@ namespace nm
 namespace root_finders
 {
 
+/// @brief Newton iteration x_n = x_0 - f(x_0) / f'(x_0) until |x_n - x_0| < tolerance
+///
+/// Stops without a root when |f'(x_0)| <= tolerance, x_0 is then left at that point and the result is NaN.
+///
+/// @param telemetry: optional stats and observer, receives |x_n - x_0| after every iteration
 double NewtonsMethod(double& x_0,
                      const std::function<double(double)>& function,
                      const std::function<double(double)>& derivative,
                      const double tolerance = 0.001,
-                     const std::int32_t max_iterations = 1000);
+                     const std::int32_t max_iterations = 1000,
+                     const matrix::SolverTelemetry& telemetry = {});
 
 }  // namespace root_finders
 
@@ -11,7 +11,6 @@
 #include "matrix_solvers/utilities.h"
 #include <cstdint>
 #include <cstdlib>
-#include <iostream>
 
 namespace nm
 {
@@ -45,8 +44,10 @@ matrix::Matrix<double> EvaluateSystem(const std::vector<std::function<double(std
 std::vector<double> MultiVarSecantMethod(const std::vector<std::function<double(std::vector<double>)>>& equations,
                                          const std::vector<std::vector<double>>& equations_arguments,
                                          const double tolerance,
-                                         const std::int32_t max_iterations)
+                                         const std::int32_t max_iterations,
+                                         const matrix::SolverTelemetry& telemetry)
 {
+    matrix::SolverMonitor monitor{telemetry};
 
     std::vector<double> xk{equations_arguments.back()};
     std::vector<double> xkp1{};
@@ -57,9 +58,14 @@ std::vector<double> MultiVarSecantMethod(const std::vector<std::function<double(
     b.at(0) = 1;
 
     std::vector<std::vector<double>> arguments = {equations_arguments};
-    for (std::int32_t k{1}; k < max_iterations; ++k)
+    std::int32_t k{1};
+    for (; k < max_iterations; ++k)
     {
-        const auto A = EvaluateSystem(equations, arguments);
+        matrix::Matrix<double> A{};
+        {
+            const auto timer = monitor.Time(matrix::SolverPhase::kOperator);
+            A = EvaluateSystem(equations, arguments);
+        }
         const auto coefficients = matrix::LUSolve(A, b);
 
         for (std::int32_t i{0}; i < static_cast<std::int32_t>(arguments.size()); ++i)
@@ -68,20 +74,20 @@ std::vector<double> MultiVarSecantMethod(const std::vector<std::function<double(
             xkp1 = matrix::AddVectors(xkp1, c);
         }
 
-        if (matrix::L2Norm(matrix::AddVectors(xkp1, matrix::ScalarMultiply(-1.0, xk))) < tolerance)
+        const auto update = matrix::L2Norm(matrix::AddVectors(xkp1, matrix::ScalarMultiply(-1.0, xk)));
+        monitor.RecordIteration(k, update);
+        if (update < tolerance)
         {
-            std::cout << "Secant method converged in " << k << " iterations.\n";
-            break;
-        }
-        if (k == max_iterations - 1)
-        {
-            std::cout << "Max iterations reached.\n";
+            monitor.Finish(k, true);
+            return xk;
         }
 
         arguments = {arguments.at(1), arguments.back(), xkp1};
         xk = xkp1;
         xkp1.assign(xkp1.size(), 0);
     }
+
+    monitor.Finish(k - 1, false);
     return xk;
 }
 
@@ -8,6 +8,7 @@
 #ifndef ROOT_FINDERS_SECANT_METHOD_MULTIVAR_SECANT_METHOD_H
 #define ROOT_FINDERS_SECANT_METHOD_MULTIVAR_SECANT_METHOD_H
 
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include <cstdint>
 #include <functional>
 #include <vector>
@@ -17,10 +18,12 @@ namespace nm
 namespace root_finders
 {
 
+/// @param telemetry: optional stats and observer, receives the L2 norm of x_k+1 - x_k after every iteration
 std::vector<double> MultiVarSecantMethod(const std::vector<std::function<double(std::vector<double>)>>& equations,
                                          const std::vector<std::vector<double>>& equations_arguments,
                                          const double tolerance = 1e-6,
-                                         const std::int32_t max_iterations = 1000);
+                                         const std::int32_t max_iterations = 1000,
+                                         const matrix::SolverTelemetry& telemetry = {});
 
 }  // namespace root_finders
 
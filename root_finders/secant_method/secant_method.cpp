@@ -6,9 +6,8 @@
  */
 
 #include "root_finders/secant_method/secant_method.h"
+#include <cmath>
 #include <cstdint>
-#include <cstdlib>
-#include <iostream>
 
 namespace nm
 {
@@ -19,26 +18,33 @@ double SecantMethod(const std::function<double(double)>& function,
                     const double x0,
                     const double x1,
                     const double tolerance,
-                    const std::int32_t max_iterations)
+                    const std::int32_t max_iterations,
+                    const matrix::SolverTelemetry& telemetry)
 {
+    matrix::SolverMonitor monitor{telemetry};
     double xkm1{x0};
     double xk{x1};
     double xkp1{0.0};
-    for (std::int32_t k{1}; k < max_iterations; ++k)
+    std::int32_t k{1};
+    for (; k < max_iterations; ++k)
     {
-        xkp1 = xk - function(xk) * (xk - xkm1) / (function(xk) - function(xkm1));
-        if (std::abs(xkp1 - xk) < tolerance)
         {
-            std::cout << "Secant method converged in " << k << " iterations.\n";
-            break;
+            const auto timer = monitor.Time(matrix::SolverPhase::kOperator);
+            xkp1 = xk - function(xk) * (xk - xkm1) / (function(xk) - function(xkm1));
         }
-        if (k == max_iterations - 1)
+
+        const auto update = std::abs(xkp1 - xk);
+        monitor.RecordIteration(k, update);
+        if (update < tolerance)
         {
-            std::cout << "Max iterations reached.\n";
+            monitor.Finish(k, true);
+            return xkp1;
         }
         xkm1 = xk;
         xk = xkp1;
     }
+
+    monitor.Finish(k - 1, false);
     return xkp1;
 }
 
@@ -8,6 +8,7 @@
 #ifndef ROOT_FINDERS_SECANT_METHOD_SECANT_METHOD_H
 #define ROOT_FINDERS_SECANT_METHOD_SECANT_METHOD_H
 
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include <cstdint>
 #include <functional>
 
@@ -16,11 +17,13 @@ namespace nm
 namespace root_finders
 {
 
+/// @param telemetry: optional stats and observer, receives |x_k+1 - x_k| after every iteration
 double SecantMethod(const std::function<double(double)>& function,
                     const double x0,
                     const double x1,
                     const double tolerance = 1e-6,
-                    const std::int32_t max_iterations = 1000);
+                    const std::int32_t max_iterations = 1000,
+                    const matrix::SolverTelemetry& telemetry = {});
 
 }  // namespace root_finders
 
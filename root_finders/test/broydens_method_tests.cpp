@@ -4,8 +4,11 @@
  * Update : October 22nd, 2025
  */
 
+#include "matrix_solvers/fixed/fixed_matrix.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include "matrix_solvers/utilities.h"
 #include "root_finders/broydens_method/broydens_method.h"
+#include <cstddef>
 #include <cstdint>
 #include <gtest/gtest.h>
 
@@ -130,6 +133,48 @@ INSTANTIATE_TEST_SUITE_P(
             "WithParabolaAndCircleGuessinSecondQuadrant"}),
     [](const ::testing::TestParamInfo<BroydensMethodTestParameter>& info) { return info.param.test_name; });
 
+TEST(BroydensMethodTelemetryTest, GivenStats_ExpectUpdateNormOfEveryIteration)
+{
+    // Given
+    const std::vector<std::function<double(std::vector<double>)>> equations{
+        [](std::vector<double> x) -> double { return x.at(0) * x.at(0) - x.at(1) - 1; },
+        [](std::vector<double> x) -> double { return x.at(0) - x.at(1) * x.at(1) + 1; }};
+    matrix::SolverStats stats{};
+
+    // Call
+    const auto result = BroydensMethod(equations, {1.0, 2.0}, 0.1, 1e-6, 1000, matrix::SolverTelemetry{&stats});
+
+    // Expect
+    EXPECT_NEAR(result.at(0), 1.618, 0.001);
+    EXPECT_TRUE(stats.converged);
+    ASSERT_EQ(stats.residual_history.size(), static_cast<std::size_t>(stats.iterations));
+    EXPECT_LT(stats.residual_history.back(), 1e-6);
+    EXPECT_GT(stats.PhaseSeconds(matrix::SolverPhase::kSetup), 0.0);
+}
+
+TEST(FixedSizeBroydensMethodTest, GivenTwoParabolas_ExpectSameRootAsDynamicSize)
+{
+    // Given
+    const auto system = [](const matrix::FixedVector<double, 2>& x) {
+        return matrix::FixedVector<double, 2>{{x[0] * x[0] - x[1] - 1, x[0] - x[1] * x[1] + 1}};
+    };
+    const std::vector<std::function<double(std::vector<double>)>> equations{
+        [](std::vector<double> x) -> double { return x.at(0) * x.at(0) - x.at(1) - 1; },
+        [](std::vector<double> x) -> double { return x.at(0) - x.at(1) * x.at(1) + 1; }};
+    matrix::SolverStats stats{};
+
+    // Call
+    const auto result = BroydensMethod<2>(
+        system, matrix::FixedVector<double, 2>{{1.0, 2.0}}, 0.1, 1e-6, 1000, matrix::SolverTelemetry{&stats});
+
+    // Expect
+    const auto expected = BroydensMethod(equations, {1.0, 2.0}, 0.1, 1e-6);
+    EXPECT_NEAR(result[0], 1.618, 0.001);
+    EXPECT_NEAR(result[0], expected.at(0), 1e-6);
+    EXPECT_NEAR(result[1], expected.at(1), 1e-6);
+    EXPECT_TRUE(stats.converged);
+}
+
 }  // namespace
 }  // namespace root_finders
 }  // namespace nm
@@ -6,7 +6,9 @@
 
 // #include "root_finders/newtons_method.h"
 #include "root_finders/newtons_method.h"
+#include "matrix_solvers/telemetry/solver_telemetry.h"
 #include <cmath>
+#include <cstdint>
 #include <gtest/gtest.h>
 
 namespace nm
@@ -60,6 +62,29 @@ TEST_F(NewtonsMethodTestFixture, GivenInitialGuessAtLocalMaxima_ExpectNaN)
     EXPECT_TRUE(std::isnan(result));
 }
 
+TEST_F(NewtonsMethodTestFixture, GivenZeroDerivative_ExpectStopWithoutDividing)
+{
+    // Given
+    double x_0 = 0.5;
+    std::int32_t function_calls{0};
+    auto function = [&function_calls](const double x) -> double {
+        ++function_calls;
+        return (x * (1.0 - x));
+    };
+    auto derivative = [](const double x) -> double { return (1 + (-2.0 * x)); };
+    matrix::SolverStats stats{};
+
+    // Call
+    const auto result = NewtonsMethod(x_0, function, derivative, 0.001, 1000, {&stats});
+
+    // Expect
+    EXPECT_TRUE(std::isnan(result));
+    EXPECT_EQ(x_0, 0.5);
+    EXPECT_EQ(function_calls, 0);
+    EXPECT_EQ(stats.iterations, 1);
+    EXPECT_FALSE(stats.converged);
+}
+
 }  // namespace
 
 }  // namespace root_finders